@@ -0,0 +1,96 @@
+//! @file Core/Benchmark_Exception.cpp
+//! @brief The definition of benchmarks which measure the cost of throwing
+//! exceptions under each stack trace capture policy.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Header File Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <cstdio>
+
+#include <gtest/gtest.h>
+
+#include "Ag/Core/Exception.hpp"
+#include "Ag/Core/Timer.hpp"
+
+namespace Ag {
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Data
+////////////////////////////////////////////////////////////////////////////////
+//! @brief The count of exceptions thrown per policy.
+constexpr size_t ThrowCount = 20000;
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Data Types
+////////////////////////////////////////////////////////////////////////////////
+//! @brief A named stack trace capture policy.
+struct Policy
+{
+    const char *Name;
+    StackCapturePolicy Value;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+// Throws and catches an exception from a single site, as a parser would.
+size_t throwAndCatch(size_t index)
+{
+    try
+    {
+        throw OperationException("Benchmark exception.");
+    }
+    catch (const OperationException &)
+    {
+        return index & 1;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Benchmarks
+////////////////////////////////////////////////////////////////////////////////
+GTEST_TEST(ExceptionBenchmark, CapturePolicies)
+{
+    const Policy policies[] = {
+        { "full", StackCapturePolicy::Full },
+        { "raw", StackCapturePolicy::Raw },
+        { "off", StackCapturePolicy::Off },
+    };
+
+    StackCapturePolicy original = Exception::getStackCapturePolicy();
+
+    std::printf("%-8s %14s\n", "Policy", "us/throw");
+
+    for (const Policy &policy : policies)
+    {
+        Exception::setStackCapturePolicy(policy.Value);
+        size_t caught = 0;
+
+        MonotonicTicks start = HighResMonotonicTimer::getTime();
+
+        for (size_t index = 0; index < ThrowCount; ++index)
+        {
+            caught += throwAndCatch(index);
+        }
+
+        double seconds = HighResMonotonicTimer::getTimeSpan(HighResMonotonicTimer::getDuration(start));
+
+        EXPECT_EQ(caught, ThrowCount / 2);
+        std::printf("%-8s %14.2f\n", policy.Name, (seconds * 1.0e6) / ThrowCount);
+    }
+
+    Exception::setStackCapturePolicy(original);
+}
+
+} // Anonymous namespace
+
+} // namespace Ag
+////////////////////////////////////////////////////////////////////////////////
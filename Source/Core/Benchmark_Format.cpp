@@ -0,0 +1,179 @@
+//! @file Core/Benchmark_Format.cpp
+//! @brief The definition of benchmarks which measure the throughput of
+//! formatting values as text.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Header File Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Ag/Core/Format.hpp"
+#include "Ag/Core/String.hpp"
+#include "Ag/Core/Timer.hpp"
+#include "Ag/Core/Variant.hpp"
+
+namespace Ag {
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Data
+////////////////////////////////////////////////////////////////////////////////
+//! @brief The count of values formatted in each pass.
+constexpr size_t ValueCount = 1000000;
+
+//! @brief The number of times each operation is repeated.
+constexpr int Iterations = 4;
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+// Creates a set of real values which look like measurements.
+std::vector<double> createMeasurements()
+{
+    std::mt19937_64 random(1234);
+    std::uniform_real_distribution<double> mantissa(1.0, 10.0);
+    std::uniform_int_distribution<int> exponent(-12, 12);
+    std::vector<double> values;
+    values.reserve(ValueCount);
+
+    while (values.size() < ValueCount)
+    {
+        values.push_back(mantissa(random) * std::pow(10.0, exponent(random)));
+    }
+
+    return values;
+}
+
+// Creates a set of real values which are short decimals, such as prices.
+std::vector<double> createPrices()
+{
+    std::mt19937_64 random(5678);
+    std::uniform_int_distribution<int> cents(1, 10000000);
+    std::vector<double> values;
+    values.reserve(ValueCount);
+
+    while (values.size() < ValueCount)
+    {
+        values.push_back(cents(random) / 100.0);
+    }
+
+    return values;
+}
+
+// Formats each value repeatedly and reports the throughput.
+void runBenchmark(const char *name, const std::vector<double> &values,
+                  const std::function<void(std::string &, double)> &fn)
+{
+    std::string buffer;
+    buffer.reserve(64);
+    size_t totalLength = 0;
+
+    MonotonicTicks start = HighResMonotonicTimer::getTime();
+
+    for (int iteration = 0; iteration < Iterations; ++iteration)
+    {
+        for (double value : values)
+        {
+            buffer.clear();
+            fn(buffer, value);
+            totalLength += buffer.length();
+        }
+    }
+
+    double seconds = HighResMonotonicTimer::getTimeSpan(HighResMonotonicTimer::getDuration(start));
+    double millions = static_cast<double>(values.size()) * Iterations / 1.0e6;
+
+    std::printf("%-28s %10.2f M values/s (%zu chars)\n", name,
+                millions / seconds, totalLength);
+}
+
+void benchmarkValues(const std::vector<double> &values)
+{
+    FormatInfo shortest(LocaleInfo::getNeutral());
+    FormatInfo fixed(LocaleInfo::getNeutral());
+    FormatInfo significant(LocaleInfo::getNeutral());
+
+    fixed.setRequiredFractionDigits(4);
+    significant.setRequiredSignificantFigures(6);
+
+    runBenchmark("snprintf %.17g", values,
+                 [](std::string &buffer, double value)
+                 {
+                     char text[32];
+                     int length = std::snprintf(text, std::size(text), "%.17g", value);
+                     buffer.append(text, static_cast<size_t>(length));
+                 });
+
+    runBenchmark("appendValue shortest", values,
+                 [&shortest](std::string &buffer, double value)
+                 {
+                     appendValue(shortest, buffer, value);
+                 });
+
+    runBenchmark("appendValue 4 places", values,
+                 [&fixed](std::string &buffer, double value)
+                 {
+                     appendValue(fixed, buffer, value);
+                 });
+
+    runBenchmark("appendValue 6 sig. figs.", values,
+                 [&significant](std::string &buffer, double value)
+                 {
+                     appendValue(significant, buffer, value);
+                 });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Benchmarks
+////////////////////////////////////////////////////////////////////////////////
+GTEST_TEST(FormatBenchmark, Measurements)
+{
+    benchmarkValues(createMeasurements());
+}
+
+GTEST_TEST(FormatBenchmark, Prices)
+{
+    benchmarkValues(createPrices());
+}
+
+GTEST_TEST(FormatBenchmark, LogEntries)
+{
+    std::vector<double> values = createMeasurements();
+    FormatInfo options(LocaleInfo::getNeutral());
+    const std::string_view spec = "[{0:d6}] {1}: latency {2:F3} ms";
+    CompiledFormat compiled(options, spec);
+    String source("io-pool");
+    int sequence = 0;
+
+    runBenchmark("appendFormat (Variant)", values,
+                 [&](std::string &buffer, double value)
+                 {
+                     appendFormat(options, spec, buffer,
+                                  { ++sequence, source, value });
+                 });
+
+    runBenchmark("CompiledFormat::append", values,
+                 [&](std::string &buffer, double value)
+                 {
+                     compiled.append(buffer, ++sequence, source, value);
+                 });
+}
+
+} // Anonymous namespace
+
+} // namespace Ag
+////////////////////////////////////////////////////////////////////////////////
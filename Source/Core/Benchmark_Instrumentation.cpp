@@ -0,0 +1,76 @@
+//! @file Core/Benchmark_Instrumentation.cpp
+//! @brief The definition of benchmarks which measure the overhead of
+//! instrumentation zones when enabled and disabled.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Header File Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <cstdio>
+
+#include <gtest/gtest.h>
+
+#include "Ag/Core/Instrumentation.hpp"
+#include "Ag/Core/Timer.hpp"
+
+namespace Ag {
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Data
+////////////////////////////////////////////////////////////////////////////////
+//! @brief The count of zones entered per measurement.
+constexpr size_t ZoneCount = 1000000;
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+// Measures the average time taken to enter and leave a zone, in nanoseconds.
+double measureZones()
+{
+    volatile size_t sink = 0;
+    MonotonicTicks start = HighResMonotonicTimer::getTime();
+
+    for (size_t index = 0; index < ZoneCount; ++index)
+    {
+        AG_INSTRUMENT_ZONE("Benchmark zone");
+        sink = sink + index;
+    }
+
+    double seconds = HighResMonotonicTimer::getTimeSpan(HighResMonotonicTimer::getDuration(start));
+
+    return (seconds * 1.0e9) / ZoneCount;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Benchmarks
+////////////////////////////////////////////////////////////////////////////////
+GTEST_TEST(InstrumentationBenchmark, ZoneOverhead)
+{
+    Instrumentation::clear();
+
+    Instrumentation::setEnabled(false);
+    double disabledNs = measureZones();
+
+    Instrumentation::setEnabled(true);
+    double enabledNs = measureZones();
+    Instrumentation::setEnabled(false);
+
+    EXPECT_EQ(Instrumentation::getEventCount(), ZoneCount);
+    Instrumentation::clear();
+
+    std::printf("%-10s %10s\n", "State", "ns/zone");
+    std::printf("%-10s %10.2f\n", "disabled", disabledNs);
+    std::printf("%-10s %10.2f\n", "enabled", enabledNs);
+}
+
+} // Anonymous namespace
+
+} // namespace Ag
+////////////////////////////////////////////////////////////////////////////////
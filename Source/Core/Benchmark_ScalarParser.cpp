@@ -0,0 +1,205 @@
+//! @file Core/Benchmark_ScalarParser.cpp
+//! @brief The definition of benchmarks which measure the throughput of
+//! parsing numeric values from text.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Header File Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Ag/Core/ScalarParser.hpp"
+#include "Ag/Core/Timer.hpp"
+
+namespace Ag {
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Data
+////////////////////////////////////////////////////////////////////////////////
+//! @brief The count of values in the table parsed.
+constexpr size_t ValueCount = 500000;
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+// Creates a comma-separated table of real values, 10 to a line.
+std::string createRealTable()
+{
+    std::mt19937_64 random(4321);
+    std::uniform_real_distribution<double> values(-1.0e6, 1.0e6);
+    std::string table;
+    char buffer[32];
+
+    for (size_t index = 0; index < ValueCount; ++index)
+    {
+        std::snprintf(buffer, std::size(buffer), "%.6f", values(random));
+        table.append(buffer);
+        table.push_back(((index % 10) == 9) ? '\n' : ',');
+    }
+
+    return table;
+}
+
+// Creates a comma-separated table of integer values, 10 to a line.
+std::string createIntegerTable()
+{
+    std::mt19937_64 random(8765);
+    std::uniform_int_distribution<int64_t> values(-5000000000ll, 5000000000ll);
+    std::string table;
+
+    for (size_t index = 0; index < ValueCount; ++index)
+    {
+        table.append(std::to_string(values(random)));
+        table.push_back(((index % 10) == 9) ? '\n' : ',');
+    }
+
+    return table;
+}
+
+// Splits a table into its individual fields.
+std::vector<std::string_view> splitTable(const std::string &table)
+{
+    std::vector<std::string_view> fields;
+    size_t start = 0;
+
+    for (size_t index = 0; index < table.length(); ++index)
+    {
+        if ((table[index] == ',') || (table[index] == '\n'))
+        {
+            fields.emplace_back(table.data() + start, index - start);
+            start = index + 1;
+        }
+    }
+
+    return fields;
+}
+
+// Runs a parsing function and reports the throughput.
+void runBenchmark(const char *name, size_t byteCount, const std::function<size_t()> &fn)
+{
+    MonotonicTicks start = HighResMonotonicTimer::getTime();
+    size_t count = fn();
+    double seconds = HighResMonotonicTimer::getTimeSpan(HighResMonotonicTimer::getDuration(start));
+
+    std::printf("%-28s %10.2f MB/s (%zu values)\n", name,
+                static_cast<double>(byteCount) / (seconds * 1.0e6), count);
+}
+
+template<typename T>
+size_t parseWithStateMachine(const std::vector<std::string_view> &fields,
+                             bool isReal)
+{
+    ScalarParser parser;
+    parser.enableFraction(isReal);
+    parser.enableExponent(isReal);
+    size_t count = 0;
+    T value;
+
+    for (std::string_view field : fields)
+    {
+        parser.reset();
+        parser.tryProcessString(field);
+
+        if (parser.tryGetValue(value))
+        {
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+template<typename T>
+size_t parseWithFastPath(const std::vector<std::string_view> &fields)
+{
+    size_t count = 0;
+    T value;
+
+    for (std::string_view field : fields)
+    {
+        if (parseScalarPrefix(field, value) > 0)
+        {
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Benchmarks
+////////////////////////////////////////////////////////////////////////////////
+GTEST_TEST(ScalarParserBenchmark, Reals)
+{
+    std::string table = createRealTable();
+    std::vector<std::string_view> fields = splitTable(table);
+
+    runBenchmark("ScalarParser", table.length(),
+                 [&]() { return parseWithStateMachine<double>(fields, true); });
+
+    runBenchmark("strtod", table.length(), [&]()
+    {
+        std::string copy;
+        size_t count = 0;
+
+        for (std::string_view field : fields)
+        {
+            copy.assign(field);
+            count += (std::strtod(copy.c_str(), nullptr) != 0.0) ? 1 : 0;
+        }
+
+        return count;
+    });
+
+    runBenchmark("parseScalarPrefix", table.length(),
+                 [&]() { return parseWithFastPath<double>(fields); });
+
+    runBenchmark("tryParseScalarArray", table.length(), [&]()
+    {
+        std::vector<double> values;
+        values.reserve(ValueCount);
+        tryParseScalarArray(table, ',', values);
+
+        return values.size();
+    });
+}
+
+GTEST_TEST(ScalarParserBenchmark, Integers)
+{
+    std::string table = createIntegerTable();
+    std::vector<std::string_view> fields = splitTable(table);
+
+    runBenchmark("ScalarParser", table.length(),
+                 [&]() { return parseWithStateMachine<int64_t>(fields, false); });
+
+    runBenchmark("parseScalarPrefix", table.length(),
+                 [&]() { return parseWithFastPath<int64_t>(fields); });
+
+    runBenchmark("tryParseScalarArray", table.length(), [&]()
+    {
+        std::vector<int64_t> values;
+        values.reserve(ValueCount);
+        tryParseScalarArray(table, ',', values);
+
+        return values.size();
+    });
+}
+
+} // Anonymous namespace
+
+} // namespace Ag
+////////////////////////////////////////////////////////////////////////////////
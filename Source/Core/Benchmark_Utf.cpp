@@ -0,0 +1,195 @@
+//! @file Core/Benchmark_Utf.cpp
+//! @brief The definition of benchmarks which measure the throughput of
+//! Unicode text processing.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Header File Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "Ag/Core/Binary.hpp"
+#include "Ag/Core/CPU.hpp"
+#include "Ag/Core/String.hpp"
+#include "Ag/Core/Timer.hpp"
+#include "Ag/Core/Utf.hpp"
+
+#include "UtfKernels.hpp"
+
+namespace Ag {
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Data
+////////////////////////////////////////////////////////////////////////////////
+//! @brief The approximate size of the synthetic log payloads.
+constexpr size_t PayloadSize = 8 * 1024 * 1024;
+
+//! @brief The number of times each operation is repeated.
+constexpr int Iterations = 8;
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+// Creates a synthetic log file, optionally with non-ASCII messages.
+std::string createLogPayload(bool includeNonAscii)
+{
+    static const char *AsciiMessages[] = {
+        "INFO  [worker-3] Request completed in 12ms status=200 path=/api/v1/items\n",
+        "DEBUG [io-pool-1] Flushed 4096 bytes to segment 000172.log\n",
+        "WARN  [scheduler] Task 'compact' overran its slot by 250ms\n",
+    };
+
+    static const char *NonAsciiMessages[] = {
+        "INFO  [worker-1] Utilisateur \xC2\xAB" "caf\xC3\xA9\xC2\xBB connect\xC3\xA9\n",
+        "INFO  [worker-2] \xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE3\x83\xA1\xE3\x83\x83\xE3\x82\xBB\xE3\x83\xBC\xE3\x82\xB8\n",
+        "ERROR [worker-4] Invalid token \xF0\x9F\x94\x91 for user \xE2\x82\xAC" "42\n",
+    };
+
+    std::mt19937 random(1234);
+    std::string payload;
+    payload.reserve(PayloadSize + 128);
+
+    while (payload.length() < PayloadSize)
+    {
+        if (includeNonAscii && ((random() % 4) == 0))
+        {
+            payload.append(NonAsciiMessages[random() % 3]);
+        }
+        else
+        {
+            payload.append(AsciiMessages[random() % 3]);
+        }
+    }
+
+    return payload;
+}
+
+// The per-byte process String construction used prior to vectorisation.
+bool measureByConverter(uint8_cptr_t bytes, size_t byteCount,
+                        Utf::Utf8Metrics &metrics)
+{
+    Utf::FromUtf8Converter converter;
+    size_t hashCode = 0;
+
+    metrics.Utf16Length = 0;
+    metrics.Utf32Length = 0;
+
+    for (size_t index = 0; index < byteCount; ++index)
+    {
+        bool hasError;
+        char32_t codePoint;
+
+        if (converter.tryConvert(bytes[index], codePoint, hasError))
+        {
+            hashCode = Bin::rotateLeft(hashCode, 7) ^ static_cast<size_t>(codePoint);
+            ++metrics.Utf32Length;
+
+            uint32_t wordCount = 0;
+
+            if (Utf::tryGetUTF16WordCountFromCodePoint(codePoint, wordCount))
+            {
+                metrics.Utf16Length += wordCount;
+            }
+        }
+        else if (hasError)
+        {
+            return false;
+        }
+    }
+
+    metrics.ErrorOffset = hashCode;
+    return true;
+}
+
+// Runs a measurement function repeatedly and reports its throughput.
+void runBenchmark(const char *name, const std::string &payload,
+                  const std::function<bool(uint8_cptr_t, size_t, Utf::Utf8Metrics &)> &fn)
+{
+    uint8_cptr_t bytes = reinterpret_cast<uint8_cptr_t>(payload.data());
+    Utf::Utf8Metrics metrics;
+
+    // Warm up.
+    ASSERT_TRUE(fn(bytes, payload.length(), metrics));
+
+    MonotonicTicks start = HighResMonotonicTimer::getTime();
+
+    for (int iteration = 0; iteration < Iterations; ++iteration)
+    {
+        ASSERT_TRUE(fn(bytes, payload.length(), metrics));
+    }
+
+    double seconds = HighResMonotonicTimer::getTimeSpan(HighResMonotonicTimer::getDuration(start));
+    double megabytes = static_cast<double>(payload.length()) * Iterations / (1024.0 * 1024.0);
+
+    std::printf("%-28s %10.1f MB/s\n", name, megabytes / seconds);
+}
+
+void benchmarkPayload(const std::string &payload)
+{
+    runBenchmark("FromUtf8Converter", payload, measureByConverter);
+    runBenchmark("tryMeasureUtf8_Base", payload, Utf::tryMeasureUtf8_Base);
+
+#ifdef AG_HAS_X64_KERNELS
+    int version = getX86_64ArchVersion();
+
+    if (version >= 2)
+    {
+        runBenchmark("tryMeasureUtf8_X64v2", payload, Utf::tryMeasureUtf8_X64v2);
+    }
+
+    if (version >= 3)
+    {
+        runBenchmark("tryMeasureUtf8_X64v3", payload, Utf::tryMeasureUtf8_X64v3);
+    }
+#endif
+
+    runBenchmark("String construction", payload,
+                 [](uint8_cptr_t bytes, size_t byteCount, Utf::Utf8Metrics &metrics)
+                 {
+                     String value(reinterpret_cast<utf8_cptr_t>(bytes), byteCount);
+                     metrics.Utf32Length = value.getUtf32Length();
+                     return true;
+                 });
+
+    std::u16string utf16Text;
+
+    runBenchmark("appendToUtf16", payload,
+                 [&utf16Text](uint8_cptr_t bytes, size_t byteCount, Utf::Utf8Metrics &metrics)
+                 {
+                     utf16Text.clear();
+                     Utf::appendToUtf16(utf16Text, reinterpret_cast<utf8_cptr_t>(bytes),
+                                        byteCount, byteCount);
+                     metrics.Utf16Length = utf16Text.length();
+                     return true;
+                 });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Benchmarks
+////////////////////////////////////////////////////////////////////////////////
+GTEST_TEST(Utf8Benchmark, AsciiLogPayload)
+{
+    benchmarkPayload(createLogPayload(false));
+}
+
+GTEST_TEST(Utf8Benchmark, MixedLogPayload)
+{
+    benchmarkPayload(createLogPayload(true));
+}
+
+} // Anonymous namespace
+
+} // namespace Ag
+////////////////////////////////////////////////////////////////////////////////
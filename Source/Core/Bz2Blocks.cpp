@@ -0,0 +1,925 @@
+//! @file Core/Bz2Blocks.cpp
+//! @brief The definition of tools which split and splice bzip2 streams at
+//! block boundaries so that blocks can be processed in parallel.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Header File Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include "CoreInternal.hpp"
+#include "Bz2Blocks.hpp"
+#include "Ag/Core/Exception.hpp"
+#include "Ag/Private/Bz2Stream.hpp"
+
+namespace Ag {
+namespace Bz2 {
+
+namespace {
+////////////////////////////////////////////////////////////////////////////////
+// Local Data
+////////////////////////////////////////////////////////////////////////////////
+//! @brief The 48-bit value which starts each compressed block (BCD pi).
+constexpr uint64_t BlockMagic = 0x314159265359ull;
+
+//! @brief The 48-bit value which marks the end of a stream (BCD sqrt(pi)).
+constexpr uint64_t EndMagic = 0x177245385090ull;
+
+//! @brief A mask which selects the bits of a magic number.
+constexpr uint64_t MagicMask = 0xFFFFFFFFFFFFull;
+
+//! @brief The count of bits in a magic number.
+constexpr size_t MagicBits = 48;
+
+//! @brief The count of bytes in a stream header, i.e. 'BZh9'.
+constexpr size_t HeaderSize = 4;
+
+//! @brief The count of bytes requested from the input stream at a time.
+constexpr size_t InputReadSize = 256 * 1024;
+
+//! @brief The count of consumed input bytes which must accumulate before the
+//! input buffer is compacted.
+constexpr size_t MinCompactSize = 64 * 1024;
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Reads up to 32 bits from a byte array, most significant bit first.
+//! @param[in] bytes The array to read from.
+//! @param[in] firstBit The index of the first bit to read.
+//! @param[in] bitCount The count of bits to read.
+//! @return The bits read, right-aligned.
+uint32_t extractBits(const uint8_t *bytes, size_t firstBit, uint8_t bitCount)
+{
+    uint64_t value = 0;
+    size_t byteIndex = firstBit / 8;
+    size_t endBit = firstBit + bitCount;
+    size_t endByte = (endBit + 7) / 8;
+
+    for (size_t index = byteIndex; index < endByte; ++index)
+    {
+        value = (value << 8) | bytes[index];
+    }
+
+    value >>= (endByte * 8) - endBit;
+
+    return static_cast<uint32_t>(value & ((1ull << bitCount) - 1));
+}
+
+//! @brief Reads a 48-bit magic number from a byte array.
+uint64_t extractMagic(const uint8_t *bytes, size_t firstBit)
+{
+    return (static_cast<uint64_t>(extractBits(bytes, firstBit, 24)) << 24) |
+           extractBits(bytes, firstBit + 24, 24);
+}
+
+//! @brief Writes a bzip2 stream header to a bit stream.
+void writeStreamHeader(BitWriter &writer, int compressionLevel)
+{
+    writer.write('B', 8);
+    writer.write('Z', 8);
+    writer.write('h', 8);
+    writer.write(static_cast<uint32_t>('0' + compressionLevel), 8);
+}
+
+//! @brief Writes the end of stream marker, stream CRC and padding to a
+//! bit stream.
+void writeStreamEnd(BitWriter &writer, uint32_t streamCrc)
+{
+    writer.write(static_cast<uint32_t>(EndMagic >> 16), 32);
+    writer.write(static_cast<uint32_t>(EndMagic & 0xFFFF), 16);
+    writer.write(streamCrc, 32);
+    writer.flush();
+}
+
+//! @brief Folds the CRC of a block into the CRC of a stream in the same way
+//! as the bz2 library.
+uint32_t combineCrc(uint32_t streamCrc, uint32_t blockCrc)
+{
+    return ((streamCrc << 1) | (streamCrc >> 31)) ^ blockCrc;
+}
+
+//! @brief Appends the bits of one run to another.
+void appendBits(BitRun &target, const BitRun &source)
+{
+    std::vector<uint8_t> joined;
+    joined.reserve(target.Bytes.size() + source.Bytes.size());
+
+    BitWriter writer(joined);
+    writer.writeBits(target.Bytes.data(), 0, target.BitCount);
+    writer.writeBits(source.Bytes.data(), 0, source.BitCount);
+    writer.flush();
+
+    target.Bytes = std::move(joined);
+    target.BitCount += source.BitCount;
+}
+
+} // Anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+// BitWriter Member Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Constructs an object which appends bits to a byte array.
+//! @param[in] output The array to append whole bytes to.
+BitWriter::BitWriter(std::vector<uint8_t> &output) :
+    _output(output),
+    _accumulator(0),
+    _accumulatedBits(0)
+{
+}
+
+//! @brief Appends a value to the bit stream.
+//! @param[in] value The value to write, right-aligned.
+//! @param[in] bitCount The count of bits to write, at most 32.
+void BitWriter::write(uint32_t value, uint8_t bitCount)
+{
+    _accumulator = (_accumulator << bitCount) |
+                   (value & ((1ull << bitCount) - 1));
+    _accumulatedBits += bitCount;
+
+    while (_accumulatedBits >= 8)
+    {
+        _accumulatedBits -= 8;
+        _output.push_back(static_cast<uint8_t>(_accumulator >> _accumulatedBits));
+    }
+
+    _accumulator &= (1ull << _accumulatedBits) - 1;
+}
+
+//! @brief Appends a run of bits from a byte array to the bit stream.
+//! @param[in] source The array to read bits from.
+//! @param[in] firstBit The index of the first bit in source to write.
+//! @param[in] bitCount The count of bits to write.
+void BitWriter::writeBits(const uint8_t *source, size_t firstBit, size_t bitCount)
+{
+    size_t bit = firstBit;
+    size_t endBit = firstBit + bitCount;
+
+    // Write bits until the source is byte-aligned.
+    while (((bit & 7) != 0) && (bit < endBit))
+    {
+        write((source[bit / 8] >> (7 - (bit & 7))) & 1, 1);
+        ++bit;
+    }
+
+    size_t wholeBytes = (endBit - bit) / 8;
+
+    if (_accumulatedBits == 0)
+    {
+        // Both source and target are aligned, copy the bytes directly.
+        const uint8_t *start = source + (bit / 8);
+        _output.insert(_output.end(), start, start + wholeBytes);
+    }
+    else
+    {
+        const uint8_t *start = source + (bit / 8);
+
+        for (size_t index = 0; index < wholeBytes; ++index)
+        {
+            write(start[index], 8);
+        }
+    }
+
+    bit += wholeBytes * 8;
+
+    // Write the remaining bits.
+    while (bit < endBit)
+    {
+        write((source[bit / 8] >> (7 - (bit & 7))) & 1, 1);
+        ++bit;
+    }
+}
+
+//! @brief Writes any incomplete byte to the output, padded with zero bits.
+void BitWriter::flush()
+{
+    if (_accumulatedBits > 0)
+    {
+        _output.push_back(static_cast<uint8_t>(_accumulator << (8 - _accumulatedBits)));
+        _accumulator = 0;
+        _accumulatedBits = 0;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ParallelCompressor Member Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Constructs an object which compresses blocks in parallel.
+//! @param[in] output The stream to write the compressed stream to.
+//! @param[in] threadCount The count of worker threads, 0 for one per
+//! hardware thread.
+//! @param[in] compressionLevel The bzip2 compression level, 1 - 9.
+//! @param[in] workFactor The bzip2 work factor, 0 - 250.
+ParallelCompressor::ParallelCompressor(IStream *output, size_t threadCount,
+                                       int compressionLevel, int workFactor) :
+    _output(output),
+    _writer(_encoded),
+    _chunkSize(0),
+    _maxPending(0),
+    _combinedCrc(0),
+    _level(std::clamp(compressionLevel, 1, 9)),
+    _workFactor(std::clamp(workFactor, 0, 250)),
+    _isFinished(false),
+    _pool(threadCount)
+{
+    _chunkSize = getMaxSingleBlockInput(_level);
+    _maxPending = _pool.getThreadCount() * 2;
+    _chunk.reserve(_chunkSize);
+
+    writeStreamHeader(_writer, _level);
+}
+
+//! @brief Buffers data to be compressed, dispatching full chunks to the
+//! worker threads.
+//! @param[in] sourceBuffer The data to compress.
+//! @param[in] sourceByteCount The count of bytes in sourceBuffer.
+//! @return The count of bytes consumed, always sourceByteCount.
+size_t ParallelCompressor::write(const void *sourceBuffer, size_t sourceByteCount)
+{
+    if (_isFinished)
+    {
+        throw OperationException("Cannot write to a compression stream which "
+                                 "has been closed.");
+    }
+
+    const uint8_t *source = static_cast<const uint8_t *>(sourceBuffer);
+    size_t remaining = sourceByteCount;
+
+    while (remaining > 0)
+    {
+        size_t count = std::min(remaining, _chunkSize - _chunk.size());
+        _chunk.insert(_chunk.end(), source, source + count);
+        source += count;
+        remaining -= count;
+
+        if (_chunk.size() == _chunkSize)
+        {
+            submitChunk();
+            writeCompletedBlocks(_maxPending);
+        }
+    }
+
+    return sourceByteCount;
+}
+
+//! @brief Compresses all buffered data and writes it to the output stream,
+//! except for any trailing bits which do not fill a byte.
+void ParallelCompressor::flush()
+{
+    if (_isFinished == false)
+    {
+        submitChunk();
+        writeCompletedBlocks(0);
+    }
+
+    _output->flush();
+}
+
+//! @brief Compresses all buffered data and terminates the stream.
+void ParallelCompressor::finish()
+{
+    if (_isFinished)
+    {
+        return;
+    }
+
+    _isFinished = true;
+    submitChunk();
+    writeCompletedBlocks(0);
+
+    writeStreamEnd(_writer, _combinedCrc);
+    _output->write(_encoded.data(), _encoded.size());
+    _encoded.clear();
+    _output->flush();
+}
+
+//! @brief Schedules the buffered chunk of data for compression.
+void ParallelCompressor::submitChunk()
+{
+    if (_chunk.empty())
+    {
+        return;
+    }
+
+    auto data = std::make_shared<std::vector<uint8_t>>(std::move(_chunk));
+    _chunk = std::vector<uint8_t>();
+    _chunk.reserve(_chunkSize);
+
+    int level = _level;
+    int workFactor = _workFactor;
+
+    _pending.push_back(_pool.submit([data, level, workFactor]()
+    {
+        return compressBlock(data->data(), data->size(), level, workFactor);
+    }));
+}
+
+//! @brief Splices compressed blocks into the output stream in order.
+//! @param[in] maxPending The maximum count of blocks which can remain in
+//! progress, blocks beyond this count are waited for.
+void ParallelCompressor::writeCompletedBlocks(size_t maxPending)
+{
+    while (_pending.empty() == false)
+    {
+        std::future<CompressedBlock> &next = _pending.front();
+
+        if ((_pending.size() <= maxPending) &&
+            (next.wait_for(std::chrono::seconds(0)) != std::future_status::ready))
+        {
+            break;
+        }
+
+        // Rethrows any exception thrown during compression.
+        CompressedBlock block = next.get();
+        _pending.pop_front();
+
+        _writer.writeBits(block.Bits.Bytes.data(), 0, block.Bits.BitCount);
+        _combinedCrc = combineCrc(_combinedCrc, block.Crc);
+    }
+
+    if (_encoded.empty() == false)
+    {
+        _output->write(_encoded.data(), _encoded.size());
+        _encoded.clear();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ParallelDecompressor Member Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Constructs an object which decompresses blocks in parallel.
+//! @param[in] input The stream to read compressed data from.
+//! @param[in] threadCount The count of worker threads, 0 for one per
+//! hardware thread.
+ParallelDecompressor::ParallelDecompressor(IStream *input, size_t threadCount) :
+    _input(input),
+    _outputOffset(0),
+    _scanByte(0),
+    _minMagicBit(0),
+    _blockStartBit(0),
+    _streamEndBit(0),
+    _register(0),
+    _maxPending(0),
+    _combinedCrc(0),
+    _level(9),
+    _state(ScanState::StreamHeader),
+    _hasStream(false),
+    _hasBlock(false),
+    _isInputEnd(false),
+    _pool(threadCount)
+{
+    _maxPending = _pool.getThreadCount() * 2;
+}
+
+//! @brief Waits for any blocks still being decompressed.
+ParallelDecompressor::~ParallelDecompressor() = default;
+
+//! @brief Reads decompressed data.
+//! @param[in] targetBuffer The buffer to receive the data.
+//! @param[in] requiredByteCount The count of bytes to read.
+//! @return The count of bytes read, less than requiredByteCount only at the
+//! end of the compressed data.
+size_t ParallelDecompressor::read(void *targetBuffer, size_t requiredByteCount)
+{
+    uint8_t *target = static_cast<uint8_t *>(targetBuffer);
+    size_t bytesRead = 0;
+
+    while (bytesRead < requiredByteCount)
+    {
+        if (_outputOffset < _output.size())
+        {
+            size_t count = std::min(requiredByteCount - bytesRead,
+                                    _output.size() - _outputOffset);
+
+            std::memcpy(target + bytesRead, _output.data() + _outputOffset, count);
+            bytesRead += count;
+            _outputOffset += count;
+        }
+        else if (tryFillOutput() == false)
+        {
+            break;
+        }
+    }
+
+    return bytesRead;
+}
+
+//! @brief Appends more data from the input stream to the compressed buffer.
+//! @retval true Data was read.
+//! @retval false The end of the input stream was reached.
+bool ParallelDecompressor::tryReadInput()
+{
+    if (_isInputEnd)
+    {
+        return false;
+    }
+
+    compactInput();
+
+    size_t oldSize = _compressed.size();
+    _compressed.resize(oldSize + InputReadSize);
+
+    size_t bytesRead = _input->read(_compressed.data() + oldSize, InputReadSize);
+    _compressed.resize(oldSize + bytesRead);
+
+    if (bytesRead == 0)
+    {
+        _isInputEnd = true;
+    }
+
+    return bytesRead > 0;
+}
+
+//! @brief Scans the compressed data for the next block boundary.
+//! @retval true A block or end of stream was added to the pending queue, or
+//! the end of the compressed data was reached.
+//! @retval false More input is required.
+//! @throws Bz2Exception If the compressed data is not valid.
+bool ParallelDecompressor::tryScan()
+{
+    if (_state == ScanState::StreamHeader)
+    {
+        if ((_scanByte + HeaderSize) > _compressed.size())
+        {
+            if (_isInputEnd == false)
+            {
+                return false;
+            }
+
+            if ((_hasStream == false) || (_scanByte > _compressed.size()))
+            {
+                // The data was empty, too short to be a stream or truncated
+                // within the stream trailer.
+                throwBz2Error("BZ2_bzDecompress()",
+                              _hasStream ? BZ_UNEXPECTED_EOF : BZ_DATA_ERROR_MAGIC);
+            }
+
+            // Ignore trailing bytes after the last stream.
+            _state = ScanState::Finished;
+            return true;
+        }
+
+        const uint8_t *header = _compressed.data() + _scanByte;
+
+        if ((header[0] != 'B') || (header[1] != 'Z') || (header[2] != 'h') ||
+            (header[3] < '1') || (header[3] > '9'))
+        {
+            if (_hasStream == false)
+            {
+                throwBz2Error("BZ2_bzDecompress()", BZ_DATA_ERROR_MAGIC);
+            }
+
+            // Ignore trailing data which isn't a concatenated stream.
+            _state = ScanState::Finished;
+            return true;
+        }
+
+        _level = header[3] - '0';
+        _scanByte += HeaderSize;
+        _minMagicBit = _scanByte * 8;
+        _hasStream = true;
+        _hasBlock = false;
+        _state = ScanState::Blocks;
+    }
+
+    if (_state != ScanState::Blocks)
+    {
+        return _state == ScanState::Finished;
+    }
+
+    // Leave enough bytes after a magic number to read the CRC which follows
+    // it, no matter its alignment.
+    size_t limit = _compressed.size();
+
+    if (_isInputEnd == false)
+    {
+        limit = (limit > 5) ? limit - 5 : 0;
+    }
+
+    for (; _scanByte < limit; ++_scanByte)
+    {
+        _register = (_register << 8) | _compressed[_scanByte];
+        size_t endBit = (_scanByte + 1) * 8;
+
+        for (size_t shift = 8; shift-- > 0; )
+        {
+            if (endBit < (MagicBits + shift))
+            {
+                continue;
+            }
+
+            size_t startBit = endBit - shift - MagicBits;
+
+            if (startBit < _minMagicBit)
+            {
+                continue;
+            }
+
+            uint64_t candidate = (_register >> shift) & MagicMask;
+
+            if (candidate == BlockMagic)
+            {
+                bool isDispatched = _hasBlock;
+
+                if (_hasBlock)
+                {
+                    dispatchBlock(startBit);
+                }
+
+                _hasBlock = true;
+                _blockStartBit = startBit;
+                _minMagicBit = startBit + MagicBits;
+
+                if (isDispatched)
+                {
+                    // No other magic number can start within this byte.
+                    ++_scanByte;
+                    return true;
+                }
+            }
+            else if (candidate == EndMagic)
+            {
+                size_t crcBit = startBit + MagicBits;
+
+                if ((crcBit + 32) > (_compressed.size() * 8))
+                {
+                    throwBz2Error("BZ2_bzDecompress()", BZ_UNEXPECTED_EOF);
+                }
+
+                if (_hasBlock)
+                {
+                    dispatchBlock(startBit);
+                    _hasBlock = false;
+                }
+
+                // The end magic number can also occur by chance within
+                // compressed data, so stop scanning until the blocks before
+                // it have been decoded.
+                PendingBlock streamEnd;
+                streamEnd.StreamCrc = readBits(crcBit, 32);
+                streamEnd.IsStreamEnd = true;
+                _pending.push_back(std::move(streamEnd));
+
+                _streamEndBit = startBit;
+                _state = ScanState::StreamEnd;
+                return true;
+            }
+        }
+    }
+
+    if (_isInputEnd)
+    {
+        throwBz2Error("BZ2_bzDecompress()", BZ_UNEXPECTED_EOF);
+    }
+
+    return false;
+}
+
+//! @brief Reads and scans input until enough blocks are being decompressed to
+//! occupy the worker threads, or the end of the data is reached.
+void ParallelDecompressor::fillPipeline()
+{
+    while (((_state == ScanState::StreamHeader) || (_state == ScanState::Blocks)) &&
+           (_pending.size() < _maxPending))
+    {
+        if (tryScan() == false)
+        {
+            tryReadInput();
+        }
+    }
+}
+
+//! @brief Schedules decompression of the block which ends at a specified bit.
+//! @param[in] endBit The index of the bit following the block.
+void ParallelDecompressor::dispatchBlock(size_t endBit)
+{
+    auto block = std::make_shared<CompressedBlock>();
+    BitWriter writer(block->Bits.Bytes);
+    writer.writeBits(_compressed.data(), _blockStartBit, endBit - _blockStartBit);
+    writer.flush();
+    block->Bits.BitCount = endBit - _blockStartBit;
+    block->Crc = readBits(_blockStartBit + MagicBits, 32);
+
+    int level = _level;
+
+    PendingBlock pending;
+    pending.Block = block;
+    pending.Level = level;
+    pending.Result = _pool.submit([block, level]()
+    {
+        DecodedBlock result;
+        result.IsValid = tryDecodeBlock(*block, level, result.Data);
+        return result;
+    });
+
+    _pending.push_back(std::move(pending));
+}
+
+//! @brief Resumes scanning after an end of stream marker once the blocks
+//! before it have been decoded.
+void ParallelDecompressor::acceptStreamEnd()
+{
+    // Any following stream starts at the next byte boundary.
+    _scanByte = (_streamEndBit + MagicBits + 32 + 7) / 8;
+    _register = 0;
+    _state = ScanState::StreamHeader;
+}
+
+//! @brief Resumes scanning after an end of stream marker which turned out to
+//! be part of the data of the block before it.
+void ParallelDecompressor::rejectStreamEnd()
+{
+    // Scan the rest of the block as a fragment starting at the false marker,
+    // but don't find it again.
+    _hasBlock = true;
+    _blockStartBit = _streamEndBit;
+    _minMagicBit = _streamEndBit + 1;
+    _scanByte = _streamEndBit / 8;
+    _register = 0;
+    _state = ScanState::Blocks;
+}
+
+//! @brief Discards compressed data which has been dispatched.
+void ParallelDecompressor::compactInput()
+{
+    size_t keepByte = _scanByte;
+
+    if (_hasBlock)
+    {
+        keepByte = std::min(keepByte, _blockStartBit / 8);
+    }
+
+    if (_state == ScanState::StreamEnd)
+    {
+        // Scanning may need to resume from the end of stream marker.
+        keepByte = std::min(keepByte, _streamEndBit / 8);
+    }
+
+    keepByte = std::min(keepByte, _compressed.size());
+
+    if (keepByte < MinCompactSize)
+    {
+        return;
+    }
+
+    _compressed.erase(_compressed.begin(), _compressed.begin() + keepByte);
+
+    size_t keepBit = keepByte * 8;
+    _scanByte -= keepByte;
+    _blockStartBit = (_blockStartBit > keepBit) ? _blockStartBit - keepBit : 0;
+    _minMagicBit = (_minMagicBit > keepBit) ? _minMagicBit - keepBit : 0;
+    _streamEndBit = (_streamEndBit > keepBit) ? _streamEndBit - keepBit : 0;
+}
+
+//! @brief Reads up to 32 bits from the compressed data.
+uint32_t ParallelDecompressor::readBits(size_t firstBit, uint8_t bitCount) const
+{
+    return extractBits(_compressed.data(), firstBit, bitCount);
+}
+
+//! @brief Replaces the output buffer with the next decompressed block.
+//! @retval true More data is available.
+//! @retval false The end of the compressed data has been reached.
+//! @throws Bz2Exception If the compressed data is not valid.
+bool ParallelDecompressor::tryFillOutput()
+{
+    while (true)
+    {
+        fillPipeline();
+
+        if (_pending.empty())
+        {
+            return false;
+        }
+
+        PendingBlock next = std::move(_pending.front());
+        _pending.pop_front();
+
+        if (next.IsStreamEnd)
+        {
+            // Every block before the marker decoded, so it is genuine.
+            if (next.StreamCrc != _combinedCrc)
+            {
+                throwBz2Error("BZ2_bzDecompress()", BZ_DATA_ERROR);
+            }
+
+            _combinedCrc = 0;
+            acceptStreamEnd();
+            continue;
+        }
+
+        // Rethrows any exception thrown during decompression.
+        DecodedBlock decoded = next.Result.get();
+        uint32_t blockCrc = next.Block->Crc;
+
+        if (decoded.IsValid == false)
+        {
+            // The block and end magic numbers can occur by chance within
+            // compressed data, in which case the block was split. Join it
+            // with the following fragments until it decodes.
+            CompressedBlock merged = *next.Block;
+
+            do
+            {
+                fillPipeline();
+
+                if (_pending.empty())
+                {
+                    throwBz2Error("BZ2_bzDecompress()", BZ_DATA_ERROR);
+                }
+
+                if (_pending.front().IsStreamEnd)
+                {
+                    // Scanning stopped at the marker, so nothing else is
+                    // pending. Continue from the marker to find the rest of
+                    // the block.
+                    _pending.pop_front();
+                    rejectStreamEnd();
+                    continue;
+                }
+
+                appendBits(merged.Bits, _pending.front().Block->Bits);
+                _pending.pop_front();
+
+                decoded.IsValid = tryDecodeBlock(merged, next.Level, decoded.Data);
+            } while (decoded.IsValid == false);
+        }
+
+        _combinedCrc = combineCrc(_combinedCrc, blockCrc);
+        _output = std::move(decoded.Data);
+        _outputOffset = 0;
+
+        if (_output.empty() == false)
+        {
+            return true;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Global Function Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Calculates the largest count of input bytes which are guaranteed to
+//! compress to a single bzip2 block.
+//! @param[in] compressionLevel The bzip2 compression level, 1 - 9.
+//! @details The initial run-length encoding stage can expand its input by up
+//! to 5/4, so the block size is scaled down accordingly.
+size_t getMaxSingleBlockInput(int compressionLevel)
+{
+    size_t blockSize = static_cast<size_t>(compressionLevel) * 100000;
+
+    return ((blockSize - 19) * 4) / 5;
+}
+
+//! @brief Compresses data as a single bzip2 block.
+//! @param[in] data The data to compress.
+//! @param[in] byteCount The count of bytes in data, no more than
+//! getMaxSingleBlockInput().
+//! @param[in] compressionLevel The bzip2 compression level, 1 - 9.
+//! @param[in] workFactor The bzip2 work factor, 0 - 250.
+//! @return The bits of the compressed block and its CRC.
+//! @throws Bz2Exception If compression fails.
+CompressedBlock compressBlock(const uint8_t *data, size_t byteCount,
+                              int compressionLevel, int workFactor)
+{
+    // The documented worst case output size is 101% of the input + 600 bytes.
+    std::vector<uint8_t> stream(byteCount + (byteCount / 100) + 601);
+    unsigned int streamLength = static_cast<unsigned int>(stream.size());
+
+    int errorCode = BZ2_bzBuffToBuffCompress(reinterpret_cast<char *>(stream.data()),
+                                             &streamLength,
+                                             reinterpret_cast<char *>(const_cast<uint8_t *>(data)),
+                                             static_cast<unsigned int>(byteCount),
+                                             compressionLevel, 0, workFactor);
+
+    if (errorCode != BZ_OK)
+    {
+        throwBz2Error("BZ2_bzBuffToBuffCompress()", errorCode);
+    }
+
+    const size_t firstBlockBit = HeaderSize * 8;
+    const size_t trailerBits = MagicBits + 32;
+    size_t totalBits = static_cast<size_t>(streamLength) * 8;
+
+    if ((totalBits < firstBlockBit + MagicBits + 32 + trailerBits) ||
+        (extractMagic(stream.data(), firstBlockBit) != BlockMagic))
+    {
+        throwBz2Error("BZ2_bzBuffToBuffCompress()", BZ_DATA_ERROR);
+    }
+
+    // The stream ends with the end magic number, the stream CRC and up to
+    // 7 bits of padding.
+    size_t endBit = 0;
+
+    for (size_t padding = 0; padding < 8; ++padding)
+    {
+        size_t candidate = totalBits - padding - trailerBits;
+
+        if (extractMagic(stream.data(), candidate) == EndMagic)
+        {
+            endBit = candidate;
+            break;
+        }
+    }
+
+    if (endBit == 0)
+    {
+        throwBz2Error("BZ2_bzBuffToBuffCompress()", BZ_DATA_ERROR);
+    }
+
+    CompressedBlock block;
+    block.Crc = extractBits(stream.data(), firstBlockBit + MagicBits, 32);
+
+    if (extractBits(stream.data(), endBit + MagicBits, 32) != block.Crc)
+    {
+        // With a single block, the stream CRC is a copy of the block CRC.
+        throw OperationException("Data compressed to more than one bzip2 block.");
+    }
+
+    block.Bits.BitCount = endBit - firstBlockBit;
+    block.Bits.Bytes.reserve((block.Bits.BitCount + 7) / 8);
+
+    BitWriter writer(block.Bits.Bytes);
+    writer.writeBits(stream.data(), firstBlockBit, block.Bits.BitCount);
+    writer.flush();
+
+    return block;
+}
+
+//! @brief Attempts to decompress a single bzip2 block.
+//! @param[in] block The bits of the block and its CRC.
+//! @param[in] compressionLevel The compression level of the stream the
+//! block was taken from.
+//! @param[out] output Receives the decompressed data.
+//! @retval true The block was successfully decompressed.
+//! @retval false The bits did not form a whole, valid block.
+//! @throws Bz2Exception If the decompressor could not be initialised.
+bool tryDecodeBlock(const CompressedBlock &block, int compressionLevel,
+                    std::vector<uint8_t> &output)
+{
+    // Wrap the block in a stream of its own.
+    std::vector<uint8_t> stream;
+    stream.reserve(block.Bits.Bytes.size() + 16);
+
+    BitWriter writer(stream);
+    writeStreamHeader(writer, compressionLevel);
+    writer.writeBits(block.Bits.Bytes.data(), 0, block.Bits.BitCount);
+    writeStreamEnd(writer, block.Crc);
+
+    bz_stream context;
+    std::memset(&context, 0, sizeof(context));
+
+    int errorCode = BZ2_bzDecompressInit(&context, 0, 0);
+
+    if (errorCode != BZ_OK)
+    {
+        throwBz2Error("BZ2_bzDecompressInit()", errorCode);
+    }
+
+    output.clear();
+    output.resize(std::max(block.Bits.Bytes.size() * 4, static_cast<size_t>(64 * 1024)));
+
+    context.next_in = reinterpret_cast<char *>(stream.data());
+    context.avail_in = static_cast<unsigned int>(stream.size());
+
+    size_t produced = 0;
+    int result = BZ_OK;
+
+    while (result == BZ_OK)
+    {
+        if (produced == output.size())
+        {
+            output.resize(output.size() * 2);
+        }
+
+        unsigned int available = static_cast<unsigned int>(output.size() - produced);
+        context.next_out = reinterpret_cast<char *>(output.data() + produced);
+        context.avail_out = available;
+
+        result = BZ2_bzDecompress(&context);
+        produced += available - context.avail_out;
+
+        if ((result == BZ_OK) && (context.avail_in == 0) &&
+            (context.avail_out == available))
+        {
+            // The input was exhausted without reaching the end of the stream.
+            break;
+        }
+    }
+
+    BZ2_bzDecompressEnd(&context);
+    output.resize(produced);
+
+    return result == BZ_STREAM_END;
+}
+
+}} // namespace Ag::Bz2
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,190 @@
+//! @file Core/Bz2Blocks.hpp
+//! @brief The declaration of tools which split and splice bzip2 streams at
+//! block boundaries so that blocks can be processed in parallel.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __AG_CORE_BZ2_BLOCKS_HPP__
+#define __AG_CORE_BZ2_BLOCKS_HPP__
+
+////////////////////////////////////////////////////////////////////////////////
+// Dependent Header Files
+////////////////////////////////////////////////////////////////////////////////
+#include <cstdint>
+
+#include <deque>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include "Ag/Core/Stream.hpp"
+#include "Ag/Core/WorkerPool.hpp"
+
+namespace Ag {
+namespace Bz2 {
+
+////////////////////////////////////////////////////////////////////////////////
+// Data Type Declarations
+////////////////////////////////////////////////////////////////////////////////
+//! @brief A run of bits stored most significant bit first, starting at the
+//! most significant bit of the first byte.
+struct BitRun
+{
+    std::vector<uint8_t> Bytes;
+    size_t BitCount = 0;
+};
+
+//! @brief The bits of a single compressed bzip2 block, starting with the
+//! block magic number.
+struct CompressedBlock
+{
+    BitRun Bits;
+    uint32_t Crc = 0;
+};
+
+//! @brief The result of decompressing a single bzip2 block.
+struct DecodedBlock
+{
+    std::vector<uint8_t> Data;
+    bool IsValid = false;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Class Declarations
+////////////////////////////////////////////////////////////////////////////////
+//! @brief An object which appends runs of bits to a byte array.
+class BitWriter
+{
+public:
+    // Construction/Destruction
+    BitWriter(std::vector<uint8_t> &output);
+
+    // Operations
+    void write(uint32_t value, uint8_t bitCount);
+    void writeBits(const uint8_t *source, size_t firstBit, size_t bitCount);
+    void flush();
+private:
+    // Internal Fields
+    std::vector<uint8_t> &_output;
+    uint64_t _accumulator;
+    uint8_t _accumulatedBits;
+};
+
+//! @brief Compresses data into independent bzip2 blocks on a set of worker
+//! threads and splices them, in order, into a single bzip2 stream.
+class ParallelCompressor
+{
+public:
+    // Construction/Destruction
+    ParallelCompressor(IStream *output, size_t threadCount,
+                       int compressionLevel, int workFactor);
+    ~ParallelCompressor() = default;
+
+    // Operations
+    size_t write(const void *sourceBuffer, size_t sourceByteCount);
+    void flush();
+    void finish();
+private:
+    // Internal Functions
+    void submitChunk();
+    void writeCompletedBlocks(size_t maxPending);
+
+    // Internal Fields
+    IStream *_output;
+    std::vector<uint8_t> _chunk;
+    std::vector<uint8_t> _encoded;
+    BitWriter _writer;
+    std::deque<std::future<CompressedBlock>> _pending;
+    size_t _chunkSize;
+    size_t _maxPending;
+    uint32_t _combinedCrc;
+    int _level;
+    int _workFactor;
+    bool _isFinished;
+    WorkerPool _pool;
+};
+
+//! @brief Locates the blocks in a bzip2 stream and decompresses them on a set
+//! of worker threads, producing the data in order.
+class ParallelDecompressor
+{
+public:
+    // Construction/Destruction
+    ParallelDecompressor(IStream *input, size_t threadCount);
+    ~ParallelDecompressor();
+
+    // Operations
+    size_t read(void *targetBuffer, size_t requiredByteCount);
+private:
+    // Internal Types
+    //! @brief A block being decompressed, or the end of a stream.
+    struct PendingBlock
+    {
+        std::shared_ptr<CompressedBlock> Block;
+        std::future<DecodedBlock> Result;
+        uint32_t StreamCrc = 0;
+        int Level = 9;
+        bool IsStreamEnd = false;
+    };
+
+    //! @brief The phases of parsing a compressed stream.
+    enum class ScanState
+    {
+        StreamHeader,
+        Blocks,
+
+        //! @brief An end of stream marker was found, scanning is suspended
+        //! until the blocks before it decode, which shows it is genuine.
+        StreamEnd,
+        Finished,
+    };
+
+    // Internal Functions
+    bool tryReadInput();
+    bool tryScan();
+    void fillPipeline();
+    void dispatchBlock(size_t endBit);
+    void acceptStreamEnd();
+    void rejectStreamEnd();
+    void compactInput();
+    uint32_t readBits(size_t firstBit, uint8_t bitCount) const;
+    bool tryFillOutput();
+
+    // Internal Fields
+    IStream *_input;
+    std::vector<uint8_t> _compressed;
+    std::deque<PendingBlock> _pending;
+    std::vector<uint8_t> _output;
+    size_t _outputOffset;
+    size_t _scanByte;
+    size_t _minMagicBit;
+    size_t _blockStartBit;
+    size_t _streamEndBit;
+    uint64_t _register;
+    size_t _maxPending;
+    uint32_t _combinedCrc;
+    int _level;
+    ScanState _state;
+    bool _hasStream;
+    bool _hasBlock;
+    bool _isInputEnd;
+    WorkerPool _pool;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Declarations
+////////////////////////////////////////////////////////////////////////////////
+size_t getMaxSingleBlockInput(int compressionLevel);
+CompressedBlock compressBlock(const uint8_t *data, size_t byteCount,
+                              int compressionLevel, int workFactor);
+bool tryDecodeBlock(const CompressedBlock &block, int compressionLevel,
+                    std::vector<uint8_t> &output);
+
+}} // namespace Ag::Bz2
+
+#endif // Header guard
+////////////////////////////////////////////////////////////////////////////////
@@ -69,7 +69,7 @@ bool x86cpuID(int cpuInfo[4], int fn)
 //! were zeroed.
 bool x86cpuID(int cpuInfo[4], int fn, int subFn)
 {
-#ifdef _M_AMD64
+#if defined(_M_AMD64) || defined(__x86_64__)
 #ifdef _MSC_VER
     // MSVC-specific x64 feature detection code.
 
@@ -77,7 +77,7 @@ bool x86cpuID(int cpuInfo[4], int fn, int subFn)
     __cpuidex(cpuInfo, fn, subFn);
 #else
     // gcc/Clang-specific x64 feature detection code.
-    __cpuid_count(fn, subfn, cpuInfo[0], cpuInfo[1], cpuInfo[2], cpuInfo[3]);
+    __cpuid_count(fn, subFn, cpuInfo[0], cpuInfo[1], cpuInfo[2], cpuInfo[3]);
 #endif
     return true;
 #else // NOT AMD64
@@ -0,0 +1,757 @@
+//! @file Core/CompressionCodec.cpp
+//! @brief The definition of interchangeable block compression algorithms
+//! and streams which apply them.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Header File Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstring>
+
+#include "Ag/Core/CompressionCodec.hpp"
+#include "Ag/Core/Exception.hpp"
+
+namespace Ag {
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Data
+////////////////////////////////////////////////////////////////////////////////
+//! @brief The count of bits used to index the LZ match hash table.
+constexpr uint32_t LzHashBits = 14;
+
+//! @brief The shortest match the LZ codec encodes.
+constexpr size_t LzMinMatch = 4;
+
+//! @brief The count of bytes at the end of a block which are always encoded
+//! as literals.
+constexpr size_t LzLastLiterals = 5;
+
+//! @brief The count of bytes at the end of a block in which no match can
+//! start.
+constexpr size_t LzMatchStartLimit = 12;
+
+//! @brief The furthest back a match can refer to.
+constexpr size_t LzMaxOffset = 65535;
+
+//! @brief Controls how quickly the LZ compressor skips ahead through data in
+//! which it finds no matches.
+constexpr uint32_t LzSkipTrigger = 6;
+
+//! @brief The count of bytes at the start of each block of a codec stream
+//! which hold the uncompressed and compressed block sizes.
+constexpr size_t BlockHeaderSize = 8;
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Reads a 32-bit value from a possibly unaligned address.
+uint32_t loadWord(const uint8_t *source)
+{
+    uint32_t value;
+    std::memcpy(&value, source, sizeof(value));
+
+    return value;
+}
+
+//! @brief Reads a 64-bit value from a possibly unaligned address.
+uint64_t loadDoubleWord(const uint8_t *source)
+{
+    uint64_t value;
+    std::memcpy(&value, source, sizeof(value));
+
+    return value;
+}
+
+//! @brief Calculates the index of a 4-byte sequence in the LZ hash table.
+uint32_t hashSequence(uint32_t sequence)
+{
+    return (sequence * 2654435761u) >> (32 - LzHashBits);
+}
+
+//! @brief Encodes a little-endian 32-bit value.
+void encodeUint32(uint8_t *target, uint32_t value)
+{
+    target[0] = static_cast<uint8_t>(value);
+    target[1] = static_cast<uint8_t>(value >> 8);
+    target[2] = static_cast<uint8_t>(value >> 16);
+    target[3] = static_cast<uint8_t>(value >> 24);
+}
+
+//! @brief Decodes a little-endian 32-bit value.
+uint32_t decodeUint32(const uint8_t *source)
+{
+    return static_cast<uint32_t>(source[0]) |
+           (static_cast<uint32_t>(source[1]) << 8) |
+           (static_cast<uint32_t>(source[2]) << 16) |
+           (static_cast<uint32_t>(source[3]) << 24);
+}
+
+//! @brief Writes the extension bytes of an LZ length which did not fit in
+//! its 4-bit token field.
+//! @param[in] target The position to write at.
+//! @param[in] remainder The length less 15.
+//! @return The position after the last byte written.
+uint8_t *writeLzLength(uint8_t *target, size_t remainder)
+{
+    while (remainder >= 255)
+    {
+        *target++ = 255;
+        remainder -= 255;
+    }
+
+    *target++ = static_cast<uint8_t>(remainder);
+
+    return target;
+}
+
+//! @brief Reads the extension bytes of an LZ length.
+//! @param[in,out] source The position to read from, updated to after the
+//! last byte read.
+//! @param[in] sourceEnd The end of the compressed data.
+//! @param[in,out] length The length to add the extension to.
+//! @retval true The length was read.
+//! @retval false The compressed data ended in the middle of the length.
+bool tryReadLzLength(const uint8_t *&source, const uint8_t *sourceEnd, size_t &length)
+{
+    uint8_t next;
+
+    do
+    {
+        if (source >= sourceEnd)
+            return false;
+
+        next = *source++;
+        length += next;
+    } while (next == 255);
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Data Types
+////////////////////////////////////////////////////////////////////////////////
+//! @brief An IStream implementation which writes to a fixed-size buffer.
+class BlockOutputStream : public IStream
+{
+public:
+    BlockOutputStream(uint8_t *target, size_t capacity) :
+        _target(target),
+        _capacity(capacity),
+        _length(0)
+    {
+    }
+
+    size_t getLength() const { return _length; }
+
+    virtual void flush() override { }
+
+    virtual size_t read(void */*targetBuffer*/, size_t /*requiredByteCount*/) override
+    {
+        throw NotSupportedException("Reading from a block output stream.");
+    }
+
+    virtual size_t write(const void *sourceBuffer, size_t sourceByteCount) override
+    {
+        if (sourceByteCount > (_capacity - _length))
+            throw OperationException("The compressed data overflowed its buffer.");
+
+        std::memcpy(_target + _length, sourceBuffer, sourceByteCount);
+        _length += sourceByteCount;
+
+        return sourceByteCount;
+    }
+private:
+    uint8_t *_target;
+    size_t _capacity;
+    size_t _length;
+};
+
+//! @brief An IStream implementation which reads from a fixed-size buffer.
+class BlockInputStream : public IStream
+{
+public:
+    BlockInputStream(const uint8_t *source, size_t length) :
+        _source(source),
+        _length(length),
+        _offset(0)
+    {
+    }
+
+    virtual void flush() override { }
+
+    virtual size_t read(void *targetBuffer, size_t requiredByteCount) override
+    {
+        size_t toRead = std::min(requiredByteCount, _length - _offset);
+
+        std::memcpy(targetBuffer, _source + _offset, toRead);
+        _offset += toRead;
+
+        return toRead;
+    }
+
+    virtual size_t write(const void */*sourceBuffer*/, size_t /*sourceByteCount*/) override
+    {
+        throw NotSupportedException("Writing to a block input stream.");
+    }
+private:
+    const uint8_t *_source;
+    size_t _length;
+    size_t _offset;
+};
+
+//! @brief Compresses blocks using the bzip2 algorithm.
+class Bzip2Codec : public ICompressionCodec
+{
+public:
+    // Inherited from ICompressionCodec.
+    virtual CompressionCodecID getID() const override { return CompressionCodecID::Bzip2; }
+
+    // Inherited from ICompressionCodec.
+    virtual utf8_cptr_t getName() const override { return "bzip2"; }
+
+    // Inherited from ICompressionCodec.
+    virtual size_t getMaxCompressedSize(size_t sourceByteCount) const override
+    {
+        // The bound documented by the bzip2 library.
+        return sourceByteCount + (sourceByteCount / 100) + 600;
+    }
+
+    // Inherited from ICompressionCodec.
+    virtual size_t compress(const void *source, size_t sourceByteCount,
+                            void *target, size_t targetCapacity) const override
+    {
+        BlockOutputStream output(static_cast<uint8_t *>(target), targetCapacity);
+
+        {
+            Bz2CompressionStream compressor(&output, 64 * 1024);
+
+            if (compressor.write(source, sourceByteCount) != sourceByteCount)
+                throw OperationException("Failed to compress a bzip2 block.");
+
+            compressor.close();
+        }
+
+        return output.getLength();
+    }
+
+    // Inherited from ICompressionCodec.
+    virtual void decompress(const void *source, size_t sourceByteCount,
+                            void *target, size_t targetByteCount) const override
+    {
+        BlockInputStream input(static_cast<const uint8_t *>(source), sourceByteCount);
+        Bz2DecompressionStream decompressor(&input, 64 * 1024);
+
+        uint8_t overflow;
+
+        if ((decompressor.read(target, targetByteCount) != targetByteCount) ||
+            (decompressor.read(&overflow, 1) != 0))
+        {
+            throw OperationException("A bzip2 block did not decompress to the expected size.");
+        }
+    }
+};
+
+//! @brief Compresses blocks using a byte-oriented LZ77 algorithm.
+//! @details The encoding is a sequence of tokens, each describing a run of
+//! literal bytes followed by a back-reference to earlier output. A token byte
+//! holds the literal count in its high nibble and the match length less 4 in
+//! its low nibble, either being extended by following bytes if they are 15.
+//! The literals are followed by a 16-bit little-endian match offset. The last
+//! token of a block holds only literals.
+class LzCodec : public ICompressionCodec
+{
+public:
+    // Inherited from ICompressionCodec.
+    virtual CompressionCodecID getID() const override { return CompressionCodecID::Lz; }
+
+    // Inherited from ICompressionCodec.
+    virtual utf8_cptr_t getName() const override { return "lz"; }
+
+    // Inherited from ICompressionCodec.
+    virtual size_t getMaxCompressedSize(size_t sourceByteCount) const override
+    {
+        return sourceByteCount + (sourceByteCount / 255) + 16;
+    }
+
+    // Inherited from ICompressionCodec.
+    virtual size_t compress(const void *source, size_t sourceByteCount,
+                            void *target, size_t targetCapacity) const override
+    {
+        if (targetCapacity < getMaxCompressedSize(sourceByteCount))
+            throw OperationException("The LZ compression buffer is too small.");
+
+        const uint8_t *input = static_cast<const uint8_t *>(source);
+        uint8_t *output = static_cast<uint8_t *>(target);
+        size_t anchor = 0;
+
+        if (sourceByteCount > LzMatchStartLimit)
+        {
+            std::vector<uint32_t> positions(size_t(1) << LzHashBits, 0);
+            const size_t matchEnd = sourceByteCount - LzLastLiterals;
+            const size_t searchEnd = sourceByteCount - LzMatchStartLimit;
+            size_t position = 1;
+
+            while (position < searchEnd)
+            {
+                uint32_t sequence = loadWord(input + position);
+                uint32_t &entry = positions[hashSequence(sequence)];
+                size_t candidate = entry;
+                entry = static_cast<uint32_t>(position);
+
+                if (((position - candidate) > LzMaxOffset) ||
+                    (loadWord(input + candidate) != sequence))
+                {
+                    // Skip ahead faster the longer no match is found.
+                    position += 1 + ((position - anchor) >> LzSkipTrigger);
+                    continue;
+                }
+
+                // Extend the match backwards over pending literals.
+                while ((position > anchor) && (candidate > 0) &&
+                       (input[position - 1] == input[candidate - 1]))
+                {
+                    --position;
+                    --candidate;
+                }
+
+                // Extend the match forwards, 8 bytes at a time where possible.
+                size_t length = LzMinMatch;
+
+                while (((position + length + sizeof(uint64_t)) <= matchEnd) &&
+                       (loadDoubleWord(input + position + length) ==
+                        loadDoubleWord(input + candidate + length)))
+                {
+                    length += sizeof(uint64_t);
+                }
+
+                while (((position + length) < matchEnd) &&
+                       (input[position + length] == input[candidate + length]))
+                {
+                    ++length;
+                }
+
+                output = writeSequence(output, input + anchor, position - anchor,
+                                       position - candidate, length);
+                position += length;
+                anchor = position;
+
+                // Index a position within the match to improve the chance of
+                // finding the next one.
+                if (position < searchEnd)
+                {
+                    positions[hashSequence(loadWord(input + position - 2))] =
+                        static_cast<uint32_t>(position - 2);
+                }
+            }
+        }
+
+        // Write the remaining bytes as literals.
+        output = writeSequence(output, input + anchor, sourceByteCount - anchor, 0, 0);
+
+        return static_cast<size_t>(output - static_cast<uint8_t *>(target));
+    }
+
+    // Inherited from ICompressionCodec.
+    virtual void decompress(const void *source, size_t sourceByteCount,
+                            void *target, size_t targetByteCount) const override
+    {
+        const uint8_t *input = static_cast<const uint8_t *>(source);
+        const uint8_t *inputEnd = input + sourceByteCount;
+        uint8_t *output = static_cast<uint8_t *>(target);
+        uint8_t *outputStart = output;
+        uint8_t *outputEnd = output + targetByteCount;
+
+        while (input < inputEnd)
+        {
+            uint8_t token = *input++;
+            size_t literalCount = token >> 4;
+
+            if ((literalCount == 15) &&
+                (tryReadLzLength(input, inputEnd, literalCount) == false))
+            {
+                throwCorrupt();
+            }
+
+            if ((literalCount > static_cast<size_t>(inputEnd - input)) ||
+                (literalCount > static_cast<size_t>(outputEnd - output)))
+            {
+                throwCorrupt();
+            }
+
+            std::memcpy(output, input, literalCount);
+            input += literalCount;
+            output += literalCount;
+
+            if (input == inputEnd)
+            {
+                // The last sequence has no match.
+                break;
+            }
+
+            if ((inputEnd - input) < 2)
+                throwCorrupt();
+
+            size_t offset = static_cast<size_t>(input[0]) |
+                            (static_cast<size_t>(input[1]) << 8);
+            input += 2;
+
+            size_t length = token & 0x0F;
+
+            if ((length == 15) &&
+                (tryReadLzLength(input, inputEnd, length) == false))
+            {
+                throwCorrupt();
+            }
+
+            length += LzMinMatch;
+
+            if ((offset == 0) ||
+                (offset > static_cast<size_t>(output - outputStart)) ||
+                (length > static_cast<size_t>(outputEnd - output)))
+            {
+                throwCorrupt();
+            }
+
+            const uint8_t *match = output - offset;
+
+            if (offset >= length)
+            {
+                std::memcpy(output, match, length);
+                output += length;
+            }
+            else
+            {
+                // The match overlaps the bytes it produces.
+                for (size_t index = 0; index < length; ++index)
+                    *output++ = *match++;
+            }
+        }
+
+        if (output != outputEnd)
+            throwCorrupt();
+    }
+private:
+    //! @brief Writes a token, its literals and any match which follows.
+    static uint8_t *writeSequence(uint8_t *output, const uint8_t *literals,
+                                  size_t literalCount, size_t offset,
+                                  size_t matchLength)
+    {
+        uint8_t *token = output++;
+        uint8_t tokenValue = 0;
+
+        if (literalCount >= 15)
+        {
+            tokenValue = 0xF0;
+            output = writeLzLength(output, literalCount - 15);
+        }
+        else
+        {
+            tokenValue = static_cast<uint8_t>(literalCount << 4);
+        }
+
+        std::memcpy(output, literals, literalCount);
+        output += literalCount;
+
+        if (matchLength > 0)
+        {
+            *output++ = static_cast<uint8_t>(offset);
+            *output++ = static_cast<uint8_t>(offset >> 8);
+
+            size_t lengthCode = matchLength - LzMinMatch;
+
+            if (lengthCode >= 15)
+            {
+                tokenValue |= 0x0F;
+                output = writeLzLength(output, lengthCode - 15);
+            }
+            else
+            {
+                tokenValue |= static_cast<uint8_t>(lengthCode);
+            }
+        }
+
+        *token = tokenValue;
+
+        return output;
+    }
+
+    //! @brief Reports that compressed data could not be decoded.
+    [[noreturn]] static void throwCorrupt()
+    {
+        throw OperationException("The LZ compressed data is corrupt.");
+    }
+};
+
+//! @brief The shared instances of each codec.
+const Bzip2Codec bzip2Codec;
+const LzCodec lzCodec;
+
+} // Anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+// ICompressionCodec Member Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Compresses a block of data into a resizable buffer.
+//! @param[in] source The bytes to compress.
+//! @param[in] sourceByteCount The count of bytes in @p source.
+//! @param[out] target Receives exactly the compressed bytes.
+void ICompressionCodec::compress(const void *source, size_t sourceByteCount,
+                                 std::vector<uint8_t> &target) const
+{
+    target.resize(getMaxCompressedSize(sourceByteCount));
+    target.resize(compress(source, sourceByteCount, target.data(), target.size()));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// CodecCompressionStream Member Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Constructs a stream which compresses data in blocks.
+//! @param[in] outputStream The stream to write compressed blocks to.
+//! @param[in] codec The algorithm used to compress each block.
+//! @param[in] blockSize The count of uncompressed bytes in each block.
+CodecCompressionStream::CodecCompressionStream(IStream *outputStream,
+                                               const ICompressionCodec &codec,
+                                               size_t blockSize /*= DefaultBlockSize*/) :
+    _output(outputStream),
+    _codec(codec),
+    _blockSize(std::clamp<size_t>(blockSize, 1, UINT32_MAX / 2)),
+    _isClosed(false)
+{
+    if (_output == nullptr)
+        throw ArgumentException("No output stream specified.", "outputStream");
+
+    _block.reserve(_blockSize);
+}
+
+//! @brief Attempts to complete the stream if close() was not called.
+CodecCompressionStream::~CodecCompressionStream()
+{
+    try
+    {
+        close();
+    }
+    catch (...)
+    {
+        // Don't allow exceptions to escape a destructor.
+    }
+}
+
+//! @brief Compresses any pending data and writes the end of the stream.
+void CodecCompressionStream::close()
+{
+    if (_isClosed)
+        return;
+
+    _isClosed = true;
+    writeBlock();
+
+    // Terminate the stream with an empty block.
+    uint8_t header[BlockHeaderSize] = { 0 };
+
+    if (_output->write(header, sizeof(header)) != sizeof(header))
+        throw OperationException("Failed to write the end of a compressed stream.");
+}
+
+// Inherited from IStream.
+bool CodecCompressionStream::isBuffered() const
+{
+    return true;
+}
+
+// Inherited from IStream.
+void CodecCompressionStream::flush()
+{
+}
+
+// Inherited from IStream.
+size_t CodecCompressionStream::read(void */*targetBuffer*/, size_t /*requiredByteCount*/)
+{
+    throw NotSupportedException("Reading for a compression writer stream.");
+}
+
+// Inherited from IStream.
+size_t CodecCompressionStream::write(const void *sourceBuffer, size_t sourceByteCount)
+{
+    if (_isClosed)
+        throw OperationException("Writing to a closed compression stream.");
+
+    const uint8_t *source = static_cast<const uint8_t *>(sourceBuffer);
+    size_t remaining = sourceByteCount;
+
+    while (remaining > 0)
+    {
+        size_t toCopy = std::min(remaining, _blockSize - _block.size());
+
+        _block.insert(_block.end(), source, source + toCopy);
+        source += toCopy;
+        remaining -= toCopy;
+
+        if (_block.size() == _blockSize)
+            writeBlock();
+    }
+
+    return sourceByteCount;
+}
+
+//! @brief Compresses the accumulated block and writes it to the output.
+void CodecCompressionStream::writeBlock()
+{
+    if (_block.empty())
+        return;
+
+    _compressedBlock.resize(BlockHeaderSize +
+                            _codec.getMaxCompressedSize(_block.size()));
+
+    size_t compressedSize = _codec.compress(_block.data(), _block.size(),
+                                            _compressedBlock.data() + BlockHeaderSize,
+                                            _compressedBlock.size() - BlockHeaderSize);
+
+    encodeUint32(_compressedBlock.data(), static_cast<uint32_t>(_block.size()));
+    encodeUint32(_compressedBlock.data() + 4, static_cast<uint32_t>(compressedSize));
+
+    size_t totalSize = BlockHeaderSize + compressedSize;
+
+    if (_output->write(_compressedBlock.data(), totalSize) != totalSize)
+        throw OperationException("Failed to write a compressed block.");
+
+    _block.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// CodecDecompressionStream Member Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Constructs a stream which decompresses data in blocks.
+//! @param[in] inputStream The stream to read compressed blocks from.
+//! @param[in] codec The algorithm used to compress each block.
+CodecDecompressionStream::CodecDecompressionStream(IStream *inputStream,
+                                                   const ICompressionCodec &codec) :
+    _input(inputStream),
+    _codec(codec),
+    _blockOffset(0),
+    _isEnd(false)
+{
+    if (_input == nullptr)
+        throw ArgumentException("No input stream specified.", "inputStream");
+}
+
+// Inherited from IStream.
+bool CodecDecompressionStream::isBuffered() const
+{
+    return true;
+}
+
+// Inherited from IStream.
+void CodecDecompressionStream::flush()
+{
+}
+
+// Inherited from IStream.
+size_t CodecDecompressionStream::read(void *targetBuffer, size_t requiredByteCount)
+{
+    uint8_t *target = static_cast<uint8_t *>(targetBuffer);
+    size_t bytesRead = 0;
+
+    while (bytesRead < requiredByteCount)
+    {
+        if ((_blockOffset == _block.size()) && (tryReadBlock() == false))
+            break;
+
+        size_t toCopy = std::min(requiredByteCount - bytesRead,
+                                 _block.size() - _blockOffset);
+
+        std::memcpy(target + bytesRead, _block.data() + _blockOffset, toCopy);
+        bytesRead += toCopy;
+        _blockOffset += toCopy;
+    }
+
+    return bytesRead;
+}
+
+// Inherited from IStream.
+size_t CodecDecompressionStream::write(const void */*sourceBuffer*/,
+                                       size_t /*sourceByteCount*/)
+{
+    throw NotSupportedException("Writing to a decompression stream.");
+}
+
+//! @brief Reads and decompresses the next block of the stream.
+//! @retval true A block of data is ready to read.
+//! @retval false The end of the stream was reached.
+bool CodecDecompressionStream::tryReadBlock()
+{
+    if (_isEnd)
+        return false;
+
+    uint8_t header[BlockHeaderSize];
+
+    if (_input->read(header, sizeof(header)) != sizeof(header))
+        throw OperationException("The compressed stream ended unexpectedly.");
+
+    size_t blockSize = decodeUint32(header);
+    size_t compressedSize = decodeUint32(header + 4);
+
+    _block.clear();
+    _blockOffset = 0;
+
+    if (blockSize == 0)
+    {
+        _isEnd = true;
+        return false;
+    }
+
+    // Guard against allocating a huge buffer from corrupt data.
+    if (compressedSize > _codec.getMaxCompressedSize(blockSize))
+        throw OperationException("The compressed stream is corrupt.");
+
+    _compressedBlock.resize(compressedSize);
+
+    if (_input->read(_compressedBlock.data(), compressedSize) != compressedSize)
+        throw OperationException("The compressed stream ended unexpectedly.");
+
+    _block.resize(blockSize);
+    _codec.decompress(_compressedBlock.data(), compressedSize,
+                      _block.data(), blockSize);
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Global Function Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Gets the implementation of a compression algorithm.
+//! @param[in] id The identifier of the algorithm.
+//! @return The codec, or nullptr if @p id was not recognised.
+const ICompressionCodec *tryGetCompressionCodec(CompressionCodecID id)
+{
+    switch (id)
+    {
+    case CompressionCodecID::Bzip2: return &bzip2Codec;
+    case CompressionCodecID::Lz: return &lzCodec;
+    default: return nullptr;
+    }
+}
+
+//! @brief Gets the implementation of a compression algorithm.
+//! @param[in] id The identifier of the algorithm.
+//! @return The codec implementation.
+//! @throws ArgumentException If @p id was not recognised.
+const ICompressionCodec &getCompressionCodec(CompressionCodecID id)
+{
+    const ICompressionCodec *codec = tryGetCompressionCodec(id);
+
+    if (codec == nullptr)
+        throw ArgumentException("Unknown compression codec.", "id");
+
+    return *codec;
+}
+
+} // namespace Ag
+////////////////////////////////////////////////////////////////////////////////
@@ -15,7 +15,9 @@
 // Dependent Header Files
 ////////////////////////////////////////////////////////////////////////////////
 #include <map>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -58,6 +60,27 @@ struct ActivationRecord;
 ////////////////////////////////////////////////////////////////////////////////
 typedef std::pair<size_t, size_t> StringRange;
 
+//! @brief An interface to the symbols of a single binary module.
+class IModuleSymbols
+{
+public:
+    // Construction/Destruction
+    virtual ~IModuleSymbols() = default;
+
+    // Accessors
+    //! @brief Finds the symbol containing an offset within the module.
+    //! @param[in] offset The offset of the code within the module.
+    //! @return An identifier of the last symbol starting at or before
+    //! @p offset, or SIZE_MAX if there was none.
+    virtual size_t findSymbol(uintptr_t offset) const = 0;
+
+    //! @brief Gets the name of a symbol.
+    //! @param[in] symbolId The identifier returned by findSymbol().
+    virtual std::string_view getName(size_t symbolId) const = 0;
+};
+
+using ModuleSymbolsCPtr = std::shared_ptr<const IModuleSymbols>;
+
 ////////////////////////////////////////////////////////////////////////////////
 // Function Declarations
 ////////////////////////////////////////////////////////////////////////////////
@@ -72,6 +95,10 @@ size_t captureActivationRecords(const CONTEXT *context,
 size_t getStackTraceSize(const StackTracePrivate *info);
 StackTracePrivate *cloneStackTrace(const StackTracePrivate *info);
 void destroyStackTrace(StackTracePrivate *&info);
+ModuleSymbolsCPtr loadModuleSymbols(const std::string &moduleFilePath);
+
+// Implemented in Stream.cpp.
+[[noreturn]] void throwBz2Error(const char *fnName, int errorCode);
 
 // Implemented in StringPrivate.cpp.
 void appendPrintf(std::string &target, const char *format, ...);
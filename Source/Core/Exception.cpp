@@ -15,8 +15,11 @@
 #include <cstring>
 
 #include <algorithm>
+#include <atomic>
 #include <deque>
+#include <mutex>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 #include "CoreInternal.hpp"
@@ -78,6 +81,153 @@ bool tryGetModuleFileName(uintptr_t baseAddr, std::string &filePath)
 }
 #endif
 
+namespace {
+////////////////////////////////////////////////////////////////////////////////
+// Local Data
+////////////////////////////////////////////////////////////////////////////////
+//! @brief The maximum count of call stack entries captured by an exception.
+constexpr size_t MaxCapturedFrames = 128;
+
+//! @brief The maximum count of distinct resolved stack traces to retain.
+constexpr size_t MaxCachedTraces = 1024;
+
+//! @brief The policy applied when capturing the stack trace of new exceptions.
+std::atomic<StackCapturePolicy> stackCapturePolicy(StackCapturePolicy::Full);
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Data Types
+////////////////////////////////////////////////////////////////////////////////
+using StackTraceCPtr = std::shared_ptr<const StackTrace>;
+
+//! @brief A process-wide cache of resolved stack traces keyed on the raw
+//! activation records they were resolved from, so that repeated throws from
+//! the same site share a single resolved trace.
+class StackTraceCache
+{
+private:
+    // Internal Types
+    struct Entry
+    {
+        std::vector<ActivationRecord> Records;
+        StackTraceCPtr Trace;
+    };
+
+    using EntryMap = std::unordered_multimap<uint64_t, Entry>;
+
+    // Internal Fields
+    std::mutex _sync;
+    EntryMap _entries;
+
+    // Internal Functions
+    //! @brief Calculates an FNV-1a hash of a set of activation records.
+    static uint64_t hashRecords(const ActivationRecord *records, size_t count)
+    {
+        uint64_t hash = 0xCBF29CE484222325ull;
+
+        for (size_t index = 0; index < count; ++index)
+        {
+            hash = (hash ^ static_cast<uint64_t>(records[index].ModuleBase)) * 0x100000001B3ull;
+            hash = (hash ^ static_cast<uint64_t>(records[index].Offset)) * 0x100000001B3ull;
+        }
+
+        return hash;
+    }
+
+    //! @brief Finds an existing trace resolved from the same records.
+    //! @note The caller must hold the lock on _sync.
+    StackTraceCPtr find(uint64_t hash, const ActivationRecord *records,
+                        size_t count) const
+    {
+        auto range = _entries.equal_range(hash);
+
+        for (auto pos = range.first; pos != range.second; ++pos)
+        {
+            const std::vector<ActivationRecord> &key = pos->second.Records;
+
+            if ((key.size() == count) &&
+                std::equal(key.begin(), key.end(), records,
+                           [](const ActivationRecord &lhs, const ActivationRecord &rhs)
+                           {
+                               return (lhs.ModuleBase == rhs.ModuleBase) &&
+                                      (lhs.Offset == rhs.Offset);
+                           }))
+            {
+                return pos->second.Trace;
+            }
+        }
+
+        return StackTraceCPtr();
+    }
+public:
+    // Construction/Destruction
+    StackTraceCache() = default;
+    ~StackTraceCache() = default;
+
+    // Operations
+    //! @brief Gets a resolved stack trace for a set of activation records,
+    //! resolving it only if the same records have not been seen before.
+    //! @param[in] records The raw activation records to resolve.
+    //! @param[in] count The count of elements in records.
+    //! @returns A shared, immutable resolved stack trace.
+    StackTraceCPtr resolve(const ActivationRecord *records, size_t count)
+    {
+        uint64_t hash = hashRecords(records, count);
+
+        {
+            std::lock_guard<std::mutex> lock(_sync);
+            StackTraceCPtr existing = find(hash, records, count);
+
+            if (existing)
+                return existing;
+        }
+
+        // Resolve symbols outside the lock as it can be slow.
+        std::shared_ptr<StackTrace> trace = std::make_shared<StackTrace>();
+        trace->capture(records, count);
+
+        std::lock_guard<std::mutex> lock(_sync);
+
+        // Another thread may have resolved the same trace in the meantime.
+        StackTraceCPtr existing = find(hash, records, count);
+
+        if (existing)
+            return existing;
+
+        if (_entries.size() < MaxCachedTraces)
+        {
+            Entry entry;
+            entry.Records.assign(records, records + count);
+            entry.Trace = trace;
+
+            _entries.emplace(hash, std::move(entry));
+        }
+
+        return trace;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Gets the process-wide cache of resolved stack traces.
+//! @note The object is never destroyed so that exceptions thrown during static
+//! finalisation can still use it.
+StackTraceCache &getStackTraceCache()
+{
+    static StackTraceCache *cache = new StackTraceCache();
+
+    return *cache;
+}
+
+const StackTrace &getEmptyStackTrace()
+{
+    static const StackTrace emptyTrace;
+
+    return emptyTrace;
+}
+
+} // Anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 // Local Data Types
 ////////////////////////////////////////////////////////////////////////////////
@@ -91,7 +241,10 @@ private:
     std::string_view _message;
     std::string_view _detail;
     std::string_view _what;
-    StackTrace _stackTrace;
+    mutable std::once_flag _resolveStackTrace;
+    mutable StackTraceCPtr _stackTrace;
+    const ActivationRecord *_rawStackTrace;
+    size_t _rawStackTraceSize;
     Exception _innerException;
     uintptr_t _errorCode;
     uint8_ptr_t _data;
@@ -102,16 +255,24 @@ public:
     //! @brief Constructs an object representing the reference counted set of
     //! self-contained information about a single exception instance.
     //! @param[in] stackTrace An object describing the call hierarchy when the
-    //! exception was detected.
+    //! exception was detected, null if it has not been resolved.
+    //! @param[in] callStack The raw activation records to resolve on demand
+    //! if stackTrace is null.
+    //! @param[in] callStackSize The count of elements in callStack.
     //! @param[in] domain A symbol identifier defining the type of the exception.
     //! @param[in] message A string detailing the nature of the exception type.
     //! @param[in] detail A string providing information specific to this exception
     //! instance.
     //! @param[in] errorCode An optional error code specific to the exception
     //! instance, if one was relevant, otherwise 0.
-    ExceptionPrivate(const StackTrace &stackTrace, const std::string_view &domain,
+    ExceptionPrivate(const StackTraceCPtr &stackTrace,
+                     const ActivationRecord *callStack, size_t callStackSize,
+                     const std::string_view &domain,
                      const std::string_view &message, const std::string_view &detail,
                      uintptr_t errorCode /* =0 */) :
+        _stackTrace(stackTrace),
+        _rawStackTrace(nullptr),
+        _rawStackTraceSize(stackTrace ? 0 : callStackSize),
         _errorCode(errorCode),
         _data(nullptr),
         _isFatal(false)
@@ -130,12 +291,13 @@ public:
             what.append(detail);
         }
 
-        // Allocate space for copies of the string fields.
+        // Allocate space for the unresolved call stack and copies of the
+        // string fields.
+        InlineField stackField = allocator.allocateStruct<ActivationRecord>(_rawStackTraceSize);
         InlineField domainField = allocator.allocate(domain);
         InlineField messageField = allocator.allocate(message);
         InlineField detailField = allocator.allocate(detail);
         InlineField whatField = allocator.allocate(what);
-        InlineField stackField = allocator.allocateRaw(getStackTraceSize(stackTrace.getData()));
 
         // Allocate space for all of the data at once.
         _data = reinterpret_cast<uint8_ptr_t>(std::malloc(allocator.getSize()));
@@ -152,15 +314,14 @@ public:
         _what = std::string_view(initialiser.initialiseField(whatField, what),
                                  whatField.Count - 1);
 
-        // The stack trace data is self-contained, so we can simply perform
-        // a binary copy.
-        StackTracePrivate *cloneTrace = static_cast<StackTracePrivate *>(initialiser.getFieldData(stackField));
-
-        std::memcpy(cloneTrace, stackTrace.getData(), stackField.Count);
+        if (_rawStackTraceSize > 0)
+        {
+            // Keep the raw records so that they can be resolved on demand.
+            ActivationRecord *records = initialiser.getFieldStruct<ActivationRecord>(stackField);
 
-        // By assigning StackTrace with a non-const pointer, the object will take
-        // ownership and mark the pointer as not to be deleted at destruction.
-        _stackTrace = cloneTrace;
+            std::copy_n(callStack, _rawStackTraceSize, records);
+            _rawStackTrace = records;
+        }
     }
 
     //! @brief Disposes of the block of memory containing all exception field data.
@@ -181,7 +342,20 @@ public:
     const std::string_view &what() const { return _what; }
     const Exception &getInnerException() const { return _innerException; }
     void setInnerException(const Exception &inner) { _innerException = inner; }
-    const StackTrace &getStackTrace() const { return _stackTrace; }
+    const StackTrace &getStackTrace() const
+    {
+        if (_rawStackTraceSize > 0)
+        {
+            std::call_once(_resolveStackTrace, [this]()
+            {
+                _stackTrace = getStackTraceCache().resolve(_rawStackTrace,
+                                                           _rawStackTraceSize);
+            });
+        }
+
+        return _stackTrace ? *_stackTrace : getEmptyStackTrace();
+    }
+
     uintptr_t getErrorCode() const { return _errorCode; }
     uint8_cptr_t getData() const { return _data; }
     bool isFatal() const { return _isFatal; }
@@ -192,13 +366,6 @@ namespace {
 ////////////////////////////////////////////////////////////////////////////////
 // Local Functions
 ////////////////////////////////////////////////////////////////////////////////
-const StackTrace &getEmptyStackTrace()
-{
-    static const StackTrace emptyTrace;
-
-    return emptyTrace;
-}
-
 const Exception &getEmptyException()
 {
     static const Exception empty;
@@ -268,6 +435,24 @@ const Exception &Exception::getInnerException() const
     return getEmptyException();
 }
 
+//! @brief Gets the policy used to capture the stack trace of exceptions
+//! as they are constructed.
+StackCapturePolicy Exception::getStackCapturePolicy()
+{
+    return stackCapturePolicy.load(std::memory_order_relaxed);
+}
+
+//! @brief Sets the policy used to capture the stack trace of exceptions
+//! constructed from now on, by any thread.
+//! @param[in] policy The new capture policy.
+//! @details Parsers which use exceptions for control flow can turn capture
+//! Off, or use Raw to defer the cost of symbol resolution until a trace is
+//! actually requested.
+void Exception::setStackCapturePolicy(StackCapturePolicy policy)
+{
+    stackCapturePolicy.store(policy, std::memory_order_relaxed);
+}
+
 //! @brief A member function which renders exceptions compatible with STL
 //! exceptions by producing a summary of the information contained.
 const char *Exception::what() const noexcept
@@ -285,18 +470,31 @@ const char *Exception::what() const noexcept
 //! which caused the exception to be thrown.
 //! @details Every type derived from Exception should call this function to
 //! embed the exception data in a self-contained and shareable form. A stack trace
-//! will be generated assuming the current function was called from an exception
-//! constructor.
+//! will be captured according to the current StackCapturePolicy assuming the
+//! current function was called from an exception constructor.
 void Exception::initialise(const std::string_view &domain,
                            const std::string_view &message,
                            const std::string_view &detail,
                            uintptr_t errorCode /* =0 */)
 {
-    StackTrace stackTrace;
-    stackTrace.captureCurrentThread(2);
+    StackCapturePolicy policy = getStackCapturePolicy();
+    ActivationRecord callStack[MaxCapturedFrames];
+    size_t callStackSize = 0;
+    StackTraceCPtr stackTrace;
+
+    if (policy != StackCapturePolicy::Off)
+    {
+        // Prune this function and the constructor of the derived exception.
+        callStackSize = StackTrace::captureCurrentThread(callStack, std::size(callStack), 2);
+
+        if ((policy == StackCapturePolicy::Full) && (callStackSize > 0))
+        {
+            stackTrace = getStackTraceCache().resolve(callStack, callStackSize);
+        }
+    }
 
-    _data = std::make_shared<ExceptionPrivate>(stackTrace, domain, message,
-                                               detail, errorCode);
+    _data = std::make_shared<ExceptionPrivate>(stackTrace, callStack, callStackSize,
+                                               domain, message, detail, errorCode);
 }
 
 //! @brief Copies and packages information about the exception.
@@ -311,7 +509,8 @@ void Exception::initialise(const std::string_view &domain,
 //! which caused the exception to be thrown.
 //! @details Only hardware exceptions where the stack was captured separately
 //! should call this function to embed the exception data in a self-contained and
-//! shareable form.
+//! shareable form. The stack trace capture policy is not applied as the
+//! trace has already been captured.
 void Exception::initialise(const ActivationRecord *callStack,
                            size_t callStackSize,
                            const std::string_view &domain,
@@ -319,11 +518,13 @@ void Exception::initialise(const ActivationRecord *callStack,
                            const std::string_view &detail,
                            uintptr_t errorCode )
 {
-    StackTrace stackTrace;
-    stackTrace.capture(callStack, callStackSize);
+    StackTraceCPtr stackTrace;
+
+    if (callStackSize > 0)
+        stackTrace = getStackTraceCache().resolve(callStack, callStackSize);
 
-    _data = std::make_shared<ExceptionPrivate>(stackTrace, domain, message,
-                                               detail, errorCode);
+    _data = std::make_shared<ExceptionPrivate>(stackTrace, callStack, callStackSize,
+                                               domain, message, detail, errorCode);
 }
 
 //! @brief Annotates an initialised exception with another exception which directly
@@ -12,8 +12,10 @@
 ////////////////////////////////////////////////////////////////////////////////
 #include <cmath>
 #include <cstdlib>
+#include <cstring>
 
 #include <algorithm>
+#include <charconv>
 #include <limits>
 #include <string>
 #include <vector>
@@ -34,13 +36,6 @@
 #include <langinfo.h>
 #endif
 
-////////////////////////////////////////////////////////////////////////////////
-// Macro Definitions
-////////////////////////////////////////////////////////////////////////////////
-#ifndef _CVTBUFSIZE
-#define _CVTBUFSIZE 308
-#endif
-
 namespace Ag {
 
 namespace {
@@ -486,6 +481,11 @@ public:
 ////////////////////////////////////////////////////////////////////////////////
 // Local Data
 ////////////////////////////////////////////////////////////////////////////////
+//! @brief The size of a buffer large enough to hold the digits of any real
+//! value, which can have up to 309 whole number digits, plus a generous
+//! number of fraction digits.
+constexpr size_t RealDigitBufferSize = 512;
+
 //! @brief Represents the insertion parameters parsed from a string format
 //! specification.
 struct InsertionToken
@@ -684,6 +684,103 @@ bool handleUnreal(NumericCharacters &chars, double value, bool &isZero)
     return isReal;
 }
 
+//! @brief Converts the text produced by std::to_chars() into a null-terminated
+//! array of significant digits and the position of the decimal point, in the
+//! same form as produced by the C runtime ecvt() and fcvt() functions.
+//! @param[in,out] digitBuffer The buffer holding the text to convert on input
+//! which receives the digits on output.
+//! @param[in] bufferSize The size of digitBuffer in characters.
+//! @param[in] result The result of converting the value to text.
+//! @param[out] decPtIndex Receives the index of the decimal point.
+//! @param[out] sign Receives the sign, 0 if positive, 1 if negative.
+//! @retval 0 If successful
+//! @retval !0 Conversion failed.
+//! @note Leading zeros are removed, each one which follows the decimal
+//! point moving the decimal point one place to the left.
+int extractRealDigits(char *digitBuffer, size_t bufferSize,
+                      const std::to_chars_result &result,
+                      int *decPtIndex, int *sign)
+{
+    if ((result.ec != std::errc()) ||
+        (result.ptr >= (digitBuffer + bufferSize)))
+    {
+        // There would be no room for the null terminator.
+        return static_cast<int>(std::errc::value_too_large);
+    }
+
+    const char *source = digitBuffer;
+    char *digits = digitBuffer;
+    int decimalPoint = 0;
+    bool isFraction = false;
+    bool isSignificant = false;
+
+    *sign = 0;
+
+    if (*source == '-')
+    {
+        *sign = 1;
+        ++source;
+    }
+
+    for (; source < result.ptr; ++source)
+    {
+        char next = *source;
+
+        if (next == '.')
+        {
+            isFraction = true;
+        }
+        else if (next == 'e')
+        {
+            // Adjust the decimal point by the exponent in scientific form.
+            int exponent = 0;
+            std::from_chars((source[1] == '+') ? source + 2 : source + 1,
+                            result.ptr, exponent);
+
+            decimalPoint += exponent;
+            break;
+        }
+        else if (isSignificant || (next != '0'))
+        {
+            isSignificant = true;
+            *digits++ = next;
+
+            if (isFraction == false)
+            {
+                ++decimalPoint;
+            }
+        }
+        else if (isFraction)
+        {
+            // A leading zero after the decimal point.
+            --decimalPoint;
+        }
+    }
+
+    *digits = '\0';
+    *decPtIndex = decimalPoint;
+
+    return 0;
+}
+
+//! @brief Calculates the shortest sequence of digits which will be parsed
+//! back to exactly the same real value.
+//! @param[in] value The real value to format.
+//! @param[out] digitBuffer The buffer to receive the digits.
+//! @param[in] bufferSize The size of digitBuffer in characters.
+//! @param[out] decPtIndex Receives the index of the decimal point.
+//! @param[out] sign Receives the sign.
+//! @retval 0 If successful
+//! @retval !0 Conversion failed.
+int realToShortestDigits(double value, char *digitBuffer,
+                         size_t bufferSize, int *decPtIndex, int *sign)
+{
+    auto result = std::to_chars(digitBuffer, digitBuffer + bufferSize, value,
+                                std::chars_format::scientific);
+
+    return extractRealDigits(digitBuffer, bufferSize, result, decPtIndex, sign);
+}
+
 //! @brief Calculates the digits of a real value rounded to a fixed number
 //! of significant figures.
 //! @param[in] value The real value to format.
@@ -697,11 +794,11 @@ bool handleUnreal(NumericCharacters &chars, double value, bool &isZero)
 int realToSignificantDigits(double value, int sigFigs, char *digitBuffer,
                             size_t bufferSize, int *decPtIndex, int *sign)
 {
-#ifdef _MSC_VER
-    return _ecvt_s(digitBuffer, bufferSize, value, sigFigs, decPtIndex, sign);
-#else
-    return ecvt_r(value, sigFigs, decPtIndex, sign, digitBuffer, bufferSize);
-#endif
+    auto result = std::to_chars(digitBuffer, digitBuffer + bufferSize, value,
+                                std::chars_format::scientific,
+                                std::max(sigFigs, 1) - 1);
+
+    return extractRealDigits(digitBuffer, bufferSize, result, decPtIndex, sign);
 }
 
 //! @brief Calculates the digits of a real value rounded to a fixed number
@@ -717,11 +814,10 @@ int realToSignificantDigits(double value, int sigFigs, char *digitBuffer,
 int realToFractionDigits(double value, int fractDigits, char *digitBuffer,
                          size_t bufferSize, int *decPtIndex, int *sign)
 {
-#ifdef _MSC_VER
-    return _fcvt_s(digitBuffer, bufferSize, value, fractDigits, decPtIndex, sign);
-#else
-    return fcvt_r(value, fractDigits, decPtIndex, sign, digitBuffer, bufferSize);
-#endif
+    auto result = std::to_chars(digitBuffer, digitBuffer + bufferSize, value,
+                                std::chars_format::fixed, fractDigits);
+
+    return extractRealDigits(digitBuffer, bufferSize, result, decPtIndex, sign);
 }
 
 //! @brief Calculates the real value best used to format a file size.
@@ -976,21 +1072,22 @@ bool tryParseInsertionToken(const std::string_view &source, size_t &offset,
     return isOK;
 }
 
-//! @brief Appends a value to a buffer.
-//! @param[out] buffer The STL string buffer to append to.
+//! @brief Creates the options used to format a value from the type code and
+//! precision of an insertion token.
 //! @param[in] token Details of the token to be formatted.
 //! @param[in] options The base options for formatting values as text.
-//! @param[in] value The value to format.
-void formatValue(std::string &buffer, const InsertionToken &token,
-                 const FormatInfo &options, const Variant &value)
+//! @return The options adapted to the insertion token.
+//! @throws FormatException If the type code of the token is not recognised.
+FormatInfo createTokenOptions(const InsertionToken &token, const FormatInfo &options)
 {
+    FormatInfo valueOptions(options);
+
     if ((token.TypeCode == '\0') ||
         (token.TypeCode == 'C') ||
         (token.TypeCode == 'c'))
     {
         // No format code was specified or it was a character, which requires
         // no special formatting.
-        value.appendToString(options, buffer);
     }
     else if ((token.TypeCode == 'I') ||
              (token.TypeCode == 'i') ||
@@ -1000,7 +1097,6 @@ void formatValue(std::string &buffer, const InsertionToken &token,
              (token.TypeCode == 'u'))
     {
         // Format a decimal integer.
-        FormatInfo valueOptions(options);
         valueOptions.setRadix(10);
 
         if (token.Precision >= 0)
@@ -1009,141 +1105,258 @@ void formatValue(std::string &buffer, const InsertionToken &token,
         }
 
         valueOptions.setRequiredFractionDigits(0);
-
-        value.appendToString(valueOptions, buffer);
     }
     else if ((token.TypeCode == 'X') ||
              (token.TypeCode == 'x'))
     {
         // Format a hexadecimal value.
-        FormatInfo hexOptions(options);
-
-        hexOptions.setRadix(16);
-        hexOptions.enableUpperCase(token.TypeCode == 'X');
+        valueOptions.setRadix(16);
+        valueOptions.enableUpperCase(token.TypeCode == 'X');
 
         if (token.Precision >= 0)
         {
-            hexOptions.setMinimumWholeDigits(static_cast<uint16_t>(token.Precision));
+            valueOptions.setMinimumWholeDigits(static_cast<uint16_t>(token.Precision));
         }
-
-        value.appendToString(hexOptions, buffer);
     }
     else if ((token.TypeCode == 'P') ||
              (token.TypeCode == 'p'))
     {
         // Format a pointer.
-        FormatInfo pointerOptions(options);
-        pointerOptions.setRadix(16);
-        pointerOptions.setMinimumWholeDigits(sizeof(void *) * 2);
-        pointerOptions.setThousandSeparator(String::Empty);
-        pointerOptions.setRequiredFractionDigits(0);
-        pointerOptions.setRequiredSignificantFigures(0);
-        pointerOptions.enableForcedSign(false);
-
-        value.appendToString(pointerOptions, buffer);
+        valueOptions.setRadix(16);
+        valueOptions.setMinimumWholeDigits(sizeof(void *) * 2);
+        valueOptions.setThousandSeparator(String::Empty);
+        valueOptions.setRequiredFractionDigits(0);
+        valueOptions.setRequiredSignificantFigures(0);
+        valueOptions.enableForcedSign(false);
     }
     else if ((token.TypeCode == 'E') ||
              (token.TypeCode == 'e'))
     {
         // Format a real value with a fixed number of significant digits.
-        FormatInfo realOptions(options);
-
-        realOptions.setMinimumWholeDigits(1);
-        realOptions.setRequiredFractionDigits(-1);
+        valueOptions.setMinimumWholeDigits(1);
+        valueOptions.setRequiredFractionDigits(-1);
 
         if (token.Precision >= 0)
         {
-            realOptions.setRequiredSignificantFigures(static_cast<int16_t>(token.Precision));
+            valueOptions.setRequiredSignificantFigures(static_cast<int16_t>(token.Precision));
         }
-
-        value.appendToString(realOptions, buffer);
     }
     else if ((token.TypeCode == 'F') ||
              (token.TypeCode == 'f'))
     {
         // Format a real value with a fixed number of significant digits.
-        FormatInfo realOptions(options);
-
-        realOptions.setMinimumWholeDigits(1);
-        realOptions.setRequiredSignificantFigures(-1);
+        valueOptions.setMinimumWholeDigits(1);
+        valueOptions.setRequiredSignificantFigures(-1);
 
         if (token.Precision >= 0)
         {
-            realOptions.setRequiredFractionDigits(static_cast<int16_t>(token.Precision));
+            valueOptions.setRequiredFractionDigits(static_cast<int16_t>(token.Precision));
         }
-
-        value.appendToString(realOptions, buffer);
     }
     else if ((token.TypeCode == 'G') ||
              (token.TypeCode == 'g'))
     {
         // Format a real value using the shortest representation.
-        FormatInfo realOptions(options);
-
-        realOptions.setMinimumWholeDigits(1);
-        realOptions.setRequiredSignificantFigures(-1);
-        realOptions.setRequiredFractionDigits(-1);
+        valueOptions.setMinimumWholeDigits(1);
+        valueOptions.setRequiredSignificantFigures(-1);
+        valueOptions.setRequiredFractionDigits(-1);
 
         if (token.Precision >= 0)
         {
-            realOptions.setMinimumFieldWidth(static_cast<uint16_t>(token.Precision));
+            valueOptions.setMinimumFieldWidth(static_cast<uint16_t>(token.Precision));
         }
-
-        value.appendToString(realOptions, buffer);
     }
     else if ((token.TypeCode == 'S') ||
              (token.TypeCode == 's'))
     {
         // Format a string.
-        FormatInfo stringOptions(options);
-
         if (token.Precision >= 0)
         {
-            stringOptions.setRequiredSignificantFigures(static_cast<uint16_t>(token.Precision));
+            valueOptions.setRequiredSignificantFigures(static_cast<uint16_t>(token.Precision));
         }
-
-        value.appendToString(stringOptions, buffer);
     }
     else if ((token.TypeCode == 'K') ||
              (token.TypeCode == 'k'))
     {
-        // Format a string.
-        FormatInfo sizeOptions(options);
-
+        // Format a file size.
         if (token.Precision >= 0)
         {
-            sizeOptions.setRequiredFractionDigits(static_cast<int16_t>(token.Precision));
+            valueOptions.setRequiredFractionDigits(static_cast<int16_t>(token.Precision));
         }
+    }
+    else
+    {
+        // Unknown format type code.
+        throw FormatException(token.TypeCode);
+    }
+
+    return valueOptions;
+}
 
+//! @brief Determines whether an insertion token type code specifies
+//! formatting a value as a file size.
+bool isFileSizeTypeCode(char typeCode)
+{
+    return (typeCode == 'K') || (typeCode == 'k');
+}
+
+//! @brief Attempts to append a value formatted as a file size to a buffer.
+//! @param[in] options The options used to format the value.
+//! @param[out] buffer The STL string buffer to append to.
+//! @param[in] value The value to format.
+//! @retval true The value was a scalar and was appended.
+//! @retval false The value could not be interpreted as a file size.
+bool tryAppendFileSize(const FormatInfo &options, std::string &buffer,
+                       const Variant &value)
+{
+    bool isOK = true;
+
+    if (value.getType() == VariantTypes::Double)
+    {
+        appendRealFileSize(options, buffer,
+                           value.getRef<DoubleVariantType, double>());
+    }
+    else if (value.getType() == VariantTypes::Float)
+    {
+        float originalValue = value.getRef<FloatVariantType, float>();
+
+        appendRealFileSize(options, buffer, originalValue);
+    }
+    else if (value.getType() == VariantTypes::Uint64)
+    {
+        // No conversion is required.
+        appendFileSize(options, buffer, value.getRef<Uint64VariantType, uint64_t>());
+    }
+    else
+    {
         Variant scalarType;
 
-        if (value.getType() == VariantTypes::Double)
+        if (value.tryConvert(VariantTypes::Uint64, scalarType))
         {
-            appendRealFileSize(sizeOptions, buffer,
-                               value.getRef<DoubleVariantType, double>());
+            appendFileSize(options, buffer,
+                           scalarType.getRef<Uint64VariantType, uint64_t>());
         }
-        else if (value.getType() == VariantTypes::Float)
+        else
         {
-            float originalValue = value.getRef<FloatVariantType, float>();
-
-            appendRealFileSize(sizeOptions, buffer, originalValue);
+            isOK = false;
         }
-        else if (value.tryConvert(VariantTypes::Uint64, scalarType))
+    }
+
+    return isOK;
+}
+
+//! @brief Appends a value to a buffer.
+//! @param[out] buffer The STL string buffer to append to.
+//! @param[in] token Details of the token to be formatted.
+//! @param[in] options The base options for formatting values as text.
+//! @param[in] value The value to format.
+void formatValue(std::string &buffer, const InsertionToken &token,
+                 const FormatInfo &options, const Variant &value)
+{
+    FormatInfo valueOptions = createTokenOptions(token, options);
+
+    if (isFileSizeTypeCode(token.TypeCode) == false)
+    {
+        value.appendToString(valueOptions, buffer);
+    }
+    else if (tryAppendFileSize(valueOptions, buffer, value) == false)
+    {
+        throw FormatException(token.ValueIndex,
+                              "Only scalar values can be formatted as a file size.");
+    }
+}
+
+//! @brief Appends text to a buffer padded to the minimum field width
+//! in the same way as a String value held in a Variant.
+//! @param[in] options The options which specify field width and alignment.
+//! @param[out] buffer The STL string buffer to append to.
+//! @param[in] text The text to append.
+void appendPaddedText(const FormatInfo &options, std::string &buffer,
+                      const String &text)
+{
+    size_t printableLength = text.getPrintLength();
+    size_t fieldLength = std::max(toSize(options.getMinimumFieldWidth()),
+                                  printableLength);
+    size_t padding = fieldLength - printableLength;
+
+    if ((padding > 0) && options.isRightAligned())
+    {
+        buffer.append(padding, ' ');
+    }
+
+    buffer.append(text.getUtf8Bytes(), text.getUtf8Length());
+
+    if ((padding > 0) && (options.isRightAligned() == false))
+    {
+        buffer.append(padding, ' ');
+    }
+}
+
+//! @brief Parses a format specification, passing literal characters and
+//! insertion tokens to a pair of handlers.
+//! @tparam TLiteralFn The type of a function which accepts a char.
+//! @tparam TTokenFn The type of a function which accepts an InsertionToken.
+//! @param[in] spec The format specification to parse.
+//! @param[in] onLiteral The function to receive literal characters.
+//! @param[in] onToken The function to receive parsed insertion tokens.
+//! @throws FormatException If the specification contains an invalid
+//! insertion token.
+template<typename TLiteralFn, typename TTokenFn>
+void parseFormatSpec(const std::string_view &spec, TLiteralFn onLiteral,
+                     TTokenFn onToken)
+{
+    size_t index = 0;
+
+    while (index < spec.length())
+    {
+        char next = spec[index];
+
+        if (next == '{')
         {
-            appendFileSize(sizeOptions, buffer,
-                           scalarType.getRef<Uint64VariantType, uint64_t>());
+            ++index;
+
+            if (index < spec.length())
+            {
+                next = spec[index];
+
+                if ((next >= '0') && (next <= '9'))
+                {
+                    // It's a value insertion token.
+                    size_t offset = index;
+                    InsertionToken token;
+
+                    if (tryParseInsertionToken(spec, offset, token))
+                    {
+                        onToken(token);
+
+                        // Move past the token.
+                        index = offset;
+                    }
+                    else
+                    {
+                        // Format error: Value index out of range.
+                        throw FormatException(spec.substr(index, offset - index));
+                    }
+                }
+                else if (next == '{')
+                {
+                    // It's an escaped open brace '{'.
+                    onLiteral('{');
+                    ++index;
+                }
+            }
+            else
+            {
+                // It's an open brace at the end of the string.
+                onLiteral('{');
+            }
         }
         else
         {
-            throw FormatException(token.ValueIndex,
-                                  "Only scalar values can be formatted as a file size.");
+            onLiteral(next);
+            ++index;
         }
     }
-    else
-    {
-        // Unknown format type code.
-        throw FormatException(token.TypeCode);
-    }
 }
 
 } // Anonymous namespace
@@ -1445,6 +1658,242 @@ void FormatInfo::setOption(uint32_t flag, bool enabled)
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// FormatArgument Member Function Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Appends the referenced value to a string as text.
+//! @param[in] options The options which define how the value is rendered.
+//! @param[out] buffer The buffer to append the value to.
+void FormatArgument::appendToString(const FormatInfo &options,
+                                    std::string &buffer) const
+{
+    switch (_kind)
+    {
+    case Kind::Boolean:
+        Variant(_value.Boolean).appendToString(options, buffer);
+        break;
+
+    case Kind::Character:
+        Variant(_value.Character).appendToString(options, buffer);
+        break;
+
+    case Kind::Signed:
+        appendValue(options, buffer, _value.Signed);
+        break;
+
+    case Kind::Unsigned:
+        appendValue(options, buffer, _value.Unsigned);
+        break;
+
+    case Kind::Real:
+        appendValue(options, buffer, _value.Real);
+        break;
+
+    case Kind::Pointer: {
+        // Format in the same way as a pointer held in a Variant.
+        FormatInfo pointerOptions(options);
+        pointerOptions.setRadix(16);
+        pointerOptions.enableForcedSign(false);
+        pointerOptions.setMinimumWholeDigits(static_cast<uint16_t>(sizeof(void *) * 2));
+        pointerOptions.setRequiredFractionDigits(0);
+        pointerOptions.setRequiredSignificantFigures(0);
+        pointerOptions.setThousandSeparator(String::Empty);
+
+        buffer.push_back('0');
+        buffer.push_back('x');
+
+        appendValue(pointerOptions, buffer, static_cast<uint64_t>(_value.Pointer));
+    } break;
+
+    case Kind::Text:
+        if (options.getMinimumFieldWidth() > 0)
+        {
+            // Padding depends on the count of printable characters.
+            appendPaddedText(options, buffer,
+                             String(_value.View.Bytes, _value.View.Length));
+        }
+        else
+        {
+            buffer.append(_value.View.Bytes, _value.View.Length);
+        }
+        break;
+
+    case Kind::String:
+        if (options.getMinimumFieldWidth() > 0)
+        {
+            appendPaddedText(options, buffer, *_value.Text);
+        }
+        else
+        {
+            buffer.append(_value.Text->getUtf8Bytes(), _value.Text->getUtf8Length());
+        }
+        break;
+
+    case Kind::Variant:
+        _value.Boxed->appendToString(options, buffer);
+        break;
+    }
+}
+
+//! @brief Attempts to append the referenced value to a string formatted as
+//! a file size.
+//! @param[in] options The options which define how the value is rendered.
+//! @param[out] buffer The buffer to append the value to.
+//! @retval true The value was a scalar and was appended.
+//! @retval false The value could not be interpreted as a file size.
+bool FormatArgument::tryAppendFileSize(const FormatInfo &options,
+                                       std::string &buffer) const
+{
+    bool isOK = true;
+
+    switch (_kind)
+    {
+    case Kind::Signed:
+        if (_value.Signed < 0)
+        {
+            isOK = false;
+        }
+        else
+        {
+            appendFileSize(options, buffer, static_cast<uint64_t>(_value.Signed));
+        }
+        break;
+
+    case Kind::Unsigned:
+        appendFileSize(options, buffer, _value.Unsigned);
+        break;
+
+    case Kind::Real:
+        appendRealFileSize(options, buffer, _value.Real);
+        break;
+
+    case Kind::Variant:
+        isOK = Ag::tryAppendFileSize(options, buffer, *_value.Boxed);
+        break;
+
+    default:
+        isOK = false;
+        break;
+    }
+
+    return isOK;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// CompiledFormat Member Function Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Parses a format specification which will format values using
+//! options derived from the display locale.
+//! @param[in] spec The format specification, see appendFormat().
+//! @throws FormatException If the specification contains an invalid
+//! insertion token.
+CompiledFormat::CompiledFormat(const std::string_view &spec) :
+    _parameterCount(0)
+{
+    FormatInfo display(LocaleInfo::getDisplay());
+
+    compile(display, spec);
+}
+
+//! @brief Parses a format specification.
+//! @param[in] options The options used to format values.
+//! @param[in] spec The format specification, see appendFormat().
+//! @throws FormatException If the specification contains an invalid
+//! insertion token.
+CompiledFormat::CompiledFormat(const FormatInfo &options,
+                               const std::string_view &spec) :
+    _parameterCount(0)
+{
+    compile(options, spec);
+}
+
+//! @brief Gets the minimum count of values which must be supplied to
+//! satisfy all of the insertion tokens in the specification.
+size_t CompiledFormat::getParameterCount() const
+{
+    return _parameterCount;
+}
+
+//! @brief Appends text with values inserted to an STL string.
+//! @param[out] buffer The buffer to append the formatted text to.
+//! @param[in] args An array of values to insert.
+//! @param[in] argCount The count of elements in args.
+//! @throws FormatException If the specification refers to a value beyond
+//! the end of args or a value cannot be formatted as specified.
+void CompiledFormat::appendArguments(std::string &buffer, const FormatArgument *args,
+                                     size_t argCount) const
+{
+    if (argCount < _parameterCount)
+    {
+        throw FormatException(argCount, _parameterCount - 1);
+    }
+
+    size_t offset = 0;
+
+    for (const Insertion &insertion : _insertions)
+    {
+        // Copy the literal text preceding the value.
+        buffer.append(_literals, offset, insertion.LiteralLength);
+        offset += insertion.LiteralLength;
+
+        const FormatArgument &arg = args[insertion.ValueIndex];
+
+        if (isFileSizeTypeCode(insertion.TypeCode) == false)
+        {
+            arg.appendToString(insertion.Options, buffer);
+        }
+        else if (arg.tryAppendFileSize(insertion.Options, buffer) == false)
+        {
+            throw FormatException(insertion.ValueIndex,
+                                  "Only scalar values can be formatted as a file size.");
+        }
+    }
+
+    // Copy any literal text following the last value.
+    buffer.append(_literals, offset, std::string::npos);
+}
+
+//! @brief Appends text with boxed values inserted to an STL string.
+//! @param[out] buffer The buffer to append the formatted text to.
+//! @param[in] params The values to insert.
+//! @throws FormatException If the specification refers to a value beyond
+//! the end of params or a value cannot be formatted as specified.
+void CompiledFormat::appendVariants(std::string &buffer,
+                                    const std::initializer_list<Variant> &params) const
+{
+    std::vector<FormatArgument> args(params.begin(), params.end());
+
+    appendArguments(buffer, args.data(), args.size());
+}
+
+//! @brief Parses the format specification into runs of literal text and
+//! the options used to format each value.
+//! @param[in] options The options used to format values.
+//! @param[in] spec The format specification to parse.
+void CompiledFormat::compile(const FormatInfo &options, const std::string_view &spec)
+{
+    size_t literalStart = 0;
+
+    _literals.reserve(spec.length());
+
+    parseFormatSpec(spec,
+                    [this](char next) { _literals.push_back(next); },
+                    [&](const InsertionToken &token)
+                    {
+                        Insertion insertion {
+                            createTokenOptions(token, options),
+                            _literals.length() - literalStart,
+                            token.ValueIndex,
+                            token.TypeCode
+                        };
+
+                        _insertions.push_back(std::move(insertion));
+                        _parameterCount = std::max(_parameterCount,
+                                                   token.ValueIndex + 1);
+                        literalStart = _literals.length();
+                    });
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Global Function Definitions
 ////////////////////////////////////////////////////////////////////////////////
@@ -1679,7 +2128,7 @@ void appendValue(const FormatInfo &options, std::string &buffer, double value)
     {
         // Create a temporary buffer big enough to hold the maximum number of digits
         // given the worst case.
-        char digitBuffer[_CVTBUFSIZE];
+        char digitBuffer[RealDigitBufferSize];
         int decPtIndex = 0, sign = 0, errorCode = 0;
         digitBuffer[0] = '\0';
 
@@ -1703,117 +2152,79 @@ void appendValue(const FormatInfo &options, std::string &buffer, double value)
         }
         else
         {
-            // Format the value using the maximum number of significant digits
-            // supported by the data type.
-            errorCode = realToSignificantDigits(value,
-                                                std::numeric_limits<double>::max_digits10,
-                                                digitBuffer, std::size(digitBuffer),
-                                                &decPtIndex, &sign);
+            // Format the value using the fewest significant digits which
+            // will be parsed back to exactly the same value.
+            errorCode = realToShortestDigits(value, digitBuffer,
+                                             std::size(digitBuffer),
+                                             &decPtIndex, &sign);
 
             if (errorCode == 0)
             {
-                // Calculate how many significant digits there really are.
-                size_t sigFigs = 0;
+                size_t sigFigs = std::strlen(digitBuffer);
+                int exponent = decPtIndex - 1;
 
-                for (size_t index = 0; digitBuffer[index]; ++index)
-                {
-                    if (digitBuffer[index] != '0')
-                    {
-                        sigFigs = index + 1;
-                    }
-                }
+                // Calculate the exponent digits in the buffer after the
+                // significant digits and their null terminator.
+                char *expDigits = digitBuffer + sigFigs + 1;
+                size_t expMaxLen = std::size(digitBuffer) - sigFigs - 1;
+                char expSign = options.isUpperCase() ? '\0' : '\1';
+                size_t exponentDigitCount = appendDigits(expDigits, expSign,
+                                                         expMaxLen, 10, exponent);
 
-                // Calculate the perspective length of the value in standard form.
-                double roundedExponent = std::trunc(std::log10(value));
-                int exponentDigitCount = static_cast<int>(std::ceil(std::log10(std::abs(roundedExponent))));
+                // Calculate the length of the value in standard form allowing
+                // for the decimal point, the E/e and the exponent sign if
+                // necessary.
+                size_t stdFormLength = ((sigFigs > 1) ? (sigFigs + 1) : sigFigs) +
+                                       exponentDigitCount + 1;
 
-                if ((roundedExponent < 0) || options.isExponentSignForced())
+                if ((exponent < 0) || options.isExponentSignForced())
                 {
-                    // Add one for the sign.
-                    ++exponentDigitCount;
+                    ++stdFormLength;
                 }
 
-                // Add one for the E/e.
-                size_t expLength = static_cast<size_t>(exponentDigitCount) + 1;
-
-                // Calculate the length of the value in standard form allowing
-                // for the decimal point if necessary.
-                size_t stdFormLength = ((sigFigs > 1) ? (sigFigs + 1) : sigFigs) + expLength;
                 size_t normFormLength = 0;
 
                 if (decPtIndex <= 0)
                 {
-                    // The value is fractional (magnitude < 1)
-
-                    // Calculate the length in long form (add 2 for leading "0.").
-                    normFormLength = toSize(-decPtIndex) + 2;
+                    // The value is fractional (magnitude < 1), add 2 for
+                    // the leading "0.".
+                    normFormLength = toSize(-decPtIndex) + sigFigs + 2;
                 }
-                else if (sigFigs < toSize(decPtIndex))
+                else if (sigFigs <= toSize(decPtIndex))
                 {
-                    // The value is a whole number with trailing zeros.
+                    // The value is a whole number, possibly with trailing zeros.
                     normFormLength = toSize(decPtIndex);
                 }
                 else
                 {
-                    // The value has zero or more fraction digits.
+                    // The value has fraction digits.
                     normFormLength = sigFigs + 1;
                 }
 
                 if (normFormLength <= stdFormLength)
                 {
-                    // Format as normal, but cut out all of the
-                    // unnecessary trailing zeros.
-                    if (toSize(decPtIndex) >= sigFigs)
+                    if (sigFigs < toSize(decPtIndex))
                     {
+                        // Pad the whole number digits with trailing zeros,
+                        // the buffer is always long enough as the normal
+                        // form is no longer than the standard form.
+                        std::fill_n(digitBuffer + sigFigs,
+                                    toSize(decPtIndex) - sigFigs, '0');
                         digitBuffer[decPtIndex] = '\0';
                     }
 
                     characters = NumericCharacters((sign == 0) ? '+' : '-',
                                                    decPtIndex, digitBuffer);
                 }
-                else if (decPtIndex > 0)
-                {
-                    size_t wholeLength = 1;
-                    char *fractDigits = digitBuffer + wholeLength;
-                    size_t fractLength = sigFigs - 1;
-
-                    // Calculate the exponent digits and add them to the
-                    // buffer after the fraction digits.
-                    size_t expMaxLen = std::size(digitBuffer) - sigFigs;
-                    char *expDigits = digitBuffer + sigFigs;
-                    char expSign;
-
-                    // There should only be a single whole number digit in
-                    // standard form.
-                    decPtIndex = 1;
-
-                    expLength = appendDigits(expDigits, expSign, expMaxLen, 10,
-                                             static_cast<int>(roundedExponent));
-
-                    characters = NumericCharacters((sign == 0) ? '+' : '-', digitBuffer,
-                                                   wholeLength, fractDigits, fractLength,
-                                                   expSign, expDigits, expLength);
-                }
                 else
                 {
-                    // The value is fractional.
-                    // Calculate the exponent digits and add them to the
-                    // buffer after the fraction digits.
-                    digitBuffer[sigFigs] = '\0';
-                    size_t expMaxLen = std::size(digitBuffer) - sigFigs - 1;
-                    char *expDigits = digitBuffer + sigFigs + 1;
-                    char expSign;
-
                     // There should only be a single whole number digit in
                     // standard form.
-                    decPtIndex = 1;
-
-                    expLength = appendDigits(expDigits, expSign, expMaxLen, 10,
-                                             static_cast<int>(roundedExponent));
-
                     characters = NumericCharacters((sign == 0) ? '+' : '-',
-                                                   decPtIndex, digitBuffer,
-                                                   expSign, expDigits);
+                                                   digitBuffer, 1,
+                                                   digitBuffer + 1, sigFigs - 1,
+                                                   expSign, expDigits,
+                                                   exponentDigitCount);
                 }
             }
         }
@@ -1921,77 +2332,24 @@ void appendFormat(const std::string_view &spec, std::string &buffer,
 void appendFormat(const FormatInfo &options, const std::string_view &spec,
                   std::string &buffer, const std::initializer_list<Variant> &params)
 {
-    // Create a random-access index of parameter values.
-    std::vector<const Variant *> paramIndex;
-    paramIndex.reserve(params.size());
-    for (const Variant &param : params)
-    {
-        paramIndex.push_back(&param);
-    }
+    // The list supports random access through the pointer to its first element.
+    const Variant *paramIndex = params.begin();
 
-    size_t index = 0;
-
-    while (index < spec.length())
-    {
-        char next = spec[index];
-
-        if (next == '{')
-        {
-            ++index;
-
-            if (index < spec.length())
-            {
-                next = spec[index];
-
-                if ((next >= '0') && (next <= '9'))
-                {
-                    // It's a value insertion token.
-                    size_t offset = index;
-
-                    // FormatInfo valueOptions(options);
-                    InsertionToken token;
-
-                    if (tryParseInsertionToken(spec, offset, token))
+    parseFormatSpec(spec,
+                    [&buffer](char next) { buffer.push_back(next); },
+                    [&](const InsertionToken &token)
                     {
                         if (token.ValueIndex < params.size())
                         {
                             // Format the value into the target string.
                             formatValue(buffer, token, options,
-                                        *paramIndex[token.ValueIndex]);
-
-                            // Move past the token.
-                            index = offset;
+                                        paramIndex[token.ValueIndex]);
                         }
                         else
                         {
                             throw FormatException(params.size(), token.ValueIndex);
                         }
-                    }
-                    else
-                    {
-                        // Format error: Value index out of range.
-                        throw FormatException(spec.substr(index, offset - index));
-                    }
-                }
-                else if (next == '{')
-                {
-                    // It's an escaped open brace '{'.
-                    buffer.push_back('{');
-                    ++index;
-                }
-            }
-            else
-            {
-                // It's an open brace at the end of the string.
-                buffer.push_back('{');
-            }
-        }
-        else
-        {
-            buffer.push_back(next);
-            ++index;
-        }
-    }
+                    });
 }
 
 } // namespace Ag
@@ -21,6 +21,43 @@
 
 namespace Ag {
 
+namespace {
+////////////////////////////////////////////////////////////////////////////////
+// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Converts text into a pre-allocated field, skipping ill-formed
+//! sequences and truncating the result at a character boundary to fit.
+//! @tparam TView The data type of the view of the source text.
+//! @tparam TChar The data type of the characters to produce.
+//! @param[in] source A view of the text to convert.
+//! @param[out] data The field to receive the converted characters.
+//! @param[in] charCount The count of characters which fit in @p data.
+//! @return The count of characters written to @p data.
+template<typename TView, typename TChar>
+size_t transcodeToField(TView source, TChar *data, size_t charCount)
+{
+    size_t outputIndex = 0;
+
+    while (true)
+    {
+        Utf::TranscodeResult result = Utf::transcode(source, data + outputIndex,
+                                                     charCount - outputIndex);
+
+        outputIndex += result.Produced;
+        source.remove_prefix(result.Consumed);
+
+        if (result.Status != Utf::TranscodeStatus::InvalidInput)
+            break;
+
+        // Skip the element which could not be converted and resume.
+        source.remove_prefix(1);
+    }
+
+    return outputIndex;
+}
+
+} // Anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 // Class Method Definitions
 ////////////////////////////////////////////////////////////////////////////////
@@ -931,43 +968,8 @@ utf16_ptr_t InlineInitialiser::initialiseFieldUTF16(const InlineField &field,
     if (tryGetSafeFieldData(field, data, safeSize))
     {
         size_t charCount = (safeSize / sizeof(char16_t)) - 1;
-        size_t outputIndex = 0;
-        Utf::FromUtf8Converter inputConverter;
-
-        for (size_t inputIndex = 0;
-             (inputIndex < byteCount) && (outputIndex < charCount);
-             ++inputIndex)
-        {
-            char32_t codePoint = U'\0';
-            bool hasError = false;
-
-            if (inputConverter.tryConvert(utf8Text[inputIndex], codePoint,
-                                          hasError))
-            {
-                uint32_t wordCount = 0;
-
-                if (Utf::tryGetUTF16WordCountFromCodePoint(codePoint, wordCount))
-                {
-                    if ((outputIndex + wordCount) > charCount)
-                    {
-                        break;
-                    }
-
-                    Utf::ToUtf16Converter outputConverter;
-                    outputConverter.setCodePoint(codePoint);
-                    char16_t utf16Word = 0;
-
-                    while (outputConverter.tryGetNextCharacter(utf16Word))
-                    {
-                        data[outputIndex++] = utf16Word;
-                    }
-                }
-            }
-            else if (hasError)
-            {
-                inputConverter.reset();
-            }
-        }
+        size_t outputIndex = transcodeToField(std::string_view(utf8Text, byteCount),
+                                              data, charCount);
 
         // Ensure the string is properly null terminated.
         data[outputIndex] = u'\0';
@@ -1022,33 +1024,8 @@ utf16_ptr_t InlineInitialiser::initialiseFieldUTF16(const InlineField &field,
     if (tryGetSafeFieldData(field, data, safeSize))
     {
         size_t charCount = (safeSize / sizeof(char16_t)) - 1;
-        size_t outputIndex = 0;
-        Utf::FromUtf8Converter inputConverter;
-
-        for (size_t inputIndex = 0;
-             (inputIndex < codePointCount) && (outputIndex < charCount);
-             ++inputIndex)
-        {
-            char32_t codePoint = utf32Text[inputIndex];
-            uint32_t wordCount = 0;
-
-            if (Utf::tryGetUTF16WordCountFromCodePoint(codePoint, wordCount))
-            {
-                if ((outputIndex + wordCount) > charCount)
-                {
-                    break;
-                }
-
-                Utf::ToUtf16Converter outputConverter;
-                outputConverter.setCodePoint(codePoint);
-                char16_t utf16Word = 0;
-
-                while (outputConverter.tryGetNextCharacter(utf16Word))
-                {
-                    data[outputIndex++] = utf16Word;
-                }
-            }
-        }
+        size_t outputIndex = transcodeToField(std::u32string_view(utf32Text, codePointCount),
+                                              data, charCount);
 
         // Ensure the string is properly null terminated.
         data[outputIndex] = u'\0';
@@ -1132,26 +1109,8 @@ utf32_ptr_t InlineInitialiser::initialiseFieldUTF32(const InlineField &field,
     if (tryGetSafeFieldData(field, data, safeSize))
     {
         size_t charCount = (safeSize / sizeof(char32_t)) - 1;
-        size_t outputIndex = 0;
-        Utf::FromUtf8Converter inputConverter;
-
-        for (size_t inputIndex = 0;
-             (inputIndex < byteCount) && (outputIndex < charCount);
-             ++inputIndex)
-        {
-            char32_t codePoint = U'\0';
-            bool hasError = false;
-
-            if (inputConverter.tryConvert(utf8Text[inputIndex], codePoint,
-                                          hasError))
-            {
-                data[outputIndex++] = codePoint;
-            }
-            else if (hasError)
-            {
-                inputConverter.reset();
-            }
-        }
+        size_t outputIndex = transcodeToField(std::string_view(utf8Text, byteCount),
+                                              data, charCount);
 
         // Ensure the string is properly null terminated.
         data[outputIndex] = U'\0';
@@ -1208,25 +1167,8 @@ utf32_ptr_t InlineInitialiser::initialiseFieldUTF32(const InlineField &field,
     if (tryGetSafeFieldData(field, data, safeSize))
     {
         size_t charCount = (safeSize / sizeof(char32_t)) - 1;
-        size_t outputIndex = 0;
-        Utf::FromUtf16Converter inputConverter;
-        char32_t codePoint = U'\0';
-        bool hasError = false;
-
-        for (size_t inputIndex = 0;
-             (inputIndex < wordCount) && (outputIndex < charCount);
-             ++inputIndex)
-        {
-            if (inputConverter.tryConvert(utf16Text[inputIndex], codePoint,
-                                          hasError))
-            {
-                data[outputIndex++] = codePoint;
-            }
-            else if (hasError)
-            {
-                inputConverter.reset();
-            }
-        }
+        size_t outputIndex = transcodeToField(std::u16string_view(utf16Text, wordCount),
+                                              data, charCount);
 
         // Ensure the string is properly null terminated.
         data[outputIndex] = U'\0';
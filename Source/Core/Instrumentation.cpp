@@ -0,0 +1,581 @@
+//! @file Core/Instrumentation.cpp
+//! @brief The definition of a light-weight mechanism for recording timed
+//! zones, counters and histogram samples in release builds.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Header File Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <cstdio>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "CoreInternal.hpp"
+#include "Ag/Core/Binary.hpp"
+#include "Ag/Core/Instrumentation.hpp"
+
+#ifndef _WIN32
+#include <sys/syscall.h>
+#endif
+
+namespace Ag {
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Data
+////////////////////////////////////////////////////////////////////////////////
+//! @brief The count of events each thread can buffer before they are moved
+//! to the shared store, must be a power of 2.
+constexpr size_t RingCapacity = 4096;
+
+static_assert((RingCapacity & (RingCapacity - 1)) == 0,
+              "The ring capacity must be a power of 2.");
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Data Types
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Identifies the type of a recorded event.
+enum class EventType : uint32_t
+{
+    Zone,
+    Counter,
+    Sample,
+};
+
+//! @brief A fixed-size event recorded by a thread.
+struct Event
+{
+    //! @brief The name of the zone, counter or histogram.
+    const char *Name;
+
+    //! @brief The time at which the event started.
+    MonotonicTicks Start;
+
+    //! @brief The duration of a zone, or the value of a counter or sample.
+    int64_t Value;
+
+    //! @brief The type of the event.
+    EventType Type;
+};
+
+//! @brief An event annotated with the thread which recorded it.
+struct RecordedEvent
+{
+    Event Data;
+    uint32_t ThreadId;
+};
+
+//! @brief A single-producer/single-consumer ring of events owned by a thread.
+//! @details The producer is the owning thread, the consumer is any thread
+//! holding the lock on the EventStore.
+class EventRing
+{
+public:
+    // Construction/Destruction
+    EventRing() :
+        _head(0),
+        _tail(0)
+    {
+    }
+
+    // Operations
+    //! @brief Attempts to append an event to the ring.
+    //! @retval true The event was added.
+    //! @retval false The ring was full.
+    bool tryPush(const Event &next)
+    {
+        size_t head = _head.load(std::memory_order_relaxed);
+
+        if ((head - _tail.load(std::memory_order_acquire)) >= RingCapacity)
+            return false;
+
+        _events[head & (RingCapacity - 1)] = next;
+        _head.store(head + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    //! @brief Passes each event in the ring to a function and removes it.
+    template<typename TFn> void drain(TFn &&fn)
+    {
+        size_t tail = _tail.load(std::memory_order_relaxed);
+        size_t head = _head.load(std::memory_order_acquire);
+
+        for (; tail != head; ++tail)
+        {
+            fn(_events[tail & (RingCapacity - 1)]);
+        }
+
+        _tail.store(tail, std::memory_order_release);
+    }
+
+private:
+    // Internal Fields
+    std::atomic<size_t> _head;
+    std::atomic<size_t> _tail;
+    Event _events[RingCapacity];
+public:
+    // Public Fields
+    uint32_t ThreadId = 0;
+    bool IsInUse = false;
+};
+
+//! @brief The process-wide set of thread rings and the events collected
+//! from them.
+class EventStore
+{
+public:
+    // Public Types
+    using HistogramMap = std::map<std::string, InstrumentHistogram, std::less<>>;
+
+    // Public Fields
+    std::mutex Sync;
+    std::vector<std::unique_ptr<EventRing>> Rings;
+    std::vector<RecordedEvent> Events;
+    HistogramMap Histograms;
+    size_t EventCapacity = Instrumentation::DefaultEventCapacity;
+    size_t DroppedEventCount = 0;
+
+    // Operations
+    //! @brief Moves the events from a thread's ring into the store.
+    //! @note The caller must hold the lock on Sync.
+    void collect(EventRing &ring)
+    {
+        ring.drain([this, &ring](const Event &next)
+        {
+            if (next.Type == EventType::Sample)
+            {
+                addToHistogram(Histograms[next.Name], next.Value);
+            }
+            else if (Events.size() < EventCapacity)
+            {
+                Events.push_back(RecordedEvent{ next, ring.ThreadId });
+            }
+            else
+            {
+                ++DroppedEventCount;
+            }
+        });
+    }
+
+    //! @brief Moves the events from every thread's ring into the store.
+    //! @note The caller must hold the lock on Sync.
+    void collectAll()
+    {
+        for (const auto &ring : Rings)
+        {
+            collect(*ring);
+        }
+    }
+
+private:
+    // Internal Functions
+    static void addToHistogram(InstrumentHistogram &histogram, int64_t value)
+    {
+        if (histogram.Count == 0)
+        {
+            histogram.Min = value;
+            histogram.Max = value;
+        }
+        else
+        {
+            histogram.Min = std::min(histogram.Min, value);
+            histogram.Max = std::max(histogram.Max, value);
+        }
+
+        ++histogram.Count;
+        histogram.Sum += static_cast<double>(value);
+
+        size_t bucket = 0;
+        int32_t msb;
+
+        if ((value > 0) && Bin::bitScanReverse(static_cast<uint64_t>(value), msb))
+        {
+            bucket = std::min(static_cast<size_t>(msb) + 1,
+                              InstrumentHistogram::BucketCount - 1);
+        }
+
+        ++histogram.Buckets[bucket];
+    }
+};
+
+//! @brief Moves the events of a thread to the store when it exits.
+struct ThreadRegistration
+{
+    EventRing *Ring = nullptr;
+
+    ~ThreadRegistration();
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Data
+////////////////////////////////////////////////////////////////////////////////
+//! @brief The ring buffer of the current thread.
+thread_local EventRing *currentRing = nullptr;
+
+//! @brief The object which releases the ring of the current thread on exit.
+thread_local ThreadRegistration currentRegistration;
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Gets the process-wide event store.
+//! @note The object is never destroyed as threads may exit during static
+//! finalisation.
+EventStore &getEventStore()
+{
+    static EventStore *store = new EventStore();
+
+    return *store;
+}
+
+//! @brief Allocates a ring buffer to the current thread.
+EventRing *attachCurrentThread()
+{
+    EventStore &store = getEventStore();
+    std::lock_guard<std::mutex> lock(store.Sync);
+    EventRing *ring = nullptr;
+
+    for (const auto &existing : store.Rings)
+    {
+        if (existing->IsInUse == false)
+        {
+            ring = existing.get();
+            break;
+        }
+    }
+
+    if (ring == nullptr)
+    {
+        store.Rings.push_back(std::make_unique<EventRing>());
+        ring = store.Rings.back().get();
+    }
+
+    ring->IsInUse = true;
+#ifdef _WIN32
+    ring->ThreadId = static_cast<uint32_t>(::GetCurrentThreadId());
+#else
+    ring->ThreadId = static_cast<uint32_t>(syscall(SYS_gettid));
+#endif
+
+    currentRing = ring;
+    currentRegistration.Ring = ring;
+
+    return ring;
+}
+
+//! @brief Adds an event to the ring buffer of the current thread, moving
+//! the contents of the ring to the store if it is full.
+void pushEvent(const char *name, MonotonicTicks start, int64_t value, EventType type)
+{
+    EventRing *ring = currentRing;
+
+    if (ring == nullptr)
+        ring = attachCurrentThread();
+
+    Event next{ name, start, value, type };
+
+    if (ring->tryPush(next) == false)
+    {
+        EventStore &store = getEventStore();
+
+        {
+            std::lock_guard<std::mutex> lock(store.Sync);
+            store.collect(*ring);
+        }
+
+        ring->tryPush(next);
+    }
+}
+
+//! @brief Appends text to a JSON document as a quoted string.
+void appendJsonString(std::string &destination, std::string_view text)
+{
+    destination.push_back('"');
+
+    for (char next : text)
+    {
+        if ((next == '"') || (next == '\\'))
+        {
+            destination.push_back('\\');
+            destination.push_back(next);
+        }
+        else if (static_cast<unsigned char>(next) < 0x20)
+        {
+            char escape[8];
+            std::snprintf(escape, std::size(escape), "\\u%04X",
+                          static_cast<unsigned>(next));
+            destination.append(escape);
+        }
+        else
+        {
+            destination.push_back(next);
+        }
+    }
+
+    destination.push_back('"');
+}
+
+//! @brief Appends a formatted value to a string.
+template<typename... TArgs>
+void appendFormat(std::string &destination, const char *format, TArgs... args)
+{
+    char buffer[64];
+    int length = std::snprintf(buffer, std::size(buffer), format, args...);
+
+    if (length > 0)
+    {
+        destination.append(buffer, std::min(static_cast<size_t>(length),
+                                            std::size(buffer) - 1));
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ThreadRegistration Member Definitions
+////////////////////////////////////////////////////////////////////////////////
+ThreadRegistration::~ThreadRegistration()
+{
+    if (Ring != nullptr)
+    {
+        EventStore &store = getEventStore();
+        std::lock_guard<std::mutex> lock(store.Sync);
+
+        store.collect(*Ring);
+        Ring->IsInUse = false;
+
+        currentRing = nullptr;
+        Ring = nullptr;
+    }
+}
+
+} // Anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+// Global Function Definitions
+////////////////////////////////////////////////////////////////////////////////
+namespace Instrumentation
+{
+
+std::atomic<bool> IsEnabledFlag(false);
+
+//! @brief Enables or disables the recording of events by all threads.
+//! @param[in] isEnabled True to start recording events, false to stop.
+//! @note Events already recorded are retained until clear() is called.
+void setEnabled(bool isEnabled)
+{
+    IsEnabledFlag.store(isEnabled, std::memory_order_relaxed);
+}
+
+//! @brief Records a completed zone on the current thread.
+//! @param[in] name A string literal naming the zone.
+//! @param[in] start The time the zone started.
+//! @param[in] duration The time spent in the zone.
+void recordZone(const char *name, MonotonicTicks start, MonotonicTicks duration)
+{
+    pushEvent(name, start, duration, EventType::Zone);
+}
+
+//! @brief Records the current value of a counter.
+//! @param[in] name A string literal naming the counter.
+//! @param[in] value The value of the counter.
+void recordCounter(const char *name, int64_t value)
+{
+    pushEvent(name, HighResMonotonicTimer::getTime(), value, EventType::Counter);
+}
+
+//! @brief Adds a value to a histogram.
+//! @param[in] name A string literal naming the histogram.
+//! @param[in] value The value to add.
+void recordSample(const char *name, int64_t value)
+{
+    pushEvent(name, 0, value, EventType::Sample);
+}
+
+//! @brief Moves the events buffered by all threads to the shared store.
+void flush()
+{
+    EventStore &store = getEventStore();
+    std::lock_guard<std::mutex> lock(store.Sync);
+
+    store.collectAll();
+}
+
+//! @brief Discards all recorded events and histograms.
+void clear()
+{
+    EventStore &store = getEventStore();
+    std::lock_guard<std::mutex> lock(store.Sync);
+
+    store.collectAll();
+    store.Events.clear();
+    store.Histograms.clear();
+    store.DroppedEventCount = 0;
+}
+
+//! @brief Sets the maximum count of zone and counter events retained, after
+//! which further events are counted as dropped until clear() is called.
+//! @param[in] capacity The maximum count of events to retain.
+//! @note Events already recorded beyond the new capacity are retained.
+void setEventCapacity(size_t capacity)
+{
+    EventStore &store = getEventStore();
+    std::lock_guard<std::mutex> lock(store.Sync);
+
+    store.EventCapacity = capacity;
+}
+
+//! @brief Gets the count of zone and counter events recorded, including those
+//! still buffered by threads.
+size_t getEventCount()
+{
+    EventStore &store = getEventStore();
+    std::lock_guard<std::mutex> lock(store.Sync);
+
+    store.collectAll();
+
+    return store.Events.size();
+}
+
+//! @brief Gets the count of zone and counter events discarded because the
+//! store was full, including those still buffered by threads.
+size_t getDroppedEventCount()
+{
+    EventStore &store = getEventStore();
+    std::lock_guard<std::mutex> lock(store.Sync);
+
+    store.collectAll();
+
+    return store.DroppedEventCount;
+}
+
+//! @brief Attempts to get a summary of the values added to a histogram.
+//! @param[in] name The name of the histogram.
+//! @param[out] histogram Receives the summary of the histogram.
+//! @retval true The histogram had at least one value.
+//! @retval false No values have been added to the named histogram.
+bool tryGetHistogram(std::string_view name, InstrumentHistogram &histogram)
+{
+    EventStore &store = getEventStore();
+    std::lock_guard<std::mutex> lock(store.Sync);
+
+    store.collectAll();
+
+    auto pos = store.Histograms.find(name);
+
+    if (pos == store.Histograms.end())
+        return false;
+
+    histogram = pos->second;
+
+    return true;
+}
+
+//! @brief Appends all recorded events as a JSON document in the Chrome trace
+//! event format, which can be loaded by chrome://tracing or Perfetto.
+//! @param[in] destination The string to append the document to.
+//! @details Zones become complete ("X") events and counters become counter
+//! ("C") events with time stamps in microseconds relative to the earliest
+//! event. Histograms are summarised in a separate top-level object.
+void appendChromeTrace(std::string &destination)
+{
+    EventStore &store = getEventStore();
+    std::lock_guard<std::mutex> lock(store.Sync);
+
+    store.collectAll();
+
+    MonotonicTicks origin = 0;
+
+    if (store.Events.empty() == false)
+    {
+        origin = std::min_element(store.Events.begin(), store.Events.end(),
+                                  [](const RecordedEvent &lhs, const RecordedEvent &rhs)
+                                  {
+                                      return lhs.Data.Start < rhs.Data.Start;
+                                  })->Data.Start;
+    }
+
+    double ticksToMicroseconds = 1.0e6 / static_cast<double>(HighResMonotonicTimer::getFrequency());
+#ifdef _WIN32
+    unsigned processId = static_cast<unsigned>(::GetCurrentProcessId());
+#else
+    unsigned processId = static_cast<unsigned>(getpid());
+#endif
+
+    destination.append("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+    bool isFirst = true;
+
+    for (const RecordedEvent &recorded : store.Events)
+    {
+        const Event &next = recorded.Data;
+
+        destination.append(isFirst ? "\n{\"name\":" : ",\n{\"name\":");
+        appendJsonString(destination, next.Name);
+        appendFormat(destination, ",\"ts\":%.3f",
+                     static_cast<double>(next.Start - origin) * ticksToMicroseconds);
+
+        if (next.Type == EventType::Zone)
+        {
+            appendFormat(destination, ",\"ph\":\"X\",\"dur\":%.3f",
+                         static_cast<double>(next.Value) * ticksToMicroseconds);
+        }
+        else
+        {
+            appendFormat(destination, ",\"ph\":\"C\",\"args\":{\"value\":%lld}",
+                         static_cast<long long>(next.Value));
+        }
+
+        appendFormat(destination, ",\"pid\":%u,\"tid\":%u}", processId,
+                     static_cast<unsigned>(recorded.ThreadId));
+        isFirst = false;
+    }
+
+    destination.append("\n],\"histograms\":{");
+    isFirst = true;
+
+    for (const auto &entry : store.Histograms)
+    {
+        const InstrumentHistogram &histogram = entry.second;
+
+        destination.append(isFirst ? "\n" : ",\n");
+        appendJsonString(destination, entry.first);
+        appendFormat(destination, ":{\"count\":%zu", histogram.Count);
+        appendFormat(destination, ",\"min\":%lld", static_cast<long long>(histogram.Min));
+        appendFormat(destination, ",\"max\":%lld", static_cast<long long>(histogram.Max));
+        appendFormat(destination, ",\"sum\":%.17g", histogram.Sum);
+        destination.append(",\"buckets\":[");
+
+        // Omit trailing empty buckets.
+        size_t bucketCount = histogram.Buckets.size();
+
+        while ((bucketCount > 1) && (histogram.Buckets[bucketCount - 1] == 0))
+        {
+            --bucketCount;
+        }
+
+        for (size_t index = 0; index < bucketCount; ++index)
+        {
+            appendFormat(destination, (index == 0) ? "%zu" : ",%zu",
+                         histogram.Buckets[index]);
+        }
+
+        destination.append("]}");
+        isFirst = false;
+    }
+
+    destination.append("\n}}\n");
+}
+
+} // namespace Instrumentation
+
+} // namespace Ag
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,785 @@
+//! @file Core/SamplingProfiler.cpp
+//! @brief The definition of an in-process statistical profiler which samples
+//! the call stacks of running threads.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Header File Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <cerrno>
+#include <cstdio>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "CoreInternal.hpp"
+#include "Ag/Core/Exception.hpp"
+#include "Ag/Core/SamplingProfiler.hpp"
+#include "Ag/Core/StackTrace.hpp"
+#include "Ag/Core/Utils.hpp"
+
+#ifndef _WIN32
+#include <csignal>
+#include <pthread.h>
+#include <sys/syscall.h>
+#endif
+
+namespace Ag {
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Data
+////////////////////////////////////////////////////////////////////////////////
+//! @brief The maximum count of return addresses recorded in each sample.
+constexpr size_t MaxSampleDepth = 64;
+
+//! @brief The count of samples each thread can buffer before they are
+//! collected, must be a power of 2.
+constexpr size_t RingCapacity = 256;
+
+//! @brief The count of entries at the top of each raw sample which belong to
+//! the signal handler and the signal trampoline.
+constexpr size_t SignalFrameCount = 2;
+
+//! @brief The interval at which the background thread collects samples.
+constexpr std::chrono::milliseconds CollectInterval(25);
+
+static_assert((RingCapacity & (RingCapacity - 1)) == 0,
+              "The ring capacity must be a power of 2.");
+static_assert(std::atomic<size_t>::is_always_lock_free,
+              "Ring buffer indices must be usable from a signal handler.");
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Data Types
+////////////////////////////////////////////////////////////////////////////////
+//! @brief The raw return addresses captured by a single sample.
+struct Sample
+{
+    size_t Depth;
+    void *Frames[MaxSampleDepth];
+};
+
+//! @brief A single-producer/single-consumer ring of samples owned by a thread.
+//! @details The producer is the signal handler running on the owning thread,
+//! the consumer is whichever thread collects samples while holding the
+//! registry lock.
+class SampleRing
+{
+public:
+    // Construction/Destruction
+    SampleRing() :
+        _head(0),
+        _tail(0)
+    {
+    }
+
+    // Accessors
+    //! @brief Gets the next slot to write to, or nullptr if the ring is full.
+    //! @note Only called by the producer.
+    Sample *tryBeginWrite()
+    {
+        size_t head = _head.load(std::memory_order_relaxed);
+
+        if ((head - _tail.load(std::memory_order_acquire)) >= RingCapacity)
+            return nullptr;
+
+        return &_samples[head & (RingCapacity - 1)];
+    }
+
+    // Operations
+    //! @brief Publishes the sample obtained from tryBeginWrite().
+    void endWrite()
+    {
+        _head.store(_head.load(std::memory_order_relaxed) + 1,
+                    std::memory_order_release);
+    }
+
+    //! @brief Passes each published sample to a function and releases it.
+    template<typename TFn> void drain(TFn &&fn)
+    {
+        size_t tail = _tail.load(std::memory_order_relaxed);
+        size_t head = _head.load(std::memory_order_acquire);
+
+        for (; tail != head; ++tail)
+        {
+            fn(_samples[tail & (RingCapacity - 1)]);
+        }
+
+        _tail.store(tail, std::memory_order_release);
+    }
+
+private:
+    // Internal Fields
+    std::atomic<size_t> _head;
+    std::atomic<size_t> _tail;
+    Sample _samples[RingCapacity];
+public:
+    // Public Fields
+#ifndef _WIN32
+    pthread_t Thread = pthread_t();
+    pid_t ThreadId = 0;
+    timer_t Timer = timer_t();
+#else
+    uint32_t ThreadId = 0;
+#endif
+    bool HasTimer = false;
+    bool IsInUse = false;
+};
+
+//! @brief The set of sample rings, one per registered thread, and the
+//! state of sampling shared by all of them.
+//! @details Rings are recycled rather than freed so that a pointer held by a
+//! thread's signal handler is always valid.
+class ThreadRegistry
+{
+public:
+    // Construction/Destruction
+    ThreadRegistry() :
+        _intervalNs(0),
+        _isSampling(false)
+    {
+    }
+
+    // Operations
+    SampleRing *attach();
+    void detach(SampleRing *ring);
+    void startSampling(long intervalNs);
+    void stopSampling();
+
+    //! @brief Passes every sample buffered by every thread to a function.
+    template<typename TFn> void drainAll(TFn &&fn)
+    {
+        std::lock_guard<std::mutex> lock(_sync);
+
+        for (const auto &ring : _rings)
+        {
+            ring->drain(fn);
+        }
+    }
+
+private:
+    // Internal Functions
+    void startTimer(SampleRing &ring);
+    static void stopTimer(SampleRing &ring);
+
+    // Internal Fields
+    std::mutex _sync;
+    std::vector<std::unique_ptr<SampleRing>> _rings;
+    long _intervalNs;
+    bool _isSampling;
+};
+
+//! @brief Unregisters a thread from sampling when it exits.
+struct ThreadRegistration
+{
+    bool IsRegistered = false;
+
+    ~ThreadRegistration();
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Data
+////////////////////////////////////////////////////////////////////////////////
+//! @brief The ring buffer of the current thread, read by the signal handler.
+//! @note This is trivially constructed so that accessing it from a signal
+//! handler never causes an allocation.
+thread_local SampleRing *currentRing = nullptr;
+
+//! @brief The object which unregisters the current thread on exit.
+thread_local ThreadRegistration currentRegistration;
+
+//! @brief The count of samples lost as the thread had no ring or it was full.
+std::atomic<size_t> droppedSampleCount(0);
+
+//! @brief The profiler currently sampling, if any.
+std::atomic<SamplingProfiler *> activeProfiler(nullptr);
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Gets the process-wide registry of sampled threads.
+//! @note The object is never destroyed as threads may unregister during
+//! static finalisation.
+ThreadRegistry &getThreadRegistry()
+{
+    static ThreadRegistry *registry = new ThreadRegistry();
+
+    return *registry;
+}
+
+#ifndef _WIN32
+//! @brief Handles the timer signal by recording the call stack of the
+//! interrupted thread.
+void onProfileSignal(int /* signalId */, siginfo_t * /* info */, void * /* context */)
+{
+    int savedErrno = errno;
+    SampleRing *ring = currentRing;
+    Sample *sample = (ring == nullptr) ? nullptr : ring->tryBeginWrite();
+
+    if (sample == nullptr)
+    {
+        droppedSampleCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        // backtrace() is only safe here because it was called once during
+        // registration, which loaded the unwinder outside of signal context.
+        int depth = backtrace(sample->Frames, static_cast<int>(MaxSampleDepth));
+        sample->Depth = static_cast<size_t>(std::max(depth, 0));
+        ring->endWrite();
+    }
+
+    errno = savedErrno;
+}
+
+//! @brief Restores the action taken on SIGPROF once all sampling timers
+//! have been deleted.
+//! @param[in] previous The action replaced when sampling started.
+//! @details No further signals can be generated, but some may still be
+//! pending on any thread. Ignoring SIGPROF discards them all, after which it
+//! is safe to restore an action which could otherwise terminate the process.
+void restoreSignalAction(const struct sigaction &previous)
+{
+    struct sigaction ignore{};
+    ignore.sa_handler = SIG_IGN;
+    sigemptyset(&ignore.sa_mask);
+    sigaction(SIGPROF, &ignore, nullptr);
+    sigaction(SIGPROF, &previous, nullptr);
+}
+
+//! @brief Ensures that the unwinder used by backtrace() is loaded before it
+//! is needed in a signal handler.
+void primeBacktrace()
+{
+    static std::once_flag primed;
+
+    std::call_once(primed, []()
+    {
+        void *frames[4];
+        backtrace(frames, static_cast<int>(std::size(frames)));
+    });
+}
+#endif
+
+//! @brief Writes a symbol to a collapsed stack, replacing characters which
+//! have a meaning in the format.
+void appendFrameName(std::string &destination, const std::string &name)
+{
+    for (char next : name)
+    {
+        destination.push_back((next == ';') ? ':' : next);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ThreadRegistry Member Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Allocates a ring buffer to the current thread and starts sampling
+//! it if sampling is active.
+SampleRing *ThreadRegistry::attach()
+{
+    std::lock_guard<std::mutex> lock(_sync);
+    SampleRing *ring = nullptr;
+
+    for (const auto &existing : _rings)
+    {
+        if (existing->IsInUse == false)
+        {
+            ring = existing.get();
+            break;
+        }
+    }
+
+    if (ring == nullptr)
+    {
+        _rings.push_back(std::make_unique<SampleRing>());
+        ring = _rings.back().get();
+    }
+
+    ring->IsInUse = true;
+#ifdef _WIN32
+    ring->ThreadId = ::GetCurrentThreadId();
+#else
+    ring->Thread = pthread_self();
+    ring->ThreadId = static_cast<pid_t>(syscall(SYS_gettid));
+#endif
+
+    if (_isSampling)
+        startTimer(*ring);
+
+    return ring;
+}
+
+//! @brief Stops sampling a thread and makes its ring buffer available for
+//! reuse. Any samples it holds are still collected.
+void ThreadRegistry::detach(SampleRing *ring)
+{
+    std::lock_guard<std::mutex> lock(_sync);
+
+    stopTimer(*ring);
+    ring->IsInUse = false;
+}
+
+//! @brief Starts a timer for every registered thread.
+//! @param[in] intervalNs The interval of CPU time between samples.
+void ThreadRegistry::startSampling(long intervalNs)
+{
+    std::lock_guard<std::mutex> lock(_sync);
+
+    _intervalNs = intervalNs;
+    _isSampling = true;
+
+    for (const auto &ring : _rings)
+    {
+        if (ring->IsInUse)
+            startTimer(*ring);
+    }
+}
+
+//! @brief Stops the timers of all registered threads.
+void ThreadRegistry::stopSampling()
+{
+    std::lock_guard<std::mutex> lock(_sync);
+
+    _isSampling = false;
+
+    for (const auto &ring : _rings)
+    {
+        stopTimer(*ring);
+    }
+}
+
+//! @brief Creates a timer which signals a thread each time it has consumed
+//! the sampling interval of CPU time.
+//! @note The caller must hold the lock on _sync.
+void ThreadRegistry::startTimer(SampleRing &ring)
+{
+#ifndef _WIN32
+    if (ring.HasTimer)
+        return;
+
+    clockid_t clock;
+
+    if (pthread_getcpuclockid(ring.Thread, &clock) != 0)
+        return;
+
+    sigevent notification{};
+    notification.sigev_notify = SIGEV_THREAD_ID;
+    notification.sigev_signo = SIGPROF;
+#ifdef sigev_notify_thread_id
+    notification.sigev_notify_thread_id = ring.ThreadId;
+#else
+    notification._sigev_un._tid = ring.ThreadId;
+#endif
+
+    if (timer_create(clock, &notification, &ring.Timer) != 0)
+        return;
+
+    itimerspec schedule{};
+    schedule.it_interval.tv_sec = _intervalNs / 1000000000l;
+    schedule.it_interval.tv_nsec = _intervalNs % 1000000000l;
+    schedule.it_value = schedule.it_interval;
+
+    if (timer_settime(ring.Timer, 0, &schedule, nullptr) == 0)
+    {
+        ring.HasTimer = true;
+    }
+    else
+    {
+        timer_delete(ring.Timer);
+    }
+#else
+    static_cast<void>(ring);
+#endif
+}
+
+//! @brief Deletes the sampling timer of a thread, if it has one.
+void ThreadRegistry::stopTimer(SampleRing &ring)
+{
+#ifndef _WIN32
+    if (ring.HasTimer)
+    {
+        timer_delete(ring.Timer);
+        ring.HasTimer = false;
+    }
+#else
+    static_cast<void>(ring);
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ThreadRegistration Member Definitions
+////////////////////////////////////////////////////////////////////////////////
+ThreadRegistration::~ThreadRegistration()
+{
+    if (IsRegistered)
+    {
+        SamplingProfiler::unregisterCurrentThread();
+    }
+}
+
+} // Anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+// Class Declarations
+////////////////////////////////////////////////////////////////////////////////
+//! @brief The internal state of a SamplingProfiler.
+class SamplingProfilerPrivate
+{
+public:
+    // Public Types
+    using StackCountMap = std::map<std::vector<uintptr_t>, size_t>;
+
+    // Public Fields
+    mutable std::mutex StacksLock;
+    StackCountMap Stacks;
+    size_t SampleCount = 0;
+
+    std::mutex CollectorLock;
+    std::condition_variable CollectorWake;
+    std::thread Collector;
+    bool IsStopping = false;
+
+#ifndef _WIN32
+    struct sigaction PreviousAction{};
+#endif
+
+    // Operations
+    //! @brief Aggregates the samples buffered by all threads.
+    void collect()
+    {
+        std::vector<uintptr_t> key;
+
+        getThreadRegistry().drainAll([&](const Sample &sample)
+        {
+            key.clear();
+
+            // Omit the signal handler frames. The first remaining frame is the
+            // interrupted instruction, the rest are return addresses which are
+            // adjusted to point within the call instruction.
+            for (size_t index = SignalFrameCount; index < sample.Depth; ++index)
+            {
+                uintptr_t address = reinterpret_cast<uintptr_t>(sample.Frames[index]);
+
+                key.push_back((index == SignalFrameCount) ? address : address - 1);
+            }
+
+            if (key.empty() == false)
+            {
+                std::lock_guard<std::mutex> lock(StacksLock);
+
+                ++Stacks[key];
+                ++SampleCount;
+            }
+        });
+    }
+
+    //! @brief Stops the timers of all threads and waits for the background
+    //! thread to exit.
+    void stopSampling()
+    {
+        getThreadRegistry().stopSampling();
+
+        {
+            std::lock_guard<std::mutex> lock(CollectorLock);
+            IsStopping = true;
+        }
+
+        CollectorWake.notify_all();
+        Collector.join();
+    }
+
+    //! @brief Periodically collects samples until the profiler stops.
+    void runCollector()
+    {
+        std::unique_lock<std::mutex> lock(CollectorLock);
+
+        while (IsStopping == false)
+        {
+            CollectorWake.wait_for(lock, CollectInterval);
+
+            lock.unlock();
+            collect();
+            lock.lock();
+        }
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// SamplingProfiler Member Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Constructs an idle profiler with no samples.
+SamplingProfiler::SamplingProfiler() :
+    _data(std::make_unique<SamplingProfilerPrivate>())
+{
+}
+
+//! @brief Stops the profiler if it is running.
+SamplingProfiler::~SamplingProfiler()
+{
+    stop();
+}
+
+//! @brief Determines whether sampling is supported on the current platform.
+bool SamplingProfiler::isSupported()
+{
+#ifdef _WIN32
+    return false;
+#else
+    return true;
+#endif
+}
+
+//! @brief Determines whether the profiler is currently sampling.
+bool SamplingProfiler::isRunning() const
+{
+    return activeProfiler.load() == this;
+}
+
+//! @brief Gets the count of samples aggregated so far.
+size_t SamplingProfiler::getSampleCount() const
+{
+    std::lock_guard<std::mutex> lock(_data->StacksLock);
+
+    return _data->SampleCount;
+}
+
+//! @brief Gets the count of distinct call stacks aggregated so far.
+size_t SamplingProfiler::getStackCount() const
+{
+    std::lock_guard<std::mutex> lock(_data->StacksLock);
+
+    return _data->Stacks.size();
+}
+
+//! @brief Gets the count of samples lost by any profiler because the
+//! interrupted thread's ring buffer was full.
+size_t SamplingProfiler::getDroppedSampleCount()
+{
+    return droppedSampleCount.load(std::memory_order_relaxed);
+}
+
+//! @brief Registers the current thread to be sampled while a profiler runs.
+//! @note The thread is unregistered automatically when it exits.
+void SamplingProfiler::registerCurrentThread()
+{
+    if ((currentRing != nullptr) || (isSupported() == false))
+        return;
+
+#ifndef _WIN32
+    primeBacktrace();
+#endif
+
+    SampleRing *ring = getThreadRegistry().attach();
+
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    currentRing = ring;
+    currentRegistration.IsRegistered = true;
+}
+
+//! @brief Stops sampling the current thread.
+void SamplingProfiler::unregisterCurrentThread()
+{
+    SampleRing *ring = currentRing;
+
+    if (ring != nullptr)
+    {
+        // Ensure the signal handler stops using the ring before it can be
+        // given to another thread.
+        currentRing = nullptr;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+
+        getThreadRegistry().detach(ring);
+        currentRegistration.IsRegistered = false;
+    }
+}
+
+//! @brief Starts sampling all registered threads, including the current one.
+//! @param[in] samplesPerSecond The rate at which each thread is sampled while
+//! it consumes CPU time.
+//! @throws NotSupportedException If sampling is not supported.
+//! @throws OperationException If another profiler is already running.
+void SamplingProfiler::start(uint32_t samplesPerSecond /*= 997*/)
+{
+    if (isSupported() == false)
+        throw NotSupportedException("Sampling profiler");
+
+    if (samplesPerSecond == 0)
+        throw ArgumentException("samplesPerSecond");
+
+    SamplingProfiler *expected = nullptr;
+
+    if (activeProfiler.compare_exchange_strong(expected, this) == false)
+    {
+        if (expected == this)
+            return;
+
+        throw OperationException("Another sampling profiler is already running.");
+    }
+
+    // Undo each step taken so far if a later one fails.
+    AtScopeExit releaseProfiler([]() { activeProfiler.store(nullptr); });
+
+    registerCurrentThread();
+
+#ifndef _WIN32
+    struct sigaction action{};
+    action.sa_sigaction = onProfileSignal;
+    action.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGPROF, &action, &_data->PreviousAction);
+
+    AtScopeExit restoreAction([this]() { restoreSignalAction(_data->PreviousAction); });
+#endif
+
+    _data->IsStopping = false;
+    _data->Collector = std::thread(&SamplingProfilerPrivate::runCollector, _data.get());
+
+    AtScopeExit stopSampling([this]() { _data->stopSampling(); });
+
+    getThreadRegistry().startSampling(static_cast<long>(1000000000l / samplesPerSecond));
+
+    stopSampling.cancel();
+#ifndef _WIN32
+    restoreAction.cancel();
+#endif
+    releaseProfiler.cancel();
+}
+
+//! @brief Stops sampling and aggregates any samples still buffered.
+void SamplingProfiler::stop()
+{
+    if (isRunning() == false)
+        return;
+
+    _data->stopSampling();
+
+    // Gather any samples taken after the collector last ran.
+    _data->collect();
+
+#ifndef _WIN32
+    restoreSignalAction(_data->PreviousAction);
+#endif
+
+    activeProfiler.store(nullptr);
+}
+
+//! @brief Aggregates the samples buffered by all threads immediately rather
+//! than waiting for the background thread to do so.
+void SamplingProfiler::collect()
+{
+    _data->collect();
+}
+
+//! @brief Discards all aggregated samples.
+void SamplingProfiler::clear()
+{
+    std::lock_guard<std::mutex> lock(_data->StacksLock);
+
+    _data->Stacks.clear();
+    _data->SampleCount = 0;
+}
+
+//! @brief Appends the aggregated samples in the collapsed stack format used
+//! by flame graph tools.
+//! @param[in] destination The string to append lines of the form
+//! "outer;inner;leaf count" to.
+//! @details Addresses are resolved to symbols using the same mechanism as
+//! StackTrace, addresses with no symbol are expressed relative to the
+//! module containing them.
+void SamplingProfiler::appendCollapsedStacks(std::string &destination) const
+{
+    std::lock_guard<std::mutex> lock(_data->StacksLock);
+
+    // Resolve every distinct address at once.
+    std::vector<uintptr_t> addresses;
+
+    for (const auto &stack : _data->Stacks)
+    {
+        addresses.insert(addresses.end(), stack.first.begin(), stack.first.end());
+    }
+
+    std::sort(addresses.begin(), addresses.end());
+    addresses.erase(std::unique(addresses.begin(), addresses.end()), addresses.end());
+
+    std::vector<ActivationRecord> records;
+    records.reserve(addresses.size());
+
+    for (uintptr_t address : addresses)
+    {
+        records.push_back(ActivationRecord{ 0, address });
+    }
+
+    StackTrace resolved;
+    resolved.capture(records.data(), records.size());
+
+    std::vector<std::string> names;
+    names.reserve(addresses.size());
+
+    for (size_t index = 0; index < resolved.getEntryCount(); ++index)
+    {
+        std::string_view symbol = resolved.getEntrySymbol(index);
+
+        if (symbol.empty())
+        {
+            // Identify the location relative to its module.
+            char offset[24];
+            std::snprintf(offset, std::size(offset), "+0x%zX",
+                          static_cast<size_t>(resolved.getEntryOffset(index)));
+
+            size_t moduleId = resolved.getEntryModule(index);
+            std::string name;
+
+            if (moduleId < resolved.getModuleCount())
+            {
+                name.assign(resolved.getModuleFileName(moduleId));
+            }
+
+            name.append(offset);
+            names.push_back(std::move(name));
+        }
+        else
+        {
+            names.emplace_back(symbol);
+        }
+    }
+
+    // Write each stack from the outermost frame inwards.
+    for (const auto &stack : _data->Stacks)
+    {
+        bool isFirst = true;
+
+        for (auto pos = stack.first.rbegin(); pos != stack.first.rend(); ++pos)
+        {
+            auto match = std::lower_bound(addresses.begin(), addresses.end(), *pos);
+            size_t nameIndex = static_cast<size_t>(match - addresses.begin());
+
+            if (isFirst == false)
+                destination.push_back(';');
+
+            if (nameIndex < names.size())
+                appendFrameName(destination, names[nameIndex]);
+
+            isFirst = false;
+        }
+
+        destination.push_back(' ');
+        destination.append(std::to_string(stack.second));
+        destination.push_back('\n');
+    }
+}
+
+} // namespace Ag
+////////////////////////////////////////////////////////////////////////////////
@@ -1,7 +1,7 @@
 //! @file Core/ScalarParser.cpp
 //! @brief The definition of an object which parses scalar values from text.
 //! @author GiantRobotLemur@na-se.co.uk
-//! @date 2021-2023
+//! @date 2021-2026
 //! @copyright This file is part of the Silver (Ag) project which is released
 //! under LGPL 3 license. See LICENSE file at the repository root or go to
 //! https://github.com/GiantRobotLemur/Ag for full license details.
@@ -12,7 +12,10 @@
 ////////////////////////////////////////////////////////////////////////////////
 #include <algorithm>
 #include <cctype>
+#include <charconv>
+#include <cstring>
 
+#include "Ag/Core/Binary.hpp"
 #include "Ag/Core/ScalarParser.hpp"
 #include "Ag/Core/Exception.hpp"
 #include "Ag/Core/Utils.hpp"
@@ -21,9 +24,407 @@ namespace Ag {
 
 namespace {
 
+////////////////////////////////////////////////////////////////////////////////
+// Local Data
+////////////////////////////////////////////////////////////////////////////////
+//! @brief The maximum count of decimal digits which can always be accumulated
+//! in a 64-bit unsigned integer without overflow.
+constexpr int MaxExactDecimalDigits = 19;
+
+//! @brief Powers of 10 which can be represented exactly as a double.
+constexpr double ExactPowersOf10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+//! @brief Powers of 10 which can be represented exactly as a float.
+constexpr float ExactFloatPowersOf10[] = {
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 // Local Functions
 ////////////////////////////////////////////////////////////////////////////////
+//! @brief Loads 8 characters as a little-endian 64-bit word.
+uint64_t loadEightCharacters(const char *source)
+{
+    uint64_t chunk;
+    std::memcpy(&chunk, source, sizeof(chunk));
+
+#ifdef AG_IS_BIG_ENDIAN
+    chunk = byteSwap(chunk);
+#endif
+
+    return chunk;
+}
+
+//! @brief Determines whether 8 characters loaded by loadEightCharacters()
+//! are all decimal digits.
+bool isEightDigits(uint64_t chunk)
+{
+    // Each byte must be 0x30-0x39, adding 6 must not carry it out of 0x3X.
+    return (((chunk & 0xF0F0F0F0F0F0F0F0ull) |
+             (((chunk + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) ==
+            0x3333333333333333ull);
+}
+
+//! @brief Converts 8 decimal digits loaded by loadEightCharacters() to their
+//! value using SWAR arithmetic.
+uint32_t parseEightDigits(uint64_t chunk)
+{
+    constexpr uint64_t Mask = 0x000000FF000000FFull;
+    constexpr uint64_t Multiplier1 = 100 + (1000000ull << 32);
+    constexpr uint64_t Multiplier2 = 1 + (10000ull << 32);
+
+    // Combine adjacent digits into 2-digit values, then pairs of those into
+    // 4-digit values and finally into a single 8-digit value.
+    chunk -= 0x3030303030303030ull;
+    chunk = (chunk * 10) + (chunk >> 8);
+    chunk = (((chunk & Mask) * Multiplier1) +
+             (((chunk >> 16) & Mask) * Multiplier2)) >> 32;
+
+    return static_cast<uint32_t>(chunk);
+}
+
+//! @brief Gets the value of a digit character in any radix up to 36.
+//! @return The digit value or 0xFF if the character is not a digit.
+uint8_t getDigitValue(char next)
+{
+    if ((next >= '0') && (next <= '9'))
+    {
+        return static_cast<uint8_t>(next - '0');
+    }
+    else if ((next >= 'a') && (next <= 'z'))
+    {
+        return static_cast<uint8_t>(next - 'a' + 10);
+    }
+    else if ((next >= 'A') && (next <= 'Z'))
+    {
+        return static_cast<uint8_t>(next - 'A' + 10);
+    }
+
+    return 0xFF;
+}
+
+//! @brief Accumulates decimal digits into a 64-bit magnitude, 8 at a time
+//! where possible.
+//! @param[in,out] pos The position of the first digit, updated to the
+//! character after the last digit.
+//! @param[in] end The end of the text.
+//! @param[out] magnitude Receives the value of the digits.
+//! @retval true The digits were accumulated.
+//! @retval false The value overflowed.
+bool tryAccumulateDecimal(const char *&pos, const char *end, uint64_t &magnitude)
+{
+    magnitude = 0;
+    int digitCount = 0;
+
+    while (((end - pos) >= 8) && ((digitCount + 8) <= MaxExactDecimalDigits))
+    {
+        uint64_t chunk = loadEightCharacters(pos);
+
+        if (isEightDigits(chunk) == false)
+        {
+            break;
+        }
+
+        magnitude = (magnitude * 100000000u) + parseEightDigits(chunk);
+        pos += 8;
+        digitCount += 8;
+    }
+
+    for (; (pos < end) && (*pos >= '0') && (*pos <= '9'); ++pos, ++digitCount)
+    {
+        uint64_t digit = static_cast<uint64_t>(*pos - '0');
+
+        if ((digitCount >= MaxExactDecimalDigits) &&
+            (magnitude > ((std::numeric_limits<uint64_t>::max() - digit) / 10)))
+        {
+            return false;
+        }
+
+        magnitude = (magnitude * 10) + digit;
+    }
+
+    return true;
+}
+
+//! @brief Parses an optionally signed integer in the neutral format.
+//! @tparam T The integer data type to produce.
+//! @param[in] text The text to parse.
+//! @param[out] value Receives the value parsed.
+//! @param[in] radix The radix of the digits, between 2 and 36.
+//! @return The count of characters parsed, 0 if no valid value was found.
+template<typename T>
+size_t parseIntegerPrefix(std::string_view text, T &value, int radix)
+{
+    using TypeInfo = std::numeric_limits<T>;
+
+    const char *start = text.data();
+    const char *end = start + text.length();
+    const char *pos = start;
+    bool isNegative = false;
+
+    if ((radix < 2) || (radix > 36))
+    {
+        throw ArgumentException("radix");
+    }
+
+    if ((pos < end) && ((*pos == '+') || (*pos == '-')))
+    {
+        isNegative = (*pos == '-');
+        ++pos;
+    }
+
+    const char *digitStart = pos;
+    uint64_t magnitude = 0;
+
+    if (radix == 10)
+    {
+        if (tryAccumulateDecimal(pos, end, magnitude) == false)
+        {
+            return 0;
+        }
+    }
+    else
+    {
+        const uint64_t limit = std::numeric_limits<uint64_t>::max() /
+                               static_cast<uint64_t>(radix);
+
+        for (; pos < end; ++pos)
+        {
+            uint8_t digit = getDigitValue(*pos);
+
+            if (digit >= radix)
+            {
+                break;
+            }
+
+            if ((magnitude > limit) ||
+                ((magnitude * radix) > (std::numeric_limits<uint64_t>::max() - digit)))
+            {
+                return 0;
+            }
+
+            magnitude = (magnitude * radix) + digit;
+        }
+    }
+
+    if (pos == digitStart)
+    {
+        return 0;
+    }
+
+    if constexpr (TypeInfo::is_signed)
+    {
+        uint64_t maxMagnitude = static_cast<uint64_t>(TypeInfo::max());
+
+        if (isNegative)
+        {
+            // The most negative value has a greater magnitude than the
+            // most positive.
+            ++maxMagnitude;
+        }
+
+        if (magnitude > maxMagnitude)
+        {
+            return 0;
+        }
+
+        value = isNegative ? static_cast<T>(0 - magnitude) :
+                             static_cast<T>(magnitude);
+    }
+    else
+    {
+        if ((isNegative && (magnitude != 0)) || (magnitude > TypeInfo::max()))
+        {
+            return 0;
+        }
+
+        value = static_cast<T>(magnitude);
+    }
+
+    return static_cast<size_t>(pos - start);
+}
+
+//! @brief Parses an optionally signed real number in the neutral format.
+//! @tparam T The floating point data type to produce.
+//! @param[in] text The text to parse.
+//! @param[out] value Receives the correctly rounded value parsed.
+//! @return The count of characters parsed, 0 if no valid value was found.
+//! @details Values whose significand and power of 10 can both be represented
+//! exactly are calculated with a single multiplication or division, others
+//! are converted using std::from_chars().
+template<typename T>
+size_t parseRealPrefix(std::string_view text, T &value)
+{
+    const char *start = text.data();
+    const char *end = start + text.length();
+    const char *pos = start;
+    bool isNegative = false;
+
+    if ((pos < end) && ((*pos == '+') || (*pos == '-')))
+    {
+        isNegative = (*pos == '-');
+        ++pos;
+    }
+
+    const char *numberStart = pos;
+
+    if ((pos == end) || (*pos < '0') || (*pos > '9'))
+    {
+        // A digit must precede any decimal point.
+        return 0;
+    }
+
+    // Accumulate as many significant digits as will fit in 64-bits.
+    uint64_t significand = 0;
+    int significantDigits = 0;
+    int exponent = 0;
+    bool isTruncated = false;
+
+    auto accumulate = [&](char next, bool isFraction)
+    {
+        if (significantDigits < MaxExactDecimalDigits)
+        {
+            significand = (significand * 10) + static_cast<uint64_t>(next - '0');
+
+            if (significand != 0)
+            {
+                ++significantDigits;
+            }
+
+            if (isFraction)
+            {
+                --exponent;
+            }
+        }
+        else
+        {
+            isTruncated |= (next != '0');
+
+            if (isFraction == false)
+            {
+                ++exponent;
+            }
+        }
+    };
+
+    while ((pos < end) && (*pos >= '0') && (*pos <= '9'))
+    {
+        if (((end - pos) >= 8) && ((significantDigits + 8) <= MaxExactDecimalDigits))
+        {
+            uint64_t chunk = loadEightCharacters(pos);
+
+            if (isEightDigits(chunk))
+            {
+                significand = (significand * 100000000u) + parseEightDigits(chunk);
+                significantDigits = (significand == 0) ? 0 : significantDigits + 8;
+                pos += 8;
+                continue;
+            }
+        }
+
+        accumulate(*pos++, false);
+    }
+
+    if (((end - pos) >= 2) && (pos[0] == '.') && (pos[1] >= '0') && (pos[1] <= '9'))
+    {
+        ++pos;
+
+        while ((pos < end) && (*pos >= '0') && (*pos <= '9'))
+        {
+            if (((end - pos) >= 8) && ((significantDigits + 8) <= MaxExactDecimalDigits))
+            {
+                uint64_t chunk = loadEightCharacters(pos);
+
+                if (isEightDigits(chunk))
+                {
+                    significand = (significand * 100000000u) + parseEightDigits(chunk);
+                    significantDigits = (significand == 0) ? 0 : significantDigits + 8;
+                    exponent -= 8;
+                    pos += 8;
+                    continue;
+                }
+            }
+
+            accumulate(*pos++, true);
+        }
+    }
+
+    if ((pos < end) && ((*pos == 'e') || (*pos == 'E')))
+    {
+        // Only consume the exponent symbol if digits follow it.
+        const char *exponentPos = pos + 1;
+        bool isExponentNegative = false;
+
+        if ((exponentPos < end) && ((*exponentPos == '+') || (*exponentPos == '-')))
+        {
+            isExponentNegative = (*exponentPos == '-');
+            ++exponentPos;
+        }
+
+        if ((exponentPos < end) && (*exponentPos >= '0') && (*exponentPos <= '9'))
+        {
+            int explicitExponent = 0;
+
+            for (; (exponentPos < end) && (*exponentPos >= '0') && (*exponentPos <= '9');
+                 ++exponentPos)
+            {
+                // Saturate, the value will underflow or overflow anyway.
+                if (explicitExponent < 100000)
+                {
+                    explicitExponent = (explicitExponent * 10) + (*exponentPos - '0');
+                }
+            }
+
+            exponent += isExponentNegative ? -explicitExponent : explicitExponent;
+            pos = exponentPos;
+        }
+    }
+
+    constexpr uint64_t MaxExactSignificand = 1ull << std::numeric_limits<T>::digits;
+    constexpr int MaxExactPower = std::is_same_v<T, float> ?
+        static_cast<int>(std::size(ExactFloatPowersOf10)) - 1 :
+        static_cast<int>(std::size(ExactPowersOf10)) - 1;
+
+    if ((isTruncated == false) && (significand <= MaxExactSignificand) &&
+        (exponent >= -MaxExactPower) && (exponent <= MaxExactPower))
+    {
+        // Both components are exact, so a single correctly rounded operation
+        // gives a correctly rounded result.
+        T result = static_cast<T>(significand);
+        T scale;
+
+        if constexpr (std::is_same_v<T, float>)
+        {
+            scale = ExactFloatPowersOf10[(exponent < 0) ? -exponent : exponent];
+        }
+        else
+        {
+            scale = static_cast<T>(ExactPowersOf10[(exponent < 0) ? -exponent : exponent]);
+        }
+
+        result = (exponent < 0) ? result / scale : result * scale;
+        value = isNegative ? -result : result;
+    }
+    else
+    {
+        T result;
+        auto conversion = std::from_chars(numberStart, pos, result,
+                                          std::chars_format::general);
+
+        if ((conversion.ec != std::errc()) || (conversion.ptr != pos))
+        {
+            return 0;
+        }
+
+        value = isNegative ? -result : result;
+    }
+
+    return static_cast<size_t>(pos - start);
+}
+
 template<typename T> T raiseToPower(T value, int power)
 {
     T result = static_cast<T>(0);
@@ -912,6 +1313,83 @@ double ScalarParser::pow(double value, int power)
     return std::pow(value, static_cast<double>(power));
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Global Function Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Parses an integer from the start of a string using a fast path
+//! which only recognises the neutral format.
+//! @param[in] text The text to parse, which should start with an optional
+//! sign followed by digits.
+//! @param[out] value Receives the value parsed.
+//! @param[in] radix The radix of the digits, between 2 and 36.
+//! @return The count of characters parsed, 0 if the text did not start with
+//! a value or the value was out of range.
+//! @throws ArgumentException If radix is not valid.
+size_t parseScalarPrefix(std::string_view text, int8_t &value, int radix /*= 10*/)
+{
+    return parseIntegerPrefix(text, value, radix);
+}
+
+//! @copydoc parseScalarPrefix(std::string_view,int8_t&,int)
+size_t parseScalarPrefix(std::string_view text, uint8_t &value, int radix /*= 10*/)
+{
+    return parseIntegerPrefix(text, value, radix);
+}
+
+//! @copydoc parseScalarPrefix(std::string_view,int8_t&,int)
+size_t parseScalarPrefix(std::string_view text, int16_t &value, int radix /*= 10*/)
+{
+    return parseIntegerPrefix(text, value, radix);
+}
+
+//! @copydoc parseScalarPrefix(std::string_view,int8_t&,int)
+size_t parseScalarPrefix(std::string_view text, uint16_t &value, int radix /*= 10*/)
+{
+    return parseIntegerPrefix(text, value, radix);
+}
+
+//! @copydoc parseScalarPrefix(std::string_view,int8_t&,int)
+size_t parseScalarPrefix(std::string_view text, int32_t &value, int radix /*= 10*/)
+{
+    return parseIntegerPrefix(text, value, radix);
+}
+
+//! @copydoc parseScalarPrefix(std::string_view,int8_t&,int)
+size_t parseScalarPrefix(std::string_view text, uint32_t &value, int radix /*= 10*/)
+{
+    return parseIntegerPrefix(text, value, radix);
+}
+
+//! @copydoc parseScalarPrefix(std::string_view,int8_t&,int)
+size_t parseScalarPrefix(std::string_view text, int64_t &value, int radix /*= 10*/)
+{
+    return parseIntegerPrefix(text, value, radix);
+}
+
+//! @copydoc parseScalarPrefix(std::string_view,int8_t&,int)
+size_t parseScalarPrefix(std::string_view text, uint64_t &value, int radix /*= 10*/)
+{
+    return parseIntegerPrefix(text, value, radix);
+}
+
+//! @brief Parses a real number from the start of a string using a fast path
+//! which only recognises the neutral format.
+//! @param[in] text The text to parse, which should start with an optional
+//! sign, digits, an optional fraction and an optional exponent.
+//! @param[out] value Receives the correctly rounded value parsed.
+//! @return The count of characters parsed, 0 if the text did not start with
+//! a value or the value was out of range.
+size_t parseScalarPrefix(std::string_view text, float &value)
+{
+    return parseRealPrefix(text, value);
+}
+
+//! @copydoc parseScalarPrefix(std::string_view,float&)
+size_t parseScalarPrefix(std::string_view text, double &value)
+{
+    return parseRealPrefix(text, value);
+}
+
 } // namespace Ag
 ////////////////////////////////////////////////////////////////////////////////
 
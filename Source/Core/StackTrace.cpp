@@ -15,10 +15,19 @@
 #include <cstddef>
 #include <cstdlib>
 #include <cstdio>
+#include <cstring>
 
 #include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
 #include "CoreInternal.hpp"
 #include "Ag/Core/InlineMemory.hpp"
 #include "Ag/Core/StackTrace.hpp"
@@ -240,27 +249,170 @@ public:
     }
 };
 
-//! @brief An object which compares pointers to TraceElement objects by their
-//! SymbolOrdinal field.
-struct CompareBySymbolOrdinal
+//! @brief The symbols of a single binary module decoded into memory from a
+//! version 1 symbol file so that they can be searched without re-reading it.
+//! @details Symbol offsets are held in an implicit binary search tree in
+//! Eytzinger (breadth-first) order so that a lookup touches a predictable set
+//! of cache lines, and symbol names are held in a single interned string table.
+class DecodedSymbolTable : public IModuleSymbols
 {
-    bool operator()(const TraceElement *lhs, const TraceElement *rhs) const
-    {
-        bool isLess = false;
+private:
+    // Internal Fields
+
+    //! @brief Symbol offsets in Eytzinger order, element 0 is unused.
+    std::vector<uintptr_t> _searchTree;
+
+    //! @brief The ordinal of the name of the symbol at each node of the tree.
+    std::vector<uint32_t> _treeNameOrdinals;
+
+    //! @brief The characters of all symbol names, without separators.
+    std::vector<char> _nameData;
+
+    //! @brief The offset of each name in _nameData, with a trailing entry
+    //! marking the end of the last name.
+    std::vector<uint32_t> _nameOffsets;
+
+    // Internal Functions
 
-        if (lhs == nullptr)
+    //! @brief Populates a sub-tree of the search tree from sorted data.
+    //! @param[in] sortedOffsets The symbol offsets in ascending order.
+    //! @param[in] sortedOrdinals The name ordinals of each symbol in sortedOffsets.
+    //! @param[in] sortedIndex The index of the next sorted element to place.
+    //! @param[in] node The 1-based index of the root of the sub-tree to fill.
+    //! @return The index of the next sorted element to place.
+    size_t fillSearchTree(const std::vector<uintptr_t> &sortedOffsets,
+                          const std::vector<uint32_t> &sortedOrdinals,
+                          size_t sortedIndex, size_t node)
+    {
+        if (node < _searchTree.size())
         {
-            isLess = (rhs != nullptr);
+            sortedIndex = fillSearchTree(sortedOffsets, sortedOrdinals,
+                                         sortedIndex, node * 2);
+
+            _searchTree[node] = sortedOffsets[sortedIndex];
+            _treeNameOrdinals[node] = sortedOrdinals[sortedIndex];
+            ++sortedIndex;
+
+            sortedIndex = fillSearchTree(sortedOffsets, sortedOrdinals,
+                                         sortedIndex, (node * 2) + 1);
         }
-        else if (rhs != nullptr)
+
+        return sortedIndex;
+    }
+
+public:
+    // Construction/Destruction
+    DecodedSymbolTable() = default;
+    virtual ~DecodedSymbolTable() = default;
+
+    // Overrides
+    //! @brief Gets the name of a symbol.
+    //! @param[in] nameOrdinal The ordinal returned by findSymbol().
+    virtual std::string_view getName(size_t nameOrdinal) const override
+    {
+        return std::string_view(_nameData.data() + _nameOffsets[nameOrdinal],
+                                _nameOffsets[nameOrdinal + 1] - _nameOffsets[nameOrdinal]);
+    }
+
+    //! @brief Finds the symbol containing an offset within the module.
+    //! @param[in] offset The offset of the code within the module.
+    //! @return The ordinal of the name of the last symbol starting at or
+    //! before @p offset, or SIZE_MAX if there was none.
+    virtual size_t findSymbol(uintptr_t offset) const override
+    {
+        const size_t nodeCount = _searchTree.size();
+        size_t node = 1;
+        size_t found = 0;
+
+        // Descend the tree, remembering the last node which was not beyond
+        // the offset, as that is the predecessor of the offset.
+        while (node < nodeCount)
         {
-            isLess = lhs->SymbolOrdinal < rhs->SymbolOrdinal;
+            size_t isNotBeyond = (_searchTree[node] <= offset) ? 1 : 0;
+
+            found = isNotBeyond ? node : found;
+            node = (node * 2) + isNotBeyond;
         }
 
-        return isLess;
+        return (found == 0) ? SIZE_MAX : _treeNameOrdinals[found];
+    }
+
+    // Operations
+    bool tryLoad(IStream *input, const SymbolHeaderV1 &header);
+
+    //! @brief Discards any partially decoded data.
+    void clear()
+    {
+        _searchTree.clear();
+        _treeNameOrdinals.clear();
+        _nameData.clear();
+        _nameOffsets.clear();
     }
 };
 
+//! @brief The symbols of a single binary module read in place from a memory
+//! mapped version 2 symbol file.
+//! @details A lookup binary searches the small sparse index, then the run of
+//! symbol records it identifies, so only a couple of pages of the file are
+//! touched and nothing is decoded up front.
+class MappedSymbolTable : public IModuleSymbols
+{
+private:
+    // Internal Fields
+    const uint8_t *_fileData;
+    size_t _fileSize;
+    SymbolHeaderV2 _header;
+    const uint64_t *_index;
+    const SymbolRecordV2 *_records;
+    const char *_strings;
+
+    // Internal Functions
+    bool tryMap(const Fs::Path &symbolFilePath);
+    void unmap();
+
+public:
+    // Construction/Destruction
+    MappedSymbolTable();
+    MappedSymbolTable(const MappedSymbolTable &) = delete;
+    MappedSymbolTable(MappedSymbolTable &&) = delete;
+    virtual ~MappedSymbolTable();
+
+    // Operations
+    MappedSymbolTable &operator=(const MappedSymbolTable &) = delete;
+    MappedSymbolTable &operator=(MappedSymbolTable &&) = delete;
+    bool tryOpen(const Fs::Path &symbolFilePath);
+
+    // Overrides
+    virtual size_t findSymbol(uintptr_t offset) const override;
+    virtual std::string_view getName(size_t symbolId) const override;
+};
+
+//! @brief A process-wide cache of the symbol tables of each module which has
+//! appeared in a resolved stack trace.
+//! @details Each module's symbol file is decoded at most once, so rendering
+//! many stack traces costs a lookup for each entry rather than reading and
+//! decompressing a file. Modules without usable symbols are also cached.
+class SymbolCache
+{
+private:
+    // Internal Fields
+    std::unordered_map<std::string, ModuleSymbolsCPtr> _modules;
+    std::mutex _lock;
+
+public:
+    // Construction/Destruction
+    SymbolCache() = default;
+    SymbolCache(const SymbolCache &) = delete;
+    SymbolCache(SymbolCache &&) = delete;
+    ~SymbolCache() = default;
+
+    // Operations
+    SymbolCache &operator=(const SymbolCache &) = delete;
+    SymbolCache &operator=(SymbolCache &&) = delete;
+
+    ModuleSymbolsCPtr getModuleSymbols(const std::string &moduleFilePath);
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 // Local Functions
 ////////////////////////////////////////////////////////////////////////////////
@@ -298,18 +450,26 @@ std::string &addString(StringElements &strings, size_t &ordinal)
     return strings.back().Text;
 }
 
-//! @brief Attempts to find and open the file defining function symbols associated
+//! @brief Gets the path to the file defining function symbols associated
 //! with a specific binary module.
 //! @param[in] moduleFilePath The full path to the binary module.
-//! @returns Either a valid pointer to an open .sym file or nullptr if no symbols
-//! associated with the module could be found.
-IFileStream::UPtr findSymbolFile(const std::string &moduleFilePath)
+Fs::Path getSymbolFilePath(const std::string &moduleFilePath)
 {
     Fs::PathBuilder path(moduleFilePath);
 
     // Change the extension.
     path.setFileExtension("sym");
 
+    return path;
+}
+
+//! @brief Attempts to find and open the file defining function symbols associated
+//! with a specific binary module.
+//! @param[in] path The path to the symbol file.
+//! @returns Either a valid pointer to an open .sym file or nullptr if no symbols
+//! associated with the module could be found.
+IFileStream::UPtr findSymbolFile(const Fs::Path &path)
+{
     IFileStream::UPtr symbolStream;
 
     // Open the file, but don't throw an exception on failure.
@@ -418,7 +578,7 @@ void resolveModules(TraceElements &traces, ModuleElements &modules,
 }
 
 #else
-// The POSIX implementation of resolveModules() and findSymbolFile().
+// The POSIX implementation of resolveModules().
 
 //! @brief Resolves the set of modules referenced in a stack trace.
 //! @param[in,out] traces The function activation records which reference the
@@ -537,157 +697,18 @@ void resolveModules(TraceElements &traces, ModuleElements &modules,
 }
 #endif
 
-//! @brief Scans through a symbol file to find the ordinals of symbols we want to
-//! resolve.
-//! @param[in] input The symbol file input stream pointing to the beginning of the
-//! offsets table.
-//! @param[in] header The header read from the symbol file.
-//! @param[in] begin The iterator of the first offset to resolve.
-//! @param[in] end The iterator pointing to after the last offset to resolve.
-//! @param[in] elementsBySymbol A table to receive traces of symbols we are interested in.
-//! @return A boolean value indicating if the operation was successful.
-bool accumulateSymbolOffsets(IStream *input, const SymbolHeaderV1 &header,
-                             TraceElements::iterator begin, TraceElements::iterator end,
-                             std::vector<TraceElement *> &elementsBySymbol)
+//! @brief Reads and decodes a version 1 symbol file.
+//! @param[in] symbolFilePath The path to the symbol file.
+//! @param[out] symbols The table to receive the decoded symbols.
+//! @retval true The symbols were successfully decoded.
+//! @retval false No valid symbol file could be found, @p symbols is empty.
+bool tryDecodeSymbols(const Fs::Path &symbolFilePath, DecodedSymbolTable &symbols)
 {
-    PackedFieldHelper symbolFields({ header.SymbolOffsetBitCount,
-                                     header.SymbolOrdinalBitCount });
-
-    TraceElements::iterator current = begin;
-    uintptr_t currentOffset = static_cast<uintptr_t>(header.InitialOffset);
-    size_t prevOrdinal = ~0u;
-    bool isOK = true;
-
-    // Stream through the contents only retaining the data we need.
-    for (uint32_t index = 0; isOK && (index < header.SymbolCount); ++index)
-    {
-        if (symbolFields.read(input))
-        {
-            currentOffset += symbolFields.getField<uintptr_t>(0);
-            size_t ordinal = symbolFields.getField<size_t>(1);
-
-            while ((current != end) && (current->Record.Offset < currentOffset))
-            {
-                // The entry is beyond the one we were looking for,
-                // assign the previous one.
-                current->SymbolOrdinal = prevOrdinal;
-
-                elementsBySymbol.push_back(&(*current));
-
-                ++current;
-            }
-
-            prevOrdinal = ordinal;
-        }
-        else
-        {
-            isOK = false;
-        }
-    }
-
-    // Assign all of the entries left to the last symbol read.
-    while (current != end)
-    {
-        // The entry is beyond the one we were looking for,
-        // assign the previous one.
-        current->SymbolOrdinal = prevOrdinal;
-
-        elementsBySymbol.push_back(&(*current));
-
-        ++current;
-    }
-
-    return isOK;
-}
-
-//! @brief Scans through a symbol file string table to find the strings associated
-//! with offsets we want to look up.
-//! @param[in] input The symbol file input stream positioned at the beginning of the
-//! string table.
-//! @param[in] header The header read from the beginning of the file.
-//! @param[in] elementsBySymbol The collection of symbol traces to resolve sorted into
-//! ordinal order.
-//! @param[in] stringTable The string table to add symbol items to.
-//! @return A boolean value indicating if the operation was successful.
-bool assignSymbolsToOffsets(IStream *input, const SymbolHeaderV1 &header,
-                            const std::vector<TraceElement *> &elementsBySymbol,
-                            StringElements &stringTable)
-{
-    auto element = elementsBySymbol.begin();
-
-    bool isOK = true;
-
-    // Read the string data.
-    PackedFieldHelper stringFields({ header.StringPrefixBitCount,
-                                        header.StringSuffixBitCount });
-    std::vector<char> buffer;
-    buffer.reserve(static_cast<size_t>(header.MaxStringLength) + 1);
-
-    for (size_t ordinal = 0;
-         isOK && (ordinal < header.SymbolCount) && (element != elementsBySymbol.end());
-         ++ordinal)
-    {
-        if (stringFields.read(input))
-        {
-            size_t prefixSize = stringFields.getField<size_t>(0);
-            size_t suffixSize = stringFields.getField<size_t>(1);
-
-            buffer.resize(prefixSize + suffixSize);
-
-            if (tryRead(input, buffer.data() + prefixSize,
-                        suffixSize))
-            {
-                // We have the complete string.
-                if (((element != elementsBySymbol.end()) &&
-                    ((*element)->SymbolOrdinal == ordinal)))
-                {
-                    // Create a symbol from the current contents
-                    // of the buffer.
-                    size_t symbolOrdinal = ~0u;
-
-                    std::string &symbol = addString(stringTable,
-                                                    symbolOrdinal);
-
-                    symbol.assign(buffer.data(), prefixSize + suffixSize);
-
-                    // Apply the symbol to all affected elements.
-                    while ((element != elementsBySymbol.end()) &&
-                            ((*element)->SymbolOrdinal == ordinal))
-                    {
-                        (*element)->SymbolOrdinal = symbolOrdinal;
-                        ++element;
-                    }
-                }
-            }
-            else
-            {
-                isOK = false;
-            }
-        }
-        else
-        {
-            isOK = false;
-        }
-    }
-
-    return isOK;
-}
-
-//! @brief Resolve the symbols in the stack trace which reference a specific module.
-//! @param[in] moduleFilePath The path to the module containing the symbols to resolve.
-//! @param[in] begin A pointer to the first stack trace element which references
-//! the module.
-//! @param[in] end A pointer to the stack trace element after the last one which
-//! references the module.
-//! @note stack trace elements are ordered by their offset within the module.
-void resolveSymbols(const std::string &moduleFilePath, StringElements &stringTable,
-                    TraceElements::iterator begin, TraceElements::iterator end)
-{
-    IFileStream::UPtr symbolFile(findSymbolFile(moduleFilePath));
+    IFileStream::UPtr symbolFile(findSymbolFile(symbolFilePath));
 
     bool symbolsRead = false;
 
-    // Check to ensure the file was successfully opened before scanning it.
+    // Check to ensure the file was successfully opened before decoding it.
     if (symbolFile)
     {
         SymbolFileHeader fileHeader;
@@ -703,9 +724,6 @@ void resolveSymbols(const std::string &moduleFilePath, StringElements &stringTab
             (fileHeader.Version[3] == 0))
         {
             // The file is valid.
-            std::vector<TraceElement *> elementsBySymbol;
-            elementsBySymbol.reserve(std::distance(begin, end));
-
             static constexpr size_t BufferSize = 16 * 1024;
 
             if (fileHeader.Version[1] == 1)
@@ -714,47 +732,71 @@ void resolveSymbols(const std::string &moduleFilePath, StringElements &stringTab
                 Bz2DecompressionStream dataStream(symbolFile.get(), BufferSize);
                 dataStream.disableExceptions();
 
-                if (accumulateSymbolOffsets(&dataStream, fileData,
-                                            begin, end, elementsBySymbol))
-                {
-                    // Order the elements by the ordinal of the symbol within
-                    // the file so that we can apply the symbols as they are read in.
-                    std::sort(elementsBySymbol.begin(), elementsBySymbol.end(),
-                              CompareBySymbolOrdinal());
-
-                    symbolsRead = assignSymbolsToOffsets(&dataStream, fileData,
-                                                         elementsBySymbol,
-                                                         stringTable);
-                }
+                symbolsRead = symbols.tryLoad(&dataStream, fileData);
             }
             else
             {
                 // The symbol data is uncompressed, but reading from a raw
                 // OS stream would benefit from some buffering.
-                BufferedStream dataStream(symbolFile.get(), 16 * 1024);
+                BufferedStream dataStream(symbolFile.get(), BufferSize);
 
-                if (accumulateSymbolOffsets(&dataStream, fileData,
-                                            begin, end, elementsBySymbol))
-                {
-                    // Order the elements by the ordinal of the symbol within
-                    // the file so that we can apply the symbols as they are read in.
-                    std::sort(elementsBySymbol.begin(), elementsBySymbol.end(),
-                              CompareBySymbolOrdinal());
-
-                    symbolsRead = assignSymbolsToOffsets(&dataStream, fileData,
-                                                         elementsBySymbol,
-                                                         stringTable);
-                }
+                symbolsRead = symbols.tryLoad(&dataStream, fileData);
             }
         }
     }
 
     if (symbolsRead == false)
+        symbols.clear();
+
+    return symbolsRead;
+}
+
+//! @brief Gets the process-wide cache of decoded module symbols.
+SymbolCache &getSymbolCache()
+{
+    // Ensure that the cache is never destroyed so that stack traces can be
+    // resolved during static finalization.
+    static SymbolCache *globalCache = new SymbolCache();
+
+    return *globalCache;
+}
+
+//! @brief Resolve the symbols in the stack trace which reference a specific module.
+//! @param[in] moduleFilePath The path to the module containing the symbols to resolve.
+//! @param[in] stringTable The string table to add symbol names to.
+//! @param[in] begin A pointer to the first stack trace element which references
+//! the module.
+//! @param[in] end A pointer to the stack trace element after the last one which
+//! references the module.
+//! @note stack trace elements are ordered by their offset within the module.
+void resolveSymbols(const std::string &moduleFilePath, StringElements &stringTable,
+                    TraceElements::iterator begin, TraceElements::iterator end)
+{
+    ModuleSymbolsCPtr symbols = getSymbolCache().getModuleSymbols(moduleFilePath);
+    size_t prevNameOrdinal = SIZE_MAX;
+    size_t prevStringOrdinal = SIZE_MAX;
+
+    for (auto current = begin; current != end; ++current)
     {
-        // Set all symbols to be empty.
-        for (auto current = begin; current != end; ++current)
+        size_t nameOrdinal = symbols->findSymbol(current->Record.Offset);
+
+        if (nameOrdinal == SIZE_MAX)
         {
-            current->SymbolOrdinal = ~0u;
+            // The offset precedes all known symbols.
+            current->SymbolOrdinal = SIZE_MAX;
+        }
+        else
+        {
+            // Elements are in offset order, so those within the same
+            // function are adjacent and can share a string.
+            if (nameOrdinal != prevNameOrdinal)
+            {
+                std::string &symbol = addString(stringTable, prevStringOrdinal);
+                symbol.assign(symbols->getName(nameOrdinal));
+                prevNameOrdinal = nameOrdinal;
+            }
+
+            current->SymbolOrdinal = prevStringOrdinal;
         }
     }
 }
@@ -933,6 +975,325 @@ StackTracePrivate *resolveStackTrace(const ActivationRecord *records, size_t cou
 
 } // Anonymous namespace
 
+////////////////////////////////////////////////////////////////////////////////
+// DecodedSymbolTable Member Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Decodes the symbol and string tables of a symbol file.
+//! @param[in] input The symbol file data positioned after the header.
+//! @param[in] header The header read from the symbol file.
+//! @retval true The entire table was successfully decoded.
+//! @retval false The file was truncated or corrupt.
+bool DecodedSymbolTable::tryLoad(IStream *input, const SymbolHeaderV1 &header)
+{
+    PackedFieldHelper symbolFields({ header.SymbolOffsetBitCount,
+                                     header.SymbolOrdinalBitCount });
+    std::vector<uintptr_t> sortedOffsets;
+    std::vector<uint32_t> sortedOrdinals;
+    uintptr_t currentOffset = static_cast<uintptr_t>(header.InitialOffset);
+
+    sortedOffsets.reserve(header.SymbolCount);
+    sortedOrdinals.reserve(header.SymbolCount);
+
+    // The symbol table is ordered by offset, each being relative to
+    // the previous one.
+    for (uint32_t index = 0; index < header.SymbolCount; ++index)
+    {
+        if (symbolFields.read(input) == false)
+            return false;
+
+        currentOffset += symbolFields.getField<uintptr_t>(0);
+        uint32_t ordinal = symbolFields.getField<uint32_t>(1);
+
+        if (ordinal >= header.SymbolCount)
+            return false;
+
+        sortedOffsets.push_back(currentOffset);
+        sortedOrdinals.push_back(ordinal);
+    }
+
+    // Each string shares a prefix with the one before it.
+    PackedFieldHelper stringFields({ header.StringPrefixBitCount,
+                                     header.StringSuffixBitCount });
+    std::vector<char> buffer;
+    buffer.reserve(static_cast<size_t>(header.MaxStringLength) + 1);
+
+    _nameOffsets.reserve(static_cast<size_t>(header.SymbolCount) + 1);
+    _nameOffsets.push_back(0);
+
+    for (uint32_t ordinal = 0; ordinal < header.SymbolCount; ++ordinal)
+    {
+        if (stringFields.read(input) == false)
+            return false;
+
+        size_t prefixSize = stringFields.getField<size_t>(0);
+        size_t suffixSize = stringFields.getField<size_t>(1);
+
+        if (prefixSize > buffer.size())
+            return false;
+
+        buffer.resize(prefixSize + suffixSize);
+
+        if (tryRead(input, buffer.data() + prefixSize, suffixSize) == false)
+            return false;
+
+        _nameData.insert(_nameData.end(), buffer.begin(), buffer.end());
+        _nameOffsets.push_back(static_cast<uint32_t>(_nameData.size()));
+    }
+
+    _searchTree.resize(sortedOffsets.size() + 1, 0);
+    _treeNameOrdinals.resize(_searchTree.size(), 0);
+    fillSearchTree(sortedOffsets, sortedOrdinals, 0, 1);
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// MappedSymbolTable Member Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Constructs an object with no symbols.
+MappedSymbolTable::MappedSymbolTable() :
+    _fileData(nullptr),
+    _fileSize(0),
+    _index(nullptr),
+    _records(nullptr),
+    _strings(nullptr)
+{
+    std::memset(&_header, 0, sizeof(_header));
+}
+
+//! @brief Unmaps the symbol file, if one was mapped.
+MappedSymbolTable::~MappedSymbolTable()
+{
+    unmap();
+}
+
+//! @brief Attempts to map a version 2 symbol file and validate its layout.
+//! @param[in] symbolFilePath The path to the symbol file.
+//! @retval true The file was mapped and can be searched.
+//! @retval false The file did not exist or was not a valid version 2 file,
+//! the object remains empty.
+bool MappedSymbolTable::tryOpen(const Fs::Path &symbolFilePath)
+{
+    constexpr size_t HeaderSize = sizeof(SymbolFileHeader) + sizeof(SymbolHeaderV2);
+
+    if ((tryMap(symbolFilePath) == false) || (_fileSize < HeaderSize))
+    {
+        unmap();
+        return false;
+    }
+
+    SymbolFileHeader fileHeader;
+    std::memcpy(&fileHeader, _fileData, sizeof(fileHeader));
+    std::memcpy(&_header, _fileData + sizeof(fileHeader), sizeof(_header));
+
+    const uint64_t fileSize = _fileSize;
+    const uint64_t indexSize = static_cast<uint64_t>(_header.IndexCount) * sizeof(uint64_t);
+    const uint64_t tableSize = static_cast<uint64_t>(_header.SymbolCount) *
+                               sizeof(SymbolRecordV2);
+
+    bool isValid =
+        (std::memcmp(fileHeader.Signature, SYMBOL_SIGNATURE,
+                     sizeof(fileHeader.Signature)) == 0) &&
+        (fileHeader.Version[0] == 2) && (fileHeader.Version[1] == 0) &&
+        (fileHeader.Version[2] == 0) && (fileHeader.Version[3] == 0) &&
+        (_header.IndexStride > 0) &&
+        (_header.IndexCount == ((static_cast<uint64_t>(_header.SymbolCount) +
+                                 _header.IndexStride - 1) / _header.IndexStride)) &&
+        ((_header.IndexOffset % alignof(uint64_t)) == 0) &&
+        ((_header.SymbolTableOffset % alignof(SymbolRecordV2)) == 0) &&
+        (_header.IndexOffset <= fileSize) &&
+        (indexSize <= fileSize - _header.IndexOffset) &&
+        (_header.SymbolTableOffset <= fileSize) &&
+        (tableSize <= fileSize - _header.SymbolTableOffset) &&
+        (_header.StringTableOffset <= fileSize) &&
+        (_header.StringTableSize <= fileSize - _header.StringTableOffset);
+
+    if (isValid == false)
+    {
+        unmap();
+        return false;
+    }
+
+    _index = offsetPtr<uint64_t>(_fileData, static_cast<size_t>(_header.IndexOffset));
+    _records = offsetPtr<SymbolRecordV2>(_fileData,
+                                         static_cast<size_t>(_header.SymbolTableOffset));
+    _strings = offsetPtr<char>(_fileData, static_cast<size_t>(_header.StringTableOffset));
+
+    return true;
+}
+
+//! @brief Finds the symbol containing an offset within the module.
+//! @param[in] offset The offset of the code within the module.
+//! @return The index of the last symbol record starting at or before
+//! @p offset, or SIZE_MAX if there was none.
+size_t MappedSymbolTable::findSymbol(uintptr_t offset) const
+{
+    if (_index == nullptr)
+        return SIZE_MAX;
+
+    // Find the run of records which contains the offset.
+    const uint64_t *indexEnd = _index + _header.IndexCount;
+    const uint64_t *run = std::upper_bound(_index, indexEnd, static_cast<uint64_t>(offset));
+
+    if (run == _index)
+        return SIZE_MAX;
+
+    size_t first = static_cast<size_t>(run - _index - 1) * _header.IndexStride;
+    size_t last = std::min(first + _header.IndexStride,
+                           static_cast<size_t>(_header.SymbolCount));
+
+    // Find the last record in the run which doesn't start beyond the offset,
+    // the first record in the run is known to qualify.
+    const SymbolRecordV2 *record =
+        std::upper_bound(_records + first, _records + last, static_cast<uint64_t>(offset),
+                         [](uint64_t value, const SymbolRecordV2 &rhs)
+                         {
+                             return value < rhs.Offset;
+                         });
+
+    return static_cast<size_t>(record - _records) - 1;
+}
+
+//! @brief Gets the name of a symbol.
+//! @param[in] symbolId The index of the record returned by findSymbol().
+//! @return The name, or an empty string if the record was corrupt.
+std::string_view MappedSymbolTable::getName(size_t symbolId) const
+{
+    const SymbolRecordV2 &record = _records[symbolId];
+
+    if ((static_cast<uint64_t>(record.NameOffset) + record.NameLength) > _header.StringTableSize)
+        return std::string_view();
+
+    return std::string_view(_strings + record.NameOffset, record.NameLength);
+}
+
+#ifdef _WIN32
+//! @brief Maps the entire contents of a file into memory for reading.
+//! @param[in] symbolFilePath The path to the file to map.
+//! @retval true The file was mapped.
+//! @retval false The file could not be opened or was empty.
+bool MappedSymbolTable::tryMap(const Fs::Path &symbolFilePath)
+{
+    std::wstring widePath = symbolFilePath.toWideString(Fs::PathUsage::Kernel);
+
+    HANDLE file = ::CreateFileW(widePath.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                                nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER size;
+    HANDLE mapping = nullptr;
+
+    if (::GetFileSizeEx(file, &size) && (size.QuadPart > 0))
+        mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    ::CloseHandle(file);
+
+    if (mapping == nullptr)
+        return false;
+
+    // The view keeps the mapping alive once it has been created.
+    void *view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    ::CloseHandle(mapping);
+
+    if (view == nullptr)
+        return false;
+
+    _fileData = static_cast<const uint8_t *>(view);
+    _fileSize = static_cast<size_t>(size.QuadPart);
+
+    return true;
+}
+
+//! @brief Unmaps the file mapped by tryMap(), if any.
+void MappedSymbolTable::unmap()
+{
+    if (_fileData != nullptr)
+        ::UnmapViewOfFile(_fileData);
+
+    _fileData = nullptr;
+    _fileSize = 0;
+    _index = nullptr;
+    _records = nullptr;
+    _strings = nullptr;
+}
+#else
+//! @brief Maps the entire contents of a file into memory for reading.
+//! @param[in] symbolFilePath The path to the file to map.
+//! @retval true The file was mapped.
+//! @retval false The file could not be opened or was empty.
+bool MappedSymbolTable::tryMap(const Fs::Path &symbolFilePath)
+{
+    String pathText = symbolFilePath.toString(Fs::PathUsage::Kernel);
+
+    int fd = ::open(pathText.getUtf8Bytes(), O_RDONLY | O_CLOEXEC);
+
+    if (fd < 0)
+        return false;
+
+    struct stat fileInfo;
+    void *view = MAP_FAILED;
+
+    if ((::fstat(fd, &fileInfo) == 0) && (fileInfo.st_size > 0))
+    {
+        view = ::mmap(nullptr, static_cast<size_t>(fileInfo.st_size), PROT_READ,
+                      MAP_SHARED, fd, 0);
+    }
+
+    // The mapping remains valid after the file is closed.
+    ::close(fd);
+
+    if (view == MAP_FAILED)
+        return false;
+
+    _fileData = static_cast<const uint8_t *>(view);
+    _fileSize = static_cast<size_t>(fileInfo.st_size);
+
+    return true;
+}
+
+//! @brief Unmaps the file mapped by tryMap(), if any.
+void MappedSymbolTable::unmap()
+{
+    if (_fileData != nullptr)
+        ::munmap(const_cast<uint8_t *>(_fileData), _fileSize);
+
+    _fileData = nullptr;
+    _fileSize = 0;
+    _index = nullptr;
+    _records = nullptr;
+    _strings = nullptr;
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// SymbolCache Member Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Gets the decoded symbols of a module, reading them on first use.
+//! @param[in] moduleFilePath The full path to the binary module.
+//! @return The symbols of the module, which may be empty, but never nullptr.
+//! @remarks The symbol file is decoded without holding the lock, so one
+//! slow module doesn't block resolution of others. If two threads race to
+//! decode the same module, the first result stored is shared.
+ModuleSymbolsCPtr SymbolCache::getModuleSymbols(const std::string &moduleFilePath)
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+
+        auto pos = _modules.find(moduleFilePath);
+
+        if (pos != _modules.end())
+            return pos->second;
+    }
+
+    ModuleSymbolsCPtr symbols = loadModuleSymbols(moduleFilePath);
+
+    std::lock_guard<std::mutex> guard(_lock);
+
+    return _modules.try_emplace(moduleFilePath, std::move(symbols)).first->second;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Class Method Definitions
 ////////////////////////////////////////////////////////////////////////////////
@@ -1373,7 +1734,18 @@ void StackTrace::capture(const _CONTEXT *context, size_t pruneEntries /* = 0 */)
     _info = resolveStackTrace(activationRecords.data(), count);
 }
 
-size_t StackTrace::captureCurrentThread(ActivationRecord* stackRecords, size_t count, size_t pruneEntries /*= 0*/)
+#endif
+
+//! @brief Captures the raw activation records of the current thread into a
+//! caller-supplied buffer without allocating memory or resolving symbols.
+//! @param[out] stackRecords The buffer to receive the activation records.
+//! @param[in] count The maximum number of records stackRecords can hold.
+//! @param[in] pruneEntries The count of entries from the top of the stack to
+//! ignore, not including this function.
+//! @returns The count of records written to stackRecords, the stack is
+//! truncated if it is deeper than count.
+size_t StackTrace::captureCurrentThread(ActivationRecord *stackRecords, size_t count,
+                                        size_t pruneEntries /*= 0*/)
 {
 #ifdef _WIN32
     CONTEXT cpuState;
@@ -1382,16 +1754,41 @@ size_t StackTrace::captureCurrentThread(ActivationRecord* stackRecords, size_t c
     // Ensure we prune the current function from the call record.
     return captureActivationRecords(&cpuState, stackRecords, count, pruneEntries + 1);
 #else
-    void** rawPtrs = reinterpret_cast<void**>(stackRecords);
+    static_assert(sizeof(ActivationRecord) == sizeof(void *) * 2,
+                  "Activation records are expected to be two pointers in size.");
 
-    // Use the gcc compiler function to get a raw stack trace.
-    size_t callStackSize = backtrace(rawPtrs, count);
+    if ((stackRecords == nullptr) || (count == 0))
+        return 0;
+
+    // The buffer has room for twice as many raw pointers as records, use it
+    // to gather the raw trace including the entries to be pruned.
+    void **rawPtrs = reinterpret_cast<void **>(stackRecords);
+    size_t skipCount = pruneEntries + 1;
+    size_t rawCapacity = std::min(count * 2, count + skipCount);
+    size_t rawCount = static_cast<size_t>(backtrace(rawPtrs, static_cast<int>(rawCapacity)));
+
+    if (rawCount <= skipCount)
+        return 0;
+
+    size_t recordCount = std::min(rawCount - skipCount, count);
+
+    // Move the pointers which will be kept to the end of the buffer so that
+    // expanding them in ascending order never overwrites one yet to be read.
+    size_t base = (count * 2) - recordCount;
+    std::memmove(rawPtrs + base, rawPtrs + skipCount, recordCount * sizeof(void *));
 
-    // TODO: fix up pointers to activation records IN THE SAME BUFFER.
-#error Not (yet) supported under Linux.
+    for (size_t index = 0; index < recordCount; ++index)
+    {
+        uintptr_t address = reinterpret_cast<uintptr_t>(rawPtrs[base + index]);
+
+        // The addresses will be split into module/offset at a lower level.
+        stackRecords[index].ModuleBase = 0;
+        stackRecords[index].Offset = address;
+    }
+
+    return recordCount;
 #endif
 }
-#endif
 
 //! @brief Assigns a call stack to the object and disables destroy
 //! semantics on it.
@@ -1471,6 +1868,25 @@ void StackTrace::dispose()
 ////////////////////////////////////////////////////////////////////////////////
 // Global Function Definitions
 ////////////////////////////////////////////////////////////////////////////////
+//! @brief Loads the symbols associated with a binary module, preferring a
+//! version 2 symbol file which can be searched in place.
+//! @param[in] moduleFilePath The full path to the binary module.
+//! @return The symbols of the module, which are empty if no valid symbol
+//! file could be found.
+ModuleSymbolsCPtr loadModuleSymbols(const std::string &moduleFilePath)
+{
+    Fs::Path symbolFilePath = getSymbolFilePath(moduleFilePath);
+    auto mappedSymbols = std::make_shared<MappedSymbolTable>();
+
+    if (mappedSymbols->tryOpen(symbolFilePath))
+        return mappedSymbols;
+
+    // Fall back to decoding a version 1 file.
+    auto decodedSymbols = std::make_shared<DecodedSymbolTable>();
+    tryDecodeSymbols(symbolFilePath, *decodedSymbols);
+
+    return decodedSymbols;
+}
 
 #ifdef _WIN32
 
@@ -11,12 +11,19 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Header File Includes
 ////////////////////////////////////////////////////////////////////////////////
+#ifndef _WIN32
+// POSIX Headers required.
+#include <sys/uio.h>
+#endif
+
 #include "CoreInternal.hpp"
+#include "Bz2Blocks.hpp"
 #include "Ag/Core/Binary.hpp"
 #include "Ag/Core/CollectionTools.hpp"
 #include "Ag/Core/Format.hpp"
 #include "Ag/Core/FsDirectory.hpp"
 #include "Ag/Core/InlineMemory.hpp"
+#include "Ag/Core/Instrumentation.hpp"
 #include "Ag/Core/Stream.hpp"
 #include "Ag/Core/Utils.hpp"
 
@@ -120,6 +127,48 @@ struct FileTraits
         return bytesWritten;
     }
 
+    static size_t readScattered(FileDescriptor fd, const MutableByteSpan *buffers,
+                                size_t bufferCount, ErrorCode &errorCode)
+    {
+        // ReadFileScatter() only supports unbuffered page-aligned transfers,
+        // so fill each buffer in turn.
+        size_t bytesRead = 0;
+        errorCode = ERROR_SUCCESS;
+
+        for (size_t index = 0; index < bufferCount; ++index)
+        {
+            const MutableByteSpan &buffer = buffers[index];
+            size_t actuallyRead = read(fd, buffer.Data, buffer.Length, errorCode);
+            bytesRead += actuallyRead;
+
+            if ((errorCode != ERROR_SUCCESS) || (actuallyRead < buffer.Length))
+                break;
+        }
+
+        return bytesRead;
+    }
+
+    static size_t writeGathered(FileDescriptor fd, const ByteSpan *buffers,
+                                size_t bufferCount, ErrorCode &errorCode)
+    {
+        // WriteFileGather() only supports unbuffered page-aligned transfers,
+        // so write each buffer in turn.
+        size_t bytesWritten = 0;
+        errorCode = ERROR_SUCCESS;
+
+        for (size_t index = 0; index < bufferCount; ++index)
+        {
+            const ByteSpan &buffer = buffers[index];
+            size_t actuallyWritten = write(fd, buffer.Data, buffer.Length, errorCode);
+            bytesWritten += actuallyWritten;
+
+            if ((errorCode != ERROR_SUCCESS) || (actuallyWritten < buffer.Length))
+                break;
+        }
+
+        return bytesWritten;
+    }
+
     static bool tryOpen(const Fs::Path &path, FileAccessBits access,
                         FileDescriptor &fd, uintptr_t &errorCode)
     {
@@ -202,6 +251,10 @@ struct FileTraits
     using ErrorCode = int;
     static constexpr FileDescriptor BadFile = -1;
 
+    //! @brief The maximum count of buffers passed to a single vectored
+    //! operation, well within IOV_MAX.
+    static constexpr int MaxVectorCount = 64;
+
     static Exception createError(const std::string_view &fnName,
                                  ErrorCode errorCode)
     {
@@ -252,6 +305,112 @@ struct FileTraits
         }
     }
 
+    static size_t readScattered(FileDescriptor fd, const MutableByteSpan *buffers,
+                                size_t bufferCount, ErrorCode &errorCode)
+    {
+        iovec vectors[MaxVectorCount];
+        size_t bytesRead = 0;
+        size_t index = 0;
+        errorCode = 0;
+
+        while (index < bufferCount)
+        {
+            int vectorCount = 0;
+            size_t batchSize = 0;
+
+            for (; (index < bufferCount) && (vectorCount < MaxVectorCount); ++index)
+            {
+                if (buffers[index].Length > 0)
+                {
+                    vectors[vectorCount].iov_base = buffers[index].Data;
+                    vectors[vectorCount].iov_len = buffers[index].Length;
+                    batchSize += buffers[index].Length;
+                    ++vectorCount;
+                }
+            }
+
+            if (vectorCount == 0)
+                break;
+
+            auto actuallyRead = ::readv(fd, vectors, vectorCount);
+
+            if (actuallyRead < 0)
+            {
+                errorCode = errno;
+                break;
+            }
+
+            bytesRead += static_cast<size_t>(actuallyRead);
+
+            if (static_cast<size_t>(actuallyRead) < batchSize)
+            {
+                // We got as much as we could.
+                break;
+            }
+        }
+
+        return bytesRead;
+    }
+
+    static size_t writeGathered(FileDescriptor fd, const ByteSpan *buffers,
+                                size_t bufferCount, ErrorCode &errorCode)
+    {
+        iovec vectors[MaxVectorCount];
+        size_t bytesWritten = 0;
+        size_t index = 0;
+        errorCode = 0;
+
+        while (index < bufferCount)
+        {
+            int vectorCount = 0;
+
+            for (; (index < bufferCount) && (vectorCount < MaxVectorCount); ++index)
+            {
+                if (buffers[index].Length > 0)
+                {
+                    vectors[vectorCount].iov_base = const_cast<uint8_t *>(buffers[index].Data);
+                    vectors[vectorCount].iov_len = buffers[index].Length;
+                    ++vectorCount;
+                }
+            }
+
+            iovec *pending = vectors;
+
+            while (vectorCount > 0)
+            {
+                auto actuallyWritten = ::writev(fd, pending, vectorCount);
+
+                if (actuallyWritten <= 0)
+                {
+                    // Stop on an error or if the device will take no more.
+                    errorCode = (actuallyWritten < 0) ? errno : 0;
+                    return bytesWritten;
+                }
+
+                bytesWritten += static_cast<size_t>(actuallyWritten);
+
+                // Skip the vectors which were fully written and trim the
+                // first which was partially written, if any.
+                size_t remaining = static_cast<size_t>(actuallyWritten);
+
+                while ((vectorCount > 0) && (remaining >= pending->iov_len))
+                {
+                    remaining -= pending->iov_len;
+                    ++pending;
+                    --vectorCount;
+                }
+
+                if (vectorCount > 0)
+                {
+                    pending->iov_base = static_cast<uint8_t *>(pending->iov_base) + remaining;
+                    pending->iov_len -= remaining;
+                }
+            }
+        }
+
+        return bytesWritten;
+    }
+
     static bool tryOpen(const Fs::Path &path, FileAccessBits access,
                         FileDescriptor &fd, uintptr_t &errorCode)
     {
@@ -423,6 +582,58 @@ public:
         return bytesWritten;
     }
 
+    // Inherited from IStream.
+    virtual size_t readScattered(const MutableByteSpan *targetBuffers,
+                                 size_t bufferCount) override
+    {
+        if (_fd == FileTraits::BadFile)
+        {
+            throw OperationException("Reading from a file which isn't open.");
+        }
+
+        FileTraits::ErrorCode errorCode;
+        size_t bytesRead = FileTraits::readScattered(_fd, targetBuffers,
+                                                     bufferCount, errorCode);
+
+        if (errorCode != 0)
+        {
+            std::string fnName;
+            fnName.assign("file.readScattered('");
+            appendAgString(fnName, _location.toString(Fs::PathUsage::Kernel));
+            fnName.append("')");
+
+            throw FileTraits::createError(fnName, errorCode);
+        }
+
+        return bytesRead;
+    }
+
+    // Inherited from IStream.
+    virtual size_t writeGathered(const ByteSpan *sourceBuffers,
+                                 size_t bufferCount) override
+    {
+        if (_fd == FileTraits::BadFile)
+        {
+            throw OperationException("Writing to a file which isn't open.");
+        }
+
+        FileTraits::ErrorCode errorCode;
+        size_t bytesWritten = FileTraits::writeGathered(_fd, sourceBuffers,
+                                                        bufferCount, errorCode);
+
+        if (errorCode != 0)
+        {
+            std::string fnName;
+            fnName.assign("file.writeGathered('");
+            appendAgString(fnName, _location.toString(Fs::PathUsage::Kernel));
+            fnName.append("')");
+
+            throw FileTraits::createError(fnName, errorCode);
+        }
+
+        return bytesWritten;
+    }
+
     // Inherited from IFileStream.
     virtual const Fs::Path &getPath() const { return _location; }
 };
@@ -537,6 +748,9 @@ public:
     virtual void onBytesCompressed(const uint8_t *compressedBytes,
                                    size_t byteCount) override
     {
+        AG_INSTRUMENT_SAMPLE("Bz2CompressionStream output bytes",
+                             static_cast<int64_t>(byteCount));
+
         if (_innerStream != nullptr)
         {
             _innerStream->write(compressedBytes, byteCount);
@@ -546,6 +760,69 @@ public:
 
 IMPLEMENT_UNIQUE_PTR(IStream);
 
+////////////////////////////////////////////////////////////////////////////////
+// IStream Member Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Reads bytes from the stream into a sequence of buffers.
+//! @param[in] targetBuffers An array of buffers to fill in order.
+//! @param[in] bufferCount The count of elements in @p targetBuffers.
+//! @return The total count of bytes read, which will only be less than the
+//! combined size of the buffers if the stream could provide no more.
+//! @throws Ag::Exception If an error occurs during the read.
+//! @remarks The default implementation calls read() for each buffer in turn.
+//! Streams which access a device directly should override it to fill all
+//! the buffers with as few system calls as possible.
+size_t IStream::readScattered(const MutableByteSpan *targetBuffers, size_t bufferCount)
+{
+    size_t bytesRead = 0;
+
+    for (size_t index = 0; index < bufferCount; ++index)
+    {
+        const MutableByteSpan &buffer = targetBuffers[index];
+
+        if (buffer.isEmpty())
+            continue;
+
+        size_t actuallyRead = read(buffer.Data, buffer.Length);
+        bytesRead += actuallyRead;
+
+        if (actuallyRead < buffer.Length)
+            break;
+    }
+
+    return bytesRead;
+}
+
+//! @brief Writes bytes to the stream from a sequence of buffers.
+//! @param[in] sourceBuffers An array of buffers to write in order.
+//! @param[in] bufferCount The count of elements in @p sourceBuffers.
+//! @return The total count of bytes written, which will only be less than the
+//! combined size of the buffers if the stream could accept no more.
+//! @throws Ag::Exception If an error occurs during the write.
+//! @remarks The default implementation calls write() for each buffer in turn.
+//! Streams which access a device directly should override it to write all
+//! the buffers with as few system calls as possible.
+size_t IStream::writeGathered(const ByteSpan *sourceBuffers, size_t bufferCount)
+{
+    size_t bytesWritten = 0;
+
+    for (size_t index = 0; index < bufferCount; ++index)
+    {
+        const ByteSpan &buffer = sourceBuffers[index];
+
+        if (buffer.isEmpty())
+            continue;
+
+        size_t actuallyWritten = write(buffer.Data, buffer.Length);
+        bytesWritten += actuallyWritten;
+
+        if (actuallyWritten < buffer.Length)
+            break;
+    }
+
+    return bytesWritten;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // BufferedStream Member Definitions
 ////////////////////////////////////////////////////////////////////////////////
@@ -816,9 +1093,18 @@ Bz2CompressionStream::Bz2CompressionStream(IStream *outputStream,
 }
 
 Bz2CompressionStream::~Bz2CompressionStream()
+{
+    close();
+}
+
+//! @brief Writes any remaining compressed data and the end of stream marker
+//! to the output stream. No more data can be written after the call.
+void Bz2CompressionStream::close()
 {
     if (_context != nullptr)
     {
+        AG_INSTRUMENT_ZONE("Bz2CompressionStream::close");
+
         _context->finishCompression();
 
         _context = nullptr;
@@ -856,6 +1142,8 @@ size_t Bz2CompressionStream::write(const void *sourceBuffer, size_t sourceByteCo
 
     if (_context != nullptr)
     {
+        AG_INSTRUMENT_ZONE("Bz2CompressionStream::write");
+
         bytesWritten = _context->compress(sourceBuffer, sourceByteCount);
     }
 
@@ -971,12 +1259,131 @@ bool Bz2DecompressionStream::tryFillInputBuffer()
     size_t maxCompressedBytes;
     void *buffer = _compressedData.lockProduceable(maxCompressedBytes);
 
-    size_t compressedBytesRead = _innerStream->read(buffer, maxCompressedBytes);
+    if (_maxBytesToRead >= 0)
+    {
+        // Don't read beyond the end of the compressed data.
+        maxCompressedBytes = static_cast<size_t>(std::min(static_cast<int64_t>(maxCompressedBytes),
+                                                          _maxBytesToRead - _compressedBytesRead));
+    }
+
+    size_t compressedBytesRead = (maxCompressedBytes > 0) ?
+                                 _innerStream->read(buffer, maxCompressedBytes) : 0;
     _compressedData.unlockProduceable(compressedBytesRead);
+    _compressedBytesRead += static_cast<int64_t>(compressedBytesRead);
 
     return compressedBytesRead > 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// ParallelBz2CompressionStream Member Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Constructs a stream which compresses blocks of data in parallel.
+//! @param[in] outputStream The stream to write compressed data to.
+//! @param[in] threadCount The count of worker threads, 0 for one per
+//! hardware thread.
+//! @param[in] compressionLevel The bzip2 compression level, 1 - 9.
+//! @param[in] workFactor The bzip2 work factor, 0 - 250.
+ParallelBz2CompressionStream::ParallelBz2CompressionStream(IStream *outputStream,
+                                                           size_t threadCount /*= 0*/,
+                                                           int compressionLevel /*= 9*/,
+                                                           int workFactor /*= 30*/) :
+    _compressor(std::make_unique<Bz2::ParallelCompressor>(outputStream, threadCount,
+                                                          compressionLevel,
+                                                          workFactor))
+{
+}
+
+ParallelBz2CompressionStream::~ParallelBz2CompressionStream()
+{
+    try
+    {
+        close();
+    }
+    catch (...)
+    {
+        // Destructors shouldn't throw, call close() to see errors.
+    }
+}
+
+//! @brief Compresses any buffered data and terminates the compressed stream.
+//! @throws Bz2Exception If compression fails.
+void ParallelBz2CompressionStream::close()
+{
+    _compressor->finish();
+}
+
+// Inherited from IStream.
+bool ParallelBz2CompressionStream::isBuffered() const
+{
+    return true;
+}
+
+// Inherited from IStream.
+void ParallelBz2CompressionStream::flush()
+{
+    _compressor->flush();
+}
+
+// Inherited from IStream.
+size_t ParallelBz2CompressionStream::read(void */*targetBuffer*/, size_t /*requiredByteCount*/)
+{
+    throw NotSupportedException("Reading for a compression writer stream.");
+}
+
+// Inherited from IStream.
+size_t ParallelBz2CompressionStream::write(const void *sourceBuffer, size_t sourceByteCount)
+{
+    return _compressor->write(sourceBuffer, sourceByteCount);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ParallelBz2DecompressionStream Member Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Constructs a stream which decompresses blocks of data in parallel.
+//! @param[in] inputStream The stream to read compressed data from.
+//! @param[in] threadCount The count of worker threads, 0 for one per
+//! hardware thread.
+ParallelBz2DecompressionStream::ParallelBz2DecompressionStream(IStream *inputStream,
+                                                               size_t threadCount /*= 0*/) :
+    _decompressor(std::make_unique<Bz2::ParallelDecompressor>(inputStream, threadCount))
+{
+}
+
+ParallelBz2DecompressionStream::~ParallelBz2DecompressionStream() = default;
+
+// Inherited from IStream.
+bool ParallelBz2DecompressionStream::isBuffered() const
+{
+    return true;
+}
+
+// Inherited from IStream.
+void ParallelBz2DecompressionStream::flush()
+{
+}
+
+// Inherited from IStream.
+size_t ParallelBz2DecompressionStream::read(void *targetBuffer, size_t requiredByteCount)
+{
+    return _decompressor->read(targetBuffer, requiredByteCount);
+}
+
+// Inherited from IStream.
+size_t ParallelBz2DecompressionStream::write(const void */*sourceBuffer*/, size_t /*sourceByteCount*/)
+{
+    throw NotSupportedException("Writing to a decompression stream.");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Global Function Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Throws an exception describing an error reported by the bz2 library.
+//! @param[in] fnName The name of the bz2 function which failed.
+//! @param[in] errorCode The error code the function returned.
+void throwBz2Error(const char *fnName, int errorCode)
+{
+    throw Bz2Exception(fnName, errorCode);
+}
 
 } // namespace Ag
 ////////////////////////////////////////////////////////////////////////////////
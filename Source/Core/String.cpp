@@ -10,13 +10,16 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Header File Includes
 ////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
 #include <cstring>
 #include <cwchar>
 #include <cwctype>
 #include <mutex>
+#include <new>
 #include <unordered_set>
 
 #include "StringPrivate.hpp"
+#include "UtfKernels.hpp"
 #include "Win32API.hpp"
 #include "Ag/Core/Format.hpp"
 #include "Ag/Core/ScalarParser.hpp"
@@ -131,24 +134,17 @@ private:
 
     // Internal Fields
     StringPrivateSet _allStrings;
-    StringPrivateSPtr _emptyStringPtr;
     std::mutex _globalLock;
 
 public:
     // Construction/Destruction
     //! @brief Constructs an empty pool or reference counted strings.
-    StringPool() :
-        _emptyStringPtr(std::make_shared<StringPrivate>())
-    {
-    }
+    StringPool() = default;
 
     StringPool(const StringPool &) = delete;
     StringPool(StringPool &&) = delete;
     virtual ~StringPool() = default;
 
-    // Accessors
-    StringPrivateSPtr getEmptyString() { return _emptyStringPtr; }
-
     // Operations
     StringPool &operator=(StringPool &&) = delete;
     StringPool &operator=(const StringPool &) = delete;
@@ -158,7 +154,7 @@ public:
     //! @param[in] str The string to dispose of.
     void destroyString(StringPrivatePtr str)
     {
-        if ((str != nullptr) && (str != _emptyStringPtr.get()))
+        if (str != nullptr)
         {
             // Claim the lock.
             MutexGuard guard(_globalLock);
@@ -174,44 +170,38 @@ public:
 
     //! @brief Gets the shared value of an immutable string identified by a key.
     //! @param[in] key The key giving the UTF-8 value of the immutable string
-    //! to obtain.
+    //! to obtain. If the value is added to the pool, any data the key owns
+    //! is moved into the new value.
     //! @return A shared pointer to a string value in the global pool.
-    StringPrivateSPtr getString(const StringPrivate &key)
+    StringPrivateSPtr getString(StringPrivate &&key)
     {
         StringPrivateSPtr str;
 
-        if (key.isEmpty())
+        // Claim the lock.
+        MutexGuard guard(_globalLock);
+
+        auto pos = _allStrings.find(&key);
+
+        if (pos == _allStrings.end())
         {
-            str = _emptyStringPtr;
+            // Dynamically allocate a shared string value object.
+            str = std::make_shared<StringPrivate>(std::move(key));
+
+            // Keep a copy in the index. It's lifetime will be governed by
+            // the use of the shared pointer out in the wild.
+            _allStrings.insert(str.get());
         }
         else
         {
-            // Claim the lock.
-            MutexGuard guard(_globalLock);
-
-            auto pos = _allStrings.find(&key);
-
-            if (pos == _allStrings.end())
-            {
-                // Dynamically allocate a shared string value object.
-                str = std::make_shared<StringPrivate>(key);
-
-                // Keep a copy in the index. It's lifetime will be governed by
-                // the use of the shared pointer out in the wild.
-                _allStrings.insert(str.get());
-            }
-            else
-            {
-                // Replicate the shared pointer already out in the wild.
-                str = const_cast<StringPrivatePtr>(*pos)->shared_from_this();
-            }
+            // Replicate the shared pointer already out in the wild.
+            str = const_cast<StringPrivatePtr>(*pos)->shared_from_this();
         }
 
         return str;
     }
 };
 
-void processScalarCharacters(ScalarParser &parser, const std::string &source)
+void processScalarCharacters(ScalarParser &parser, const std::string_view &source)
 {
     bool isLeading = true;
 
@@ -237,6 +227,50 @@ void processScalarCharacters(ScalarParser &parser, const std::string &source)
     }
 }
 
+//! @brief Attempts to parse a plain number without the overhead of the
+//! ScalarParser state machine.
+//! @param[in] text The text to parse.
+//! @param[out] scalar Receives the value parsed.
+//! @param[in] radix The radix of integer digits.
+//! @retval true The text contained a complete value in the neutral format.
+//! @retval false The text must be parsed by ScalarParser, it may contain
+//! thousand separators, an unusual format or an invalid value.
+template<typename T>
+bool tryParseScalarFast(std::string_view text, T &scalar, int radix)
+{
+    size_t start = 0;
+
+    while ((start < text.length()) && (std::isspace(text[start]) != 0))
+    {
+        ++start;
+    }
+
+    text.remove_prefix(start);
+
+    T value;
+    size_t length;
+
+    if constexpr (std::is_integral_v<T>)
+    {
+        length = parseScalarPrefix(text, value, radix);
+    }
+    else
+    {
+        length = parseScalarPrefix(text, value);
+    }
+
+    // Only accept the value if the state machine could not have continued
+    // it, e.g. with a thousand separator.
+    if ((length > 0) &&
+        ((length == text.length()) || (std::isspace(text[length]) != 0)))
+    {
+        scalar = value;
+        return true;
+    }
+
+    return false;
+}
+
 //! @brief Converts a scalar to a printable hexadecimal digit.
 //! @param[in] value The scalar to convert (0-15).
 //! @return The value rendered as a single hex digit.
@@ -256,8 +290,13 @@ char toHexDigit(uint32_t value)
 //! of appropriate size.
 //! @retval false The string did not represent a valid integer value.
 template<typename T, std::enable_if_t<std::is_integral_v<T>, bool> = true>
-bool tryParseScalarInternal(const std::string &text, int radix, T &scalar)
+bool tryParseScalarInternal(const std::string_view &text, int radix, T &scalar)
 {
+    if (tryParseScalarFast(text, scalar, radix))
+    {
+        return true;
+    }
+
     ScalarParser parser;
     parser.enableSign(true);
     parser.enableExponent(false);
@@ -278,8 +317,13 @@ bool tryParseScalarInternal(const std::string &text, int radix, T &scalar)
 //! of appropriate size.
 //! @retval false The string did not represent a valid real value.
 template<typename T, std::enable_if_t<std::is_floating_point_v<T>, bool> = true>
-bool tryParseScalarInternal(const std::string &text, T &scalar)
+bool tryParseScalarInternal(const std::string_view &text, T &scalar)
 {
+    if (tryParseScalarFast(text, scalar, 10))
+    {
+        return true;
+    }
+
     ScalarParser parser;
     parser.enableSign(true);
     parser.enableExponent(true);
@@ -372,7 +416,7 @@ String transform(const String &text, wint_t (*transformFn)(wint_t))
 
         if (isDifferent)
         {
-            return String(buffer);
+            return String(std::move(buffer));
         }
         else
         {
@@ -387,11 +431,10 @@ String transform(const String &text, wint_t (*transformFn)(wint_t))
 // Member Functions
 ///////////////////////////////////////////////////////////////////////////////
 //! @brief Constructs an iterator representing a position within a string.
-//! @param[in] source The inner string data.
+//! @param[in] source The string being iterated over.
 //! @param[in] offset The offset in bytes into the string of the beginning of
 //! the next code point.
-String::iterator::iterator(const std::shared_ptr<StringPrivate> &source,
-                             size_t offset) :
+String::iterator::iterator(const String &source, size_t offset) :
     _source(source),
     _offset(offset),
     _cachedEncodedLength(0),
@@ -466,7 +509,7 @@ String::iterator &String::iterator::operator++()
         else
         {
             // Set to the end of the string.
-            _offset = _source->getUTF8Length();
+            _offset = _source.getUtf8Length();
         }
     }
 
@@ -498,7 +541,7 @@ String::iterator String::iterator::operator++(int)
         else
         {
             // Set to the end of the string.
-            _offset = _source->getUTF8Length();
+            _offset = _source.getUtf8Length();
         }
     }
 
@@ -556,7 +599,7 @@ String::iterator String::iterator::operator--(int)
 //! different strings.
 bool String::iterator::operator==(const String::iterator &rhs) const
 {
-    return (rhs._offset == _offset) && (rhs._source.get() == rhs._source.get());
+    return (rhs._offset == _offset) && (rhs._source == _source);
 }
 
 //! @brief Determines whether an iterator identifies a different code point
@@ -567,7 +610,7 @@ bool String::iterator::operator==(const String::iterator &rhs) const
 //! different strings.
 bool String::iterator::operator!=(const String::iterator &rhs) const
 {
-    return (rhs._offset != _offset) || (rhs._source.get() != rhs._source.get());
+    return (rhs._offset != _offset) || (rhs._source != _source);
 }
 
 //! @brief Returns the byte offset into the UTF-8 string of the first
@@ -581,7 +624,7 @@ size_t String::iterator::getOffset() const
 //! of the string.
 bool String::iterator::isPastEnd() const
 {
-    return _offset >= _source->getUTF8Length();
+    return _offset >= _source.getUtf8Length();
 }
 
 //! @brief Ensures the cached Unicode code point information relating to the byte
@@ -592,14 +635,13 @@ void String::iterator::ensureCacheValid() const
     {
         _cachedValue = 0;
         _cachedEncodedLength = 0;
-        const std::string &data = _source->getData();
-        size_t max = data.length();
+        size_t max = _source.getUtf8Length();
 
-        if (_offset < data.length())
+        if (_offset < max)
         {
             Utf::FromUtf8Converter  converter;
             bool hasError = false;
-            uint8_cptr_t dataBytes = reinterpret_cast<uint8_cptr_t>(data.c_str());
+            uint8_cptr_t dataBytes = reinterpret_cast<uint8_cptr_t>(_source.getUtf8Bytes());
 
             for (size_t pos = _offset; (hasError == false) && (pos < max); ++pos)
             {
@@ -625,10 +667,10 @@ void String::iterator::ensureCacheValid() const
 bool String::iterator::tryAdvance(size_t &nextOffset) const
 {
     Utf::FromUtf8Converter  converter;
-    size_t max = _source->getData().length();
+    size_t max = _source.getUtf8Length();
     bool hasError = false;
     bool hasNext = false;
-    uint8_cptr_t data = reinterpret_cast<uint8_cptr_t>(_source->getData().c_str());
+    uint8_cptr_t data = reinterpret_cast<uint8_cptr_t>(_source.getUtf8Bytes());
 
     for (size_t pos = nextOffset; (hasError == false) && (pos < max); ++pos)
     {
@@ -653,7 +695,7 @@ bool String::iterator::tryRetreat(size_t &previousOffset) const
 {
     bool hasPrevious = false;
 
-    uint8_cptr_t data = reinterpret_cast<uint8_cptr_t>(_source->getData().c_str());
+    uint8_cptr_t data = reinterpret_cast<uint8_cptr_t>(_source.getUtf8Bytes());
 
     for (size_t pos = previousOffset; pos > 0; --pos)
     {
@@ -672,9 +714,9 @@ bool String::iterator::tryRetreat(size_t &previousOffset) const
 }
 
 //! @brief Creates an empty string value.
-String::String() :
-    _str(getGlobalPool().getEmptyString())
+String::String()
 {
+    initialiseInline(nullptr, 0);
 }
 
 //! @brief Constructs a string value from a null-terminated array of UTF-8
@@ -684,7 +726,7 @@ String::String(utf8_cptr_t nullTerminatedUtf8)
 {
     StringPrivate key(nullTerminatedUtf8);
 
-    _str = getGlobalPool().getString(key);
+    initialise(std::move(key));
 }
 
 //! @brief Constructs a string value from a bounded array of UTF-8 encoded bytes.
@@ -695,7 +737,7 @@ String::String(utf8_cptr_t boundedUtf8, size_t byteCount)
 {
     StringPrivate key(boundedUtf8, byteCount);
 
-    _str = getGlobalPool().getString(key);
+    initialise(std::move(key));
 }
 
 //! @brief Constructs a string value from a null-terminated array of UTF-16
@@ -705,7 +747,7 @@ String::String(utf16_cptr_t nullTerminatedUtf16)
 {
     StringPrivate key(nullTerminatedUtf16);
 
-    _str = getGlobalPool().getString(key);
+    initialise(std::move(key));
 }
 
 //! @brief Constructs a string value from a bounded array of UTF-16 encoded words.
@@ -716,7 +758,7 @@ String::String(utf16_cptr_t boundedUtf16, size_t wordCount)
 {
     StringPrivate key(boundedUtf16, wordCount);
 
-    _str = getGlobalPool().getString(key);
+    initialise(std::move(key));
 }
 
 //! @brief Constructs a string value from a null-terminated array of UTF-32
@@ -727,7 +769,7 @@ String::String(utf32_cptr_t nullTerminatedUtf32)
 {
     StringPrivate key(nullTerminatedUtf32);
 
-    _str = getGlobalPool().getString(key);
+    initialise(std::move(key));
 }
 
 //! @brief Constructs a string value from a bounded array of Unicode code points.
@@ -738,7 +780,7 @@ String::String(utf32_cptr_t boundedUtf32, size_t codePointCount)
 {
     StringPrivate key(boundedUtf32, codePointCount);
 
-    _str = getGlobalPool().getString(key);
+    initialise(std::move(key));
 }
 
 //! @brief Constructs a string value from a null-terminated array of
@@ -749,7 +791,7 @@ String::String(wchar_cptr_t nullTerminatedWide)
 {
     StringPrivate key(nullTerminatedWide);
 
-    _str = getGlobalPool().getString(key);
+    initialise(std::move(key));
 }
 
 //! @brief Constructs a string value from a bounded array of wide characters.
@@ -760,7 +802,7 @@ String::String(wchar_cptr_t boundedWide, size_t charCount)
 {
     StringPrivate key(boundedWide, charCount);
 
-    _str = getGlobalPool().getString(key);
+    initialise(std::move(key));
 }
 
 //! @brief Constructs an immutable UTF-8 encoded string value from a mutable
@@ -771,7 +813,7 @@ String::String(const std::string_view &stlUtf8StringView)
     StringPrivate key(stlUtf8StringView.data(),
                       stlUtf8StringView.length());
 
-    _str = getGlobalPool().getString(key);
+    initialise(std::move(key));
 }
 
 //! @brief Constructs an immutable UTF-8 encoded string value from a mutable
@@ -781,7 +823,18 @@ String::String(const std::string &stlUtf8String)
 {
     StringPrivate key(stlUtf8String.c_str(), stlUtf8String.length());
 
-    _str = getGlobalPool().getString(key);
+    initialise(std::move(key));
+}
+
+//! @brief Constructs an immutable UTF-8 encoded string value by taking the
+//! contents of a mutable STL string, avoiding a copy of long values.
+//! @param[in] stlUtf8String The STL string to take the value of, which is
+//! left in an unspecified state.
+String::String(std::string &&stlUtf8String)
+{
+    StringPrivate key(std::move(stlUtf8String));
+
+    initialise(std::move(key));
 }
 
 //! @brief Constructs an immutable UTF-8 encoded string value from a mutable
@@ -791,7 +844,7 @@ String::String(const std::u16string_view &stlUtf16View)
 {
     StringPrivate key(stlUtf16View.data(), stlUtf16View.length());
 
-    _str = getGlobalPool().getString(key);
+    initialise(std::move(key));
 }
 
 //! @brief Constructs an immutable UTF-8 encoded string value from a mutable
@@ -801,7 +854,7 @@ String::String(const std::u16string &stlUtf16String)
 {
     StringPrivate key(stlUtf16String.c_str(), stlUtf16String.length());
 
-    _str = getGlobalPool().getString(key);
+    initialise(std::move(key));
 }
 
 //! @brief Constructs an immutable UTF-8 encoded string value from a mutable
@@ -811,7 +864,7 @@ String::String(const std::u32string_view &stlUtf32View)
 {
     StringPrivate key(stlUtf32View.data(), stlUtf32View.length());
 
-    _str = getGlobalPool().getString(key);
+    initialise(std::move(key));
 }
 
 //! @brief Constructs an immutable UTF-8 encoded string value from a mutable
@@ -821,7 +874,7 @@ String::String(const std::u32string &stlUtf32String)
 {
     StringPrivate key(stlUtf32String.c_str(), stlUtf32String.length());
 
-    _str = getGlobalPool().getString(key);
+    initialise(std::move(key));
 }
 
 //! @brief Constructs an immutable UTF-8 encoded string value from a mutable
@@ -831,7 +884,7 @@ String::String(const std::wstring_view &stlWideView)
 {
     StringPrivate key(stlWideView.data(), stlWideView.length());
 
-    _str = getGlobalPool().getString(key);
+    initialise(std::move(key));
 }
 
 //! @brief Constructs an immutable UTF-8 encoded string value from a mutable
@@ -841,7 +894,31 @@ String::String(const std::wstring &stlWideString)
 {
     StringPrivate key(stlWideString.c_str(), stlWideString.length());
 
-    _str = getGlobalPool().getString(key);
+    initialise(std::move(key));
+}
+
+//! @brief Constructs a string value which shares the value of another.
+//! @param[in] rhs The string to copy.
+String::String(const String &rhs)
+{
+    initialiseCopy(rhs);
+}
+
+//! @brief Constructs a string value by taking the value of another, leaving
+//! it empty.
+//! @param[in] rhs The string to take the value of.
+String::String(String &&rhs) noexcept
+{
+    initialiseMove(std::move(rhs));
+}
+
+//! @brief Releases the reference to any shared string value.
+String::~String()
+{
+    if (isInline() == false)
+    {
+        getShared().~SharedPtr();
+    }
 }
 
 //! @brief Indicates whether the string contains no characters.
@@ -849,31 +926,61 @@ String::String(const std::wstring &stlWideString)
 //! @retval false The string contains at least one character.
 bool String::isEmpty() const
 {
-    return _str->isEmpty();
+    return isInline() ? (_storage[StorageSize - 1] == 0) :
+                        getShared()->isEmpty();
 }
 
 //! @brief Gets the hash code calculated from the value of the string.
 size_t String::getHashCode() const
 {
-    return _str->getHashCode();
+    if (isInline())
+    {
+        // Calculate the hash of short values on demand.
+        return hashUtf8(_storage, getUtf8Length());
+    }
+
+    return getShared()->getHashCode();
 }
 
 //! @brief Gets the length of the string in it's native UTF-8 encoding in bytes.
 size_t String::getUtf8Length() const
 {
-    return _str->getUTF8Length();
+    return isInline() ? static_cast<uint8_t>(_storage[StorageSize - 1]) :
+                        getShared()->getUTF8Length();
 }
 
 //! @brief Gets count of 16-bit UTF-16 words required to represent the string.
 size_t String::getUtf16Length() const
 {
-    return _str->getUTF16Length();
+    if (isInline())
+    {
+        // Calculate the length of short values on demand, they were
+        // validated on construction.
+        Utf::Utf8Metrics metrics;
+        Utf::tryMeasureUtf8(reinterpret_cast<uint8_cptr_t>(_storage),
+                            getUtf8Length(), metrics);
+
+        return metrics.Utf16Length;
+    }
+
+    return getShared()->getUTF16Length();
 }
 
 //! @brief Gets the count of Unicode code points which the string represents.
 size_t String::getUtf32Length() const
 {
-    return _str->getUTF32Length();
+    if (isInline())
+    {
+        // Calculate the length of short values on demand, they were
+        // validated on construction.
+        Utf::Utf8Metrics metrics;
+        Utf::tryMeasureUtf8(reinterpret_cast<uint8_cptr_t>(_storage),
+                            getUtf8Length(), metrics);
+
+        return metrics.Utf32Length;
+    }
+
+    return getShared()->getUTF32Length();
 }
 
 //! @brief Gets the count of wide characters which is required to represent
@@ -881,9 +988,9 @@ size_t String::getUtf32Length() const
 size_t String::getWideLength() const
 {
 #ifdef WCHAR_IS_32BIT
-    return _str->getUTF32Length();
+    return getUtf32Length();
 #else
-    return _str->getUTF16Length();
+    return getUtf16Length();
 #endif
 }
 
@@ -892,7 +999,7 @@ size_t String::getWideLength() const
 //! @note Unlike other length value, this value is calculated, not cached.
 size_t String::getPrintLength() const
 {
-    uint8_cptr_t text = reinterpret_cast<uint8_cptr_t>(_str->getData().c_str());
+    uint8_cptr_t text = reinterpret_cast<uint8_cptr_t>(getUtf8Bytes());
     Utf::FromUtf8Converter fromUtf8;
     Utf::ToWideConverter toWide;
     size_t printable = 0;
@@ -900,7 +1007,7 @@ size_t String::getPrintLength() const
     wchar_t wideChar = 0;
     bool hasErrors = false;
 
-    for (size_t index = 0, count = _str->getData().length(); index < count; ++index)
+    for (size_t index = 0, count = getUtf8Length(); index < count; ++index)
     {
         if (fromUtf8.tryConvert(text[index], codePoint, hasErrors))
         {
@@ -927,14 +1034,15 @@ size_t String::getPrintLength() const
 //! UTF-8 encoded bytes.
 utf8_cptr_t String::getUtf8Bytes() const
 {
-    return _str->getData().c_str();
+    return isInline() ? _storage : getShared()->getUTF8Bytes();
 }
 
 //! @brief Gets the reference count of the shared string value.
-//! @note This member function is for testing purposes only!
+//! @note This member function is for testing purposes only! Short values
+//! stored in-line are not shared and always report a single reference.
 long String::getReferenceCount() const
 {
-    return _str.use_count();
+    return isInline() ? 1 : getShared().use_count();
 }
 
 //! @brief Determines if the current string contains another as some or all of
@@ -947,13 +1055,13 @@ bool String::contains(utf8_cptr_t rhsUtf8) const
 {
     bool isRhsEmpty = Utf::isNullOrEmpty(rhsUtf8);
 
-    if (_str->isEmpty() || isRhsEmpty)
+    if (isEmpty() || isRhsEmpty)
     {
         return true;
     }
     else
     {
-        return _str->getData().find(rhsUtf8) != std::string::npos;
+        return getView().find(rhsUtf8) != std::string_view::npos;
     }
 }
 
@@ -964,7 +1072,7 @@ bool String::contains(utf8_cptr_t rhsUtf8) const
 //! @retval false The string rhs does not appear in the current string.
 bool String::contains(const std::string_view &rhsUtf8) const
 {
-    if (_str->isEmpty())
+    if (isEmpty())
     {
         return rhsUtf8.empty();
     }
@@ -974,7 +1082,7 @@ bool String::contains(const std::string_view &rhsUtf8) const
     }
     else
     {
-        return _str->getData().find(rhsUtf8) != std::string::npos;
+        return getView().find(rhsUtf8) != std::string_view::npos;
     }
 }
 
@@ -985,17 +1093,17 @@ bool String::contains(const std::string_view &rhsUtf8) const
 //! @retval false The string rhs does not appear in the current string.
 bool String::contains(const String &rhs) const
 {
-    if (_str->isEmpty())
+    if (isEmpty())
     {
-        return rhs._str->isEmpty();
+        return rhs.isEmpty();
     }
-    else if (rhs._str->isEmpty())
+    else if (rhs.isEmpty())
     {
         return true;
     }
     else
     {
-        return _str->getData().find(rhs._str->getData()) != std::string::npos;
+        return getView().find(rhs.getView()) != std::string_view::npos;
     }
 }
 
@@ -1003,14 +1111,14 @@ bool String::contains(const String &rhs) const
 //! char32_t code point in the string.
 String::iterator String::begin() const
 {
-    return iterator(_str, 0);
+    return iterator(*this, 0);
 }
 
 //! @brief Gets the iterator representing the position just past the last
 //! char32_t code point in the string.
 String::iterator String::end() const
 {
-    return iterator(_str, _str->getUTF8Length());
+    return iterator(*this, getUtf8Length());
 }
 
 //! @brief Searches for the first occurrence of a specified Unicode code point.
@@ -1027,12 +1135,12 @@ String::iterator String::find(char32_t character) const
     UTF8CodePoint codePoint(character);
 
     // Search for the encoded sequence of bytes.
-    const std::string &source = _str->getData();
+    std::string_view source = getView();
 
     size_t offset = source.find(codePoint.getEncoding(), 0,
                                 codePoint.getLength());
 
-    return iterator(_str, (offset == std::string::npos) ? source.length() : offset);
+    return iterator(*this, (offset == std::string_view::npos) ? source.length() : offset);
 }
 
 //! @brief Searches for the next occurrence of a specified Unicode code point
@@ -1047,7 +1155,7 @@ String::iterator String::find(const String::iterator from,
     {
         //throw UnicodeConversionException(GET_CURRENT_LOCATION(), character);
     }
-    else if (from._source != _str)
+    else if (from._source != *this)
     {
         //throw PrimitiveArgumentException(GET_CURRENT_LOCATION(), "from");
     }
@@ -1056,12 +1164,12 @@ String::iterator String::find(const String::iterator from,
     UTF8CodePoint codePoint(character);
 
     // Search for the encoded sequence of bytes.
-    const std::string &source = _str->getData();
+    std::string_view source = getView();
 
     size_t offset = source.find(codePoint.getEncoding(), from._offset,
                                 codePoint.getLength());
 
-    return iterator(_str, (offset == std::string::npos) ? source.length() : offset);
+    return iterator(*this, (offset == std::string_view::npos) ? source.length() : offset);
 }
 
 //! @brief Searches for the last occurrence of a specified Unicode code point.
@@ -1078,22 +1186,22 @@ String::iterator String::reverseFind(char32_t character) const
     UTF8CodePoint codePoint(character);
 
     // Search backward for the encoded sequence of bytes.
-    const std::string &source = _str->getData();
-    size_t offset = std::string::npos;
+    std::string_view source = getView();
+    size_t offset = std::string_view::npos;
 
     if (codePoint.getLength() == 1)
     {
         // Quickly search for a single byte.
-        offset = source.rfind(*codePoint.getEncoding(), std::string::npos);
+        offset = source.rfind(*codePoint.getEncoding(), std::string_view::npos);
     }
     else
     {
         // Search more slowly for an encoded sub-string.
-        offset = source.rfind(codePoint.getEncoding(), std::string::npos,
+        offset = source.rfind(codePoint.getEncoding(), std::string_view::npos,
                               codePoint.getLength());
     }
 
-    return iterator(_str, (offset == std::string::npos) ? source.length() : offset);
+    return iterator(*this, (offset == std::string_view::npos) ? source.length() : offset);
 }
 
 //! @brief Searches backward for the previous occurrence of a specified Unicode
@@ -1108,7 +1216,7 @@ String::iterator String::reverseFind(const String::iterator from,
     {
         // throw UnicodeConversionException(GET_CURRENT_LOCATION(), character);
     }
-    else if (from._source != _str)
+    else if (from._source != *this)
     {
         // throw PrimitiveArgumentException(GET_CURRENT_LOCATION(), "from");
     }
@@ -1117,12 +1225,12 @@ String::iterator String::reverseFind(const String::iterator from,
     UTF8CodePoint codePoint(character);
 
     // Search backward for the encoded sequence of bytes.
-    const std::string &source = _str->getData();
+    std::string_view source = getView();
 
     size_t offset = source.rfind(codePoint.getEncoding(), from._offset,
                                  codePoint.getLength());
 
-    return iterator(_str, (offset == std::string::npos) ? source.length() : offset);
+    return iterator(*this, (offset == std::string_view::npos) ? source.length() : offset);
 }
 
 //! @brief Creates a UTF-8 string value by converting a string from the current
@@ -1135,7 +1243,7 @@ String String::fromNativeCodePage(const char *nativeString)
 
     Utf::appendNative(buffer, nativeString);
 
-    return String(buffer);
+    return String(std::move(buffer));
 }
 
 //! @brief Processes a format specification in order to create a string
@@ -1154,7 +1262,7 @@ String String::format(utf8_cptr_t spec,
 
     appendFormat(neutralFormat, specView, buffer, params);
 
-    return String(buffer);
+    return String(std::move(buffer));
 }
 
 //! @brief Processes a format specification in order to create a string
@@ -1171,7 +1279,7 @@ String String::format(const FormatInfo &format, utf8_cptr_t spec,
 
     appendFormat(format, specView, buffer, params);
 
-    return String(buffer);
+    return String(std::move(buffer));
 }
 
 //! @brief Processes a format specification in order to create a string
@@ -1190,7 +1298,7 @@ String String::format(const String &spec,
 
     appendFormat(neutralFormat, specView, buffer, params);
 
-    return String(buffer);
+    return String(std::move(buffer));
 }
 
 //! @brief Processes a format specification in order to create a string
@@ -1207,7 +1315,7 @@ String String::format(const FormatInfo &format, const String &spec,
 
     appendFormat(format, specView, buffer, params);
 
-    return String(buffer);
+    return String(std::move(buffer));
 }
 
 //! @brief Converts an Unicode character into a printable representation,
@@ -1246,7 +1354,7 @@ String String::formatUcsNonPrintable(char32_t ch)
         // Reverse the entire string.
         std::reverse(buffer.begin(), buffer.end());
 
-        return String(buffer);
+        return String(std::move(buffer));
     }
     else
     {
@@ -1275,7 +1383,7 @@ String String::formatAsciiNonPrintable(char ch)
         buffer.push_back(toHexDigit(static_cast<uint8_t>(ch) & 0x0F));
     }
 
-    return String(buffer);
+    return String(std::move(buffer));
 }
 
 
@@ -1285,9 +1393,22 @@ String String::formatAsciiNonPrintable(char ch)
 //! @retval false The rhs string differs from the current one.
 bool String::operator==(const String &rhs) const
 {
-    // If the inner pointers are identical, the String instances reference the
-    // same globally unique inner string.
-    return _str.get() == rhs._str.get();
+    bool isEqual = false;
+
+    if (isInline())
+    {
+        // Values short enough to be stored in-line never appear in the global
+        // pool, so only compare the characters of in-line values.
+        isEqual = rhs.isInline() && (getView() == rhs.getView());
+    }
+    else if (rhs.isInline() == false)
+    {
+        // If the inner pointers are identical, the String instances reference
+        // the same globally unique inner string.
+        isEqual = getShared().get() == rhs.getShared().get();
+    }
+
+    return isEqual;
 }
 
 //! @brief Determines if the current string matches a null-terminated UTF-8
@@ -1299,7 +1420,7 @@ bool String::operator==(const String &rhs) const
 //! to the current string.
 bool String::operator==(utf8_cptr_t nullTerminatedUtf8) const
 {
-    return _str.get()->getData() == nullTerminatedUtf8;
+    return getView() == nullTerminatedUtf8;
 }
 
 //! @brief Determines if two string have differing values.
@@ -1308,9 +1429,7 @@ bool String::operator==(utf8_cptr_t nullTerminatedUtf8) const
 //! @retval false The rhs string is identical to the current one.
 bool String::operator!=(const String &rhs) const
 {
-    // If the inner pointers are identical, the String instances reference the
-    // same globally unique inner string.
-    return _str.get() != rhs._str.get();
+    return (*this == rhs) == false;
 }
 
 //! @brief Determines if the current string is different from a
@@ -1322,7 +1441,7 @@ bool String::operator!=(const String &rhs) const
 //! current string.
 bool String::operator!=(utf8_cptr_t nullTerminatedUtf8) const
 {
-    return _str.get()->getData() != nullTerminatedUtf8;
+    return getView() != nullTerminatedUtf8;
 }
 
 //! @brief Performs a less-than comparison between the current and another string.
@@ -1335,18 +1454,18 @@ bool String::operator<(const String &rhs) const
 
     int diff = 0;
 
-    size_t minSize = std::min(_str->getUTF8Length(), rhs._str->getUTF8Length());
+    size_t minSize = std::min(getUtf8Length(), rhs.getUtf8Length());
 
     if (minSize > 0)
     {
-        diff = std::memcmp(_str->getData().c_str(),
-                           rhs._str->getData().c_str(), minSize);
+        diff = std::memcmp(getUtf8Bytes(),
+                           rhs.getUtf8Bytes(), minSize);
     }
 
     if (diff == 0)
     {
         // The shortest string has the lower value.
-        isLessThan = _str->getUTF8Length() < rhs._str->getUTF8Length();
+        isLessThan = getUtf8Length() < rhs.getUtf8Length();
     }
     else
     {
@@ -1361,37 +1480,66 @@ bool String::operator<(const String &rhs) const
 //! @return The sub of the two strings.
 String String::operator+(const String &rhs) const
 {
-    if (_str->isEmpty())
+    if (isEmpty())
     {
         return rhs;
     }
-    else if (rhs._str->isEmpty())
+    else if (rhs.isEmpty())
     {
         return *this;
     }
     else
     {
         std::string buffer;
-        const std::string &lhsValue = _str->getData();
-        const std::string &rhsValue = rhs._str->getData();
+        std::string_view lhsValue = getView();
+        std::string_view rhsValue = rhs.getView();
 
         buffer.reserve(lhsValue.length() + rhsValue.length());
         buffer.assign(lhsValue);
         buffer.append(rhsValue);
 
-        return String(buffer);
+        return String(std::move(buffer));
+    }
+}
+
+//! @brief Overwrites the current value with that of another string.
+//! @param[in] rhs The string to copy.
+//! @return A reference to the current string.
+String &String::operator=(const String &rhs)
+{
+    if (&rhs != this)
+    {
+        release();
+        initialiseCopy(rhs);
     }
+
+    return *this;
+}
+
+//! @brief Overwrites the current value by taking that of another string,
+//! leaving it empty.
+//! @param[in] rhs The string to take the value of.
+//! @return A reference to the current string.
+String &String::operator=(String &&rhs) noexcept
+{
+    if (&rhs != this)
+    {
+        release();
+        initialiseMove(std::move(rhs));
+    }
+
+    return *this;
 }
 
 //! @brief Overwrites the string with a null-terminated array of UTF-8 bytes.
 //! @param[in] nullTerminatedUtf8 The array of bytes representing the string to
 //! assign.
 //! @return A reference to the current string.
-String String::operator=(utf8_cptr_t nullTerminatedUtf8)
+String &String::operator=(utf8_cptr_t nullTerminatedUtf8)
 {
-    StringPrivate key(nullTerminatedUtf8);
-
-    _str = getGlobalPool().getString(key);
+    // Create the new value before releasing the old one in case the
+    // argument refers to it.
+    *this = String(nullTerminatedUtf8);
 
     return *this;
 }
@@ -1401,11 +1549,9 @@ String String::operator=(utf8_cptr_t nullTerminatedUtf8)
 //! @param[in] nullTerminatedUtf16 The array of bytes representing the string to
 //! assign.
 //! @return A reference to the current string.
-String String::operator=(utf16_cptr_t nullTerminatedUtf16)
+String &String::operator=(utf16_cptr_t nullTerminatedUtf16)
 {
-    StringPrivate key(nullTerminatedUtf16);
-
-    _str = getGlobalPool().getString(key);
+    *this = String(nullTerminatedUtf16);
 
     return *this;
 }
@@ -1415,11 +1561,9 @@ String String::operator=(utf16_cptr_t nullTerminatedUtf16)
 //! @param[in] nullTerminatedUtf32 The array of code points representing the
 //! string to assign.
 //! @return A reference to the current string.
-String String::operator=(utf32_cptr_t nullTerminatedUtf32)
+String &String::operator=(utf32_cptr_t nullTerminatedUtf32)
 {
-    StringPrivate key(nullTerminatedUtf32);
-
-    _str = getGlobalPool().getString(key);
+    *this = String(nullTerminatedUtf32);
 
     return *this;
 }
@@ -1428,11 +1572,9 @@ String String::operator=(utf32_cptr_t nullTerminatedUtf32)
 //! @param[in] nullTerminatedWide The array of wide characters representing the
 //! string to assign.
 //! @return A reference to the current string.
-String String::operator=(wchar_cptr_t nullTerminatedWide)
+String &String::operator=(wchar_cptr_t nullTerminatedWide)
 {
-    StringPrivate key(nullTerminatedWide);
-
-    _str = getGlobalPool().getString(key);
+    *this = String(nullTerminatedWide);
 
     return *this;
 }
@@ -1442,11 +1584,9 @@ String String::operator=(wchar_cptr_t nullTerminatedWide)
 //! encoded STL string.
 //! @param[in] stlUtf8String The string value to assign.
 //! @return A reference to the current object.
-String String::operator=(const std::string &stlUtf8String)
+String &String::operator=(const std::string &stlUtf8String)
 {
-    StringPrivate key(stlUtf8String.c_str(), stlUtf8String.length());
-
-    _str = getGlobalPool().getString(key);
+    *this = String(stlUtf8String);
 
     return *this;
 }
@@ -1455,11 +1595,9 @@ String String::operator=(const std::string &stlUtf8String)
 //! encoded STL string.
 //! @param[in] stlUtf16String The string value to convert and assign.
 //! @return A reference to the current object.
-String String::operator=(const std::u16string &stlUtf16String)
+String &String::operator=(const std::u16string &stlUtf16String)
 {
-    StringPrivate key(stlUtf16String.c_str(), stlUtf16String.length());
-
-    _str = getGlobalPool().getString(key);
+    *this = String(stlUtf16String);
 
     return *this;
 }
@@ -1468,11 +1606,9 @@ String String::operator=(const std::u16string &stlUtf16String)
 //! STL string.
 //! @param[in] stlUtf32String The string value to convert and assign.
 //! @return A reference to the current object.
-String String::operator=(const std::u32string &stlUtf32String)
+String &String::operator=(const std::u32string &stlUtf32String)
 {
-    StringPrivate key(stlUtf32String.c_str(), stlUtf32String.length());
-
-    _str = getGlobalPool().getString(key);
+    *this = String(stlUtf32String);
 
     return *this;
 }
@@ -1481,11 +1617,9 @@ String String::operator=(const std::u32string &stlUtf32String)
 //! STL string.
 //! @param[in] wideString The string value to convert and assign.
 //! @return A reference to the current object.
-String String::operator=(const std::wstring &wideString)
+String &String::operator=(const std::wstring &wideString)
 {
-    StringPrivate key(wideString.c_str(), wideString.length());
-
-    _str = getGlobalPool().getString(key);
+    *this = String(wideString);
 
     return *this;
 }
@@ -1511,11 +1645,11 @@ String String::toLower() const
 String String::substring(const String::iterator &start,
                          const String::iterator &end) const
 {
-    if ((start._source != _str) || (start._offset > end._offset))
+    if ((start._source != *this) || (start._offset > end._offset))
     {
         throw ArgumentException("start");
     }
-    else if ((end._source != _str) || (end._offset > _str->getUTF8Length()))
+    else if ((end._source != *this) || (end._offset > getUtf8Length()))
     {
         throw ArgumentException("end");
     }
@@ -1528,7 +1662,7 @@ String String::substring(const String::iterator &start,
     {
         if (start._offset == 0)
         {
-            if (length >= _str->getUTF8Length())
+            if (length >= getUtf8Length())
             {
                 // Simply copy the current string.
                 result = *this;
@@ -1536,13 +1670,13 @@ String String::substring(const String::iterator &start,
             else
             {
                 // Create a value from a leading section.
-                result = String(_str->getData().c_str(), length);
+                result = String(getUtf8Bytes(), length);
             }
         }
         else
         {
             // Create a value from a mid-section.
-            result = String(_str->getData().c_str() + start._offset, length);
+            result = String(getUtf8Bytes() + start._offset, length);
         }
     }
 
@@ -1552,25 +1686,24 @@ String String::substring(const String::iterator &start,
 //! @brief Gets the text as a UTF-8 encoded STL string.
 std::string String::toUtf8() const
 {
-    return _str->getData();
+    return std::string(getView());
 }
 
 //! @brief Returns a view of the raw UTF-8 encoded string data.
+//! @note The view of a short value refers to storage within the current
+//! object, so it cannot outlive it.
 std::string_view String::toUtf8View() const
 {
-    const std::string &data = _str->getData();
-
-    return std::string_view(data.c_str(), data.length());
+    return getView();
 }
 
 //! @brief Gets the text as a UTF-16 encoded STL string.
 std::u16string String::toUtf16() const
 {
-    std::u16string text;
-    StringPrivatePtr str = _str.get();
+    std::u16string text(getUtf16Length(), u'\0');
 
-    Utf::appendToUtf16(text, str->getData().c_str(),
-                       str->getUTF8Length(), str->getUTF16Length());
+    // The text is known to be well formed and the length exact.
+    Utf::transcode(getView(), text.data(), text.length());
 
     return text;
 }
@@ -1578,11 +1711,9 @@ std::u16string String::toUtf16() const
 //! @brief Gets the text as a UTF-32 encoded STL string.
 std::u32string String::toUtf32() const
 {
-    std::u32string text;
-    StringPrivatePtr str = _str.get();
+    std::u32string text(getUtf32Length(), U'\0');
 
-    Utf::appendToUtf32(text, str->getData().c_str(),
-                       str->getUTF8Length(), str->getUTF32Length());
+    Utf::transcode(getView(), text.data(), text.length());
 
     return text;
 }
@@ -1590,15 +1721,9 @@ std::u32string String::toUtf32() const
 //! @brief Converts the string to an STL wide character string.
 std::wstring String::toWide() const
 {
-    std::wstring wideText;
+    std::wstring wideText(getWideLength(), L'\0');
 
-    StringPrivatePtr str = _str.get();
-    Utf::appendToWide(wideText, str->getData().c_str(), str->getData().length(),
-#ifdef WCHAR_IS_32BIT
-                      str->getUTF32Length());
-#else
-                      str->getUTF16Length());
-#endif
+    Utf::transcode(getView(), wideText.data(), wideText.length());
 
     return wideText;
 }
@@ -1610,58 +1735,23 @@ std::wstring String::toWide() const
 //! character.
 void String::appendToWideBuffer(std::vector<wchar_t> &buffer) const
 {
-    StringPrivatePtr str = _str.get();
-
-    if (str->isEmpty())
+    if (isEmpty())
         return;
 
-    size_t wideLength;
-
-#ifdef WCHAR_IS_32BIT
-    wideLength = str->getUTF32Length();
-#else
-    wideLength = str->getUTF16Length();
-    Utf::ToUtf16Converter outputConverter;
-#endif
+    size_t offset = buffer.size();
+    size_t wideLength = getWideLength();
 
-    // Ensure the buffer has enough space for the new characters.
-    size_t requiredSize = buffer.size() + wideLength + 1;
+    // Ensure the buffer has enough space for the new characters and a
+    // terminator the caller is likely to add.
+    size_t requiredSize = offset + wideLength + 1;
 
     if (requiredSize > buffer.capacity())
     {
         buffer.reserve(requiredSize);
     }
 
-    Utf::FromUtf8Converter inputConverter;
-    uint8_cptr_t bytes = reinterpret_cast<uint8_cptr_t>(str->getData().c_str());
-    size_t byteCount = str->getData().length();
-
-    bool hasError = false;
-    char32_t codePoint = U'\0';
-
-    for (size_t index = 0; index < byteCount; ++index)
-    {
-        // Append the converted code points raw.
-        if (inputConverter.tryConvert(bytes[index], codePoint, hasError))
-        {
-#ifdef WCHAR_IS_32BIT
-            buffer.push_back(codePoint);
-#else
-            // Convert to code points and then UTF-16.
-            outputConverter.setCodePoint(codePoint);
-            char16_t utf16word = u'\0';
-
-            while (outputConverter.tryGetNextCharacter(utf16word))
-            {
-                buffer.push_back(utf16word);
-            }
-#endif
-        }
-        else if (hasError)
-        {
-            inputConverter.reset();
-        }
-    }
+    buffer.resize(offset + wideLength);
+    Utf::transcode(getView(), buffer.data() + offset, wideLength);
 }
 
 //! @brief Performs a per-byte comparison of two string.
@@ -1673,12 +1763,12 @@ int String::compare(const String &rhs) const
 {
     int diff = 0;
 
-    if (rhs._str.get() != _str.get())
+    if (rhs != *this)
     {
-        utf8_cptr_t lhsText = _str->getData().c_str();
-        size_t lhsLength = _str->getData().length();
-        utf8_cptr_t rhsText = rhs._str->getData().c_str();
-        size_t rhsLength = rhs._str->getData().length();
+        utf8_cptr_t lhsText = getUtf8Bytes();
+        size_t lhsLength = getUtf8Length();
+        utf8_cptr_t rhsText = rhs.getUtf8Bytes();
+        size_t rhsLength = rhs.getUtf8Length();
 
         size_t commonSize = std::min(lhsLength, rhsLength);
 
@@ -1704,7 +1794,7 @@ int String::compareIgnoreCase(const String &rhs) const
 {
     int diff = 0;
 
-    if (rhs._str.get() != _str.get())
+    if (rhs != *this)
     {
         diff = compareIgnoreCase(rhs.toUtf8View());
     }
@@ -1720,8 +1810,8 @@ int String::compareIgnoreCase(const String &rhs) const
 //! @retval >0 The current string has a higher value than rhs.
 int String::compareIgnoreCase(const std::string_view &rhs) const
 {
-    utf8_cptr_t lhsText = _str->getData().c_str();
-    size_t lhsLength = _str->getData().length();
+    utf8_cptr_t lhsText = getUtf8Bytes();
+    size_t lhsLength = getUtf8Length();
     utf8_cptr_t rhsText = rhs.data();
     size_t rhsLength = rhs.length();
 
@@ -1746,12 +1836,12 @@ int String::compareIgnoreCase(const std::string_view &rhs) const
 //! prefix.
 bool String::startsWith(const std::string_view &prefix) const
 {
-    const std::string &str = _str->getData();
+    std::string_view str = getView();
     bool hasPrefix = false;
 
     if (prefix.length() <= str.length())
     {
-        hasPrefix = std::memcmp(prefix.data(), str.c_str(),
+        hasPrefix = std::memcmp(prefix.data(), str.data(),
                                 prefix.length()) == 0;
     }
 
@@ -1767,7 +1857,7 @@ bool String::startsWith(const std::string_view &prefix) const
 //! could, its value overflowed.
 bool String::tryParseScalar(int8_t &scalar, int radix /* = 10 */) const
 {
-    return tryParseScalarInternal(_str->getData(), radix, scalar);
+    return tryParseScalarInternal(getView(), radix, scalar);
 }
 
 //! @brief Attempts to parse a scalar integer from the contents of the string.
@@ -1779,7 +1869,7 @@ bool String::tryParseScalar(int8_t &scalar, int radix /* = 10 */) const
 //! could, its value overflowed.
 bool String::tryParseScalar(uint8_t &scalar, int radix /* = 10 */) const
 {
-    return tryParseScalarInternal(_str->getData(), radix, scalar);
+    return tryParseScalarInternal(getView(), radix, scalar);
 }
 
 //! @brief Attempts to parse a scalar integer from the contents of the string.
@@ -1791,7 +1881,7 @@ bool String::tryParseScalar(uint8_t &scalar, int radix /* = 10 */) const
 //! could, its value overflowed.
 bool String::tryParseScalar(int16_t &scalar, int radix /* = 10 */) const
 {
-    return tryParseScalarInternal(_str->getData(), radix, scalar);
+    return tryParseScalarInternal(getView(), radix, scalar);
 }
 
 //! @brief Attempts to parse a scalar integer from the contents of the string.
@@ -1803,7 +1893,7 @@ bool String::tryParseScalar(int16_t &scalar, int radix /* = 10 */) const
 //! could, its value overflowed.
 bool String::tryParseScalar(uint16_t &scalar, int radix /* = 10 */) const
 {
-    return tryParseScalarInternal(_str->getData(), radix, scalar);
+    return tryParseScalarInternal(getView(), radix, scalar);
 }
 
 //! @brief Attempts to parse a scalar integer from the contents of the string.
@@ -1815,7 +1905,7 @@ bool String::tryParseScalar(uint16_t &scalar, int radix /* = 10 */) const
 //! could, its value overflowed.
 bool String::tryParseScalar(int32_t &scalar, int radix /* = 10 */) const
 {
-    return tryParseScalarInternal(_str->getData(), radix, scalar);
+    return tryParseScalarInternal(getView(), radix, scalar);
 }
 
 //! @brief Attempts to parse a scalar integer from the contents of the string.
@@ -1827,7 +1917,7 @@ bool String::tryParseScalar(int32_t &scalar, int radix /* = 10 */) const
 //! could, its value overflowed.
 bool String::tryParseScalar(uint32_t &scalar, int radix /* = 10 */) const
 {
-    return tryParseScalarInternal(_str->getData(), radix, scalar);
+    return tryParseScalarInternal(getView(), radix, scalar);
 }
 
 //! @brief Attempts to parse a scalar integer from the contents of the string.
@@ -1839,7 +1929,7 @@ bool String::tryParseScalar(uint32_t &scalar, int radix /* = 10 */) const
 //! could, its value overflowed.
 bool String::tryParseScalar(int64_t &scalar, int radix /* = 10 */) const
 {
-    return tryParseScalarInternal(_str->getData(), radix, scalar);
+    return tryParseScalarInternal(getView(), radix, scalar);
 }
 
 //! @brief Attempts to parse a scalar integer from the contents of the string.
@@ -1851,7 +1941,7 @@ bool String::tryParseScalar(int64_t &scalar, int radix /* = 10 */) const
 //! could, its value overflowed.
 bool String::tryParseScalar(uint64_t &scalar, int radix /* = 10 */) const
 {
-    return tryParseScalarInternal(_str->getData(), radix, scalar);
+    return tryParseScalarInternal(getView(), radix, scalar);
 }
 
 //! @brief Attempts to parse a real scalar value from the contents of the string.
@@ -1862,7 +1952,7 @@ bool String::tryParseScalar(uint64_t &scalar, int radix /* = 10 */) const
 //! could, its value overflowed.
 bool String::tryParseScalar(float &scalar) const
 {
-    return tryParseScalarInternal(_str->getData(), scalar);
+    return tryParseScalarInternal(getView(), scalar);
 }
 
 //! @brief Attempts to parse a real scalar value from the contents of the string.
@@ -1873,7 +1963,170 @@ bool String::tryParseScalar(float &scalar) const
 //! could, its value overflowed.
 bool String::tryParseScalar(double &scalar) const
 {
-    return tryParseScalarInternal(_str->getData(), scalar);
+    return tryParseScalarInternal(getView(), scalar);
+}
+
+//! @brief Determines whether the string value is stored within the object
+//! rather than as a shared value in the global pool.
+bool String::isInline() const noexcept
+{
+    return static_cast<uint8_t>(_storage[StorageSize - 1]) != SharedTag;
+}
+
+//! @brief Gets the shared pointer to the pooled value of a string which is
+//! not stored in-line.
+const String::SharedPtr &String::getShared() const noexcept
+{
+    return *std::launder(reinterpret_cast<const SharedPtr *>(_storage));
+}
+
+//! @brief Gets the shared pointer to the pooled value of a string which is
+//! not stored in-line.
+String::SharedPtr &String::getShared() noexcept
+{
+    return *std::launder(reinterpret_cast<SharedPtr *>(_storage));
+}
+
+//! @brief Gets a view of the UTF-8 encoded bytes of the string value.
+std::string_view String::getView() const noexcept
+{
+    if (isInline())
+    {
+        return std::string_view(_storage,
+                                static_cast<uint8_t>(_storage[StorageSize - 1]));
+    }
+    else
+    {
+        const StringPrivate *str = getShared().get();
+
+        return std::string_view(str->getUTF8Bytes(), str->getUTF8Length());
+    }
+}
+
+//! @brief Initialises uninitialised storage from a validated string value
+//! either in-line, if short enough, or by reference to the global pool.
+//! @param[in] key The validated string value to take the value of.
+void String::initialise(StringPrivate &&key)
+{
+    if (key.getUTF8Length() <= MaxInlineLength)
+    {
+        initialiseInline(key.getUTF8Bytes(), key.getUTF8Length());
+    }
+    else
+    {
+        new(_storage) SharedPtr(getGlobalPool().getString(std::move(key)));
+        _storage[StorageSize - 1] = static_cast<char>(SharedTag);
+    }
+}
+
+//! @brief Initialises uninitialised storage with a short in-line value.
+//! @param[in] boundedUtf8 The validated UTF-8 bytes to store.
+//! @param[in] byteCount The count of bytes in @p boundedUtf8, no more than
+//! MaxInlineLength.
+void String::initialiseInline(utf8_cptr_t boundedUtf8, size_t byteCount) noexcept
+{
+    std::fill_n(_storage, StorageSize, '\0');
+
+    if (byteCount > 0)
+    {
+        std::memcpy(_storage, boundedUtf8, byteCount);
+    }
+
+    _storage[StorageSize - 1] = static_cast<char>(byteCount);
+}
+
+//! @brief Initialises uninitialised storage with the value of another string.
+//! @param[in] rhs The string to copy.
+void String::initialiseCopy(const String &rhs) noexcept
+{
+    if (rhs.isInline())
+    {
+        std::memcpy(_storage, rhs._storage, StorageSize);
+    }
+    else
+    {
+        new(_storage) SharedPtr(rhs.getShared());
+        _storage[StorageSize - 1] = static_cast<char>(SharedTag);
+    }
+}
+
+//! @brief Initialises uninitialised storage by taking the value of another
+//! string, leaving it empty.
+//! @param[in] rhs The string to take the value of.
+void String::initialiseMove(String &&rhs) noexcept
+{
+    if (rhs.isInline())
+    {
+        std::memcpy(_storage, rhs._storage, StorageSize);
+
+        // Make the source an empty string.
+        rhs._storage[0] = '\0';
+        rhs._storage[StorageSize - 1] = 0;
+    }
+    else
+    {
+        new(_storage) SharedPtr(std::move(rhs.getShared()));
+        _storage[StorageSize - 1] = static_cast<char>(SharedTag);
+        rhs.release();
+    }
+}
+
+//! @brief Releases any reference to a pooled value, leaving the string empty.
+void String::release() noexcept
+{
+    if (isInline() == false)
+    {
+        getShared().~SharedPtr();
+    }
+
+    initialiseInline(nullptr, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// StringInternPool Member Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Gets the count of unique string values held in the pool.
+size_t StringInternPool::getCount() const
+{
+    return _values.size();
+}
+
+//! @brief Gets a pool which is private to the calling thread.
+//! @note The pool is disposed of when the thread exits.
+StringInternPool &StringInternPool::getThreadPool()
+{
+    static thread_local StringInternPool threadPool;
+
+    return threadPool;
+}
+
+//! @brief Gets a string value with the specified text, creating it the first
+//! time the text is encountered.
+//! @param[in] utf8 The UTF-8 encoded text of the string value to obtain.
+//! @return A reference to the string value which will remain valid until the
+//! pool is cleared or destroyed.
+//! @throws UnicodeConversionException If @p utf8 is not validly encoded.
+const String &StringInternPool::intern(const std::string_view &utf8)
+{
+    auto pos = _valuesByText.find(utf8);
+
+    if (pos == _valuesByText.end())
+    {
+        // The view used as a key must refer to the bytes of the pooled value
+        // rather than those of the caller.
+        const String &value = _values.emplace_back(utf8);
+
+        pos = _valuesByText.emplace(value.toUtf8View(), &value).first;
+    }
+
+    return *pos->second;
+}
+
+//! @brief Removes all string values from the pool.
+void StringInternPool::clear()
+{
+    _valuesByText.clear();
+    _values.clear();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
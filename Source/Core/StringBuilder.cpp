@@ -0,0 +1,213 @@
+//! @file Core/StringBuilder.cpp
+//! @brief The definition of an object which accumulates text in order to
+//! create an immutable string value.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Header File Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+
+#include "Ag/Core/StringBuilder.hpp"
+#include "Ag/Core/Utf.hpp"
+#include "Ag/Core/Variant.hpp"
+
+namespace Ag {
+
+////////////////////////////////////////////////////////////////////////////////
+// StringBuilder Member Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Constructs an empty string builder.
+StringBuilder::StringBuilder() :
+    _length(0),
+    _nextChunkSize(DefaultChunkSize)
+{
+}
+
+//! @brief Constructs an empty string builder which expects to accumulate a
+//! specified amount of text.
+//! @param[in] initialCapacity The count of UTF-8 bytes to reserve space for
+//! in the first chunk.
+StringBuilder::StringBuilder(size_t initialCapacity) :
+    _length(0),
+    _nextChunkSize(std::max(initialCapacity, DefaultChunkSize))
+{
+}
+
+//! @brief Determines whether any text has been accumulated.
+bool StringBuilder::isEmpty() const
+{
+    return _length == 0;
+}
+
+//! @brief Gets the count of UTF-8 bytes accumulated so far.
+size_t StringBuilder::getUtf8Length() const
+{
+    return _length;
+}
+
+//! @brief Gets the count of chunks the accumulated text is stored in.
+size_t StringBuilder::getChunkCount() const
+{
+    return _chunks.size();
+}
+
+//! @brief Appends UTF-8 encoded text.
+//! @param[in] utf8Text The text to append.
+//! @return A reference to the current object.
+//! @note The text is not validated until toString() is called.
+StringBuilder &StringBuilder::append(const std::string_view &utf8Text)
+{
+    std::string_view remaining = utf8Text;
+
+    // Fill the last chunk before starting another.
+    while (remaining.empty() == false)
+    {
+        std::string &tail = reserveTail(1);
+        size_t byteCount = std::min(remaining.length(),
+                                    tail.capacity() - tail.length());
+
+        tail.append(remaining.data(), byteCount);
+        remaining.remove_prefix(byteCount);
+    }
+
+    _length += utf8Text.length();
+
+    return *this;
+}
+
+//! @brief Appends UTF-8 encoded text held in an STL string.
+//! @param[in] utf8Text The text to append.
+//! @return A reference to the current object.
+StringBuilder &StringBuilder::append(const std::string &utf8Text)
+{
+    return append(std::string_view(utf8Text));
+}
+
+//! @brief Appends null-terminated UTF-8 encoded text.
+//! @param[in] nullTerminatedUtf8 The text to append, nullptr is treated as
+//! an empty string.
+//! @return A reference to the current object.
+StringBuilder &StringBuilder::append(utf8_cptr_t nullTerminatedUtf8)
+{
+    if (nullTerminatedUtf8 != nullptr)
+    {
+        append(std::string_view(nullTerminatedUtf8));
+    }
+
+    return *this;
+}
+
+//! @brief Appends the value of an immutable string.
+//! @param[in] text The string to append.
+//! @return A reference to the current object.
+StringBuilder &StringBuilder::append(const String &text)
+{
+    return append(text.toUtf8View());
+}
+
+//! @brief Appends a single Unicode code point encoded as UTF-8.
+//! @param[in] codePoint The code point to append, invalid values are ignored.
+//! @return A reference to the current object.
+StringBuilder &StringBuilder::append(char32_t codePoint)
+{
+    std::string &tail = reserveTail(Utf::MaxUTF8EncodingLength);
+    size_t initialLength = tail.length();
+
+    Utf::appendCodePoint(tail, codePoint);
+    _length += tail.length() - initialLength;
+
+    return *this;
+}
+
+//! @brief Appends text produced by processing a format specification using
+//! formatting options derived from the neutral locale.
+//! @param[in] spec The format specification used as a template for the text
+//! to append.
+//! @param[in] params The set of values to be substituted into the text.
+//! @return A reference to the current object.
+StringBuilder &StringBuilder::appendFormat(const std::string_view &spec,
+                                           const std::initializer_list<Variant> &params)
+{
+    FormatInfo neutralFormat(LocaleInfo::getNeutral());
+
+    return appendFormat(neutralFormat, spec, params);
+}
+
+//! @brief Appends text produced by processing a format specification.
+//! @param[in] options Defines how values should be formatted as text.
+//! @param[in] spec The format specification used as a template for the text
+//! to append.
+//! @param[in] params The set of values to be substituted into the text.
+//! @return A reference to the current object.
+StringBuilder &StringBuilder::appendFormat(const FormatInfo &options,
+                                           const std::string_view &spec,
+                                           const std::initializer_list<Variant> &params)
+{
+    // Formatting directly into the last chunk will only reallocate it if
+    // the estimate is too small.
+    std::string &tail = reserveTail(spec.length() + (params.size() * MinValueSpace));
+    size_t initialLength = tail.length();
+
+    Ag::appendFormat(options, spec, tail, params);
+    _length += tail.length() - initialLength;
+
+    return *this;
+}
+
+//! @brief Discards all accumulated text.
+void StringBuilder::clear()
+{
+    _chunks.clear();
+    _length = 0;
+}
+
+//! @brief Creates an immutable string from the text accumulated so far.
+//! @return A string containing a copy of the accumulated text.
+//! @throws UnicodeConversionException If the accumulated text was not
+//! valid UTF-8.
+//! @details The text is gathered into a single buffer which the String
+//! adopts, so that only one allocation is made.
+String StringBuilder::toString() const
+{
+    if (_chunks.size() == 1)
+    {
+        return String(_chunks.front());
+    }
+
+    std::string buffer;
+    buffer.reserve(_length);
+
+    for (const std::string &chunk : _chunks)
+    {
+        buffer.append(chunk);
+    }
+
+    return String(std::move(buffer));
+}
+
+//! @brief Ensures the last chunk has space for a specified number of bytes,
+//! allocating a new chunk if not.
+//! @param[in] byteCount The count of bytes required.
+//! @return A reference to the chunk to append to.
+std::string &StringBuilder::reserveTail(size_t byteCount)
+{
+    if (_chunks.empty() ||
+        ((_chunks.back().capacity() - _chunks.back().length()) < byteCount))
+    {
+        std::string &chunk = _chunks.emplace_back();
+        chunk.reserve(std::max(_nextChunkSize, byteCount));
+
+        _nextChunkSize = std::min(_nextChunkSize * 2, MaxChunkSize);
+    }
+
+    return _chunks.back();
+}
+
+} // namespace Ag
+////////////////////////////////////////////////////////////////////////////////
@@ -1,7 +1,7 @@
 //! @file Core/StringPrivate.cpp
 //! @brief The definition of the inner object of the Ag library string value type.
 //! @author GiantRobotLemur@na-se.co.uk
-//! @date 2021-2025
+//! @date 2021-2026
 //! @copyright This file is part of the Silver (Ag) project which is released
 //! under LGPL 3 license. See LICENSE file at the repository root or go to
 //! https://github.com/GiantRobotLemur/Ag for full license details.
@@ -17,12 +17,16 @@
 #include <string>
 #include <vector>
 
-#include "Ag/Core/Binary.hpp"
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
 #include "Ag/Core/Exception.hpp"
 #include "Ag/Core/Utf.hpp"
 
 #include "CoreInternal.hpp"
 #include "StringPrivate.hpp"
+#include "UtfKernels.hpp"
 
 namespace Ag {
 
@@ -111,6 +115,75 @@ public:
     }
 };
 
+////////////////////////////////////////////////////////////////////////////////
+// Local Data
+////////////////////////////////////////////////////////////////////////////////
+// Constants used by the string hash, taken from the public domain wyhash.
+constexpr uint64_t HashSecret0 = 0xA0761D6478BD642Full;
+constexpr uint64_t HashSecret1 = 0xE7037ED1A0B428DBull;
+constexpr uint64_t HashSecret2 = 0x8EBC6AF09C88C6E3ull;
+constexpr uint64_t HashSecret3 = 0x589965CC75374CC3ull;
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Reads an unaligned 64-bit word in native byte order.
+uint64_t readWord64(uint8_cptr_t bytes) noexcept
+{
+    uint64_t word;
+    std::memcpy(&word, bytes, sizeof(word));
+
+    return word;
+}
+
+//! @brief Reads an unaligned 32-bit word in native byte order.
+uint64_t readWord32(uint8_cptr_t bytes) noexcept
+{
+    uint32_t word;
+    std::memcpy(&word, bytes, sizeof(word));
+
+    return word;
+}
+
+//! @brief Multiplies two 64-bit values and folds the 128-bit product.
+//! @param[in,out] lhs The left operand, receives the lower 64-bits of the
+//! product.
+//! @param[in,out] rhs The right operand, receives the upper 64-bits of the
+//! product.
+void multiply128(uint64_t &lhs, uint64_t &rhs) noexcept
+{
+#if defined(_MSC_VER) && defined(_M_AMD64)
+    lhs = _umul128(lhs, rhs, &rhs);
+#elif defined(__SIZEOF_INT128__)
+    // Use __extension__ to keep pedantic warnings about __int128 quiet.
+    __extension__ using Product = unsigned __int128;
+    Product product = static_cast<Product>(lhs) * rhs;
+
+    lhs = static_cast<uint64_t>(product);
+    rhs = static_cast<uint64_t>(product >> 64);
+#else
+    // Portable long multiplication using 32-bit halves.
+    uint64_t lhsHigh = lhs >> 32, lhsLow = static_cast<uint32_t>(lhs);
+    uint64_t rhsHigh = rhs >> 32, rhsLow = static_cast<uint32_t>(rhs);
+    uint64_t highHigh = lhsHigh * rhsHigh;
+    uint64_t highLow = lhsHigh * rhsLow;
+    uint64_t lowHigh = lhsLow * rhsHigh;
+    uint64_t lowLow = lhsLow * rhsLow;
+    uint64_t cross = (lowLow >> 32) + static_cast<uint32_t>(highLow) + lowHigh;
+
+    lhs = (cross << 32) | static_cast<uint32_t>(lowLow);
+    rhs = highHigh + (highLow >> 32) + (cross >> 32);
+#endif
+}
+
+//! @brief Mixes two 64-bit values into one.
+uint64_t mix64(uint64_t lhs, uint64_t rhs) noexcept
+{
+    multiply128(lhs, rhs);
+
+    return lhs ^ rhs;
+}
+
 } // Anonymous namespace
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -122,6 +195,7 @@ StringPrivate::StringPrivate() :
     _utf8Length(0),
     _utf16Length(0),
     _utf32Length(0),
+    _lazyState(0),
     _data(nullptr),
     _isDynamic(false)
 {
@@ -135,16 +209,76 @@ StringPrivate::StringPrivate() :
 //! non-local converted UTF-8 string data.
 StringPrivate::StringPrivate(const StringPrivate &key) :
     std::enable_shared_from_this<StringPrivate>(key),
-    _hashCode(key._hashCode),
+    _hashCode(0),
     _utf8Length(key._utf8Length),
-    _utf16Length(key._utf16Length),
-    _utf32Length(key._utf32Length),
+    _utf16Length(0),
+    _utf32Length(0),
+    _lazyState(0),
     _data(nullptr),
     _localData(key._data, key._utf8Length),
     _isDynamic(true)
 {
     // Copy the pointer after the STL string constructor has been called.
     _data = _localData.c_str();
+
+    copyLazyFields(key);
+}
+
+//! @brief Constructs a string value which has been dynamically allocated to
+//! allow the string data to be stored in-line, taking the converted data
+//! from a key which owns it rather than copying it.
+//! @param[in] key The string value containing metadata and the UTF-8 string
+//! data, which is left empty.
+StringPrivate::StringPrivate(StringPrivate &&key) :
+    std::enable_shared_from_this<StringPrivate>(key),
+    _hashCode(0),
+    _utf8Length(key._utf8Length),
+    _utf16Length(0),
+    _utf32Length(0),
+    _lazyState(0),
+    _data(nullptr),
+    _isDynamic(true)
+{
+    if (key._data == key._localData.c_str())
+    {
+        _localData = std::move(key._localData);
+    }
+    else
+    {
+        _localData.assign(key._data, key._utf8Length);
+    }
+
+    _data = _localData.c_str();
+    copyLazyFields(key);
+
+    // Leave the key as a valid empty string.
+    key._localData.clear();
+    key._data = key._localData.c_str();
+    key._utf8Length = 0;
+    key._lazyState.store(0, std::memory_order_relaxed);
+}
+
+//! @brief Constructs a string value which has been allocated on the stack
+//! by taking ownership of the contents of an STL string of UTF-8 encoded
+//! bytes.
+//! @param[in] utf8Text The string to take the contents of.
+StringPrivate::StringPrivate(std::string &&utf8Text) :
+    _hashCode(0),
+    _utf8Length(0),
+    _utf16Length(0),
+    _utf32Length(0),
+    _lazyState(0),
+    _data(nullptr),
+    _isDynamic(false)
+{
+    std::string text(std::move(utf8Text));
+
+    initialiseUTF8(text.c_str(), text.length());
+
+    // Take ownership once validated. Short text may move, so update the
+    // pointer afterwards.
+    _localData = std::move(text);
+    _data = _localData.c_str();
 }
 
 //! @brief Constructs a string value which has been allocated on the stack
@@ -156,6 +290,7 @@ StringPrivate::StringPrivate(utf8_cptr_t nullTerminatedUtf8) :
     _utf8Length(0),
     _utf16Length(0),
     _utf32Length(0),
+    _lazyState(0),
     _data(nullptr),
     _isDynamic(false)
 {
@@ -175,6 +310,7 @@ StringPrivate::StringPrivate(utf8_cptr_t boundedUtf8, size_t byteCount) :
     _utf8Length(0),
     _utf16Length(0),
     _utf32Length(0),
+    _lazyState(0),
     _data(nullptr),
     _isDynamic(false)
 {
@@ -190,6 +326,7 @@ StringPrivate::StringPrivate(utf16_cptr_t nullTerminatedUtf16) :
     _utf8Length(0),
     _utf16Length(0),
     _utf32Length(0),
+    _lazyState(0),
     _data(nullptr),
     _isDynamic(false)
 {
@@ -209,6 +346,7 @@ StringPrivate::StringPrivate(utf16_cptr_t boundedUtf16, size_t wordCount) :
     _utf8Length(0),
     _utf16Length(0),
     _utf32Length(0),
+    _lazyState(0),
     _data(nullptr),
     _isDynamic(false)
 {
@@ -224,6 +362,7 @@ StringPrivate::StringPrivate(utf32_cptr_t nullTerminatedUtf32) :
     _utf8Length(0),
     _utf16Length(0),
     _utf32Length(0),
+    _lazyState(0),
     _data(nullptr),
     _isDynamic(false)
 {
@@ -242,6 +381,7 @@ StringPrivate::StringPrivate(utf32_cptr_t boundedUtf32, size_t codePointCount) :
     _utf8Length(0),
     _utf16Length(0),
     _utf32Length(0),
+    _lazyState(0),
     _data(nullptr),
     _isDynamic(false)
 {
@@ -257,6 +397,7 @@ StringPrivate::StringPrivate(wchar_cptr_t nullTerminatedWide) :
     _utf8Length(0),
     _utf16Length(0),
     _utf32Length(0),
+    _lazyState(0),
     _data(nullptr),
     _isDynamic(false)
 {
@@ -279,6 +420,7 @@ StringPrivate::StringPrivate(wchar_cptr_t boundedWide, size_t charCount) :
     _utf8Length(0),
     _utf16Length(0),
     _utf32Length(0),
+    _lazyState(0),
     _data(nullptr),
     _isDynamic(false)
 {
@@ -310,10 +452,25 @@ const std::string &StringPrivate::getData() const
     return _localData;
 }
 
+//! @brief Gets the UTF-8 encoded bytes of the string, which may not be
+//! null-terminated if the object was constructed from a bounded array.
+utf8_cptr_t StringPrivate::getUTF8Bytes() const
+{
+    return _data;
+}
+
 //! @brief Gets a hash code calculated from the text data.
+//! @note The hash code is calculated on first use.
 size_t StringPrivate::getHashCode() const
 {
-    return _hashCode;
+    if ((_lazyState.load(std::memory_order_acquire) & HasHashCode) == 0)
+    {
+        // Threads racing to get here will all store the same value.
+        _hashCode.store(hashUtf8(_data, _utf8Length), std::memory_order_relaxed);
+        _lazyState.fetch_or(HasHashCode, std::memory_order_release);
+    }
+
+    return _hashCode.load(std::memory_order_relaxed);
 }
 
 //! @brief Gets the count of UTF-8 bytes which represent the string.
@@ -324,16 +481,22 @@ size_t StringPrivate::getUTF8Length() const
 
 //! @brief Gets the count of UTF-16 16-bit words required to represent
 //! the string.
+//! @note The length is calculated on first use.
 size_t StringPrivate::getUTF16Length() const
 {
-    return _utf16Length;
+    ensureLengths();
+
+    return _utf16Length.load(std::memory_order_relaxed);
 }
 
 //! @brief Gets the count of Unicode code points required to represent
 //! the string.
+//! @note The length is calculated on first use.
 size_t StringPrivate::getUTF32Length() const
 {
-    return _utf32Length;
+    ensureLengths();
+
+    return _utf32Length.load(std::memory_order_relaxed);
 }
 
 //! @brief Determines if two string values are identical.
@@ -346,8 +509,7 @@ bool StringPrivate::operator==(const StringPrivate &rhs) const
         // It's the same instance.
         isEqual = true;
     }
-    else if ((_utf8Length == rhs._utf8Length) &&
-             (_hashCode == rhs._hashCode))
+    else if (_utf8Length == rhs._utf8Length)
     {
         isEqual = std::memcmp(_data, rhs._data, _utf8Length) == 0;
     }
@@ -355,6 +517,57 @@ bool StringPrivate::operator==(const StringPrivate &rhs) const
     return isEqual;
 }
 
+//! @brief Calculates the lengths of the string in other encodings if they
+//! have not already been calculated.
+void StringPrivate::ensureLengths() const
+{
+    if ((_lazyState.load(std::memory_order_acquire) & HasLengths) == 0)
+    {
+        Utf::Utf8Metrics metrics;
+
+        // The text was validated on construction, so this cannot fail.
+        Utf::tryMeasureUtf8(reinterpret_cast<uint8_cptr_t>(_data),
+                            _utf8Length, metrics);
+
+        // Threads racing to get here will all store the same values.
+        _utf16Length.store(metrics.Utf16Length, std::memory_order_relaxed);
+        _utf32Length.store(metrics.Utf32Length, std::memory_order_relaxed);
+        _lazyState.fetch_or(HasLengths, std::memory_order_release);
+    }
+}
+
+//! @brief Copies any properties which a key has already calculated.
+//! @param[in] key The string value to copy calculated properties from.
+void StringPrivate::copyLazyFields(const StringPrivate &key) noexcept
+{
+    uint8_t keyState = key._lazyState.load(std::memory_order_acquire);
+
+    if (keyState & HasHashCode)
+    {
+        _hashCode.store(key._hashCode.load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+    }
+
+    if (keyState & HasLengths)
+    {
+        setLengths(key._utf16Length.load(std::memory_order_relaxed),
+                   key._utf32Length.load(std::memory_order_relaxed));
+    }
+
+    _lazyState.store(keyState, std::memory_order_release);
+}
+
+//! @brief Records the lengths of the string in other encodings when they
+//! are already known.
+//! @param[in] utf16Length The count of UTF-16 words required.
+//! @param[in] utf32Length The count of code points in the string.
+void StringPrivate::setLengths(size_t utf16Length, size_t utf32Length) noexcept
+{
+    _utf16Length.store(utf16Length, std::memory_order_relaxed);
+    _utf32Length.store(utf32Length, std::memory_order_relaxed);
+    _lazyState.fetch_or(HasLengths, std::memory_order_release);
+}
+
 //! @brief Performs shared initialisation of the object from a UTF-8
 //! encoded array.
 //! @param[in] boundedUtf8 The array of UTF-8 bytes to retain as the source
@@ -362,43 +575,19 @@ bool StringPrivate::operator==(const StringPrivate &rhs) const
 //! @param[in] byteCount The count of bytes in the array.
 void StringPrivate::initialiseUTF8(utf8_cptr_t boundedUtf8, size_t byteCount)
 {
-    _hashCode = 0;
     _utf8Length = byteCount;
-    _utf16Length = 0;
-    _utf32Length = 0;
     _data = boundedUtf8;
     _localData.clear();
 
-    Utf::FromUtf8Converter converter;
-    size_t codePointStartIndex = 0;
+    // Only validate the text, the hash code and lengths in other encodings
+    // are calculated if they are needed.
+    Utf::Utf8Metrics metrics;
+    uint8_cptr_t bytes = reinterpret_cast<uint8_cptr_t>(boundedUtf8);
 
-    for (size_t index = 0; index < byteCount; ++index)
+    if (Utf::tryValidateUtf8(bytes, byteCount, metrics) == false)
     {
-        bool hasError;
-        char32_t codePoint;
-
-        if (converter.tryConvert(boundedUtf8[index], codePoint, hasError))
-        {
-            _hashCode = Bin::rotateLeft(_hashCode, 7) ^ static_cast<size_t>(codePoint);
-
-            codePointStartIndex = index + 1;
-
-            // Update the sizes for various encodings.
-            ++_utf32Length;
-
-            uint32_t wordCount = 0;
-
-            if (Utf::tryGetUTF16WordCountFromCodePoint(codePoint, wordCount))
-            {
-                _utf16Length += wordCount;
-            }
-        }
-        else if (hasError)
-        {
-            throw UnicodeConversionException(
-                reinterpret_cast<uint8_cptr_t>(boundedUtf8 + codePointStartIndex),
-                (index + 1) - codePointStartIndex);
-        }
+        throw UnicodeConversionException(bytes + metrics.ErrorOffset,
+                                         metrics.ErrorLength);
     }
 }
 
@@ -409,13 +598,14 @@ void StringPrivate::initialiseUTF8(utf8_cptr_t boundedUtf8, size_t byteCount)
 //! @param[in] wordCount The count of 16-bit characters in the array.
 void StringPrivate::initialiseUTF16(utf16_cptr_t boundedUtf16, size_t wordCount)
 {
-    _hashCode = 0;
     _utf8Length = 0;
-    _utf16Length = 0;
-    _utf32Length = 0;
     _data = nullptr;
     _localData.clear();
 
+    // The lengths are calculated during conversion, so store them eagerly.
+    size_t utf16Length = 0;
+    size_t utf32Length = 0;
+
     Utf::FromUtf16Converter converter;
     Utf::ToUtf8Converter toUtf8;
 
@@ -431,10 +621,8 @@ void StringPrivate::initialiseUTF16(utf16_cptr_t boundedUtf16, size_t wordCount)
 
         if (converter.tryConvert(boundedUtf16[index], codePoint, hasError))
         {
-            _hashCode = Bin::rotateLeft(_hashCode, 7) ^ static_cast<size_t>(codePoint);
-
-            _utf16Length += index + 1 - codePointStartIndex;
-            ++_utf32Length;
+            utf16Length += index + 1 - codePointStartIndex;
+            ++utf32Length;
 
             uint8_t nextByte;
             toUtf8.setCodePoint(codePoint);
@@ -455,6 +643,7 @@ void StringPrivate::initialiseUTF16(utf16_cptr_t boundedUtf16, size_t wordCount)
 
     _utf8Length = _localData.length();
     _data = _localData.c_str();
+    setLengths(utf16Length, utf32Length);
 }
 
 //! @brief Performs shared initialisation of the object from an array of
@@ -464,13 +653,14 @@ void StringPrivate::initialiseUTF16(utf16_cptr_t boundedUtf16, size_t wordCount)
 //! @param[in] codePointCount The count of Unicode characters in the array.
 void StringPrivate::initialiseUTF32(utf32_cptr_t boundedUtf32, size_t codePointCount)
 {
-    _hashCode = 0;
     _utf8Length = 0;
-    _utf16Length = 0;
-    _utf32Length = 0;
     _data = nullptr;
     _localData.clear();
 
+    // The lengths are calculated during conversion, so store them eagerly.
+    size_t utf16Length = 0;
+    size_t utf32Length = 0;
+
     Utf::ToUtf8Converter toUtf8;
 
     // "Guess" at the UTF-8 size of the string.
@@ -481,33 +671,25 @@ void StringPrivate::initialiseUTF32(utf32_cptr_t boundedUtf32, size_t codePointC
         char32_t codePoint = boundedUtf32[index];
         uint32_t codePointData = static_cast<uint32_t>(codePoint);
 
-        if (codePointData < 0xD800)
-        {
-            _hashCode = Bin::rotateLeft(_hashCode, 7) ^ codePointData;
-        }
-        else if (codePointData < 0xE000)
+        if ((codePointData >= 0xD800) && (codePointData < 0xE000))
         {
             // It's within the UTF-16 low/high surrogate range.
             throw UnicodeConversionException(codePoint);
         }
-        else if (codePointData <= CodePointMax)
-        {
-            _hashCode = Bin::rotateLeft(_hashCode, 7) ^ codePointData;
-        }
-        else
+        else if (codePointData > CodePointMax)
         {
             // It's beyond the largest legal Unicode code point value.
             throw UnicodeConversionException(codePoint);
         }
 
         // Update various encoding lengths.
-        ++_utf32Length;
+        ++utf32Length;
 
         uint32_t count = 0;
 
         if (Utf::tryGetUTF16WordCountFromCodePoint(codePoint, count))
         {
-            _utf16Length += count;
+            utf16Length += count;
         }
 
         toUtf8.setCodePoint(codePoint);
@@ -521,11 +703,94 @@ void StringPrivate::initialiseUTF32(utf32_cptr_t boundedUtf32, size_t codePointC
 
     _utf8Length = _localData.length();
     _data = _localData.c_str();
+    setLengths(utf16Length, utf32Length);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 // Global Function Definitions
 ////////////////////////////////////////////////////////////////////////////////
+//! @brief Calculates the hash code of a string from its UTF-8 encoded bytes.
+//! @param[in] utf8Bytes The bytes to hash.
+//! @param[in] byteCount The count of bytes in @p utf8Bytes.
+//! @return The hash code, which will be the same regardless of the encoding
+//! the string was originally constructed from.
+//! @details The algorithm follows wyhash, consuming 16 or 48 bytes at a time
+//! and folding them with 64 x 64 => 128-bit multiplications.
+size_t hashUtf8(utf8_cptr_t utf8Bytes, size_t byteCount) noexcept
+{
+    uint8_cptr_t bytes = reinterpret_cast<uint8_cptr_t>(utf8Bytes);
+    uint64_t seed = mix64(HashSecret0, HashSecret1);
+    uint64_t lhs, rhs;
+
+    if (byteCount <= 16)
+    {
+        if (byteCount >= 4)
+        {
+            // Read two, possibly overlapping, pairs of 32-bit words.
+            size_t offset = (byteCount >> 3) << 2;
+
+            lhs = (readWord32(bytes) << 32) | readWord32(bytes + offset);
+            rhs = (readWord32(bytes + byteCount - 4) << 32) |
+                  readWord32(bytes + byteCount - 4 - offset);
+        }
+        else if (byteCount > 0)
+        {
+            lhs = (static_cast<uint64_t>(bytes[0]) << 16) |
+                  (static_cast<uint64_t>(bytes[byteCount >> 1]) << 8) |
+                  bytes[byteCount - 1];
+            rhs = 0;
+        }
+        else
+        {
+            lhs = rhs = 0;
+        }
+    }
+    else
+    {
+        size_t remaining = byteCount;
+
+        if (remaining > 48)
+        {
+            // Process three independent lanes to hide multiplier latency.
+            uint64_t seed1 = seed;
+            uint64_t seed2 = seed;
+
+            do
+            {
+                seed = mix64(readWord64(bytes) ^ HashSecret1,
+                             readWord64(bytes + 8) ^ seed);
+                seed1 = mix64(readWord64(bytes + 16) ^ HashSecret2,
+                              readWord64(bytes + 24) ^ seed1);
+                seed2 = mix64(readWord64(bytes + 32) ^ HashSecret3,
+                              readWord64(bytes + 40) ^ seed2);
+                bytes += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+
+            seed ^= seed1 ^ seed2;
+        }
+
+        while (remaining > 16)
+        {
+            seed = mix64(readWord64(bytes) ^ HashSecret1,
+                         readWord64(bytes + 8) ^ seed);
+            bytes += 16;
+            remaining -= 16;
+        }
+
+        // Hash the last 16 bytes, which may overlap those already processed.
+        lhs = readWord64(bytes + remaining - 16);
+        rhs = readWord64(bytes + remaining - 8);
+    }
+
+    lhs ^= HashSecret1;
+    rhs ^= seed;
+    multiply128(lhs, rhs);
+
+    return static_cast<size_t>(mix64(lhs ^ HashSecret0 ^ byteCount,
+                                     rhs ^ HashSecret1));
+}
+
 //! @brief Compares two null-terminated strings without regard for case.
 //! @param[in] lhs The first string to compare.
 //! @param[in] rhs The second string to compare.
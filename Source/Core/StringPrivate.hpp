@@ -1,7 +1,7 @@
 //! @file Core/StringPrivate.hpp
 //! @brief The declaration of the inner object of the Ag library string value type.
 //! @author GiantRobotLemur@na-se.co.uk
-//! @date 2021-2023
+//! @date 2021-2026
 //! @copyright This file is part of the Silver (Ag) project which is released
 //! under LGPL 3 license. See LICENSE file at the repository root or go to
 //! https://github.com/GiantRobotLemur/Ag for full license details.
@@ -13,6 +13,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Dependent Header Files
 ////////////////////////////////////////////////////////////////////////////////
+#include <atomic>
 #include <memory>
 #include <string>
 
@@ -31,7 +32,8 @@ public:
     // Constructors/Destructors
     StringPrivate();
     StringPrivate(const StringPrivate &key);
-    StringPrivate(StringPrivate &&rhs) = delete;
+    StringPrivate(StringPrivate &&key);
+    StringPrivate(std::string &&utf8Text);
     StringPrivate(utf8_cptr_t nullTerminatedUtf8);
     StringPrivate(utf8_cptr_t boundedUtf8, size_t byteCount);
     StringPrivate(utf16_cptr_t nullTerminatedUtf16);
@@ -45,6 +47,7 @@ public:
     // Accessors
     bool isEmpty() const;
     const std::string &getData() const;
+    utf8_cptr_t getUTF8Bytes() const;
     size_t getHashCode() const;
     size_t getUTF8Length() const;
     size_t getUTF16Length() const;
@@ -55,16 +58,28 @@ public:
     StringPrivate &operator=(const StringPrivate &rhs) = delete;
     StringPrivate &operator=(StringPrivate &&rhs) = delete;
 private:
+    // Internal Types
+    //! @brief Identifies the fields which are calculated on first use.
+    enum LazyFields : uint8_t
+    {
+        HasHashCode = 0x01,
+        HasLengths = 0x02,
+    };
+
     // Internal Functions
+    void ensureLengths() const;
+    void copyLazyFields(const StringPrivate &key) noexcept;
+    void setLengths(size_t utf16Length, size_t utf32Length) noexcept;
     void initialiseUTF8(utf8_cptr_t boundedUtf8, size_t byteCount);
     void initialiseUTF16(utf16_cptr_t boundedUtf16, size_t wordCount);
     void initialiseUTF32(utf32_cptr_t boundedUtf32, size_t codePointCount);
 
     // Internal Fields
-    size_t _hashCode;
+    mutable std::atomic<size_t> _hashCode;
     size_t _utf8Length;
-    size_t _utf16Length;
-    size_t _utf32Length;
+    mutable std::atomic<size_t> _utf16Length;
+    mutable std::atomic<size_t> _utf32Length;
+    mutable std::atomic<uint8_t> _lazyState;
     utf8_cptr_t _data;
     std::string _localData;
     bool _isDynamic;
@@ -74,6 +89,7 @@ private:
 // Function Prototypes
 ///////////////////////////////////////////////////////////////////////////////
 void disposeOfDynamicString(StringPrivate *str);
+size_t hashUtf8(utf8_cptr_t utf8Bytes, size_t byteCount) noexcept;
 
 } // namespace Ag
 
@@ -19,7 +19,9 @@
 
 #include "Ag/Private/Bz2Stream.hpp"
 #include "Ag/Core/CollectionTools.hpp"
+#include "Ag/Core/Exception.hpp"
 #include "Ag/Core/FsPath.hpp"
+#include "Ag/Core/Stream.hpp"
 #include "Ag/Core/Utils.hpp"
 
 namespace Ag {
@@ -56,6 +58,39 @@ public:
     }
 };
 
+//! @brief An in-memory stream used to capture compressed data.
+class MemoryStream : public IStream
+{
+public:
+    std::vector<uint8_t> Data;
+    size_t Position = 0;
+
+    // Construction/Destruction
+    MemoryStream() = default;
+    MemoryStream(const std::vector<uint8_t> &data) : Data(data) { }
+    virtual ~MemoryStream() = default;
+
+    // Overrides
+    virtual void flush() override { }
+
+    virtual size_t read(void *targetBuffer, size_t requiredByteCount) override
+    {
+        size_t count = std::min(requiredByteCount, Data.size() - Position);
+        std::copy_n(Data.data() + Position, count, static_cast<uint8_t *>(targetBuffer));
+        Position += count;
+
+        return count;
+    }
+
+    virtual size_t write(const void *sourceBuffer, size_t sourceByteCount) override
+    {
+        const uint8_t *source = static_cast<const uint8_t *>(sourceBuffer);
+        Data.insert(Data.end(), source, source + sourceByteCount);
+
+        return sourceByteCount;
+    }
+};
+
 std::vector<uint8_t> generateRandomData(size_t byteCount, uint32_t seed)
 {
     using EntropyGenerator = std::independent_bits_engine<std::ranlux24_base, 32, uint32_t>;
@@ -195,6 +230,122 @@ std::vector<uint8_t> readWholeFile(const Ag::Fs::Path &filePath)
     return fileData;
 }
 
+// Creates data large enough to span several bzip2 blocks at level 1 which
+// contains both compressible and incompressible runs.
+std::vector<uint8_t> createMultiBlockData()
+{
+    constexpr size_t DataSize = 640 * 1024;
+    std::vector<uint8_t> programData = readWholeFile(Ag::Fs::Path::getProgramFile());
+    std::vector<uint8_t> data;
+    data.reserve(DataSize);
+
+    uint32_t seed = 1;
+
+    while ((data.size() < DataSize) && (programData.empty() == false))
+    {
+        size_t count = std::min(programData.size(), DataSize - data.size()) / 2;
+        data.insert(data.end(), programData.begin(), programData.begin() + count);
+
+        std::vector<uint8_t> noise = generateRandomData(4096, seed++);
+        data.insert(data.end(), noise.begin(), noise.end());
+    }
+
+    data.resize(std::min(data.size(), DataSize));
+
+    return data;
+}
+
+// Reads a stream to its end in fragments of an awkward size.
+std::vector<uint8_t> readAll(IStream &stream)
+{
+    std::vector<uint8_t> data;
+    uint8_t buffer[3001];
+    size_t bytesRead;
+
+    while ((bytesRead = stream.read(buffer, std::size(buffer))) > 0)
+    {
+        data.insert(data.end(), buffer, buffer + bytesRead);
+    }
+
+    return data;
+}
+
+std::vector<uint8_t> compressInParallel(const std::vector<uint8_t> &data,
+                                        size_t threadCount)
+{
+    MemoryStream compressed;
+    ParallelBz2CompressionStream specimen(&compressed, threadCount, 1);
+
+    // Write in pieces which don't align with the chunk size.
+    constexpr size_t PieceSize = 10007;
+
+    for (size_t offset = 0; offset < data.size(); offset += PieceSize)
+    {
+        size_t count = std::min(PieceSize, data.size() - offset);
+        EXPECT_EQ(specimen.write(data.data() + offset, count), count);
+    }
+
+    specimen.close();
+
+    return compressed.Data;
+}
+
+// Creates data which compresses to bzip2 blocks containing the end of stream
+// magic number. Each block header has a 16-bit map of the byte values in use
+// for each group of 16 values, so using the byte values corresponding to the
+// bits of the magic number in the first 3 groups reproduces it.
+std::vector<uint8_t> createEndMagicData(size_t byteCount)
+{
+    constexpr uint16_t GroupMaps[] = { 0x1772, 0x4538, 0x5090 };
+    std::vector<uint8_t> byteValues;
+
+    for (size_t group = 0; group < std::size(GroupMaps); ++group)
+    {
+        for (uint8_t bit = 0; bit < 16; ++bit)
+        {
+            if (GroupMaps[group] & (0x8000 >> bit))
+                byteValues.push_back(static_cast<uint8_t>((group * 16) + bit));
+        }
+    }
+
+    // Never repeat a byte, as runs would add their lengths to the values used.
+    std::mt19937 generator(17);
+    std::uniform_int_distribution<size_t> selector(1, byteValues.size() - 1);
+    std::vector<uint8_t> data(byteCount);
+    size_t previous = 0;
+
+    for (uint8_t &next : data)
+    {
+        previous = (previous + selector(generator)) % byteValues.size();
+        next = byteValues[previous];
+    }
+
+    return data;
+}
+
+// Counts the occurrences of the bzip2 end of stream magic number at any bit
+// alignment within compressed data.
+size_t countEndMagic(const std::vector<uint8_t> &compressed)
+{
+    constexpr uint64_t EndMagic = 0x177245385090ull;
+    constexpr uint64_t MagicMask = 0xFFFFFFFFFFFFull;
+    uint64_t shifter = 0;
+    size_t count = 0;
+
+    for (size_t index = 0; index < compressed.size(); ++index)
+    {
+        shifter = (shifter << 8) | compressed[index];
+
+        for (size_t shift = 0; (index >= 6) && (shift < 8); ++shift)
+        {
+            if (((shifter >> shift) & MagicMask) == EndMagic)
+                ++count;
+        }
+    }
+
+    return count;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Unit Tests
 ////////////////////////////////////////////////////////////////////////////////
@@ -229,6 +380,130 @@ GTEST_TEST(Bz2Stream, CompressionAndDecompressionBinaryData)
     testCompressionAndDecompression(programData.data(), programData.size(), false);
 }
 
+GTEST_TEST(Bz2Stream, ParallelCompressionReadBySerialDecompressor)
+{
+    std::vector<uint8_t> original = createMultiBlockData();
+    ASSERT_FALSE(original.empty());
+
+    MemoryStream compressed(compressInParallel(original, 3));
+    ASSERT_LT(compressed.Data.size(), original.size());
+
+    Bz2DecompressionStream specimen(&compressed, 4096);
+    std::vector<uint8_t> result = readAll(specimen);
+
+    ASSERT_EQ(result.size(), original.size());
+    EXPECT_TRUE(result == original);
+}
+
+GTEST_TEST(Bz2Stream, SerialCompressionReadByParallelDecompressor)
+{
+    std::vector<uint8_t> original = createMultiBlockData();
+    ASSERT_FALSE(original.empty());
+
+    MemoryStream compressed;
+
+    {
+        Bz2CompressionStream compressor(&compressed, 4096, 1);
+        ASSERT_EQ(compressor.write(original.data(), original.size()), original.size());
+    }
+
+    ParallelBz2DecompressionStream specimen(&compressed, 3);
+    std::vector<uint8_t> result = readAll(specimen);
+
+    ASSERT_EQ(result.size(), original.size());
+    EXPECT_TRUE(result == original);
+}
+
+GTEST_TEST(Bz2Stream, ParallelRoundTripConcatenatedStreams)
+{
+    std::vector<uint8_t> original = createMultiBlockData();
+    std::vector<uint8_t> extra = generateRandomData(1000, 99);
+    MemoryStream compressed(compressInParallel(original, 2));
+    std::vector<uint8_t> second = compressInParallel(extra, 1);
+
+    compressed.Data.insert(compressed.Data.end(), second.begin(), second.end());
+
+    ParallelBz2DecompressionStream specimen(&compressed, 2);
+    std::vector<uint8_t> result = readAll(specimen);
+
+    original.insert(original.end(), extra.begin(), extra.end());
+    ASSERT_EQ(result.size(), original.size());
+    EXPECT_TRUE(result == original);
+}
+
+GTEST_TEST(Bz2Stream, ParallelEmptyStream)
+{
+    MemoryStream compressed(compressInParallel(std::vector<uint8_t>(), 1));
+    ASSERT_FALSE(compressed.Data.empty());
+
+    Bz2DecompressionStream serial(&compressed, 256);
+    EXPECT_TRUE(readAll(serial).empty());
+
+    compressed.Position = 0;
+    ParallelBz2DecompressionStream parallel(&compressed, 1);
+    EXPECT_TRUE(readAll(parallel).empty());
+}
+
+GTEST_TEST(Bz2Stream, ParallelDecompressorIgnoresEndMagicInBlock)
+{
+    std::vector<uint8_t> original = createEndMagicData(20000);
+    MemoryStream compressed;
+
+    {
+        Bz2CompressionStream compressor(&compressed, 4096, 1);
+        ASSERT_EQ(compressor.write(original.data(), original.size()), original.size());
+    }
+
+    // The magic number should occur within the block as well as at the end.
+    ASSERT_GT(countEndMagic(compressed.Data), 1u);
+
+    ParallelBz2DecompressionStream specimen(&compressed, 2);
+    std::vector<uint8_t> result = readAll(specimen);
+
+    ASSERT_EQ(result.size(), original.size());
+    EXPECT_TRUE(result == original);
+}
+
+GTEST_TEST(Bz2Stream, ParallelDecompressorIgnoresEndMagicInLaterBlock)
+{
+    // Follow ordinary blocks with enough data for at least one whole block
+    // to contain the end magic number, then concatenate another stream.
+    std::vector<uint8_t> original = createMultiBlockData();
+    original.resize(200 * 1024);
+
+    std::vector<uint8_t> crafted = createEndMagicData(300 * 1024);
+    original.insert(original.end(), crafted.begin(), crafted.end());
+
+    std::vector<uint8_t> extra = generateRandomData(1000, 98);
+    MemoryStream compressed(compressInParallel(original, 3));
+    std::vector<uint8_t> second = compressInParallel(extra, 1);
+
+    ASSERT_GT(countEndMagic(compressed.Data), 1u);
+    compressed.Data.insert(compressed.Data.end(), second.begin(), second.end());
+
+    ParallelBz2DecompressionStream specimen(&compressed, 3);
+    std::vector<uint8_t> result = readAll(specimen);
+
+    original.insert(original.end(), extra.begin(), extra.end());
+    ASSERT_EQ(result.size(), original.size());
+    EXPECT_TRUE(result == original);
+}
+
+GTEST_TEST(Bz2Stream, ParallelDecompressorRejectsCorruptData)
+{
+    std::vector<uint8_t> original = createMultiBlockData();
+    MemoryStream compressed(compressInParallel(original, 2));
+
+    compressed.Data[compressed.Data.size() / 2] ^= 0x10;
+
+    ParallelBz2DecompressionStream specimen(&compressed, 2);
+    EXPECT_THROW(readAll(specimen), Exception);
+
+    MemoryStream notCompressed(original);
+    ParallelBz2DecompressionStream other(&notCompressed, 1);
+    EXPECT_THROW(readAll(other), Exception);
+}
+
 } // Anonymous namespace
 
 } // namespace Ag
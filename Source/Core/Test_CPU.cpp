@@ -26,7 +26,7 @@ GTEST_TEST(CPU, GetX86_64ArchVersion)
 {
     int version = getX86_64ArchVersion();
 
-#if defined(_MSC_VER) && defined(_M_AMD64)
+#if defined(_M_AMD64) || defined(__x86_64__)
     EXPECT_GE(version, 1);
 #else
     EXPECT_EQ(version, 0);
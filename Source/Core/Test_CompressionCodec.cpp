@@ -0,0 +1,210 @@
+//! @file Core/Test_CompressionCodec.cpp
+//! @brief The definition of unit tests for the compression codecs and the
+//! streams which apply them.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Header File Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Ag/Core/CompressionCodec.hpp"
+#include "Ag/Core/Exception.hpp"
+
+namespace Ag {
+
+namespace {
+////////////////////////////////////////////////////////////////////////////////
+// Local Data Types
+////////////////////////////////////////////////////////////////////////////////
+//! @brief An in-memory stream used to capture compressed data.
+class VectorStream : public IStream
+{
+public:
+    std::vector<uint8_t> Data;
+    size_t Position = 0;
+
+    virtual void flush() override { }
+
+    virtual size_t read(void *targetBuffer, size_t requiredByteCount) override
+    {
+        size_t count = std::min(requiredByteCount, Data.size() - Position);
+        std::copy_n(Data.data() + Position, count, static_cast<uint8_t *>(targetBuffer));
+        Position += count;
+
+        return count;
+    }
+
+    virtual size_t write(const void *sourceBuffer, size_t sourceByteCount) override
+    {
+        const uint8_t *source = static_cast<const uint8_t *>(sourceBuffer);
+        Data.insert(Data.end(), source, source + sourceByteCount);
+
+        return sourceByteCount;
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+std::vector<uint8_t> createRandomData(size_t byteCount, uint32_t seed)
+{
+    std::mt19937 generator(seed);
+    std::vector<uint8_t> data(byteCount);
+
+    std::generate(data.begin(), data.end(),
+                  [&generator]() { return static_cast<uint8_t>(generator()); });
+
+    return data;
+}
+
+std::vector<uint8_t> createTextData(size_t byteCount)
+{
+    static const char *words[] = { "alpha ", "beta ", "gamma ", "delta ",
+                                   "epsilon ", "zeta ", "eta ", "theta\n" };
+    std::mt19937 generator(42);
+    std::vector<uint8_t> data;
+    data.reserve(byteCount + 16);
+
+    while (data.size() < byteCount)
+    {
+        const char *word = words[generator() % std::size(words)];
+        data.insert(data.end(), word, word + std::char_traits<char>::length(word));
+    }
+
+    data.resize(byteCount);
+
+    return data;
+}
+
+void verifyRoundTrip(const ICompressionCodec &codec, const std::vector<uint8_t> &original)
+{
+    std::vector<uint8_t> compressed;
+    codec.compress(original.data(), original.size(), compressed);
+
+    EXPECT_LE(compressed.size(), codec.getMaxCompressedSize(original.size()));
+
+    std::vector<uint8_t> decompressed(original.size());
+    codec.decompress(compressed.data(), compressed.size(),
+                     decompressed.data(), decompressed.size());
+
+    EXPECT_EQ(decompressed, original);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Unit Tests
+////////////////////////////////////////////////////////////////////////////////
+GTEST_TEST(CompressionCodec, GetCodecs)
+{
+    EXPECT_EQ(getCompressionCodec(CompressionCodecID::Bzip2).getID(),
+              CompressionCodecID::Bzip2);
+    EXPECT_EQ(getCompressionCodec(CompressionCodecID::Lz).getID(),
+              CompressionCodecID::Lz);
+    EXPECT_EQ(tryGetCompressionCodec(CompressionCodecID::Max), nullptr);
+    EXPECT_THROW(getCompressionCodec(CompressionCodecID::Max), ArgumentException);
+}
+
+GTEST_TEST(CompressionCodec, RoundTripBlocks)
+{
+    std::vector<std::vector<uint8_t>> samples;
+    samples.emplace_back();
+    samples.emplace_back(1, 'A');
+    samples.emplace_back(13, 'B');
+    samples.emplace_back(100000, 0);
+    samples.push_back(createRandomData(70000, 1));
+    samples.push_back(createTextData(300000));
+
+    for (CompressionCodecID id : { CompressionCodecID::Bzip2, CompressionCodecID::Lz })
+    {
+        const ICompressionCodec &codec = getCompressionCodec(id);
+
+        for (const std::vector<uint8_t> &sample : samples)
+        {
+            verifyRoundTrip(codec, sample);
+        }
+    }
+}
+
+GTEST_TEST(CompressionCodec, LzCompressesRepetitiveData)
+{
+    const ICompressionCodec &codec = getCompressionCodec(CompressionCodecID::Lz);
+    std::vector<uint8_t> text = createTextData(100000);
+    std::vector<uint8_t> compressed;
+
+    codec.compress(text.data(), text.size(), compressed);
+
+    EXPECT_LT(compressed.size(), text.size() / 2);
+}
+
+GTEST_TEST(CompressionCodec, LzRejectsCorruptData)
+{
+    const ICompressionCodec &codec = getCompressionCodec(CompressionCodecID::Lz);
+    std::vector<uint8_t> text = createTextData(10000);
+    std::vector<uint8_t> compressed;
+    std::vector<uint8_t> output(text.size());
+
+    codec.compress(text.data(), text.size(), compressed);
+
+    // Truncated data.
+    EXPECT_THROW(codec.decompress(compressed.data(), compressed.size() / 2,
+                                  output.data(), output.size()),
+                 OperationException);
+
+    // The wrong expected size.
+    EXPECT_THROW(codec.decompress(compressed.data(), compressed.size(),
+                                  output.data(), output.size() - 1),
+                 OperationException);
+
+    // A match which refers to before the start of the output.
+    const uint8_t badOffset[] = { 0x10, 'A', 0x10, 0x00, 0x00 };
+    EXPECT_THROW(codec.decompress(badOffset, sizeof(badOffset),
+                                  output.data(), 5),
+                 OperationException);
+}
+
+GTEST_TEST(CompressionCodec, RoundTripStreams)
+{
+    std::vector<uint8_t> original = createTextData(200000);
+
+    for (CompressionCodecID id : { CompressionCodecID::Bzip2, CompressionCodecID::Lz })
+    {
+        const ICompressionCodec &codec = getCompressionCodec(id);
+        VectorStream compressed;
+
+        {
+            CodecCompressionStream compressor(&compressed, codec, 32 * 1024);
+
+            // Write in uneven pieces to cross block boundaries.
+            for (size_t offset = 0; offset < original.size(); offset += 1000)
+            {
+                size_t count = std::min<size_t>(1000, original.size() - offset);
+                ASSERT_EQ(compressor.write(original.data() + offset, count), count);
+            }
+
+            compressor.close();
+        }
+
+        CodecDecompressionStream decompressor(&compressed, codec);
+        std::vector<uint8_t> decompressed(original.size() + 100);
+
+        ASSERT_EQ(decompressor.read(decompressed.data(), decompressed.size()),
+                  original.size());
+        decompressed.resize(original.size());
+        EXPECT_EQ(decompressed, original);
+    }
+}
+
+} // Anonymous namespace
+
+} // namespace Ag
+////////////////////////////////////////////////////////////////////////////////
@@ -33,6 +33,24 @@ public:
     }
 };
 
+//! @brief Restores the exception stack capture policy on destruction.
+class CapturePolicyScope
+{
+public:
+    CapturePolicyScope(StackCapturePolicy policy) :
+        _previous(Exception::getStackCapturePolicy())
+    {
+        Exception::setStackCapturePolicy(policy);
+    }
+
+    ~CapturePolicyScope()
+    {
+        Exception::setStackCapturePolicy(_previous);
+    }
+private:
+    StackCapturePolicy _previous;
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 // Unit Tests
 ////////////////////////////////////////////////////////////////////////////////
@@ -78,6 +96,60 @@ GTEST_TEST(Exception, CreateSimple)
 }
 NO_OPTIMIZE_FN_END
 
+GTEST_TEST(Exception, CapturePolicyOff)
+{
+    CapturePolicyScope scope(StackCapturePolicy::Off);
+
+    MyCustomException specimen("Hello", "World", 0);
+
+    EXPECT_STREQ(specimen.getDomain().data(), "Custom");
+    EXPECT_TRUE(specimen.getStackTrace().isEmpty());
+}
+
+NO_OPTIMIZE_FN_BEGIN
+GTEST_TEST(Exception, CapturePolicyRaw)
+{
+    CapturePolicyScope scope(StackCapturePolicy::Raw);
+
+    MyCustomException specimen("Hello", "World", 0);
+
+    // The trace is resolved on first access and is stable thereafter.
+    const StackTrace &trace = specimen.getStackTrace();
+    ASSERT_FALSE(trace.isEmpty());
+    EXPECT_EQ(&specimen.getStackTrace(), &trace);
+    EXPECT_GE(trace.getEntryCount(), 3);
+    EXPECT_NE(trace.getEntrySymbol(0).find(__FUNCTION__), std::string_view::npos);
+}
+NO_OPTIMIZE_FN_END
+
+GTEST_TEST(Exception, RepeatedThrowsShareTrace)
+{
+    CapturePolicyScope scope(StackCapturePolicy::Full);
+    std::vector<MyCustomException> thrown;
+
+    for (int index = 0; index < 3; ++index)
+    {
+        try
+        {
+            throw MyCustomException("Repeated", "Same site", index);
+        }
+        catch (const MyCustomException &ex)
+        {
+            thrown.push_back(ex);
+        }
+    }
+
+    ASSERT_FALSE(thrown.front().getStackTrace().isEmpty());
+    EXPECT_EQ(thrown[0].getStackTrace().getData(), thrown[1].getStackTrace().getData());
+    EXPECT_EQ(thrown[0].getStackTrace().getData(), thrown[2].getStackTrace().getData());
+
+    // A different throw site must have its own trace.
+    MyCustomException other("Different", "Other site", 0);
+
+    ASSERT_FALSE(other.getStackTrace().isEmpty());
+    EXPECT_NE(other.getStackTrace().getData(), thrown[0].getStackTrace().getData());
+}
+
 } // namespace Ag
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -11,6 +11,8 @@
 // Header File Includes
 ////////////////////////////////////////////////////////////////////////////////
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <gtest/gtest.h>
 
 #include <Ag/Core.hpp>
@@ -379,8 +381,57 @@ GTEST_TEST(Format, FormatRealG)
     buffer.clear();
     appendValue(specimen, buffer, 108.1344);
 
-    // Give up!
-    // EXPECT_STREQ(buffer.c_str(), "108.1344");
+    EXPECT_STREQ(buffer.c_str(), "108.1344");
+
+    buffer.clear();
+    appendValue(specimen, buffer, 0.1);
+
+    EXPECT_STREQ(buffer.c_str(), "0.1");
+
+    buffer.clear();
+    appendValue(specimen, buffer, -2.5);
+
+    EXPECT_STREQ(buffer.c_str(), "-2.5");
+
+    buffer.clear();
+    appendValue(specimen, buffer, 1.0e-7);
+
+    EXPECT_STREQ(buffer.c_str(), "1e-7");
+
+    buffer.clear();
+    appendValue(specimen, buffer, -1.25e100);
+
+    EXPECT_STREQ(buffer.c_str(), "-1.25e100");
+
+    buffer.clear();
+    appendValue(specimen, buffer, 1.0 / 3.0);
+
+    EXPECT_STREQ(buffer.c_str(), "0.3333333333333333");
+}
+
+GTEST_TEST(Format, FormatRealRoundTrip)
+{
+    FormatInfo specimen(LocaleInfo::getNeutral());
+    std::string buffer;
+    uint64_t bits = 0x123456789ABCDEFull;
+
+    for (int count = 0; count < 10000; ++count)
+    {
+        // Generate pseudo-random bit patterns with a linear congruential generator.
+        bits = (bits * 6364136223846793005ull) + 1442695040888963407ull;
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+
+        if (std::isnormal(value) == false)
+        {
+            continue;
+        }
+
+        buffer.clear();
+        appendValue(specimen, buffer, value);
+
+        EXPECT_EQ(std::strtod(buffer.c_str(), nullptr), value) << buffer;
+    }
 }
 
 GTEST_TEST(Format, FormatFileSize)
@@ -446,6 +497,82 @@ GTEST_TEST(FormattedOutput, EmbedInt)
     EXPECT_STREQ(buffer.c_str(), "Does a radioactive cat have 9 half-lives?");
 }
 
+GTEST_TEST(CompiledFormat, LiteralText)
+{
+    CompiledFormat specimen(FormatInfo(LocaleInfo::getNeutral()),
+                            "No values {{here} at all{");
+    std::string buffer;
+
+    EXPECT_EQ(specimen.getParameterCount(), 0u);
+
+    specimen.append(buffer);
+    EXPECT_STREQ(buffer.c_str(), "No values {here} at all{");
+}
+
+GTEST_TEST(CompiledFormat, ReuseWithTypedValues)
+{
+    CompiledFormat specimen(FormatInfo(LocaleInfo::getNeutral()),
+                            "Does a radioactive {1} have {0} half-lives?");
+    std::string buffer;
+
+    EXPECT_EQ(specimen.getParameterCount(), 2u);
+
+    specimen.append(buffer, 9, "cat");
+    EXPECT_STREQ(buffer.c_str(), "Does a radioactive cat have 9 half-lives?");
+
+    buffer.clear();
+    specimen.append(buffer, 2.5, std::string("dog"));
+    EXPECT_STREQ(buffer.c_str(), "Does a radioactive dog have 2.5 half-lives?");
+
+    String result = specimen.format(uint8_t(3), String("bat"));
+    EXPECT_EQ(result, "Does a radioactive bat have 3 half-lives?");
+}
+
+GTEST_TEST(CompiledFormat, MatchesVariantFormatting)
+{
+    FormatInfo options(LocaleInfo::getNeutral());
+    std::string_view spec = "{0:X4}|{1:F2}|{2:d5}|{3:K}|{4}|{5}|{6:E3}|{7}";
+    CompiledFormat specimen(options, spec);
+    String name("Bob");
+    std::string expected;
+    std::string buffer;
+
+    appendFormat(options, spec, expected,
+                 { 0xBEEFu, 3.14159, -42, uint64_t(1536) * 1024, true,
+                   U'\u00A3', 1.0 / 3.0, name });
+
+    specimen.append(buffer, 0xBEEFu, 3.14159, -42, uint64_t(1536) * 1024, true,
+                    U'\u00A3', 1.0 / 3.0, name);
+
+    EXPECT_EQ(buffer, expected);
+
+    // Variants can be passed through directly.
+    buffer.clear();
+    Variant boxed(int16_t(-7));
+    CompiledFormat boxedSpec(options, "[{0:d3}]");
+
+    boxedSpec.append(buffer, boxed);
+    EXPECT_STREQ(buffer.c_str(), "[-007]");
+
+    buffer.clear();
+    boxedSpec.appendVariants(buffer, { int16_t(-7) });
+    EXPECT_STREQ(buffer.c_str(), "[-007]");
+}
+
+GTEST_TEST(CompiledFormat, Errors)
+{
+    FormatInfo options(LocaleInfo::getNeutral());
+    std::string buffer;
+
+    EXPECT_THROW({ CompiledFormat(options, "Bad {0:"); }, Exception);
+    EXPECT_THROW({ CompiledFormat(options, "Bad {0:Z}"); }, Exception);
+
+    CompiledFormat specimen(options, "{0} and {2}");
+
+    EXPECT_THROW({ specimen.append(buffer, 1, 2); }, Exception);
+    EXPECT_THROW({ CompiledFormat(options, "{0:K}").append(buffer, "text"); }, Exception);
+}
+
 } // Anonymous namespace
 
 } // namespace Ag
@@ -0,0 +1,182 @@
+//! @file Core/Test_Instrumentation.cpp
+//! @brief The definition of unit tests for instrumentation zones, counters
+//! and histograms.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Header File Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Ag/Core/Instrumentation.hpp"
+
+namespace Ag {
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Data Types
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Enables instrumentation for the lifetime of the object, discarding
+//! any events recorded before and after.
+class InstrumentationScope
+{
+public:
+    InstrumentationScope(bool isEnabled = true)
+    {
+        Instrumentation::clear();
+        Instrumentation::setEnabled(isEnabled);
+    }
+
+    ~InstrumentationScope()
+    {
+        Instrumentation::setEnabled(false);
+        Instrumentation::clear();
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Unit Tests
+////////////////////////////////////////////////////////////////////////////////
+GTEST_TEST(Instrumentation, DisabledRecordsNothing)
+{
+    InstrumentationScope scope(false);
+    InstrumentHistogram histogram;
+
+    {
+        AG_INSTRUMENT_ZONE("Disabled zone");
+        AG_INSTRUMENT_COUNTER("Disabled counter", 42);
+        AG_INSTRUMENT_SAMPLE("Disabled histogram", 42);
+    }
+
+    EXPECT_FALSE(Instrumentation::isEnabled());
+    EXPECT_EQ(Instrumentation::getEventCount(), 0u);
+    EXPECT_FALSE(Instrumentation::tryGetHistogram("Disabled histogram", histogram));
+}
+
+GTEST_TEST(Instrumentation, RecordZonesAndCounters)
+{
+    InstrumentationScope scope;
+
+    {
+        AG_INSTRUMENT_ZONE("Outer zone");
+
+        for (int index = 0; index < 3; ++index)
+        {
+            AG_INSTRUMENT_ZONE("Inner \"zone\"");
+            AG_INSTRUMENT_COUNTER("Loop counter", index);
+        }
+    }
+
+    EXPECT_EQ(Instrumentation::getEventCount(), 7u);
+
+    std::string trace;
+    Instrumentation::appendChromeTrace(trace);
+
+    EXPECT_EQ(trace.front(), '{');
+    EXPECT_NE(trace.find("\"traceEvents\":["), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"Outer zone\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"Inner \\\"zone\\\"\""), std::string::npos);
+    EXPECT_NE(trace.find("\"ph\":\"X\",\"dur\":"), std::string::npos);
+    EXPECT_NE(trace.find("\"ph\":\"C\",\"args\":{\"value\":2}"), std::string::npos);
+
+    Instrumentation::clear();
+    EXPECT_EQ(Instrumentation::getEventCount(), 0u);
+}
+
+GTEST_TEST(Instrumentation, HistogramBuckets)
+{
+    InstrumentationScope scope;
+
+    for (int64_t value : { 0, 1, 2, 3, 4, 1000 })
+    {
+        AG_INSTRUMENT_SAMPLE("Sizes", value);
+    }
+
+    InstrumentHistogram histogram;
+    ASSERT_TRUE(Instrumentation::tryGetHistogram("Sizes", histogram));
+
+    EXPECT_EQ(histogram.Count, 6u);
+    EXPECT_EQ(histogram.Min, 0);
+    EXPECT_EQ(histogram.Max, 1000);
+    EXPECT_DOUBLE_EQ(histogram.Sum, 1010.0);
+    EXPECT_EQ(histogram.Buckets[0], 1u);
+    EXPECT_EQ(histogram.Buckets[1], 1u);
+    EXPECT_EQ(histogram.Buckets[2], 2u);
+    EXPECT_EQ(histogram.Buckets[3], 1u);
+    EXPECT_EQ(histogram.Buckets[10], 1u);
+
+    // Histograms are not trace events.
+    EXPECT_EQ(Instrumentation::getEventCount(), 0u);
+
+    std::string trace;
+    Instrumentation::appendChromeTrace(trace);
+
+    EXPECT_NE(trace.find("\"Sizes\":{\"count\":6,\"min\":0,\"max\":1000"),
+              std::string::npos);
+}
+
+GTEST_TEST(Instrumentation, RecordOnManyThreads)
+{
+    InstrumentationScope scope;
+
+    // Record more events than a thread can buffer.
+    constexpr size_t EventsPerThread = 10000;
+    constexpr size_t ThreadCount = 4;
+    std::vector<std::thread> threads;
+
+    for (size_t index = 0; index < ThreadCount; ++index)
+    {
+        threads.emplace_back([]()
+        {
+            for (size_t count = 0; count < EventsPerThread; ++count)
+            {
+                AG_INSTRUMENT_ZONE("Worker zone");
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(Instrumentation::getEventCount(), EventsPerThread * ThreadCount);
+}
+
+GTEST_TEST(Instrumentation, DropEventsBeyondCapacity)
+{
+    InstrumentationScope scope;
+    Instrumentation::setEventCapacity(100);
+
+    for (int index = 0; index < 150; ++index)
+    {
+        AG_INSTRUMENT_COUNTER("Capped counter", index);
+    }
+
+    EXPECT_EQ(Instrumentation::getEventCount(), 100u);
+    EXPECT_EQ(Instrumentation::getDroppedEventCount(), 50u);
+
+    // Clearing makes space again.
+    Instrumentation::clear();
+    EXPECT_EQ(Instrumentation::getDroppedEventCount(), 0u);
+
+    AG_INSTRUMENT_COUNTER("Capped counter", 0);
+    EXPECT_EQ(Instrumentation::getEventCount(), 1u);
+
+    Instrumentation::setEventCapacity(Instrumentation::DefaultEventCapacity);
+}
+
+} // Anonymous namespace
+
+} // namespace Ag
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,186 @@
+//! @file Core/Test_SamplingProfiler.cpp
+//! @brief The definition of unit tests for the SamplingProfiler class.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Header File Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <thread>
+
+#ifndef _WIN32
+#include <csignal>
+#include <pthread.h>
+#endif
+
+#include <gtest/gtest.h>
+
+#include <Ag/Core.hpp>
+#include <Ag/GTest_Core.hpp>
+
+namespace Ag {
+
+// Note no anonymous namespace so that the functions sampled definitely
+// appear in the stack trace.
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+NO_OPTIMIZE_FN_BEGIN
+// Consumes CPU time for a fixed period so that the thread is sampled.
+double burnCpuForProfiler(std::chrono::milliseconds period)
+{
+    auto end = std::chrono::steady_clock::now() + period;
+    double total = 0.0;
+
+    while (std::chrono::steady_clock::now() < end)
+    {
+        for (int index = 1; index < 1000; ++index)
+        {
+            total += std::sqrt(static_cast<double>(index));
+        }
+    }
+
+    return total;
+}
+
+// Consumes CPU time on a thread other than the one which started profiling.
+double burnCpuOnWorkerThread(std::chrono::milliseconds period)
+{
+    return burnCpuForProfiler(period);
+}
+NO_OPTIMIZE_FN_END
+
+////////////////////////////////////////////////////////////////////////////////
+// Unit Tests
+////////////////////////////////////////////////////////////////////////////////
+GTEST_TEST(SamplingProfiler, IdleProfiler)
+{
+    SamplingProfiler specimen;
+    std::string collapsed;
+
+    EXPECT_FALSE(specimen.isRunning());
+    EXPECT_EQ(specimen.getSampleCount(), 0u);
+    EXPECT_EQ(specimen.getStackCount(), 0u);
+
+    specimen.stop();
+    specimen.appendCollapsedStacks(collapsed);
+    EXPECT_TRUE(collapsed.empty());
+}
+
+GTEST_TEST(SamplingProfiler, OnlyOneProfilerRuns)
+{
+    if (SamplingProfiler::isSupported() == false)
+        GTEST_SKIP();
+
+    SamplingProfiler first;
+    SamplingProfiler second;
+
+    first.start();
+    EXPECT_TRUE(first.isRunning());
+    EXPECT_THROW(second.start(), OperationException);
+    EXPECT_FALSE(second.isRunning());
+
+    first.stop();
+    EXPECT_FALSE(first.isRunning());
+}
+
+GTEST_TEST(SamplingProfiler, SampleCurrentThread)
+{
+    if (SamplingProfiler::isSupported() == false)
+        GTEST_SKIP();
+
+    SamplingProfiler specimen;
+
+    specimen.start(1000);
+    EXPECT_GT(burnCpuForProfiler(std::chrono::milliseconds(300)), 0.0);
+    specimen.stop();
+
+    EXPECT_GT(specimen.getSampleCount(), 10u);
+    EXPECT_GT(specimen.getStackCount(), 0u);
+
+    std::string collapsed;
+    specimen.appendCollapsedStacks(collapsed);
+
+    EXPECT_NE(collapsed.find("burnCpuForProfiler"), std::string::npos);
+    EXPECT_EQ(collapsed.back(), '\n');
+
+    specimen.clear();
+    EXPECT_EQ(specimen.getSampleCount(), 0u);
+    EXPECT_EQ(specimen.getStackCount(), 0u);
+}
+
+GTEST_TEST(SamplingProfiler, SampleRegisteredThread)
+{
+    if (SamplingProfiler::isSupported() == false)
+        GTEST_SKIP();
+
+    SamplingProfiler specimen;
+    specimen.start(1000);
+
+    std::thread worker([]()
+    {
+        SamplingProfiler::registerCurrentThread();
+        burnCpuOnWorkerThread(std::chrono::milliseconds(300));
+    });
+
+    worker.join();
+    specimen.stop();
+
+    std::string collapsed;
+    specimen.appendCollapsedStacks(collapsed);
+
+    EXPECT_NE(collapsed.find("burnCpuOnWorkerThread"), std::string::npos);
+}
+
+GTEST_TEST(SamplingProfiler, RepeatedStartStop)
+{
+    if (SamplingProfiler::isSupported() == false)
+        GTEST_SKIP();
+
+    // Stop while signals are likely to be pending, the process must survive.
+    SamplingProfiler specimen;
+
+    for (int iteration = 0; iteration < 200; ++iteration)
+    {
+        specimen.start(100000);
+        EXPECT_GT(burnCpuForProfiler(std::chrono::milliseconds(1)), 0.0);
+        specimen.stop();
+        EXPECT_FALSE(specimen.isRunning());
+    }
+}
+
+#ifndef _WIN32
+GTEST_TEST(SamplingProfiler, StopDiscardsPendingSignals)
+{
+    // Leave a signal pending across stop(), it must not be delivered to
+    // the default action once SIGPROF is unblocked.
+    sigset_t profileSignal;
+    sigemptyset(&profileSignal);
+    sigaddset(&profileSignal, SIGPROF);
+
+    SamplingProfiler specimen;
+
+    for (int iteration = 0; iteration < 20; ++iteration)
+    {
+        pthread_sigmask(SIG_BLOCK, &profileSignal, nullptr);
+        specimen.start(100000);
+        EXPECT_GT(burnCpuForProfiler(std::chrono::milliseconds(1)), 0.0);
+        pthread_kill(pthread_self(), SIGPROF);
+        specimen.stop();
+        pthread_sigmask(SIG_UNBLOCK, &profileSignal, nullptr);
+
+        EXPECT_FALSE(specimen.isRunning());
+    }
+}
+#endif
+
+} // namespace Ag
+////////////////////////////////////////////////////////////////////////////////
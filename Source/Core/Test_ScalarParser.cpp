@@ -1,7 +1,7 @@
 //! @file Core/Test_ScalarParser.cpp
 //! @brief The definition of unit tests for the ScalarParser class.
 //! @author GiantRobotLemur@na-se.co.uk
-//! @date 2021-2024
+//! @date 2021-2026
 //! @copyright This file is part of the Silver (Ag) project which is released
 //! under LGPL 3 license. See LICENSE file at the repository root or go to
 //! https://github.com/GiantRobotLemur/Ag for full license details.
@@ -10,6 +10,10 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Header File Includes
 ////////////////////////////////////////////////////////////////////////////////
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
 #include <gtest/gtest.h>
 
 #include <Ag/Core.hpp>
@@ -64,6 +68,157 @@ GTEST_TEST(ScalarParser, ParseIntegers)
     EXPECT_EQ(int8, -128);
 }
 
+GTEST_TEST(ScalarParser, FastPathIntegers)
+{
+    int32_t int32 = 0;
+    EXPECT_EQ(parseScalarPrefix("0", int32), 1u);
+    EXPECT_EQ(int32, 0);
+
+    EXPECT_EQ(parseScalarPrefix("-2147483648,", int32), 11u);
+    EXPECT_EQ(int32, std::numeric_limits<int32_t>::min());
+
+    EXPECT_EQ(parseScalarPrefix("+2147483647 ", int32), 11u);
+    EXPECT_EQ(int32, std::numeric_limits<int32_t>::max());
+
+    EXPECT_EQ(parseScalarPrefix("2147483648", int32), 0u);
+    EXPECT_EQ(parseScalarPrefix("-", int32), 0u);
+    EXPECT_EQ(parseScalarPrefix("x12", int32), 0u);
+
+    uint64_t uint64 = 0;
+    EXPECT_EQ(parseScalarPrefix("18446744073709551615", uint64), 20u);
+    EXPECT_EQ(uint64, std::numeric_limits<uint64_t>::max());
+    EXPECT_EQ(parseScalarPrefix("18446744073709551616", uint64), 0u);
+    EXPECT_EQ(parseScalarPrefix("000000000000000000000000042", uint64), 27u);
+    EXPECT_EQ(uint64, 42u);
+    EXPECT_EQ(parseScalarPrefix("-1", uint64), 0u);
+
+    EXPECT_EQ(parseScalarPrefix("DeadBeef", uint64, 16), 8u);
+    EXPECT_EQ(uint64, 0xDEADBEEFu);
+    EXPECT_EQ(parseScalarPrefix("ffffffffffffffff", uint64, 16), 16u);
+    EXPECT_EQ(uint64, std::numeric_limits<uint64_t>::max());
+    EXPECT_EQ(parseScalarPrefix("10000000000000000", uint64, 16), 0u);
+
+    int8_t int8 = 0;
+    EXPECT_EQ(parseScalarPrefix("-129", int8), 0u);
+    EXPECT_EQ(parseScalarPrefix("-128", int8), 4u);
+    EXPECT_EQ(int8, -128);
+
+    EXPECT_THROW(parseScalarPrefix("1", int8, 37), ArgumentException);
+}
+
+GTEST_TEST(ScalarParser, FastPathReals)
+{
+    double value = 0.0;
+
+    EXPECT_EQ(parseScalarPrefix("0.1", value), 3u);
+    EXPECT_EQ(value, 0.1);
+
+    EXPECT_EQ(parseScalarPrefix("-2.5e-3;", value), 7u);
+    EXPECT_EQ(value, -2.5e-3);
+
+    EXPECT_EQ(parseScalarPrefix("1e", value), 1u);
+    EXPECT_EQ(value, 1.0);
+
+    EXPECT_EQ(parseScalarPrefix("3.", value), 1u);
+    EXPECT_EQ(value, 3.0);
+
+    EXPECT_EQ(parseScalarPrefix("123456789012345678901234567890", value), 30u);
+    EXPECT_EQ(value, 123456789012345678901234567890.0);
+
+    EXPECT_EQ(parseScalarPrefix("0.000000000000000000000000000001234", value), 35u);
+    EXPECT_EQ(value, 1.234e-30);
+
+    EXPECT_EQ(parseScalarPrefix("1.7976931348623157e308", value), 22u);
+    EXPECT_EQ(value, std::numeric_limits<double>::max());
+
+    EXPECT_EQ(parseScalarPrefix("1e400", value), 0u);
+    EXPECT_EQ(parseScalarPrefix(".5", value), 0u);
+    EXPECT_EQ(parseScalarPrefix("-", value), 0u);
+
+    float single = 0.0f;
+    EXPECT_EQ(parseScalarPrefix("3.14159274", single), 10u);
+    EXPECT_EQ(single, 3.14159274f);
+
+    EXPECT_EQ(parseScalarPrefix("16777217", single), 8u);
+    EXPECT_EQ(single, 16777216.0f);
+}
+
+GTEST_TEST(ScalarParser, FastPathRealsRoundTrip)
+{
+    // Use a simple LCG to generate arbitrary bit patterns.
+    uint64_t state = 0x853C49E6748FEA9Bull;
+    char buffer[64];
+
+    for (int index = 0; index < 20000; ++index)
+    {
+        state = (state * 6364136223846793005ull) + 1442695040888963407ull;
+
+        double expected;
+        std::memcpy(&expected, &state, sizeof(expected));
+
+        if (std::isfinite(expected) == false)
+        {
+            continue;
+        }
+
+        int length = std::snprintf(buffer, std::size(buffer), "%.17g", expected);
+        double actual = 0.0;
+
+        ASSERT_EQ(parseScalarPrefix(std::string_view(buffer, static_cast<size_t>(length)), actual),
+                  static_cast<size_t>(length)) << buffer;
+        ASSERT_EQ(actual, std::strtod(buffer, nullptr)) << buffer;
+    }
+}
+
+GTEST_TEST(ScalarParser, ParseArray)
+{
+    std::vector<double> reals;
+    size_t errorOffset = 0;
+
+    EXPECT_TRUE(tryParseScalarArray(" 1.5, -2 ,3e2\r\n4,5\n\n", ',', reals, &errorOffset));
+    ASSERT_EQ(reals.size(), 5u);
+    EXPECT_EQ(reals[0], 1.5);
+    EXPECT_EQ(reals[1], -2.0);
+    EXPECT_EQ(reals[2], 300.0);
+    EXPECT_EQ(reals[3], 4.0);
+    EXPECT_EQ(reals[4], 5.0);
+
+    std::vector<int32_t> integers;
+    EXPECT_TRUE(tryParseScalarArray("1\t2\t\t3\n4", '\t', integers));
+    EXPECT_EQ(integers, std::vector<int32_t>({ 1, 2, 3, 4 }));
+
+    integers.clear();
+    EXPECT_TRUE(tryParseScalarArray("", ',', integers));
+    EXPECT_TRUE(integers.empty());
+
+    std::vector<uint16_t> hex;
+    EXPECT_TRUE(tryParseScalarArray("FF;1a;0", ';', hex, nullptr, 16));
+    EXPECT_EQ(hex, std::vector<uint16_t>({ 0xFF, 0x1A, 0 }));
+}
+
+GTEST_TEST(ScalarParser, ParseArrayErrors)
+{
+    std::vector<int32_t> values;
+    size_t errorOffset = 0;
+
+    EXPECT_FALSE(tryParseScalarArray("1,2x,3", ',', values, &errorOffset));
+    EXPECT_EQ(errorOffset, 3u);
+    EXPECT_EQ(values, std::vector<int32_t>({ 1, 2 }));
+
+    values.clear();
+    EXPECT_FALSE(tryParseScalarArray("1,,3", ',', values, &errorOffset));
+    EXPECT_EQ(errorOffset, 2u);
+
+    values.clear();
+    EXPECT_FALSE(tryParseScalarArray("1,2,", ',', values, &errorOffset));
+    EXPECT_EQ(errorOffset, 4u);
+
+    values.clear();
+    EXPECT_FALSE(tryParseScalarArray("1,99999999999", ',', values, &errorOffset));
+    EXPECT_EQ(errorOffset, 2u);
+    EXPECT_EQ(values.size(), 1u);
+}
+
 } // Anonymous namespace
 
 } // namespace Ag
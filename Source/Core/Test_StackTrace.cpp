@@ -10,6 +10,8 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Header File Includes
 ////////////////////////////////////////////////////////////////////////////////
+#include <thread>
+
 #include <gtest/gtest.h>
 
 #include <Ag/Core.hpp>
@@ -77,6 +79,48 @@ GTEST_TEST(StackTrace, Capture)
     EXPECT_NE(thisFn.find(__FUNCTION__), std::string_view::npos);
 }
 
+GTEST_TEST(StackTrace, ResolveConcurrently)
+{
+    constexpr size_t ThreadCount = 4;
+    constexpr size_t TraceCount = 50;
+    std::vector<std::thread> threads;
+    std::vector<std::string> symbols(ThreadCount);
+    std::vector<size_t> matchCounts(ThreadCount, 0);
+
+    // Repeatedly capture and resolve traces on several threads, which should
+    // all share the same cached symbols and resolve the same function each time.
+    for (size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+    {
+        threads.emplace_back([&, threadIndex]()
+        {
+            for (size_t index = 0; index < TraceCount; ++index)
+            {
+                StackTrace trace;
+                trace.captureCurrentThread();
+
+                if (trace.getEntryCount() == 0)
+                    continue;
+
+                if (index == 0)
+                    symbols[threadIndex].assign(trace.getEntrySymbol(0));
+
+                if (trace.getEntrySymbol(0) == symbols[threadIndex])
+                    ++matchCounts[threadIndex];
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+        thread.join();
+
+    for (size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+    {
+        EXPECT_FALSE(symbols[threadIndex].empty());
+        EXPECT_EQ(symbols[threadIndex], symbols[0]);
+        EXPECT_EQ(matchCounts[threadIndex], TraceCount);
+    }
+}
+
 } // namespace Ag
 ////////////////////////////////////////////////////////////////////////////////
 
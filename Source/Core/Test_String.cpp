@@ -19,6 +19,29 @@ namespace Ag {
 
 namespace {
 
+////////////////////////////////////////////////////////////////////////////////
+// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Determines whether constructing a string from UTF-8 bytes fails with
+//! a UnicodeConversionException, which is internal to the library so can only
+//! be identified by its domain.
+::testing::AssertionResult isUnicodeConversionError(std::string_view utf8)
+{
+    try
+    {
+        String specimen(utf8);
+    }
+    catch (const Exception &error)
+    {
+        if (error.getDomain() == "UnicodeConversionException")
+            return ::testing::AssertionSuccess();
+
+        return ::testing::AssertionFailure() << "Unexpected " << error.getDomain();
+    }
+
+    return ::testing::AssertionFailure() << "No exception was thrown";
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Unit Tests
 ////////////////////////////////////////////////////////////////////////////////
@@ -79,16 +102,84 @@ GTEST_TEST(StringValue, ConstructBoundedUTF8)
 
 GTEST_TEST(StringValue, ConstructInvalidUFT8)
 {
-    //ASSERT_THROW({ String specimen("Hello \xC2\xA3 World \xF0\x9F\xBA!"); },
-    //             UnicodeConversionException);
+    EXPECT_TRUE(isUnicodeConversionError("Hello \xC2\xA3 World \xF0\x9F\xBA!"));
+    EXPECT_TRUE(isUnicodeConversionError("Hello \xC2 World!"));
 
-    //ASSERT_THROW({ String specimen("Hello \xC2 World!"); },
-    //             UnicodeConversionException);
+    // Try the largest value representable using the UTF-8 encoding, but
+    // an invalid code point.
+    EXPECT_TRUE(isUnicodeConversionError("Hello \xF7\xBF\xBF\xBF World!"));
+}
 
-    //// Try the largest value representable using the UTF-8 encoding, but
-    //// an invalid code point.
-    //ASSERT_THROW({ String specimen("Hello \xF7\xBF\xBF\xBF World!"); },
-    //             UnicodeConversionException);
+GTEST_TEST(StringValue, ConstructInvalidUTF8AtBlockBoundaries)
+{
+    // Validation works on 16 and 32 byte blocks, so place errors either side
+    // of each boundary and sequences which straddle them.
+    for (size_t boundary : { 16u, 32u, 64u })
+    {
+        std::string text(boundary * 2, 'x');
+
+        for (size_t offset = boundary - 1; offset <= boundary; ++offset)
+        {
+            // A lone continuation byte.
+            std::string invalid(text);
+            invalid[offset] = '\x80';
+            EXPECT_TRUE(isUnicodeConversionError(invalid)) <<
+                "Continuation byte at " << offset;
+
+            // A lead byte without its continuation bytes.
+            invalid.assign(text);
+            invalid[offset] = '\xE2';
+            EXPECT_TRUE(isUnicodeConversionError(invalid)) <<
+                "Truncated sequence at " << offset;
+
+            // A byte which never appears in UTF-8.
+            invalid.assign(text);
+            invalid[offset] = '\xFF';
+            EXPECT_TRUE(isUnicodeConversionError(invalid)) <<
+                "Invalid byte at " << offset;
+        }
+
+        // A valid sequence straddling the boundary, then the same sequence
+        // with its final continuation byte replaced.
+        std::string valid(text);
+        valid.replace(boundary - 2, 4, "\xF0\x9F\x8D\xBA");
+        EXPECT_NO_THROW({ String specimen(valid); });
+
+        valid[boundary + 1] = 'x';
+        EXPECT_TRUE(isUnicodeConversionError(valid)) <<
+            "Straddling sequence at " << boundary;
+
+        // A sequence truncated by the end of the string at the boundary.
+        std::string truncated(boundary - 1, 'x');
+        truncated.push_back('\xC2');
+        EXPECT_TRUE(isUnicodeConversionError(truncated)) <<
+            "Sequence truncated at " << boundary;
+    }
+}
+
+GTEST_TEST(StringValue, ConstructByTakingSTLString)
+{
+    std::string longText(100, 'z');
+    String expected(longText);
+    String specimen { std::string(longText) };
+
+    EXPECT_EQ(specimen.getUtf8Length(), 100u);
+    EXPECT_EQ(specimen, expected);
+    EXPECT_EQ(specimen.getUtf8Bytes(), expected.getUtf8Bytes());
+
+    // A value not already in the pool.
+    std::string uniqueText = longText + "\xC2\xA3 unique";
+    String adopted(std::move(uniqueText));
+
+    EXPECT_EQ(adopted.getUtf8Length(), 109u);
+    EXPECT_EQ(adopted.getUtf32Length(), 108u);
+    EXPECT_EQ(adopted, String(longText + "\xC2\xA3 unique"));
+
+    String shortValue(std::string("Short"));
+    EXPECT_EQ(shortValue, "Short");
+
+    ASSERT_THROW({ String invalid(std::string("Hello \x80 World!")); },
+                 Exception);
 }
 
 GTEST_TEST(StringValue, Sharing)
@@ -170,6 +261,26 @@ GTEST_TEST(StringValue, AssignNullTerminatedUTF8)
     EXPECT_EQ(alternate.getReferenceCount(), refCount);
 }
 
+GTEST_TEST(StringValue, AssignOwnUTF8Bytes)
+{
+    // Short enough to be stored in-line.
+    const char shortValue[] = "Short \xC2\xA3";
+    String shortSpecimen(shortValue);
+
+    shortSpecimen = shortSpecimen.getUtf8Bytes();
+    EXPECT_STREQ(shortSpecimen.getUtf8Bytes(), shortValue);
+    EXPECT_EQ(shortSpecimen.getUtf8Length(), std::size(shortValue) - 1);
+
+    // Long enough to be held in the pool, with a unique value so that the
+    // specimen holds the only reference to it.
+    const char longValue[] = "A much longer value which is pooled \xF0\x9F\x8D\xBA 5f3a";
+    String longSpecimen(longValue);
+
+    longSpecimen = longSpecimen.getUtf8Bytes();
+    EXPECT_STREQ(longSpecimen.getUtf8Bytes(), longValue);
+    EXPECT_EQ(longSpecimen.getUtf8Length(), std::size(longValue) - 1);
+}
+
 GTEST_TEST(StringValue, ConstructNullTerminatedUTF16)
 {
     // 0xC2 0xA3 is the UTF-8 encoding of UK pounds
@@ -437,6 +548,133 @@ GTEST_TEST(StringValue, TryParseUint32)
     EXPECT_EQ(result, 0x0020u);
 }
 
+GTEST_TEST(StringValue, TryParseReal)
+{
+    double result = 0.0;
+
+    ASSERT_TRUE(String("  1.25  ").tryParseScalar(result));
+    EXPECT_EQ(result, 1.25);
+
+    ASSERT_TRUE(String("-6.02214076e23").tryParseScalar(result));
+    EXPECT_EQ(result, -6.02214076e23);
+
+    EXPECT_FALSE(String("pi").tryParseScalar(result));
+}
+
+GTEST_TEST(StringValue, ShortValuesAreEquivalent)
+{
+    String shortValue("Tag");
+    String longValue("A value long enough to be stored in the global pool.");
+
+    EXPECT_EQ(shortValue, String(u"Tag"));
+    EXPECT_EQ(shortValue, String(U"Tag"));
+    EXPECT_EQ(shortValue.getHashCode(), String(U"Tag").getHashCode());
+    EXPECT_EQ(shortValue.getUtf16Length(), 3u);
+    EXPECT_EQ(shortValue.getUtf32Length(), 3u);
+    EXPECT_NE(shortValue, longValue);
+    EXPECT_NE(longValue, shortValue);
+    EXPECT_NE(shortValue, String("Tags"));
+
+    // Copy and move both representations.
+    String shortCopy = shortValue;
+    String longCopy = longValue;
+
+    EXPECT_EQ(shortCopy, shortValue);
+    EXPECT_EQ(longCopy, longValue);
+    EXPECT_EQ(longCopy.getUtf8Bytes(), longValue.getUtf8Bytes());
+
+    String shortMoved = std::move(shortCopy);
+    String longMoved = std::move(longCopy);
+
+    EXPECT_TRUE(shortCopy.isEmpty());
+    EXPECT_TRUE(longCopy.isEmpty());
+    EXPECT_EQ(shortMoved, shortValue);
+    EXPECT_EQ(longMoved, longValue);
+
+    // A sub-string short enough to be stored in-line should compare equal
+    // to the same value constructed directly.
+    String prefix = longValue.substring(longValue.begin(),
+                                        longValue.find(U' '));
+
+    EXPECT_EQ(prefix, String("A"));
+    EXPECT_STREQ(prefix.getUtf8Bytes(), "A");
+
+    StringSet values;
+    values.insert(shortValue);
+    values.insert(longValue);
+
+    EXPECT_EQ(values.count(String("Tag")), 1u);
+    EXPECT_EQ(values.count(longMoved), 1u);
+}
+
+GTEST_TEST(StringValue, InternPool)
+{
+    StringInternPool pool;
+
+    EXPECT_EQ(pool.getCount(), 0u);
+
+    const String &first = pool.intern("Identifier");
+    const String &longFirst = pool.intern("A long identifier which won't fit in-line");
+
+    EXPECT_EQ(pool.getCount(), 2u);
+    EXPECT_EQ(first, String("Identifier"));
+    EXPECT_EQ(&pool.intern(std::string("Identifier")), &first);
+    EXPECT_EQ(&pool.intern("A long identifier which won't fit in-line"), &longFirst);
+    EXPECT_EQ(pool.getCount(), 2u);
+
+    pool.clear();
+    EXPECT_EQ(pool.getCount(), 0u);
+
+    StringInternPool &threadPool = StringInternPool::getThreadPool();
+
+    EXPECT_EQ(&threadPool, &StringInternPool::getThreadPool());
+    EXPECT_EQ(threadPool.intern("Thread"), String("Thread"));
+}
+
+GTEST_TEST(StringValue, HashDistribution)
+{
+    // Symbol-like identifiers differing in only a few characters should
+    // produce well distributed hash codes.
+    constexpr size_t SampleCount = 4096;
+    constexpr size_t BucketCount = 256;
+    std::unordered_set<size_t> hashes;
+    std::vector<size_t> buckets(BucketCount, 0);
+
+    for (size_t index = 0; index < SampleCount; ++index)
+    {
+        std::string text("Namespace::Class::member_");
+        text.append(std::to_string(index));
+
+        size_t hashCode = String(text).getHashCode();
+        hashes.insert(hashCode);
+        ++buckets[hashCode % BucketCount];
+    }
+
+    EXPECT_EQ(hashes.size(), SampleCount);
+
+    // No bucket should be more than 3 times as full as average.
+    for (size_t count : buckets)
+    {
+        EXPECT_LT(count, (SampleCount / BucketCount) * 3);
+    }
+}
+
+GTEST_TEST(StringValue, HashIndependentOfSourceEncoding)
+{
+    const char *utf8 = "A long string value which is not stored in-line \xE2\x82\xAC";
+    String fromUtf8(utf8);
+    String fromUtf16(u"A long string value which is not stored in-line \u20AC");
+    String fromUtf32(U"A long string value which is not stored in-line \u20AC");
+
+    EXPECT_EQ(fromUtf8, fromUtf16);
+    EXPECT_EQ(fromUtf8, fromUtf32);
+    EXPECT_EQ(fromUtf8.getHashCode(), fromUtf16.getHashCode());
+    EXPECT_EQ(fromUtf8.getHashCode(), fromUtf32.getHashCode());
+    EXPECT_EQ(fromUtf8.getUtf16Length(), 49u);
+    EXPECT_EQ(fromUtf8.getUtf32Length(), 49u);
+    EXPECT_EQ(fromUtf16.getUtf8Length(), 51u);
+}
+
 } // Anonymous namespace
 
 } // namespace Ag
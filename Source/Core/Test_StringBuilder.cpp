@@ -0,0 +1,149 @@
+//! @file Core/Test_StringBuilder.cpp
+//! @brief The definition of unit tests for the Ag::StringBuilder object.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Header File Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <gtest/gtest.h>
+
+#include <Ag/Core.hpp>
+
+namespace Ag {
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+// Unit Tests
+////////////////////////////////////////////////////////////////////////////////
+GTEST_TEST(StringBuilder, Empty)
+{
+    StringBuilder specimen;
+
+    EXPECT_TRUE(specimen.isEmpty());
+    EXPECT_EQ(specimen.getUtf8Length(), 0u);
+    EXPECT_EQ(specimen.getChunkCount(), 0u);
+    EXPECT_TRUE(specimen.toString().isEmpty());
+
+    specimen.append(static_cast<utf8_cptr_t>(nullptr));
+    specimen.append(std::string_view());
+    EXPECT_TRUE(specimen.isEmpty());
+}
+
+GTEST_TEST(StringBuilder, AppendFragments)
+{
+    StringBuilder specimen;
+    String name("Hello World!");
+
+    specimen.append("Greeting: ").append(name).append(U'£');
+    specimen.append(U'\U0001F600');
+
+    EXPECT_FALSE(specimen.isEmpty());
+    EXPECT_EQ(specimen.getUtf8Length(), 28u);
+    EXPECT_EQ(specimen.toString(),
+              "Greeting: Hello World!\xC2\xA3\xF0\x9F\x98\x80");
+}
+
+GTEST_TEST(StringBuilder, AppendSpansChunks)
+{
+    StringBuilder specimen;
+    std::string expected;
+
+    for (int index = 0; index < 1000; ++index)
+    {
+        std::string fragment(static_cast<size_t>(index % 37) + 1, 'a' + (index % 26));
+
+        specimen.append(fragment);
+        expected.append(fragment);
+    }
+
+    EXPECT_GT(specimen.getChunkCount(), 1u);
+    EXPECT_EQ(specimen.getUtf8Length(), expected.length());
+    EXPECT_EQ(specimen.toString(), expected.c_str());
+
+    // A single large fragment fills the space left before starting a new chunk.
+    std::string large(100000, 'x');
+    specimen.append(large);
+    expected.append(large);
+
+    String result = specimen.toString();
+    EXPECT_EQ(result.getUtf8Length(), expected.length());
+    EXPECT_EQ(result, expected.c_str());
+}
+
+GTEST_TEST(StringBuilder, AppendFormattedValues)
+{
+    StringBuilder specimen;
+    FormatInfo options(LocaleInfo::getNeutral());
+
+    specimen.append("Value: ").appendValue(options, 42);
+    specimen.append(", ").appendValue(options, uint64_t(1234567890123ull));
+    specimen.append(", ").appendFormat("{0} half-lives", { 9 });
+
+    EXPECT_EQ(specimen.toString(), "Value: 42, 1234567890123, 9 half-lives");
+    EXPECT_EQ(specimen.getUtf8Length(), 38u);
+}
+
+GTEST_TEST(StringBuilder, AppendCompiledFormat)
+{
+    StringBuilder specimen;
+    CompiledFormat entry(FormatInfo(LocaleInfo::getNeutral()),
+                         "[{0:d3}] {1}: {2}\n");
+
+    for (int index = 0; index < 3; ++index)
+    {
+        specimen.appendFormat(entry, index, "worker", index * 1.5);
+    }
+
+    EXPECT_EQ(specimen.toString(),
+              "[000] worker: 0\n[001] worker: 1.5\n[002] worker: 3\n");
+}
+
+GTEST_TEST(StringBuilder, MatchesPooledValue)
+{
+    std::string text(500, 'q');
+    String expected(text);
+    StringBuilder specimen(16);
+
+    specimen.append(std::string_view(text).substr(0, 100));
+    specimen.append(std::string_view(text).substr(100));
+
+    String result = specimen.toString();
+
+    EXPECT_EQ(result, expected);
+    EXPECT_EQ(result.getHashCode(), expected.getHashCode());
+    EXPECT_EQ(result.getUtf8Bytes(), expected.getUtf8Bytes());
+}
+
+GTEST_TEST(StringBuilder, ClearAndReuse)
+{
+    StringBuilder specimen;
+
+    specimen.append("First");
+    specimen.clear();
+
+    EXPECT_TRUE(specimen.isEmpty());
+    EXPECT_EQ(specimen.getChunkCount(), 0u);
+
+    specimen.append("Second");
+    EXPECT_EQ(specimen.toString(), "Second");
+}
+
+GTEST_TEST(StringBuilder, InvalidTextRejected)
+{
+    StringBuilder specimen;
+
+    specimen.append("Hello \x80 World!");
+
+    EXPECT_THROW({ specimen.toString(); }, Exception);
+}
+
+} // Anonymous namespace
+
+} // namespace Ag
+////////////////////////////////////////////////////////////////////////////////
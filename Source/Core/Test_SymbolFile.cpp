@@ -0,0 +1,459 @@
+//! @file Core/Test_SymbolFile.cpp
+//! @brief The definition of unit tests for reading the symbol files written
+//! by the SymbolPackager tool.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Header File Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Ag/Core/FsDirectory.hpp"
+#include "Ag/Core/FsPath.hpp"
+#include "Ag/Core/Stream.hpp"
+#include "Ag/Core/Utils.hpp"
+#include "Ag/Private/SymbolEncoding.hpp"
+
+#include "CoreInternal.hpp"
+
+namespace Ag {
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Data
+////////////////////////////////////////////////////////////////////////////////
+// More symbols than a single run of the version 2 sparse index.
+constexpr size_t SymbolCount = 600;
+constexpr uintptr_t FirstOffset = 0x1000;
+constexpr uintptr_t SymbolSpacing = 0x20;
+
+// The offset of the version 2 header within a symbol file.
+constexpr size_t HeaderV2Offset = sizeof(SymbolFileHeader);
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Data Types
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Creates symbol files for a module which doesn't exist using the
+//! SymbolPackager tool, deleting them afterwards.
+class SymbolFileHarness
+{
+private:
+    // Internal Fields
+    Fs::Path _listingPath;
+    Fs::Path _symbolPath;
+    std::string _modulePath;
+
+public:
+    SymbolFileHarness()
+    {
+        // The module itself is never created. Name it after the test so that
+        // tests running in parallel use different files.
+        std::string moduleName("Core_SymbolFile_");
+        moduleName.append(::testing::UnitTest::GetInstance()->current_test_info()->name());
+        moduleName.append(".bin");
+
+        Fs::PathBuilder builder;
+        builder.assignProgramDirectory();
+        builder.pushElement(moduleName);
+
+        Fs::Path modulePath(builder);
+
+        _modulePath = modulePath.toString().toUtf8();
+        _listingPath = modulePath.changeFileExtension("nm");
+        _symbolPath = modulePath.changeFileExtension("sym");
+    }
+
+    ~SymbolFileHarness()
+    {
+        for (const Fs::Path &path : { _listingPath, _symbolPath })
+        {
+            Fs::Entry file(path);
+
+            if (file.exists())
+                file.remove(/* reportError = */ false);
+        }
+    }
+
+    const std::string &getModulePath() const { return _modulePath; }
+
+    //! @brief Writes the symbol file using the SymbolPackager tool.
+    //! @param[in] formatOption The option selecting the format to write.
+    //! @retval true The symbol file was written.
+    //! @retval false The tool was not built or failed.
+    bool tryPackage(const char *formatOption)
+    {
+#ifdef AG_SYMBOL_PACKAGER_PATH
+        // Describe the symbols in the format written by the GNU nm tool, in
+        // no particular order. Every fifth symbol shares the same name.
+        std::string listing;
+
+        for (size_t index = SymbolCount; index-- > 0; )
+        {
+            char line[64];
+            std::snprintf(line, sizeof(line), "%016llx T %s\n",
+                          static_cast<unsigned long long>(FirstOffset + (index * SymbolSpacing)),
+                          getSymbolName(index).c_str());
+            listing.append(line);
+        }
+
+        if (writeFile(_listingPath, std::vector<uint8_t>(listing.begin(), listing.end())) == false)
+            return false;
+
+        std::string command;
+        command.push_back('"');
+        command.append(AG_SYMBOL_PACKAGER_PATH);
+        command.append("\" ");
+        command.append(formatOption);
+        command.append(" -f GNUNm \"");
+        command.append(_listingPath.toString().toUtf8());
+        command.append("\" -o \"");
+        command.append(_symbolPath.toString().toUtf8());
+        command.push_back('"');
+
+#ifdef _WIN32
+        // The command processor strips the outer quotes from the command.
+        command.insert(command.begin(), '"');
+        command.push_back('"');
+#endif
+
+        return std::system(command.c_str()) == 0;
+#else
+        static_cast<void>(formatOption);
+        return false;
+#endif
+    }
+
+    std::vector<uint8_t> readSymbolFile() const
+    {
+        String error;
+        FILE *fp = nullptr;
+        std::vector<uint8_t> fileData;
+
+        if (tryOpenFile(_symbolPath.toString(), "rb", fp, error))
+        {
+            StdFilePtr fileHandle(fp);
+            uint8_t buffer[4096];
+            size_t byteCount;
+
+            while ((byteCount = std::fread(buffer, 1, sizeof(buffer), fp)) > 0)
+            {
+                fileData.insert(fileData.end(), buffer, buffer + byteCount);
+            }
+        }
+
+        return fileData;
+    }
+
+    void writeSymbolFile(const std::vector<uint8_t> &fileData) const
+    {
+        ASSERT_TRUE(writeFile(_symbolPath, fileData));
+    }
+
+    static std::string getSymbolName(size_t index)
+    {
+        return ((index % 5) == 0) ? std::string("sharedSymbol") :
+                                    "symbol_" + std::to_string(index);
+    }
+
+private:
+    static bool writeFile(const Fs::Path &path, const std::vector<uint8_t> &fileData)
+    {
+        String error;
+        FILE *fp = nullptr;
+
+        if (tryOpenFile(path.toString(), "wb", fp, error) == false)
+            return false;
+
+        StdFilePtr fileHandle(fp);
+
+        return std::fwrite(fileData.data(), 1, fileData.size(), fp) == fileData.size();
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Resolves an offset to a symbol name.
+//! @return The name of the symbol or "<none>" if the offset wasn't resolved.
+std::string resolve(const ModuleSymbolsCPtr &symbols, uintptr_t offset)
+{
+    size_t symbolId = symbols->findSymbol(offset);
+
+    return (symbolId == SIZE_MAX) ? std::string("<none>") :
+                                    std::string(symbols->getName(symbolId));
+}
+
+//! @brief Verifies that every symbol written by SymbolFileHarness resolves.
+void expectAllSymbolsResolve(const ModuleSymbolsCPtr &symbols)
+{
+    EXPECT_EQ(resolve(symbols, 0), "<none>");
+    EXPECT_EQ(resolve(symbols, FirstOffset - 1), "<none>");
+
+    for (size_t index = 0; index < SymbolCount; ++index)
+    {
+        uintptr_t offset = FirstOffset + (index * SymbolSpacing);
+        std::string expected = SymbolFileHarness::getSymbolName(index);
+
+        EXPECT_EQ(resolve(symbols, offset), expected);
+        EXPECT_EQ(resolve(symbols, offset + SymbolSpacing - 1), expected);
+    }
+
+    // Offsets beyond the last symbol are assumed to be within it.
+    EXPECT_EQ(resolve(symbols, FirstOffset + (SymbolCount * SymbolSpacing) + 0x1000),
+              SymbolFileHarness::getSymbolName(SymbolCount - 1));
+}
+
+//! @brief Reads the header common to all versions of a symbol file.
+SymbolFileHeader getFileHeader(const std::vector<uint8_t> &fileData)
+{
+    SymbolFileHeader header;
+    std::memcpy(&header, fileData.data(), sizeof(header));
+
+    return header;
+}
+
+//! @brief Reads the version 2 header of a symbol file.
+SymbolHeaderV2 getHeaderV2(const std::vector<uint8_t> &fileData)
+{
+    SymbolHeaderV2 header;
+    std::memcpy(&header, fileData.data() + HeaderV2Offset, sizeof(header));
+
+    return header;
+}
+
+//! @brief Overwrites the version 2 header of a symbol file.
+void setHeaderV2(std::vector<uint8_t> &fileData, const SymbolHeaderV2 &header)
+{
+    std::memcpy(fileData.data() + HeaderV2Offset, &header, sizeof(header));
+}
+
+//! @brief Overwrites a record in the table of a version 2 symbol file.
+void setRecordV2(std::vector<uint8_t> &fileData, size_t index, const SymbolRecordV2 &record)
+{
+    size_t offset = static_cast<size_t>(getHeaderV2(fileData).SymbolTableOffset) +
+                    (index * sizeof(SymbolRecordV2));
+
+    std::memcpy(fileData.data() + offset, &record, sizeof(record));
+}
+
+//! @brief Gets a record from the table of a version 2 symbol file.
+SymbolRecordV2 getRecordV2(const std::vector<uint8_t> &fileData, size_t index)
+{
+    size_t offset = static_cast<size_t>(getHeaderV2(fileData).SymbolTableOffset) +
+                    (index * sizeof(SymbolRecordV2));
+    SymbolRecordV2 record;
+    std::memcpy(&record, fileData.data() + offset, sizeof(record));
+
+    return record;
+}
+
+//! @brief Verifies that a corrupt symbol file yields no symbols.
+void expectRejected(const SymbolFileHarness &harness,
+                    const std::vector<uint8_t> &fileData)
+{
+    harness.writeSymbolFile(fileData);
+
+    ModuleSymbolsCPtr symbols = loadModuleSymbols(harness.getModulePath());
+    ASSERT_TRUE(symbols);
+
+    EXPECT_EQ(symbols->findSymbol(FirstOffset), SIZE_MAX);
+    EXPECT_EQ(symbols->findSymbol(FirstOffset + (SymbolCount * SymbolSpacing)), SIZE_MAX);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Unit Tests
+////////////////////////////////////////////////////////////////////////////////
+GTEST_TEST(SymbolFile, NoSymbolFile)
+{
+    SymbolFileHarness harness;
+
+    ModuleSymbolsCPtr symbols = loadModuleSymbols(harness.getModulePath());
+    ASSERT_TRUE(symbols);
+
+    EXPECT_EQ(symbols->findSymbol(FirstOffset), SIZE_MAX);
+}
+
+GTEST_TEST(SymbolFile, ResolveVersion1Compressed)
+{
+    SymbolFileHarness harness;
+
+    if (harness.tryPackage("-c") == false)
+        GTEST_SKIP() << "The SymbolPackager tool is not available.";
+
+    std::vector<uint8_t> fileData = harness.readSymbolFile();
+    ASSERT_GE(fileData.size(), sizeof(SymbolFileHeader));
+    EXPECT_EQ(getFileHeader(fileData).Version[0], 1u);
+    EXPECT_EQ(getFileHeader(fileData).Version[1], 1u);
+
+    expectAllSymbolsResolve(loadModuleSymbols(harness.getModulePath()));
+}
+
+GTEST_TEST(SymbolFile, ResolveVersion1Uncompressed)
+{
+    SymbolFileHarness harness;
+
+    if (harness.tryPackage("-u") == false)
+        GTEST_SKIP() << "The SymbolPackager tool is not available.";
+
+    std::vector<uint8_t> fileData = harness.readSymbolFile();
+    ASSERT_GE(fileData.size(), sizeof(SymbolFileHeader));
+    EXPECT_EQ(getFileHeader(fileData).Version[0], 1u);
+    EXPECT_EQ(getFileHeader(fileData).Version[1], 0u);
+
+    expectAllSymbolsResolve(loadModuleSymbols(harness.getModulePath()));
+}
+
+GTEST_TEST(SymbolFile, ResolveVersion2)
+{
+    SymbolFileHarness harness;
+
+    if (harness.tryPackage("-m") == false)
+        GTEST_SKIP() << "The SymbolPackager tool is not available.";
+
+    std::vector<uint8_t> fileData = harness.readSymbolFile();
+    ASSERT_GE(fileData.size(), HeaderV2Offset + sizeof(SymbolHeaderV2));
+    EXPECT_EQ(getFileHeader(fileData).Version[0], 2u);
+
+    SymbolHeaderV2 header = getHeaderV2(fileData);
+    EXPECT_EQ(header.SymbolCount, SymbolCount);
+    EXPECT_GT(header.IndexCount, 1u);
+    EXPECT_EQ(header.SymbolTableOffset % header.TableAlignment, 0u);
+
+    // Identical names share characters.
+    EXPECT_EQ(getRecordV2(fileData, 0).NameOffset, getRecordV2(fileData, 5).NameOffset);
+
+    expectAllSymbolsResolve(loadModuleSymbols(harness.getModulePath()));
+}
+
+GTEST_TEST(SymbolFile, RejectTruncatedVersion2)
+{
+    SymbolFileHarness harness;
+
+    if (harness.tryPackage("-m") == false)
+        GTEST_SKIP() << "The SymbolPackager tool is not available.";
+
+    const std::vector<uint8_t> fileData = harness.readSymbolFile();
+    SymbolHeaderV2 header = getHeaderV2(fileData);
+
+    for (size_t size : { size_t(0), HeaderV2Offset + sizeof(SymbolHeaderV2) - 1,
+                         static_cast<size_t>(header.IndexOffset) + 8,
+                         static_cast<size_t>(header.SymbolTableOffset) + 100,
+                         fileData.size() - 1 })
+    {
+        SCOPED_TRACE(size);
+        expectRejected(harness, std::vector<uint8_t>(fileData.begin(),
+                                                     fileData.begin() + size));
+    }
+}
+
+GTEST_TEST(SymbolFile, RejectBadIndexStrideVersion2)
+{
+    SymbolFileHarness harness;
+
+    if (harness.tryPackage("-m") == false)
+        GTEST_SKIP() << "The SymbolPackager tool is not available.";
+
+    const std::vector<uint8_t> fileData = harness.readSymbolFile();
+
+    for (uint32_t stride : { 0u, 1u, 1024u })
+    {
+        SCOPED_TRACE(stride);
+        std::vector<uint8_t> corrupt = fileData;
+        SymbolHeaderV2 header = getHeaderV2(corrupt);
+        header.IndexStride = stride;
+        setHeaderV2(corrupt, header);
+
+        expectRejected(harness, corrupt);
+    }
+}
+
+GTEST_TEST(SymbolFile, RejectBadTableBoundsVersion2)
+{
+    SymbolFileHarness harness;
+
+    if (harness.tryPackage("-m") == false)
+        GTEST_SKIP() << "The SymbolPackager tool is not available.";
+
+    const std::vector<uint8_t> fileData = harness.readSymbolFile();
+    const SymbolHeaderV2 original = getHeaderV2(fileData);
+
+    std::vector<uint8_t> corrupt = fileData;
+    SymbolHeaderV2 header = original;
+    header.SymbolCount += 1000;
+    header.IndexCount = (header.SymbolCount + header.IndexStride - 1) / header.IndexStride;
+    setHeaderV2(corrupt, header);
+    expectRejected(harness, corrupt);
+
+    corrupt = fileData;
+    header = original;
+    header.StringTableSize += 1;
+    setHeaderV2(corrupt, header);
+    expectRejected(harness, corrupt);
+
+    corrupt = fileData;
+    header = original;
+    header.SymbolTableOffset += 4;
+    setHeaderV2(corrupt, header);
+    expectRejected(harness, corrupt);
+}
+
+GTEST_TEST(SymbolFile, IgnoreBadNameVersion2)
+{
+    SymbolFileHarness harness;
+
+    if (harness.tryPackage("-m") == false)
+        GTEST_SKIP() << "The SymbolPackager tool is not available.";
+
+    std::vector<uint8_t> fileData = harness.readSymbolFile();
+    const SymbolHeaderV2 header = getHeaderV2(fileData);
+    const uint32_t stringTableSize = static_cast<uint32_t>(header.StringTableSize);
+
+    SymbolRecordV2 record = getRecordV2(fileData, 1);
+    record.NameOffset = stringTableSize;
+    setRecordV2(fileData, 1, record);
+
+    record = getRecordV2(fileData, 2);
+    record.NameLength = stringTableSize + 1;
+    setRecordV2(fileData, 2, record);
+
+    record = getRecordV2(fileData, 3);
+    record.NameOffset = UINT32_MAX;
+    record.NameLength = UINT32_MAX;
+    setRecordV2(fileData, 3, record);
+
+    harness.writeSymbolFile(fileData);
+
+    // The rest of the file is valid, only the corrupt names are discarded.
+    ModuleSymbolsCPtr symbols = loadModuleSymbols(harness.getModulePath());
+    ASSERT_TRUE(symbols);
+
+    EXPECT_EQ(resolve(symbols, FirstOffset), SymbolFileHarness::getSymbolName(0));
+
+    for (size_t index = 1; index < 4; ++index)
+    {
+        uintptr_t offset = FirstOffset + (index * SymbolSpacing);
+
+        EXPECT_NE(symbols->findSymbol(offset), SIZE_MAX);
+        EXPECT_EQ(resolve(symbols, offset), "");
+    }
+
+    EXPECT_EQ(resolve(symbols, FirstOffset + (4 * SymbolSpacing)),
+              SymbolFileHarness::getSymbolName(4));
+}
+
+} // Anonymous namespace
+
+} // namespace Ag
+////////////////////////////////////////////////////////////////////////////////
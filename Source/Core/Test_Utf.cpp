@@ -314,6 +314,67 @@ GTEST_TEST(UnicodeTests, FromUtf16)
     EXPECT_TRUE(hasError);
 }
 
+GTEST_TEST(UnicodeTests, TranscodeUtf8)
+{
+    // Pound sign, euro sign and an emoji.
+    std::string_view text("A\xC2\xA3\xE2\x82\xAC\xF0\x9F\x98\x80");
+    char16_t utf16[8];
+    char32_t utf32[8];
+
+    TranscodeResult result = transcode(text, utf16, 8);
+    EXPECT_EQ(result.Status, TranscodeStatus::Complete);
+    EXPECT_EQ(result.Consumed, text.length());
+    EXPECT_EQ(std::u16string(utf16, result.Produced), u"A\u00A3\u20AC\U0001F600");
+
+    result = transcode(text, utf32, 8);
+    EXPECT_EQ(result.Status, TranscodeStatus::Complete);
+    EXPECT_EQ(result.Consumed, text.length());
+    EXPECT_EQ(std::u32string(utf32, result.Produced), U"A\u00A3\u20AC\U0001F600");
+
+    // Never split a surrogate pair.
+    result = transcode(text, utf16, 4);
+    EXPECT_EQ(result.Status, TranscodeStatus::DestinationFull);
+    EXPECT_EQ(result.Consumed, 6u);
+    EXPECT_EQ(result.Produced, 3u);
+
+    // Stop at the first ill-formed sequence.
+    result = transcode(std::string_view("AB\xE2\x82" "C"), utf32, 8);
+    EXPECT_EQ(result.Status, TranscodeStatus::InvalidInput);
+    EXPECT_EQ(result.Consumed, 2u);
+    EXPECT_EQ(result.Produced, 2u);
+}
+
+GTEST_TEST(UnicodeTests, TranscodeUtf16AndUtf32)
+{
+    std::u16string_view utf16Text(u"A\u00A3\U0001F600");
+    std::u32string_view utf32Text(U"A\u00A3\U0001F600");
+    char16_t utf16[8];
+    char32_t utf32[8];
+
+    TranscodeResult result = transcode(utf16Text, utf32, 8);
+    EXPECT_EQ(result.Status, TranscodeStatus::Complete);
+    EXPECT_EQ(result.Consumed, 4u);
+    EXPECT_EQ(std::u32string(utf32, result.Produced), utf32Text);
+
+    result = transcode(utf32Text, utf16, 8);
+    EXPECT_EQ(result.Status, TranscodeStatus::Complete);
+    EXPECT_EQ(result.Consumed, 3u);
+    EXPECT_EQ(std::u16string(utf16, result.Produced), utf16Text);
+
+    // An unpaired surrogate.
+    const char16_t unpaired[] = { u'A', 0xD83D, u'B' };
+    result = transcode(std::u16string_view(unpaired, 3), utf32, 8);
+    EXPECT_EQ(result.Status, TranscodeStatus::InvalidInput);
+    EXPECT_EQ(result.Consumed, 1u);
+
+    // A value beyond the range of Unicode.
+    const char32_t tooLarge[] = { U'A', 0x110000 };
+    result = transcode(std::u32string_view(tooLarge, 2), utf16, 8);
+    EXPECT_EQ(result.Status, TranscodeStatus::InvalidInput);
+    EXPECT_EQ(result.Consumed, 1u);
+    EXPECT_EQ(result.Produced, 1u);
+}
+
 } // Anonymous namespace
 
 }} // namespace Ag::Utf
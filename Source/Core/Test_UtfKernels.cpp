@@ -0,0 +1,309 @@
+//! @file Core/Test_UtfKernels.cpp
+//! @brief The definition of unit tests for the architecture-specific bulk
+//! Unicode text operations.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Header File Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Ag/Core/CPU.hpp"
+
+#include "UtfKernels.hpp"
+
+namespace Ag {
+namespace Utf {
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+bool tryMeasure(const std::string_view &text, Utf8Metrics &metrics)
+{
+    return tryMeasureUtf8_Base(reinterpret_cast<uint8_cptr_t>(text.data()),
+                               text.length(), metrics);
+}
+
+// Creates a pseudo-random mixture of 1, 2, 3 and 4-byte sequences.
+std::string createMixedText(size_t minLength, uint32_t seed)
+{
+    static const char *Fragments[] = {
+        "The quick brown fox ", "jumps over ", "\xC2\xA3", "\xC3\xA9t\xC3\xA9 ",
+        "\xE2\x82\xAC", "\xE4\xB8\xAD\xE6\x96\x87", "\xF0\x9F\x98\x80",
+        "\xF4\x8F\xBF\xBF", "\xEF\xBF\xBD", "\xED\x9F\xBF", "lazy dog. ", "\n"
+    };
+
+    constexpr size_t FragmentCount = sizeof(Fragments) / sizeof(Fragments[0]);
+    std::mt19937 random(seed);
+    std::string text;
+
+    while (text.length() < minLength)
+    {
+        text.append(Fragments[random() % FragmentCount]);
+    }
+
+    return text;
+}
+
+void expectKernelsAgree(const std::string &text)
+{
+    uint8_cptr_t bytes = reinterpret_cast<uint8_cptr_t>(text.data());
+    Utf8Metrics expected, actual;
+    bool isValid = tryMeasureUtf8_Base(bytes, text.length(), expected);
+
+    EXPECT_EQ(tryMeasureUtf8(bytes, text.length(), actual), isValid);
+
+    if (isValid)
+    {
+        EXPECT_EQ(actual.Utf16Length, expected.Utf16Length);
+        EXPECT_EQ(actual.Utf32Length, expected.Utf32Length);
+    }
+    else
+    {
+        EXPECT_EQ(actual.ErrorOffset, expected.ErrorOffset);
+        EXPECT_EQ(actual.ErrorLength, expected.ErrorLength);
+    }
+
+#ifdef AG_HAS_X64_KERNELS
+    int version = getX86_64ArchVersion();
+
+    if (version >= 2)
+    {
+        EXPECT_EQ(tryMeasureUtf8_X64v2(bytes, text.length(), actual), isValid);
+
+        if (isValid)
+        {
+            EXPECT_EQ(actual.Utf16Length, expected.Utf16Length);
+            EXPECT_EQ(actual.Utf32Length, expected.Utf32Length);
+        }
+    }
+
+    if (version >= 3)
+    {
+        EXPECT_EQ(tryMeasureUtf8_X64v3(bytes, text.length(), actual), isValid);
+
+        if (isValid)
+        {
+            EXPECT_EQ(actual.Utf16Length, expected.Utf16Length);
+            EXPECT_EQ(actual.Utf32Length, expected.Utf32Length);
+        }
+    }
+#endif
+}
+
+// Verifies that all transcoding kernels produce the same output.
+template<typename TChar>
+void expectTranscodersAgree(const std::string &text, size_t capacity)
+{
+    uint8_cptr_t bytes = reinterpret_cast<uint8_cptr_t>(text.data());
+    std::vector<TChar> expected(capacity + 1, 0);
+    std::vector<TChar> actual(capacity + 1, 0);
+    TranscodeResult expectedResult = transcodeUtf8_Base(bytes, text.length(),
+                                                        expected.data(), capacity);
+
+    auto verify = [&](const TranscodeResult &result)
+    {
+        EXPECT_EQ(result.Status, expectedResult.Status);
+        EXPECT_EQ(result.Consumed, expectedResult.Consumed);
+        EXPECT_EQ(result.Produced, expectedResult.Produced);
+        EXPECT_EQ(actual, expected);
+    };
+
+    verify(transcodeUtf8(bytes, text.length(), actual.data(), capacity));
+
+#ifdef AG_HAS_X64_KERNELS
+    int version = getX86_64ArchVersion();
+
+    if (version >= 2)
+    {
+        std::fill(actual.begin(), actual.end(), 0);
+        verify(transcodeUtf8_X64v2(bytes, text.length(), actual.data(), capacity));
+    }
+
+    if (version >= 3)
+    {
+        std::fill(actual.begin(), actual.end(), 0);
+        verify(transcodeUtf8_X64v3(bytes, text.length(), actual.data(), capacity));
+    }
+#endif
+
+    // The guard element should never be written.
+    EXPECT_EQ(actual[capacity], 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Unit Tests
+////////////////////////////////////////////////////////////////////////////////
+GTEST_TEST(UtfKernels, MeasureEmpty)
+{
+    Utf8Metrics metrics;
+
+    EXPECT_TRUE(tryMeasure(std::string_view(), metrics));
+    EXPECT_EQ(metrics.Utf16Length, 0u);
+    EXPECT_EQ(metrics.Utf32Length, 0u);
+}
+
+GTEST_TEST(UtfKernels, MeasureValid)
+{
+    Utf8Metrics metrics;
+
+    EXPECT_TRUE(tryMeasure("Hello World!", metrics));
+    EXPECT_EQ(metrics.Utf16Length, 12u);
+    EXPECT_EQ(metrics.Utf32Length, 12u);
+
+    // Pound sign, euro sign and an emoji.
+    EXPECT_TRUE(tryMeasure("\xC2\xA3\xE2\x82\xAC\xF0\x9F\x98\x80", metrics));
+    EXPECT_EQ(metrics.Utf16Length, 4u);
+    EXPECT_EQ(metrics.Utf32Length, 3u);
+
+    // The largest legal code point.
+    EXPECT_TRUE(tryMeasure("\xF4\x8F\xBF\xBF", metrics));
+    EXPECT_EQ(metrics.Utf16Length, 2u);
+    EXPECT_EQ(metrics.Utf32Length, 1u);
+}
+
+GTEST_TEST(UtfKernels, MeasureInvalid)
+{
+    Utf8Metrics metrics;
+
+    // Unexpected continuation byte.
+    EXPECT_FALSE(tryMeasure("Hello \x80 World!", metrics));
+    EXPECT_EQ(metrics.ErrorOffset, 6u);
+    EXPECT_EQ(metrics.ErrorLength, 1u);
+
+    // Truncated sequence followed by ASCII.
+    EXPECT_FALSE(tryMeasure("Hello \xC2 World!", metrics));
+    EXPECT_EQ(metrics.ErrorOffset, 6u);
+    EXPECT_EQ(metrics.ErrorLength, 2u);
+
+    // Truncated sequence at the end of the text.
+    EXPECT_FALSE(tryMeasure("Hello \xF0\x9F\x98", metrics));
+    EXPECT_EQ(metrics.ErrorOffset, 6u);
+    EXPECT_EQ(metrics.ErrorLength, 3u);
+
+    // Overlong encodings.
+    EXPECT_FALSE(tryMeasure("\xC0\xAF", metrics));
+    EXPECT_FALSE(tryMeasure("\xE0\x80\xAF", metrics));
+    EXPECT_FALSE(tryMeasure("\xF0\x80\x80\xAF", metrics));
+
+    // Encoded UTF-16 surrogate.
+    EXPECT_FALSE(tryMeasure("\xED\xA0\x80", metrics));
+
+    // Beyond U+10FFFF.
+    EXPECT_FALSE(tryMeasure("\xF4\x90\x80\x80", metrics));
+    EXPECT_FALSE(tryMeasure("Hello \xF7\xBF\xBF\xBF World!", metrics));
+    EXPECT_EQ(metrics.ErrorOffset, 6u);
+    EXPECT_EQ(metrics.ErrorLength, 1u);
+}
+
+GTEST_TEST(UtfKernels, VectorKernelsAgreeOnValidText)
+{
+    // Cover all alignments of the end of the text relative to a block.
+    for (size_t length = 0; length < 160; ++length)
+    {
+        std::string text = createMixedText(length, static_cast<uint32_t>(length));
+        expectKernelsAgree(text);
+    }
+
+    expectKernelsAgree(std::string(1000, 'A'));
+    expectKernelsAgree(createMixedText(1 << 16, 42));
+}
+
+GTEST_TEST(UtfKernels, VectorKernelsAgreeOnInvalidText)
+{
+    static const char *Corruptions[] = {
+        "\x80", "\xC2", "\xE2\x82", "\xF0\x9F\x98", "\xC0\xAF", "\xE0\x80\xAF",
+        "\xED\xA0\x80", "\xF4\x90\x80\x80", "\xF8", "\xFF", "\xC2\xA3\xA3"
+    };
+
+    std::string base = createMixedText(200, 7);
+
+    for (const char *corruption : Corruptions)
+    {
+        // Place the error across each position within a block.
+        for (size_t offset = 0; offset < 70; ++offset)
+        {
+            std::string text(offset, 'x');
+            text.append(corruption);
+            text.append(base);
+
+            expectKernelsAgree(text);
+
+            // And at the end of the text.
+            text.assign(base, 0, base.length() - (base.length() % 32) + offset % 32);
+
+            // Ensure we start on a sequence boundary.
+            while ((text.empty() == false) &&
+                   ((static_cast<uint8_t>(text.back()) & 0x80) != 0))
+            {
+                text.pop_back();
+            }
+
+            text.append(corruption);
+            expectKernelsAgree(text);
+        }
+    }
+}
+
+GTEST_TEST(UtfKernels, TranscodeValid)
+{
+    std::string text("Hello \xC2\xA3\xE2\x82\xAC\xF0\x9F\x98\x80!");
+    char16_t utf16[16];
+    char32_t utf32[16];
+
+    TranscodeResult result = transcodeUtf8_Base(reinterpret_cast<uint8_cptr_t>(text.data()),
+                                                text.length(), utf16, 16);
+    EXPECT_EQ(result.Status, TranscodeStatus::Complete);
+    EXPECT_EQ(result.Consumed, text.length());
+    EXPECT_EQ(std::u16string(utf16, result.Produced), u"Hello \u00A3\u20AC\U0001F600!");
+
+    result = transcodeUtf8_Base(reinterpret_cast<uint8_cptr_t>(text.data()),
+                                text.length(), utf32, 16);
+    EXPECT_EQ(result.Status, TranscodeStatus::Complete);
+    EXPECT_EQ(std::u32string(utf32, result.Produced), U"Hello \u00A3\u20AC\U0001F600!");
+}
+
+GTEST_TEST(UtfKernels, VectorTranscodersAgree)
+{
+    for (size_t length = 0; length < 160; ++length)
+    {
+        std::string text = createMixedText(length, static_cast<uint32_t>(length));
+
+        expectTranscodersAgree<char16_t>(text, text.length());
+        expectTranscodersAgree<char32_t>(text, text.length());
+
+        // Run out of space part way through.
+        expectTranscodersAgree<char16_t>(text, length / 2);
+        expectTranscodersAgree<char32_t>(text, length / 3);
+    }
+
+    std::string ascii(1000, 'A');
+    expectTranscodersAgree<char16_t>(ascii, ascii.length());
+    expectTranscodersAgree<char32_t>(ascii, 999);
+
+    std::string mixed = createMixedText(1 << 16, 42);
+    expectTranscodersAgree<char16_t>(mixed, mixed.length());
+    expectTranscodersAgree<char32_t>(mixed, mixed.length());
+
+    // Stop at an ill-formed sequence.
+    std::string invalid = ascii + "\xE0\x80\xAF" + mixed;
+    expectTranscodersAgree<char16_t>(invalid, invalid.length());
+    expectTranscodersAgree<char32_t>(invalid, invalid.length());
+}
+
+} // Anonymous namespace
+
+}} // namespace Ag::Utf
+////////////////////////////////////////////////////////////////////////////////
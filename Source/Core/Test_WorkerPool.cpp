@@ -0,0 +1,85 @@
+//! @file Core/Test_WorkerPool.cpp
+//! @brief The definition of unit tests for the WorkerPool class.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Header File Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Ag/Core/WorkerPool.hpp"
+
+namespace Ag {
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+// Unit Tests
+////////////////////////////////////////////////////////////////////////////////
+GTEST_TEST(WorkerPool, DefaultThreadCount)
+{
+    WorkerPool specimen;
+
+    EXPECT_GE(WorkerPool::getDefaultThreadCount(), 1u);
+    EXPECT_EQ(specimen.getThreadCount(), WorkerPool::getDefaultThreadCount());
+}
+
+GTEST_TEST(WorkerPool, SubmitReturnsResults)
+{
+    WorkerPool specimen(3);
+    std::vector<std::future<int>> results;
+
+    ASSERT_EQ(specimen.getThreadCount(), 3u);
+
+    for (int index = 0; index < 100; ++index)
+    {
+        results.push_back(specimen.submit([index]() { return index * index; }));
+    }
+
+    for (int index = 0; index < 100; ++index)
+    {
+        EXPECT_EQ(results[index].get(), index * index);
+    }
+}
+
+GTEST_TEST(WorkerPool, SubmitPropagatesExceptions)
+{
+    WorkerPool specimen(1);
+
+    std::future<int> result = specimen.submit([]() -> int
+    {
+        throw std::runtime_error("Task failed.");
+    });
+
+    EXPECT_THROW(result.get(), std::runtime_error);
+}
+
+GTEST_TEST(WorkerPool, DestructionExecutesQueuedTasks)
+{
+    std::atomic<int> count(0);
+
+    {
+        WorkerPool specimen(2);
+
+        for (int index = 0; index < 50; ++index)
+        {
+            specimen.post([&count]() { ++count; });
+        }
+    }
+
+    EXPECT_EQ(count.load(), 50);
+}
+
+} // Anonymous namespace
+
+} // namespace Ag
+////////////////////////////////////////////////////////////////////////////////
@@ -17,6 +17,7 @@
 
 #include "CoreInternal.hpp"
 #include "Win32API.hpp"
+#include "UtfKernels.hpp"
 #include "Ag/Core/Utf.hpp"
 
 namespace Ag {
@@ -520,6 +521,131 @@ size_t utf32Length(const std::u16string_view &utf16Text)
     return length;
 }
 
+//! @brief Converts UTF-8 text and appends it to an STL container, skipping
+//! any ill-formed sequences.
+//! @tparam TBuffer The data type of the container of UTF-16, UTF-32 or wide
+//! characters to append to.
+//! @param[out] destination The container to receive the converted characters.
+//! @param[in] utf8Text The UTF-8 encoded text to convert.
+//! @param[in] hintSize The expected count of characters to be produced, or 0
+//! to assume the worst case.
+template<typename TBuffer>
+void appendTranscoded(TBuffer &destination, std::string_view utf8Text,
+                      size_t hintSize)
+{
+    size_t offset = destination.size();
+
+    // No encoding requires more characters than there are UTF-8 bytes.
+    destination.resize(offset + ((hintSize > 0) ? hintSize : utf8Text.length()));
+
+    while (true)
+    {
+        TranscodeResult result = transcode(utf8Text, destination.data() + offset,
+                                           destination.size() - offset);
+
+        offset += result.Produced;
+        utf8Text.remove_prefix(result.Consumed);
+
+        if (result.Status == TranscodeStatus::Complete)
+        {
+            break;
+        }
+        else if (result.Status == TranscodeStatus::InvalidInput)
+        {
+            // Skip the byte which could not be converted and resume.
+            utf8Text.remove_prefix(1);
+        }
+        else
+        {
+            // The hint was too small.
+            destination.resize(offset + utf8Text.length());
+        }
+    }
+
+    destination.resize(offset);
+}
+
+//! @brief Converts UTF-16 text to UTF-32 using portable scalar code.
+TranscodeResult transcodeUtf16Scalar(const std::u16string_view &utf16Text,
+                                     char32_t *destination, size_t capacity)
+{
+    size_t inputIndex = 0;
+    size_t outputIndex = 0;
+    size_t wordCount = utf16Text.length();
+
+    while (inputIndex < wordCount)
+    {
+        if (outputIndex >= capacity)
+        {
+            return { inputIndex, outputIndex, TranscodeStatus::DestinationFull };
+        }
+
+        char32_t word = utf16Text[inputIndex];
+
+        if ((word & 0xF800) != 0xD800)
+        {
+            destination[outputIndex++] = word;
+            ++inputIndex;
+        }
+        else if ((word < 0xDC00) && ((inputIndex + 1) < wordCount) &&
+                 ((utf16Text[inputIndex + 1] & 0xFC00) == 0xDC00))
+        {
+            // Combine a well-formed surrogate pair.
+            char32_t lowWord = utf16Text[inputIndex + 1];
+            destination[outputIndex++] = 0x10000 + ((word - 0xD800) << 10) +
+                                         (lowWord - 0xDC00);
+            inputIndex += 2;
+        }
+        else
+        {
+            return { inputIndex, outputIndex, TranscodeStatus::InvalidInput };
+        }
+    }
+
+    return { inputIndex, outputIndex, TranscodeStatus::Complete };
+}
+
+//! @brief Converts UTF-32 text to UTF-16 using portable scalar code.
+TranscodeResult transcodeUtf32Scalar(const std::u32string_view &utf32Text,
+                                     char16_t *destination, size_t capacity)
+{
+    size_t inputIndex = 0;
+    size_t outputIndex = 0;
+
+    for (size_t codePointCount = utf32Text.length(); inputIndex < codePointCount; ++inputIndex)
+    {
+        char32_t codePoint = utf32Text[inputIndex];
+
+        if ((codePoint > CodePointMax) || ((codePoint & 0x1FF800) == 0xD800))
+        {
+            return { inputIndex, outputIndex, TranscodeStatus::InvalidInput };
+        }
+        else if (codePoint < 0x10000)
+        {
+            if (outputIndex >= capacity)
+            {
+                return { inputIndex, outputIndex, TranscodeStatus::DestinationFull };
+            }
+
+            destination[outputIndex++] = static_cast<char16_t>(codePoint);
+        }
+        else
+        {
+            // Encode a surrogate pair, but never split one.
+            if ((outputIndex + 2) > capacity)
+            {
+                return { inputIndex, outputIndex, TranscodeStatus::DestinationFull };
+            }
+
+            codePoint -= 0x10000;
+            destination[outputIndex++] = static_cast<char16_t>(0xD800 | (codePoint >> 10));
+            destination[outputIndex++] = static_cast<char16_t>(0xDC00 | (codePoint & 0x3FF));
+        }
+    }
+
+    return { inputIndex, outputIndex, TranscodeStatus::Complete };
+}
+
 } // Anonymous namespace
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1482,38 +1608,7 @@ void appendToUtf8(std::string &destination, utf32_cptr_t codePoints,
 void appendToUtf16(std::u16string &destination, utf8_cptr_t utf8Bytes,
                    size_t byteCount, size_t hintSize /* = 0 */)
 {
-    FromUtf8Converter inputConverter;
-    ToUtf16Converter outputConverter;
-    uint8_cptr_t bytes = reinterpret_cast<uint8_cptr_t>(utf8Bytes);
-    bool hasError = false;
-    char32_t codePoint = U'\0';
-
-    if (hintSize > 0)
-    {
-        destination.reserve(hintSize + destination.length());
-    }
-    else
-    {
-        destination.reserve(byteCount+ destination.length());
-    }
-
-    for (size_t index = 0; index < byteCount; ++index)
-    {
-        if (inputConverter.tryConvert(bytes[index], codePoint, hasError))
-        {
-            outputConverter.setCodePoint(codePoint);
-            char16_t utf16word = u'\0';
-
-            while (outputConverter.tryGetNextCharacter(utf16word))
-            {
-                destination.push_back(utf16word);
-            }
-        }
-        else if (hasError)
-        {
-            inputConverter.reset();
-        }
-    }
+    appendTranscoded(destination, std::string_view(utf8Bytes, byteCount), hintSize);
 }
 
 //! @brief Converts a bounded array of UTF-8 encode bytes to UTF-32 and appends
@@ -1527,78 +1622,7 @@ void appendToUtf16(std::u16string &destination, utf8_cptr_t utf8Bytes,
 void appendToUtf32(std::u32string &destination, utf8_cptr_t utf8Bytes,
                    size_t byteCount, size_t hintSize /* = 0 */)
 {
-    FromUtf8Converter inputConverter;
-    uint8_cptr_t bytes = reinterpret_cast<uint8_cptr_t>(utf8Bytes);
-    bool hasError = false;
-    char32_t codePoint = U'\0';
-
-    if (hintSize > 0)
-    {
-        destination.reserve(hintSize + destination.size());
-    }
-    else
-    {
-        destination.reserve(byteCount + destination.size());
-    }
-
-    for (size_t index = 0; index < byteCount; ++index)
-    {
-        if (inputConverter.tryConvert(bytes[index], codePoint, hasError))
-        {
-            destination.push_back(codePoint);
-        }
-        else if (hasError)
-        {
-            inputConverter.reset();
-        }
-    }
-}
-
-template<typename TBuffer>
-void appendToWideInternal(TBuffer& destination, utf8_cptr_t utf8Bytes,
-                          size_t byteCount, size_t hintSize)
-{
-#ifndef WCHAR_IS_32BIT
-    ToUtf16Converter outputConverter;
-#endif
-
-    FromUtf8Converter inputConverter;
-    uint8_cptr_t bytes = reinterpret_cast<uint8_cptr_t>(utf8Bytes);
-    bool hasError = false;
-    char32_t codePoint = U'\0';
-
-    size_t reserveSize = (hintSize > 0) ? hintSize :
-        calculateConvertedLength(std::string_view(utf8Bytes, byteCount),
-            Encoding::Wide);
-
-    if (destination.capacity() < reserveSize)
-    {
-        destination.reserve(reserveSize);
-    }
-
-    for (size_t index = 0; index < byteCount; ++index)
-    {
-        // Append the converted code points raw.
-        if (inputConverter.tryConvert(bytes[index], codePoint, hasError))
-        {
-#ifdef WCHAR_IS_32BIT
-            destination.push_back(codePoint);
-#else
-            // Convert to code points and then UTF-16.
-            outputConverter.setCodePoint(codePoint);
-            char16_t utf16word = u'\0';
-
-            while (outputConverter.tryGetNextCharacter(utf16word))
-            {
-                destination.push_back(utf16word);
-            }
-#endif
-        }
-        else if (hasError)
-        {
-            inputConverter.reset();
-        }
-    }
+    appendTranscoded(destination, std::string_view(utf8Bytes, byteCount), hintSize);
 }
 
 //! @brief Converts a bounded array of UTF-8 encode bytes to wide characters
@@ -1611,7 +1635,7 @@ void appendToWideInternal(TBuffer& destination, utf8_cptr_t utf8Bytes,
 void appendToWide(std::wstring &destination, utf8_cptr_t utf8Bytes,
                   size_t byteCount, size_t hintSize /* = 0 */)
 {
-    appendToWideInternal(destination, utf8Bytes, byteCount, hintSize);
+    appendTranscoded(destination, std::string_view(utf8Bytes, byteCount), hintSize);
 }
 
 //! @brief Converts a bounded array of UTF-8 encode bytes to wide characters
@@ -1626,7 +1650,77 @@ void appendToWide(std::wstring &destination, utf8_cptr_t utf8Bytes,
 void appendToWide(std::vector<wchar_t>& destination, utf8_cptr_t utf8Bytes,
                   size_t byteCount, size_t hintSize /* = 0 */)
 {
-    appendToWideInternal(destination, utf8Bytes, byteCount, hintSize);
+    appendTranscoded(destination, std::string_view(utf8Bytes, byteCount), hintSize);
+}
+
+//! @brief Converts UTF-8 encoded text to UTF-16 in bulk.
+//! @param[in] utf8Text The UTF-8 encoded text to convert.
+//! @param[out] destination The buffer to receive the UTF-16 words.
+//! @param[in] capacity The count of words @p destination can hold.
+//! @return The extent of the conversion and the reason it stopped. The
+//! conversion stops at the first ill-formed sequence and never writes part
+//! of a surrogate pair. No null terminator is written.
+TranscodeResult transcode(const std::string_view &utf8Text,
+                          char16_t *destination, size_t capacity)
+{
+    return transcodeUtf8(reinterpret_cast<uint8_cptr_t>(utf8Text.data()),
+                         utf8Text.length(), destination, capacity);
+}
+
+//! @brief Converts UTF-8 encoded text to UTF-32 in bulk.
+//! @param[in] utf8Text The UTF-8 encoded text to convert.
+//! @param[out] destination The buffer to receive the code points.
+//! @param[in] capacity The count of code points @p destination can hold.
+//! @return The extent of the conversion and the reason it stopped. The
+//! conversion stops at the first ill-formed sequence. No null terminator
+//! is written.
+TranscodeResult transcode(const std::string_view &utf8Text,
+                          char32_t *destination, size_t capacity)
+{
+    return transcodeUtf8(reinterpret_cast<uint8_cptr_t>(utf8Text.data()),
+                         utf8Text.length(), destination, capacity);
+}
+
+//! @brief Converts UTF-8 encoded text to wide characters in bulk.
+//! @param[in] utf8Text The UTF-8 encoded text to convert.
+//! @param[out] destination The buffer to receive the wide characters.
+//! @param[in] capacity The count of characters @p destination can hold.
+//! @return The extent of the conversion and the reason it stopped. No null
+//! terminator is written.
+TranscodeResult transcode(const std::string_view &utf8Text,
+                          wchar_t *destination, size_t capacity)
+{
+#ifdef WCHAR_IS_32BIT
+    return transcode(utf8Text, reinterpret_cast<char32_t *>(destination), capacity);
+#else
+    return transcode(utf8Text, reinterpret_cast<char16_t *>(destination), capacity);
+#endif
+}
+
+//! @brief Converts UTF-16 encoded text to UTF-32 in bulk.
+//! @param[in] utf16Text The UTF-16 encoded text to convert.
+//! @param[out] destination The buffer to receive the code points.
+//! @param[in] capacity The count of code points @p destination can hold.
+//! @return The extent of the conversion and the reason it stopped. The
+//! conversion stops at the first unpaired surrogate. No null terminator
+//! is written.
+TranscodeResult transcode(const std::u16string_view &utf16Text,
+                          char32_t *destination, size_t capacity)
+{
+    return transcodeUtf16Scalar(utf16Text, destination, capacity);
+}
+
+//! @brief Converts UTF-32 encoded text to UTF-16 in bulk.
+//! @param[in] utf32Text The code points to convert.
+//! @param[out] destination The buffer to receive the UTF-16 words.
+//! @param[in] capacity The count of words @p destination can hold.
+//! @return The extent of the conversion and the reason it stopped. The
+//! conversion stops at the first value which is not a valid code point and
+//! never writes part of a surrogate pair. No null terminator is written.
+TranscodeResult transcode(const std::u32string_view &utf32Text,
+                          char16_t *destination, size_t capacity)
+{
+    return transcodeUtf32Scalar(utf32Text, destination, capacity);
 }
 
 //! @brief Converts a null-terminated array of characters in the native code
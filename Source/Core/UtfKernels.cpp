@@ -0,0 +1,461 @@
+//! @file Core/UtfKernels.cpp
+//! @brief The definition of portable bulk operations on Unicode text and the
+//! selection of the best implementation for the current CPU.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Header File Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstring>
+
+#include "Ag/Core/CPU.hpp"
+
+#include "UtfKernels.hpp"
+
+namespace Ag {
+namespace Utf {
+
+namespace {
+////////////////////////////////////////////////////////////////////////////////
+// Local Data Types
+////////////////////////////////////////////////////////////////////////////////
+//! @brief The signature of a function which validates and measures UTF-8 text.
+using MeasureUtf8Fn = bool(*)(uint8_cptr_t, size_t, Utf8Metrics &);
+
+//! @brief The signature of a function which converts UTF-8 text to UTF-16.
+using TranscodeUtf16Fn = TranscodeResult(*)(uint8_cptr_t, size_t, char16_t *, size_t);
+
+//! @brief The signature of a function which converts UTF-8 text to UTF-32.
+using TranscodeUtf32Fn = TranscodeResult(*)(uint8_cptr_t, size_t, char32_t *, size_t);
+
+//! @brief The set of kernels best suited to the current CPU.
+struct Utf8Kernels
+{
+    MeasureUtf8Fn Measure;
+    MeasureUtf8Fn Validate;
+    TranscodeUtf16Fn ToUtf16;
+    TranscodeUtf32Fn ToUtf32;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Data
+////////////////////////////////////////////////////////////////////////////////
+//! @brief The count of bytes below which the set up costs of the vectorised
+//! kernels outweigh the benefits.
+constexpr size_t MinVectorLength = 32;
+
+//! @brief A mask selecting the most significant bit of each byte in a word.
+constexpr uint64_t AsciiMask = 0x8080808080808080ull;
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Determines whether a byte is a UTF-8 continuation byte.
+constexpr bool isContinuation(uint8_t byte) noexcept
+{
+    return (byte & 0xC0) == 0x80;
+}
+
+//! @brief Determines the length of a multi-byte UTF-8 encoded sequence and
+//! whether it is well formed.
+//! @param[in] utf8Bytes The text containing the sequence.
+//! @param[in] index The offset of the non-ASCII leading byte of the sequence.
+//! @param[in] byteCount The count of bytes in @p utf8Bytes.
+//! @param[out] errorLength Receives the count of bytes in the sequence if it
+//! was ill-formed.
+//! @return The count of bytes in the sequence or 0 if it was ill-formed.
+inline size_t getSequenceLength(uint8_cptr_t utf8Bytes, size_t index,
+                                size_t byteCount, size_t &errorLength) noexcept
+{
+    uint8_t leadByte = utf8Bytes[index];
+
+    // Determine the length of the sequence and the valid range of the
+    // byte which follows the leading byte.
+    size_t sequenceLength = 0;
+    uint8_t minSecond = 0x80;
+    uint8_t maxSecond = 0xBF;
+
+    if (leadByte < 0xC2)
+    {
+        // An unexpected continuation byte or an overlong 2-byte encoding.
+        sequenceLength = 0;
+    }
+    else if (leadByte < 0xE0)
+    {
+        sequenceLength = 2;
+    }
+    else if (leadByte < 0xF0)
+    {
+        sequenceLength = 3;
+
+        if (leadByte == 0xE0)
+        {
+            // Exclude overlong 3-byte encodings.
+            minSecond = 0xA0;
+        }
+        else if (leadByte == 0xED)
+        {
+            // Exclude encoded UTF-16 surrogates.
+            maxSecond = 0x9F;
+        }
+    }
+    else if (leadByte < 0xF5)
+    {
+        sequenceLength = 4;
+
+        if (leadByte == 0xF0)
+        {
+            // Exclude overlong 4-byte encodings.
+            minSecond = 0x90;
+        }
+        else if (leadByte == 0xF4)
+        {
+            // Exclude code points beyond U+10FFFF.
+            maxSecond = 0x8F;
+        }
+    }
+
+    if (sequenceLength == 0)
+    {
+        errorLength = 1;
+        return 0;
+    }
+
+    // Verify the continuation bytes which are present.
+    size_t available = std::min(sequenceLength, byteCount - index);
+    size_t validCount = 1;
+
+    if (available > 1)
+    {
+        uint8_t second = utf8Bytes[index + 1];
+
+        if ((second >= minSecond) && (second <= maxSecond))
+        {
+            validCount = 2;
+
+            while ((validCount < available) &&
+                   isContinuation(utf8Bytes[index + validCount]))
+            {
+                ++validCount;
+            }
+        }
+    }
+
+    if (validCount < sequenceLength)
+    {
+        // Report the truncated sequence, including the offending byte
+        // if there was one.
+        errorLength = std::min(validCount + 1, byteCount - index);
+        return 0;
+    }
+
+    return sequenceLength;
+}
+
+//! @brief Converts UTF-8 text to UTF-16 or UTF-32 using portable scalar code.
+//! @tparam TChar The data type of the characters to produce.
+template<typename TChar>
+TranscodeResult transcodeUtf8Scalar(uint8_cptr_t utf8Bytes, size_t byteCount,
+                                    TChar *destination, size_t capacity)
+{
+    size_t inputIndex = 0;
+    size_t outputIndex = 0;
+
+    while (inputIndex < byteCount)
+    {
+        // Copy runs of ASCII characters a word at a time.
+        uint64_t word;
+
+        while (((inputIndex + sizeof(word)) <= byteCount) &&
+               ((outputIndex + sizeof(word)) <= capacity))
+        {
+            std::memcpy(&word, utf8Bytes + inputIndex, sizeof(word));
+
+            if (word & AsciiMask)
+                break;
+
+            for (size_t offset = 0; offset < sizeof(word); ++offset)
+            {
+                destination[outputIndex + offset] =
+                    static_cast<TChar>(utf8Bytes[inputIndex + offset]);
+            }
+
+            inputIndex += sizeof(word);
+            outputIndex += sizeof(word);
+        }
+
+        if (inputIndex >= byteCount)
+            break;
+
+        uint8_t leadByte = utf8Bytes[inputIndex];
+        size_t sequenceLength = 1;
+        char32_t codePoint = leadByte;
+
+        if (leadByte >= 0x80)
+        {
+            size_t errorLength = 0;
+            sequenceLength = getSequenceLength(utf8Bytes, inputIndex,
+                                               byteCount, errorLength);
+
+            if (sequenceLength == 0)
+            {
+                return { inputIndex, outputIndex, TranscodeStatus::InvalidInput };
+            }
+
+            codePoint = leadByte & (0x7F >> sequenceLength);
+
+            for (size_t offset = 1; offset < sequenceLength; ++offset)
+            {
+                codePoint = (codePoint << 6) |
+                            (utf8Bytes[inputIndex + offset] & 0x3F);
+            }
+        }
+
+        if constexpr (sizeof(TChar) == sizeof(char16_t))
+        {
+            if (codePoint > 0xFFFF)
+            {
+                // Encode a surrogate pair, but never split one.
+                if ((outputIndex + 2) > capacity)
+                {
+                    return { inputIndex, outputIndex, TranscodeStatus::DestinationFull };
+                }
+
+                codePoint -= 0x10000;
+                destination[outputIndex++] = static_cast<TChar>(0xD800 | (codePoint >> 10));
+                destination[outputIndex++] = static_cast<TChar>(0xDC00 | (codePoint & 0x3FF));
+                inputIndex += sequenceLength;
+                continue;
+            }
+        }
+
+        if (outputIndex >= capacity)
+        {
+            return { inputIndex, outputIndex, TranscodeStatus::DestinationFull };
+        }
+
+        destination[outputIndex++] = static_cast<TChar>(codePoint);
+        inputIndex += sequenceLength;
+    }
+
+    return { inputIndex, outputIndex, TranscodeStatus::Complete };
+}
+
+//! @brief Selects the best implementation of each kernel available on the
+//! current CPU.
+Utf8Kernels selectKernels()
+{
+#ifdef AG_HAS_X64_KERNELS
+    int version = getX86_64ArchVersion();
+
+    if (version >= 3)
+    {
+        return { tryMeasureUtf8_X64v3, tryValidateUtf8_X64v3,
+                 transcodeUtf8_X64v3, transcodeUtf8_X64v3 };
+    }
+    else if (version >= 2)
+    {
+        return { tryMeasureUtf8_X64v2, tryValidateUtf8_X64v2,
+                 transcodeUtf8_X64v2, transcodeUtf8_X64v2 };
+    }
+#endif
+
+    // The scalar kernel calculates lengths at almost no extra cost.
+    return { tryMeasureUtf8_Base, tryMeasureUtf8_Base,
+             transcodeUtf8_Base, transcodeUtf8_Base };
+}
+
+//! @brief Gets the kernels selected for the current CPU.
+const Utf8Kernels &getKernels()
+{
+    static const Utf8Kernels bestKernels = selectKernels();
+
+    return bestKernels;
+}
+
+} // Anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+// Global Function Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Validates a block of UTF-8 encoded text and calculates the length
+//! of the text in other encodings using the fastest kernel available.
+//! @param[in] utf8Bytes The bytes to validate.
+//! @param[in] byteCount The count of bytes in @p utf8Bytes.
+//! @param[out] metrics Receives the lengths of the text in other encodings
+//! or the location of the first invalid sequence of bytes.
+//! @retval true The text was well formed, the lengths in @p metrics are valid.
+//! @retval false The text contained an ill-formed sequence which is described
+//! by the ErrorOffset and ErrorLength fields of @p metrics.
+//! @details Text is well formed if it meets the requirements of table 3-7 of
+//! the Unicode standard, which excludes overlong encodings, encoded UTF-16
+//! surrogates, code points beyond U+10FFFF and truncated sequences.
+bool tryMeasureUtf8(uint8_cptr_t utf8Bytes, size_t byteCount, Utf8Metrics &metrics)
+{
+    if (byteCount < MinVectorLength)
+    {
+        return tryMeasureUtf8_Base(utf8Bytes, byteCount, metrics);
+    }
+    else if (getKernels().Measure(utf8Bytes, byteCount, metrics))
+    {
+        return true;
+    }
+
+    // The vectorised kernels only determine that an error exists, re-scan
+    // the text to locate it.
+    return tryMeasureUtf8_Base(utf8Bytes, byteCount, metrics);
+}
+
+//! @brief Validates a block of UTF-8 encoded text using the fastest kernel
+//! available without necessarily calculating its length in other encodings.
+//! @param[in] utf8Bytes The bytes to validate.
+//! @param[in] byteCount The count of bytes in @p utf8Bytes.
+//! @param[out] metrics Receives the location of the first invalid sequence
+//! of bytes, the length fields may not be set.
+//! @retval true The text was well formed.
+//! @retval false The text contained an ill-formed sequence which is described
+//! by the ErrorOffset and ErrorLength fields of @p metrics.
+bool tryValidateUtf8(uint8_cptr_t utf8Bytes, size_t byteCount, Utf8Metrics &metrics)
+{
+    if (byteCount < MinVectorLength)
+    {
+        return tryMeasureUtf8_Base(utf8Bytes, byteCount, metrics);
+    }
+    else if (getKernels().Validate(utf8Bytes, byteCount, metrics))
+    {
+        return true;
+    }
+
+    // Re-scan the text to locate the error.
+    return tryMeasureUtf8_Base(utf8Bytes, byteCount, metrics);
+}
+
+//! @brief Converts UTF-8 text to UTF-16 using the fastest kernel available.
+//! @param[in] utf8Bytes The bytes to convert.
+//! @param[in] byteCount The count of bytes in @p utf8Bytes.
+//! @param[out] destination The buffer to receive the UTF-16 words.
+//! @param[in] capacity The count of words @p destination can hold.
+//! @return The extent of the conversion and the reason it stopped.
+TranscodeResult transcodeUtf8(uint8_cptr_t utf8Bytes, size_t byteCount,
+                              char16_t *destination, size_t capacity)
+{
+    return (byteCount < MinVectorLength) ?
+        transcodeUtf8_Base(utf8Bytes, byteCount, destination, capacity) :
+        getKernels().ToUtf16(utf8Bytes, byteCount, destination, capacity);
+}
+
+//! @brief Converts UTF-8 text to UTF-32 using the fastest kernel available.
+//! @param[in] utf8Bytes The bytes to convert.
+//! @param[in] byteCount The count of bytes in @p utf8Bytes.
+//! @param[out] destination The buffer to receive the code points.
+//! @param[in] capacity The count of code points @p destination can hold.
+//! @return The extent of the conversion and the reason it stopped.
+TranscodeResult transcodeUtf8(uint8_cptr_t utf8Bytes, size_t byteCount,
+                              char32_t *destination, size_t capacity)
+{
+    return (byteCount < MinVectorLength) ?
+        transcodeUtf8_Base(utf8Bytes, byteCount, destination, capacity) :
+        getKernels().ToUtf32(utf8Bytes, byteCount, destination, capacity);
+}
+
+//! @brief Validates a block of UTF-8 encoded text and calculates the length
+//! of the text in other encodings using portable scalar code.
+//! @param[in] utf8Bytes The bytes to validate.
+//! @param[in] byteCount The count of bytes in @p utf8Bytes.
+//! @param[out] metrics Receives the lengths of the text in other encodings
+//! or the location of the first invalid sequence of bytes.
+//! @retval true The text was well formed, the lengths in @p metrics are valid.
+//! @retval false The text contained an ill-formed sequence which is described
+//! by the ErrorOffset and ErrorLength fields of @p metrics.
+bool tryMeasureUtf8_Base(uint8_cptr_t utf8Bytes, size_t byteCount,
+                         Utf8Metrics &metrics)
+{
+    size_t utf16Length = 0;
+    size_t utf32Length = 0;
+    size_t index = 0;
+
+    metrics.ErrorOffset = 0;
+    metrics.ErrorLength = 0;
+
+    while (index < byteCount)
+    {
+        // Skip runs of ASCII characters a word at a time.
+        uint64_t word;
+
+        while ((index + sizeof(word)) <= byteCount)
+        {
+            std::memcpy(&word, utf8Bytes + index, sizeof(word));
+
+            if (word & AsciiMask)
+                break;
+
+            index += sizeof(word);
+            utf32Length += sizeof(word);
+        }
+
+        if (index >= byteCount)
+            break;
+
+        uint8_t leadByte = utf8Bytes[index];
+
+        if (leadByte < 0x80)
+        {
+            ++index;
+            ++utf32Length;
+            continue;
+        }
+
+        size_t sequenceLength = getSequenceLength(utf8Bytes, index, byteCount,
+                                                  metrics.ErrorLength);
+
+        if (sequenceLength == 0)
+        {
+            metrics.ErrorOffset = index;
+            return false;
+        }
+
+        index += sequenceLength;
+        ++utf32Length;
+
+        // Code points beyond the BMP require a UTF-16 surrogate pair.
+        utf16Length += (sequenceLength == 4) ? 1 : 0;
+    }
+
+    metrics.Utf32Length = utf32Length;
+    metrics.Utf16Length = utf16Length + utf32Length;
+
+    return true;
+}
+
+//! @brief Converts UTF-8 text to UTF-16 using portable scalar code.
+//! @param[in] utf8Bytes The bytes to convert.
+//! @param[in] byteCount The count of bytes in @p utf8Bytes.
+//! @param[out] destination The buffer to receive the UTF-16 words.
+//! @param[in] capacity The count of words @p destination can hold.
+//! @return The extent of the conversion and the reason it stopped.
+TranscodeResult transcodeUtf8_Base(uint8_cptr_t utf8Bytes, size_t byteCount,
+                                   char16_t *destination, size_t capacity)
+{
+    return transcodeUtf8Scalar(utf8Bytes, byteCount, destination, capacity);
+}
+
+//! @brief Converts UTF-8 text to UTF-32 using portable scalar code.
+//! @param[in] utf8Bytes The bytes to convert.
+//! @param[in] byteCount The count of bytes in @p utf8Bytes.
+//! @param[out] destination The buffer to receive the code points.
+//! @param[in] capacity The count of code points @p destination can hold.
+//! @return The extent of the conversion and the reason it stopped.
+TranscodeResult transcodeUtf8_Base(uint8_cptr_t utf8Bytes, size_t byteCount,
+                                   char32_t *destination, size_t capacity)
+{
+    return transcodeUtf8Scalar(utf8Bytes, byteCount, destination, capacity);
+}
+
+}} // namespace Ag::Utf
+////////////////////////////////////////////////////////////////////////////////
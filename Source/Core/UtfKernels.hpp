@@ -0,0 +1,105 @@
+//! @file Core/UtfKernels.hpp
+//! @brief The declaration of bulk operations on Unicode text which have
+//! implementations specialised for different CPU architecture levels.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __AG_CORE_UTF_KERNELS_HPP__
+#define __AG_CORE_UTF_KERNELS_HPP__
+
+////////////////////////////////////////////////////////////////////////////////
+// Dependent Header Files
+////////////////////////////////////////////////////////////////////////////////
+#include "Ag/Core/Configuration.hpp"
+#include "Ag/Core/Utf.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Macro Definitions
+////////////////////////////////////////////////////////////////////////////////
+#if defined(_M_AMD64) || defined(__x86_64__)
+//! @brief Defined if kernels specialised for x86-64 architecture levels are
+//! available to be selected at runtime.
+#define AG_HAS_X64_KERNELS
+
+#ifdef _MSC_VER
+// MSVC allows any intrinsic to be used in any function.
+#define AG_TARGET_X64V2
+#define AG_TARGET_X64V3
+#else
+//! @brief Marks a function as being compiled for the x86-64 v2 architecture
+//! level, regardless of the options the rest of the module is compiled with.
+#define AG_TARGET_X64V2 __attribute__((target("sse4.2,popcnt")))
+
+//! @brief Marks a function as being compiled for the x86-64 v3 architecture
+//! level, regardless of the options the rest of the module is compiled with.
+#define AG_TARGET_X64V3 __attribute__((target("avx2,bmi,bmi2,popcnt")))
+#endif
+#endif
+
+namespace Ag {
+namespace Utf {
+
+////////////////////////////////////////////////////////////////////////////////
+// Data Type Declarations
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Describes the result of validating a block of UTF-8 encoded text.
+struct Utf8Metrics
+{
+    //! @brief The count of 16-bit words required to encode the text as UTF-16.
+    size_t Utf16Length;
+
+    //! @brief The count of Unicode code points encoded in the text.
+    size_t Utf32Length;
+
+    //! @brief The offset of the first byte of the first invalid sequence.
+    size_t ErrorOffset;
+
+    //! @brief The count of bytes in the first invalid sequence.
+    size_t ErrorLength;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Declarations
+////////////////////////////////////////////////////////////////////////////////
+bool tryMeasureUtf8(uint8_cptr_t utf8Bytes, size_t byteCount, Utf8Metrics &metrics);
+bool tryValidateUtf8(uint8_cptr_t utf8Bytes, size_t byteCount, Utf8Metrics &metrics);
+TranscodeResult transcodeUtf8(uint8_cptr_t utf8Bytes, size_t byteCount,
+                              char16_t *destination, size_t capacity);
+TranscodeResult transcodeUtf8(uint8_cptr_t utf8Bytes, size_t byteCount,
+                              char32_t *destination, size_t capacity);
+
+// Individual implementations, exposed for testing and benchmarking.
+bool tryMeasureUtf8_Base(uint8_cptr_t utf8Bytes, size_t byteCount,
+                         Utf8Metrics &metrics);
+TranscodeResult transcodeUtf8_Base(uint8_cptr_t utf8Bytes, size_t byteCount,
+                                   char16_t *destination, size_t capacity);
+TranscodeResult transcodeUtf8_Base(uint8_cptr_t utf8Bytes, size_t byteCount,
+                                   char32_t *destination, size_t capacity);
+
+#ifdef AG_HAS_X64_KERNELS
+bool tryMeasureUtf8_X64v2(uint8_cptr_t utf8Bytes, size_t byteCount,
+                          Utf8Metrics &metrics);
+bool tryValidateUtf8_X64v2(uint8_cptr_t utf8Bytes, size_t byteCount,
+                           Utf8Metrics &metrics);
+bool tryMeasureUtf8_X64v3(uint8_cptr_t utf8Bytes, size_t byteCount,
+                          Utf8Metrics &metrics);
+bool tryValidateUtf8_X64v3(uint8_cptr_t utf8Bytes, size_t byteCount,
+                           Utf8Metrics &metrics);
+TranscodeResult transcodeUtf8_X64v2(uint8_cptr_t utf8Bytes, size_t byteCount,
+                                    char16_t *destination, size_t capacity);
+TranscodeResult transcodeUtf8_X64v2(uint8_cptr_t utf8Bytes, size_t byteCount,
+                                    char32_t *destination, size_t capacity);
+TranscodeResult transcodeUtf8_X64v3(uint8_cptr_t utf8Bytes, size_t byteCount,
+                                    char16_t *destination, size_t capacity);
+TranscodeResult transcodeUtf8_X64v3(uint8_cptr_t utf8Bytes, size_t byteCount,
+                                    char32_t *destination, size_t capacity);
+#endif
+
+}} // namespace Ag::Utf
+
+#endif // Header guard
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,599 @@
+//! @file Core/UtfKernels_x64.cpp
+//! @brief The definition of bulk operations on Unicode text which are
+//! vectorised for specific x86-64 architecture levels.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Header File Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <cstring>
+
+#include "UtfKernels.hpp"
+
+#ifdef AG_HAS_X64_KERNELS
+#include <immintrin.h>
+
+namespace Ag {
+namespace Utf {
+
+namespace {
+////////////////////////////////////////////////////////////////////////////////
+// Local Data
+////////////////////////////////////////////////////////////////////////////////
+// The UTF-8 validation kernels use the lookup algorithm described in
+// "Validating UTF-8 In Less Than One Instruction Per Byte" (Keiser & Lemire,
+// 2021). Each pair of adjacent bytes is classified using three 16-entry tables
+// indexed by nibbles, the bitwise AND of the results is non-zero only where
+// the pair is ill-formed.
+constexpr uint8_t TooShort     = 1 << 0; // 11______ 0_______ or 11______ 11______
+constexpr uint8_t TooLong      = 1 << 1; // 0_______ 10______
+constexpr uint8_t Overlong3    = 1 << 2; // 11100000 100_____
+constexpr uint8_t TooLarge     = 1 << 3; // 11110100 1001____ or 11110100 101_____
+constexpr uint8_t Surrogate    = 1 << 4; // 11101101 101_____
+constexpr uint8_t Overlong2    = 1 << 5; // 1100000_ 10______
+constexpr uint8_t TooLarge1000 = 1 << 6; // 11110101+ 1000____
+constexpr uint8_t Overlong4    = 1 << 6; // 11110000 1000____
+constexpr uint8_t TwoConts     = 1 << 7; // 10______ 10______
+constexpr uint8_t Carry        = TooShort | TooLong | TwoConts;
+
+//! @brief Classifies the high nibble of the first byte of each pair.
+alignas(16) const uint8_t Byte1HighTable[16] = {
+    // 0_______ ________ <ASCII in byte 1>
+    TooLong, TooLong, TooLong, TooLong,
+    TooLong, TooLong, TooLong, TooLong,
+    // 10______ ________ <continuation in byte 1>
+    TwoConts, TwoConts, TwoConts, TwoConts,
+    // 1100____ ________ <two byte lead in byte 1>
+    TooShort | Overlong2,
+    // 1101____ ________ <two byte lead in byte 1>
+    TooShort,
+    // 1110____ ________ <three byte lead in byte 1>
+    TooShort | Overlong3 | Surrogate,
+    // 1111____ ________ <four+ byte lead in byte 1>
+    TooShort | TooLarge | TooLarge1000 | Overlong4
+};
+
+//! @brief Classifies the low nibble of the first byte of each pair.
+alignas(16) const uint8_t Byte1LowTable[16] = {
+    // ____0000 ________
+    Carry | Overlong3 | Overlong2 | Overlong4,
+    // ____0001 ________
+    Carry | Overlong2,
+    // ____001_ ________
+    Carry,
+    Carry,
+    // ____0100 ________
+    Carry | TooLarge,
+    // ____0101 ________
+    Carry | TooLarge | TooLarge1000,
+    // ____011_ ________
+    Carry | TooLarge | TooLarge1000,
+    Carry | TooLarge | TooLarge1000,
+    // ____1___ ________
+    Carry | TooLarge | TooLarge1000,
+    Carry | TooLarge | TooLarge1000,
+    Carry | TooLarge | TooLarge1000,
+    Carry | TooLarge | TooLarge1000,
+    Carry | TooLarge | TooLarge1000,
+    // ____1101 ________
+    Carry | TooLarge | TooLarge1000 | Surrogate,
+    Carry | TooLarge | TooLarge1000,
+    Carry | TooLarge | TooLarge1000
+};
+
+//! @brief Classifies the high nibble of the second byte of each pair.
+alignas(16) const uint8_t Byte2HighTable[16] = {
+    // ________ 0_______ <ASCII in byte 2>
+    TooShort, TooShort, TooShort, TooShort,
+    TooShort, TooShort, TooShort, TooShort,
+    // ________ 1000____
+    TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge1000 | Overlong4,
+    // ________ 1001____
+    TooLong | Overlong2 | TwoConts | Overlong3 | TooLarge,
+    // ________ 101_____
+    TooLong | Overlong2 | TwoConts | Surrogate | TooLarge,
+    TooLong | Overlong2 | TwoConts | Surrogate | TooLarge,
+    // ________ 11______ <lead byte in byte 2>
+    TooShort, TooShort, TooShort, TooShort
+};
+
+//! @brief The largest values which can legally appear in the last bytes of
+//! a block if the block does not end part way through a sequence.
+alignas(32) const uint8_t IncompleteLimits[32] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Classifies the bytes of a 16-byte block of UTF-8 text.
+//! @param[in] input The block to classify.
+//! @param[in] previous The block which preceded @p input.
+//! @return A vector which is zero if the block is well formed.
+AG_TARGET_X64V2
+__m128i checkUtf8Block_X64v2(__m128i input, __m128i previous)
+{
+    const __m128i nibbleMask = _mm_set1_epi8(0x0F);
+    const __m128i prev1 = _mm_alignr_epi8(input, previous, 15);
+
+    __m128i byte1High = _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i *>(Byte1HighTable)),
+                                         _mm_and_si128(_mm_srli_epi16(prev1, 4), nibbleMask));
+    __m128i byte1Low = _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i *>(Byte1LowTable)),
+                                        _mm_and_si128(prev1, nibbleMask));
+    __m128i byte2High = _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i *>(Byte2HighTable)),
+                                         _mm_and_si128(_mm_srli_epi16(input, 4), nibbleMask));
+
+    __m128i specialCases = _mm_and_si128(_mm_and_si128(byte1High, byte1Low), byte2High);
+
+    // Verify that the 3rd and 4th bytes of longer sequences are continuations.
+    const __m128i prev2 = _mm_alignr_epi8(input, previous, 14);
+    const __m128i prev3 = _mm_alignr_epi8(input, previous, 13);
+    __m128i isThirdByte = _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+    __m128i isFourthByte = _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+    __m128i mustBeContinuation = _mm_and_si128(_mm_or_si128(isThirdByte, isFourthByte),
+                                               _mm_set1_epi8(static_cast<char>(0x80)));
+
+    return _mm_xor_si128(mustBeContinuation, specialCases);
+}
+
+//! @brief Classifies the bytes of a 32-byte block of UTF-8 text.
+//! @param[in] input The block to classify.
+//! @param[in] previous The block which preceded @p input.
+//! @return A vector which is zero if the block is well formed.
+AG_TARGET_X64V3
+__m256i checkUtf8Block_X64v3(__m256i input, __m256i previous)
+{
+    const __m256i nibbleMask = _mm256_set1_epi8(0x0F);
+
+    // Get the previous block's high lane alongside this block's low lane so
+    // that bytes can be shifted between lanes.
+    const __m256i spanning = _mm256_permute2x128_si256(previous, input, 0x21);
+    const __m256i prev1 = _mm256_alignr_epi8(input, spanning, 15);
+
+    __m256i byte1High = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i *>(Byte1HighTable))),
+                                            _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibbleMask));
+    __m256i byte1Low = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i *>(Byte1LowTable))),
+                                           _mm256_and_si256(prev1, nibbleMask));
+    __m256i byte2High = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i *>(Byte2HighTable))),
+                                            _mm256_and_si256(_mm256_srli_epi16(input, 4), nibbleMask));
+
+    __m256i specialCases = _mm256_and_si256(_mm256_and_si256(byte1High, byte1Low), byte2High);
+
+    // Verify that the 3rd and 4th bytes of longer sequences are continuations.
+    const __m256i prev2 = _mm256_alignr_epi8(input, spanning, 14);
+    const __m256i prev3 = _mm256_alignr_epi8(input, spanning, 13);
+    __m256i isThirdByte = _mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+    __m256i isFourthByte = _mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+    __m256i mustBeContinuation = _mm256_and_si256(_mm256_or_si256(isThirdByte, isFourthByte),
+                                                  _mm256_set1_epi8(static_cast<char>(0x80)));
+
+    return _mm256_xor_si256(mustBeContinuation, specialCases);
+}
+
+//! @brief Validates a block of UTF-8 encoded text and optionally calculates
+//! the length of the text in other encodings using SSE4.2 instructions.
+//! @tparam IsMeasuring True to calculate lengths, false to only validate.
+//! @param[in] utf8Bytes The bytes to validate.
+//! @param[in] byteCount The count of bytes in @p utf8Bytes.
+//! @param[out] metrics Receives the lengths of the text in other encodings
+//! if @p IsMeasuring is true.
+//! @retval true The text was well formed.
+//! @retval false The text contained an ill-formed sequence, the location of
+//! which is not determined.
+template<bool IsMeasuring>
+AG_TARGET_X64V2
+bool scanUtf8_X64v2(uint8_cptr_t utf8Bytes, size_t byteCount,
+                    Utf8Metrics &metrics)
+{
+    constexpr size_t BlockSize = sizeof(__m128i);
+    const __m128i continuationLimit = _mm_set1_epi8(-64);
+    const __m128i fourByteLead = _mm_set1_epi8(static_cast<char>(0xF0));
+    const __m128i incompleteLimits = _mm_load_si128(reinterpret_cast<const __m128i *>(IncompleteLimits + 16));
+    const __m128i zero = _mm_setzero_si128();
+
+    __m128i error = zero;
+    __m128i previous = zero;
+    __m128i previousIncomplete = zero;
+    size_t continuationCount = 0;
+    size_t fourByteCount = 0;
+    alignas(16) uint8_t tail[BlockSize];
+
+    for (size_t offset = 0; offset < byteCount; offset += BlockSize)
+    {
+        __m128i input;
+
+        if ((offset + BlockSize) <= byteCount)
+        {
+            input = _mm_loadu_si128(reinterpret_cast<const __m128i *>(utf8Bytes + offset));
+        }
+        else
+        {
+            // Pad the final partial block with ASCII nulls.
+            std::memset(tail, 0, BlockSize);
+            std::memcpy(tail, utf8Bytes + offset, byteCount - offset);
+            input = _mm_load_si128(reinterpret_cast<const __m128i *>(tail));
+        }
+
+        if (_mm_movemask_epi8(input) == 0)
+        {
+            // An all-ASCII block is valid unless the previous block ended
+            // part way through a sequence.
+            error = _mm_or_si128(error, previousIncomplete);
+            previousIncomplete = zero;
+        }
+        else
+        {
+            error = _mm_or_si128(error, checkUtf8Block_X64v2(input, previous));
+            previousIncomplete = _mm_subs_epu8(input, incompleteLimits);
+
+            if constexpr (IsMeasuring)
+            {
+                // Signed bytes less than -64 are 0x80-0xBF continuation bytes.
+                uint32_t continuations = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(continuationLimit, input)));
+                uint32_t fourByteLeads = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(input, fourByteLead), input)));
+
+                continuationCount += static_cast<size_t>(_mm_popcnt_u32(continuations));
+                fourByteCount += static_cast<size_t>(_mm_popcnt_u32(fourByteLeads));
+            }
+        }
+
+        previous = input;
+    }
+
+    error = _mm_or_si128(error, previousIncomplete);
+
+    if constexpr (IsMeasuring)
+    {
+        metrics.Utf32Length = byteCount - continuationCount;
+        metrics.Utf16Length = metrics.Utf32Length + fourByteCount;
+    }
+
+    metrics.ErrorOffset = 0;
+    metrics.ErrorLength = 0;
+
+    return _mm_testz_si128(error, error) != 0;
+}
+
+//! @brief Validates a block of UTF-8 encoded text and optionally calculates
+//! the length of the text in other encodings using AVX2 instructions.
+//! @tparam IsMeasuring True to calculate lengths, false to only validate.
+//! @param[in] utf8Bytes The bytes to validate.
+//! @param[in] byteCount The count of bytes in @p utf8Bytes.
+//! @param[out] metrics Receives the lengths of the text in other encodings
+//! if @p IsMeasuring is true.
+//! @retval true The text was well formed.
+//! @retval false The text contained an ill-formed sequence, the location of
+//! which is not determined.
+template<bool IsMeasuring>
+AG_TARGET_X64V3
+bool scanUtf8_X64v3(uint8_cptr_t utf8Bytes, size_t byteCount,
+                    Utf8Metrics &metrics)
+{
+    constexpr size_t BlockSize = sizeof(__m256i);
+    const __m256i continuationLimit = _mm256_set1_epi8(-64);
+    const __m256i fourByteLead = _mm256_set1_epi8(static_cast<char>(0xF0));
+    const __m256i incompleteLimits = _mm256_load_si256(reinterpret_cast<const __m256i *>(IncompleteLimits));
+    const __m256i zero = _mm256_setzero_si256();
+
+    __m256i error = zero;
+    __m256i previous = zero;
+    __m256i previousIncomplete = zero;
+    size_t continuationCount = 0;
+    size_t fourByteCount = 0;
+    alignas(32) uint8_t tail[BlockSize];
+
+    for (size_t offset = 0; offset < byteCount; offset += BlockSize)
+    {
+        __m256i input;
+
+        if ((offset + BlockSize) <= byteCount)
+        {
+            input = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(utf8Bytes + offset));
+        }
+        else
+        {
+            // Pad the final partial block with ASCII nulls.
+            std::memset(tail, 0, BlockSize);
+            std::memcpy(tail, utf8Bytes + offset, byteCount - offset);
+            input = _mm256_load_si256(reinterpret_cast<const __m256i *>(tail));
+        }
+
+        if (_mm256_movemask_epi8(input) == 0)
+        {
+            // An all-ASCII block is valid unless the previous block ended
+            // part way through a sequence.
+            error = _mm256_or_si256(error, previousIncomplete);
+            previousIncomplete = zero;
+        }
+        else
+        {
+            error = _mm256_or_si256(error, checkUtf8Block_X64v3(input, previous));
+            previousIncomplete = _mm256_subs_epu8(input, incompleteLimits);
+
+            if constexpr (IsMeasuring)
+            {
+                // Signed bytes less than -64 are 0x80-0xBF continuation bytes.
+                uint32_t continuations = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(continuationLimit, input)));
+                uint32_t fourByteLeads = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(input, fourByteLead), input)));
+
+                continuationCount += static_cast<size_t>(_mm_popcnt_u32(continuations));
+                fourByteCount += static_cast<size_t>(_mm_popcnt_u32(fourByteLeads));
+            }
+        }
+
+        previous = input;
+    }
+
+    error = _mm256_or_si256(error, previousIncomplete);
+
+    if constexpr (IsMeasuring)
+    {
+        metrics.Utf32Length = byteCount - continuationCount;
+        metrics.Utf16Length = metrics.Utf32Length + fourByteCount;
+    }
+
+    metrics.ErrorOffset = 0;
+    metrics.ErrorLength = 0;
+
+    return _mm256_testz_si256(error, error) != 0;
+}
+
+//! @brief Converts a run of UTF-8 text which contains non-ASCII characters
+//! using the scalar kernel.
+//! @param[in] utf8Bytes The text being converted.
+//! @param[in] byteCount The count of bytes in @p utf8Bytes.
+//! @param[in] windowEnd The offset of the end of the run, which is extended
+//! to the next sequence boundary.
+//! @param[out] destination The buffer to receive the converted characters.
+//! @param[in] capacity The count of characters @p destination can hold.
+//! @param[in,out] result The progress of the conversion to update.
+//! @retval true The run was converted in full.
+//! @retval false The conversion stopped, the reason is recorded in @p result.
+template<typename TChar>
+bool transcodeRun(uint8_cptr_t utf8Bytes, size_t byteCount, size_t windowEnd,
+                  TChar *destination, size_t capacity, TranscodeResult &result)
+{
+    // A well-formed sequence never starts with a continuation byte, so the
+    // window won't split one.
+    while ((windowEnd < byteCount) && ((utf8Bytes[windowEnd] & 0xC0) == 0x80))
+    {
+        ++windowEnd;
+    }
+
+    TranscodeResult run = transcodeUtf8_Base(utf8Bytes + result.Consumed,
+                                             windowEnd - result.Consumed,
+                                             destination + result.Produced,
+                                             capacity - result.Produced);
+
+    result.Consumed += run.Consumed;
+    result.Produced += run.Produced;
+    result.Status = run.Status;
+
+    return run.Status == TranscodeStatus::Complete;
+}
+
+//! @brief Converts UTF-8 text to UTF-16 or UTF-32, widening blocks of ASCII
+//! characters using SSE4.1 instructions.
+//! @tparam TChar The data type of the characters to produce.
+template<typename TChar>
+AG_TARGET_X64V2
+TranscodeResult transcodeBlocks_X64v2(uint8_cptr_t utf8Bytes, size_t byteCount,
+                                      TChar *destination, size_t capacity)
+{
+    constexpr size_t BlockSize = sizeof(__m128i);
+    TranscodeResult result = { 0, 0, TranscodeStatus::Complete };
+
+    while (((result.Consumed + BlockSize) <= byteCount) &&
+           ((result.Produced + BlockSize) <= capacity))
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(utf8Bytes + result.Consumed));
+
+        if (_mm_movemask_epi8(block) != 0)
+        {
+            if (transcodeRun(utf8Bytes, byteCount, result.Consumed + BlockSize,
+                             destination, capacity, result) == false)
+            {
+                return result;
+            }
+
+            continue;
+        }
+
+        __m128i *output = reinterpret_cast<__m128i *>(destination + result.Produced);
+
+        if constexpr (sizeof(TChar) == sizeof(char16_t))
+        {
+            _mm_storeu_si128(output, _mm_cvtepu8_epi16(block));
+            _mm_storeu_si128(output + 1, _mm_cvtepu8_epi16(_mm_srli_si128(block, 8)));
+        }
+        else
+        {
+            _mm_storeu_si128(output, _mm_cvtepu8_epi32(block));
+            _mm_storeu_si128(output + 1, _mm_cvtepu8_epi32(_mm_srli_si128(block, 4)));
+            _mm_storeu_si128(output + 2, _mm_cvtepu8_epi32(_mm_srli_si128(block, 8)));
+            _mm_storeu_si128(output + 3, _mm_cvtepu8_epi32(_mm_srli_si128(block, 12)));
+        }
+
+        result.Consumed += BlockSize;
+        result.Produced += BlockSize;
+    }
+
+    // Convert the remaining text.
+    transcodeRun(utf8Bytes, byteCount, byteCount, destination, capacity, result);
+
+    return result;
+}
+
+//! @brief Converts UTF-8 text to UTF-16 or UTF-32, widening blocks of ASCII
+//! characters using AVX2 instructions.
+//! @tparam TChar The data type of the characters to produce.
+template<typename TChar>
+AG_TARGET_X64V3
+TranscodeResult transcodeBlocks_X64v3(uint8_cptr_t utf8Bytes, size_t byteCount,
+                                      TChar *destination, size_t capacity)
+{
+    constexpr size_t BlockSize = sizeof(__m256i);
+    TranscodeResult result = { 0, 0, TranscodeStatus::Complete };
+
+    while (((result.Consumed + BlockSize) <= byteCount) &&
+           ((result.Produced + BlockSize) <= capacity))
+    {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(utf8Bytes + result.Consumed));
+
+        if (_mm256_movemask_epi8(block) != 0)
+        {
+            if (transcodeRun(utf8Bytes, byteCount, result.Consumed + BlockSize,
+                             destination, capacity, result) == false)
+            {
+                return result;
+            }
+
+            continue;
+        }
+
+        __m256i *output = reinterpret_cast<__m256i *>(destination + result.Produced);
+        __m128i low = _mm256_castsi256_si128(block);
+        __m128i high = _mm256_extracti128_si256(block, 1);
+
+        if constexpr (sizeof(TChar) == sizeof(char16_t))
+        {
+            _mm256_storeu_si256(output, _mm256_cvtepu8_epi16(low));
+            _mm256_storeu_si256(output + 1, _mm256_cvtepu8_epi16(high));
+        }
+        else
+        {
+            _mm256_storeu_si256(output, _mm256_cvtepu8_epi32(low));
+            _mm256_storeu_si256(output + 1, _mm256_cvtepu8_epi32(_mm_srli_si128(low, 8)));
+            _mm256_storeu_si256(output + 2, _mm256_cvtepu8_epi32(high));
+            _mm256_storeu_si256(output + 3, _mm256_cvtepu8_epi32(_mm_srli_si128(high, 8)));
+        }
+
+        result.Consumed += BlockSize;
+        result.Produced += BlockSize;
+    }
+
+    // Convert the remaining text.
+    transcodeRun(utf8Bytes, byteCount, byteCount, destination, capacity, result);
+
+    return result;
+}
+
+} // Anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+// Global Function Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Validates a block of UTF-8 encoded text and calculates the length
+//! of the text in other encodings using SSE4.2 instructions.
+//! @param[in] utf8Bytes The bytes to validate.
+//! @param[in] byteCount The count of bytes in @p utf8Bytes.
+//! @param[out] metrics Receives the lengths of the text in other encodings.
+//! @retval true The text was well formed, the lengths in @p metrics are valid.
+//! @retval false The text contained an ill-formed sequence, the location of
+//! which is not determined.
+bool tryMeasureUtf8_X64v2(uint8_cptr_t utf8Bytes, size_t byteCount,
+                          Utf8Metrics &metrics)
+{
+    return scanUtf8_X64v2<true>(utf8Bytes, byteCount, metrics);
+}
+
+//! @brief Validates a block of UTF-8 encoded text using SSE4.2 instructions.
+//! @param[in] utf8Bytes The bytes to validate.
+//! @param[in] byteCount The count of bytes in @p utf8Bytes.
+//! @param[out] metrics Unused, the lengths are not calculated.
+//! @retval true The text was well formed.
+//! @retval false The text contained an ill-formed sequence, the location of
+//! which is not determined.
+bool tryValidateUtf8_X64v2(uint8_cptr_t utf8Bytes, size_t byteCount,
+                           Utf8Metrics &metrics)
+{
+    return scanUtf8_X64v2<false>(utf8Bytes, byteCount, metrics);
+}
+
+//! @brief Validates a block of UTF-8 encoded text and calculates the length
+//! of the text in other encodings using AVX2 instructions.
+//! @param[in] utf8Bytes The bytes to validate.
+//! @param[in] byteCount The count of bytes in @p utf8Bytes.
+//! @param[out] metrics Receives the lengths of the text in other encodings.
+//! @retval true The text was well formed, the lengths in @p metrics are valid.
+//! @retval false The text contained an ill-formed sequence, the location of
+//! which is not determined.
+bool tryMeasureUtf8_X64v3(uint8_cptr_t utf8Bytes, size_t byteCount,
+                          Utf8Metrics &metrics)
+{
+    return scanUtf8_X64v3<true>(utf8Bytes, byteCount, metrics);
+}
+
+//! @brief Validates a block of UTF-8 encoded text using AVX2 instructions.
+//! @param[in] utf8Bytes The bytes to validate.
+//! @param[in] byteCount The count of bytes in @p utf8Bytes.
+//! @param[out] metrics Unused, the lengths are not calculated.
+//! @retval true The text was well formed.
+//! @retval false The text contained an ill-formed sequence, the location of
+//! which is not determined.
+bool tryValidateUtf8_X64v3(uint8_cptr_t utf8Bytes, size_t byteCount,
+                           Utf8Metrics &metrics)
+{
+    return scanUtf8_X64v3<false>(utf8Bytes, byteCount, metrics);
+}
+
+//! @brief Converts UTF-8 text to UTF-16 using SSE4.1 instructions.
+//! @param[in] utf8Bytes The bytes to convert.
+//! @param[in] byteCount The count of bytes in @p utf8Bytes.
+//! @param[out] destination The buffer to receive the UTF-16 words.
+//! @param[in] capacity The count of words @p destination can hold.
+//! @return The extent of the conversion and the reason it stopped.
+TranscodeResult transcodeUtf8_X64v2(uint8_cptr_t utf8Bytes, size_t byteCount,
+                                    char16_t *destination, size_t capacity)
+{
+    return transcodeBlocks_X64v2(utf8Bytes, byteCount, destination, capacity);
+}
+
+//! @brief Converts UTF-8 text to UTF-32 using SSE4.1 instructions.
+//! @param[in] utf8Bytes The bytes to convert.
+//! @param[in] byteCount The count of bytes in @p utf8Bytes.
+//! @param[out] destination The buffer to receive the code points.
+//! @param[in] capacity The count of code points @p destination can hold.
+//! @return The extent of the conversion and the reason it stopped.
+TranscodeResult transcodeUtf8_X64v2(uint8_cptr_t utf8Bytes, size_t byteCount,
+                                    char32_t *destination, size_t capacity)
+{
+    return transcodeBlocks_X64v2(utf8Bytes, byteCount, destination, capacity);
+}
+
+//! @brief Converts UTF-8 text to UTF-16 using AVX2 instructions.
+//! @param[in] utf8Bytes The bytes to convert.
+//! @param[in] byteCount The count of bytes in @p utf8Bytes.
+//! @param[out] destination The buffer to receive the UTF-16 words.
+//! @param[in] capacity The count of words @p destination can hold.
+//! @return The extent of the conversion and the reason it stopped.
+TranscodeResult transcodeUtf8_X64v3(uint8_cptr_t utf8Bytes, size_t byteCount,
+                                    char16_t *destination, size_t capacity)
+{
+    return transcodeBlocks_X64v3(utf8Bytes, byteCount, destination, capacity);
+}
+
+//! @brief Converts UTF-8 text to UTF-32 using AVX2 instructions.
+//! @param[in] utf8Bytes The bytes to convert.
+//! @param[in] byteCount The count of bytes in @p utf8Bytes.
+//! @param[out] destination The buffer to receive the code points.
+//! @param[in] capacity The count of code points @p destination can hold.
+//! @return The extent of the conversion and the reason it stopped.
+TranscodeResult transcodeUtf8_X64v3(uint8_cptr_t utf8Bytes, size_t byteCount,
+                                    char32_t *destination, size_t capacity)
+{
+    return transcodeBlocks_X64v3(utf8Bytes, byteCount, destination, capacity);
+}
+
+}} // namespace Ag::Utf
+
+#endif // AG_HAS_X64_KERNELS
+////////////////////////////////////////////////////////////////////////////////
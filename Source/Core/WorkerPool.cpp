@@ -0,0 +1,119 @@
+//! @file Core/WorkerPool.cpp
+//! @brief The definition of an object which executes tasks on a fixed set
+//! of background threads.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Header File Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+
+#include "Ag/Core/Exception.hpp"
+#include "Ag/Core/WorkerPool.hpp"
+
+namespace Ag {
+
+////////////////////////////////////////////////////////////////////////////////
+// WorkerPool Member Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Constructs a pool and starts its threads.
+//! @param[in] threadCount The count of threads to create, 0 to use one per
+//! hardware thread.
+WorkerPool::WorkerPool(size_t threadCount /*= 0*/) :
+    _isStopping(false)
+{
+    if (threadCount == 0)
+    {
+        threadCount = getDefaultThreadCount();
+    }
+
+    _threads.reserve(threadCount);
+
+    for (size_t index = 0; index < threadCount; ++index)
+    {
+        _threads.emplace_back(&WorkerPool::runWorker, this);
+    }
+}
+
+//! @brief Executes any queued tasks, then stops and joins the threads.
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> guard(_queueLock);
+        _isStopping = true;
+    }
+
+    _taskAvailable.notify_all();
+
+    for (std::thread &worker : _threads)
+    {
+        worker.join();
+    }
+}
+
+//! @brief Gets the count of threads which execute tasks.
+size_t WorkerPool::getThreadCount() const
+{
+    return _threads.size();
+}
+
+//! @brief Gets the count of threads a pool is created with by default, which
+//! is the count of hardware threads available.
+size_t WorkerPool::getDefaultThreadCount()
+{
+    return std::max(static_cast<size_t>(std::thread::hardware_concurrency()),
+                    static_cast<size_t>(1));
+}
+
+//! @brief Schedules a task to be executed on a worker thread.
+//! @param[in] task The task to execute, it should not throw exceptions.
+//! @throws OperationException If the pool is being destroyed.
+void WorkerPool::post(Task &&task)
+{
+    {
+        std::lock_guard<std::mutex> guard(_queueLock);
+
+        if (_isStopping)
+        {
+            throw OperationException("Cannot post a task to a worker pool "
+                                     "which is shutting down.");
+        }
+
+        _tasks.emplace_back(std::move(task));
+    }
+
+    _taskAvailable.notify_one();
+}
+
+//! @brief The function executed by each worker thread.
+void WorkerPool::runWorker()
+{
+    std::unique_lock<std::mutex> guard(_queueLock);
+
+    while (true)
+    {
+        _taskAvailable.wait(guard, [this]() { return _isStopping || (_tasks.empty() == false); });
+
+        if (_tasks.empty())
+        {
+            // The pool is stopping and all tasks have been executed.
+            break;
+        }
+
+        Task next = std::move(_tasks.front());
+        _tasks.pop_front();
+
+        // Execute the task without holding the lock.
+        guard.unlock();
+        next();
+        guard.lock();
+    }
+}
+
+} // namespace Ag
+////////////////////////////////////////////////////////////////////////////////
@@ -14,6 +14,7 @@
 #include <iterator>
 
 #include "Ag/Core/Exception.hpp"
+#include "Ag/Core/Instrumentation.hpp"
 #include "Ag/Geometry/Line2D.hpp"
 #include "Ag/Geometry/DCEL_Sweep.hpp"
 
@@ -257,6 +258,10 @@ void splitEdgesAtIntersections(NodeTable &nodes, EdgeTable &edges,
                                IDToIDMappingCollection &intersections,
                                SortedEdgeSubstituteMap &substitutes)
 {
+    AG_INSTRUMENT_ZONE("DCEL::splitEdgesAtIntersections");
+    AG_INSTRUMENT_SAMPLE("DCEL sweep intersections per batch",
+                         static_cast<int64_t>(intersections.size()));
+
     edges.batchSplitEdges(nodes, intersections, substitutes);
     intersections.clear();
 }
@@ -894,6 +899,8 @@ bool containsSweepEvent(const SweepContext &context, SweepEventCollection &event
 //! @returns A mapping of edges split to the run of nodes which replaced them.
 SortedEdgeSubstituteMap findAllIntersections(NodeTable &nodes, EdgeTable &edges)
 {
+    AG_INSTRUMENT_ZONE("DCEL::findAllIntersections");
+
     SweepContext context(nodes);
 
     // Stoke an event queue with a start and end event for every edge.
@@ -914,9 +921,16 @@ SortedEdgeSubstituteMap findAllIntersections(NodeTable &nodes, EdgeTable &edges)
     SweepEvent currentEvent;
     SortedEdgeSubstituteMap substitutes;
     substitutes.reserve(16);
+#ifndef AG_DISABLE_INSTRUMENTATION
+    int64_t eventCount = 0;
+#endif
 
     while (eventQueue.tryPopEvent(currentEvent))
     {
+#ifndef AG_DISABLE_INSTRUMENTATION
+        ++eventCount;
+#endif
+
         // Move the sweep to the position of the next event.
         NodePtr eventNode = currentEvent.getEventNode();
         auto eventType = static_cast<IntersectionEventType>(currentEvent.getEventType());
@@ -1094,6 +1108,10 @@ SortedEdgeSubstituteMap findAllIntersections(NodeTable &nodes, EdgeTable &edges)
     // Process final batch of edges to be split.
     splitEdgesAtIntersections(nodes, edges, splitNodesByEdgeID, substitutes);
 
+#ifndef AG_DISABLE_INSTRUMENTATION
+    AG_INSTRUMENT_SAMPLE("DCEL sweep events", eventCount);
+#endif
+
     return substitutes;
 }
 
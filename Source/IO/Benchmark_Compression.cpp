@@ -0,0 +1,196 @@
+//! @file IO/Benchmark_Compression.cpp
+//! @brief The definition of benchmarks which compare the compression ratio
+//! and throughput of the codecs used to encode serialized hierarchies.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Header File Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <cstdio>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+#include "Ag/Core/Timer.hpp"
+#include "Ag/IO/HierarchySerialization.hpp"
+#include "Ag/IO/MemoryStream.hpp"
+
+#include "SampleData.hpp"
+#include "TestTools.hpp"
+
+namespace Ag {
+namespace IO {
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Data
+////////////////////////////////////////////////////////////////////////////////
+//! @brief The count of anonymous children in the random sample hierarchy.
+constexpr size_t SampleChildCount = 32;
+
+//! @brief The count of records in the structured sample hierarchy.
+constexpr int RecordCount = 50000;
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Data Types
+////////////////////////////////////////////////////////////////////////////////
+//! @brief A named set of serialization options to measure.
+struct Configuration
+{
+    const char *Name;
+    SerializationOptions Options;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+// Gets the set of encodings to compare.
+std::vector<Configuration> getConfigurations()
+{
+    return {
+        { "uncompressed", SerializationOptions() },
+        { "bzip2", SerializationOptions(true) },
+        { "bzip2 (1MB chunks)", SerializationOptions(true, 1024 * 1024) },
+        { "lz", SerializationOptions(CompressionCodecID::Lz) },
+    };
+}
+
+// Writes a table of records whose values repeat, as typical of real data.
+void writeRecords(ArrayWriter &writer)
+{
+    static const char *categories[] = { "Alpha", "Beta", "Gamma", "Delta" };
+    std::vector<int16_t> samples(16);
+
+    for (int index = 0; index < RecordCount; ++index)
+    {
+        ObjectWriter record = writer.beginWriteObject();
+        record.write("Index", index);
+        record.write("Category", String(categories[index % std::size(categories)]));
+        record.write("Scale", 0.25 * (index % 100));
+
+        for (size_t sample = 0; sample < samples.size(); ++sample)
+            samples[sample] = static_cast<int16_t>((index + sample) % 512);
+
+        record.beginWriteArray("Samples").writePackedArray(samples);
+    }
+}
+
+// Reads every value of the records written by writeRecords().
+size_t readRecords(ArrayReader &reader)
+{
+    size_t valueCount = 0;
+    ObjectReader record;
+
+    while (reader.tryReadNext(record))
+    {
+        std::string_view category;
+        double scale;
+        int32_t index;
+
+        if (record.tryRead("Index", index) &&
+            record.tryRead("Category", category) &&
+            record.tryRead("Scale", scale))
+        {
+            valueCount += 3;
+        }
+
+        ArrayReader samples = record.readArray("Samples");
+        valueCount += samples.readNextPackedArray<int16_t>().size();
+    }
+
+    return valueCount;
+}
+
+// Measures the time taken by a function in seconds.
+double measure(const std::function<void()> &fn)
+{
+    MonotonicTicks start = HighResMonotonicTimer::getTime();
+    fn();
+
+    return HighResMonotonicTimer::getTimeSpan(HighResMonotonicTimer::getDuration(start));
+}
+
+// Encodes and decodes a hierarchy with each configuration and reports the
+// size, ratio and throughput relative to the uncompressed encoding.
+void runBenchmark(const char *fixtureName,
+                  const std::function<void(ArrayWriter &)> &writeFixture,
+                  const std::function<void(ArrayReader &)> &readFixture)
+{
+    std::printf("%s\n%-20s %12s %8s %14s %14s\n", fixtureName, "Codec",
+                "Bytes", "Ratio", "Write MB/s", "Read MB/s");
+
+    double uncompressedSize = 0.0;
+
+    for (const Configuration &config : getConfigurations())
+    {
+        MemoryStream encoded;
+
+        double writeSeconds = measure([&]()
+        {
+            ArrayWriter writer = beginSerializeArray(&encoded, config.Options);
+            writeFixture(writer);
+            writer.close();
+        });
+
+        double encodedSize = static_cast<double>(encoded.getLength());
+
+        if (uncompressedSize == 0.0)
+            uncompressedSize = encodedSize;
+
+        double readSeconds = measure([&]()
+        {
+            encoded.setPosition(StreamRelative::Beginning, 0);
+            HierarchyRoot root(&encoded);
+            ArrayReader reader = root.getRootArray();
+            readFixture(reader);
+        });
+
+        double megabytes = uncompressedSize / (1024.0 * 1024.0);
+
+        std::printf("%-20s %12.0f %8.2f %14.1f %14.1f\n", config.Name, encodedSize,
+                    uncompressedSize / encodedSize, megabytes / writeSeconds,
+                    megabytes / readSeconds);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Benchmarks
+////////////////////////////////////////////////////////////////////////////////
+GTEST_TEST(CompressionBenchmark, SampleData)
+{
+    RandomByteGenerator entropySource(71);
+    SampleData original;
+
+    original.makeRandom(entropySource, true, SampleChildCount);
+
+    runBenchmark("Random sample data", [&](ArrayWriter &writer)
+    {
+        original.write(writer);
+    },
+    [&](ArrayReader &reader)
+    {
+        SampleData readData;
+        readData.read(reader);
+
+        EXPECT_TRUE(readData.isEqual(original));
+    });
+}
+
+GTEST_TEST(CompressionBenchmark, StructuredRecords)
+{
+    runBenchmark("Structured records", writeRecords, [](ArrayReader &reader)
+    {
+        EXPECT_EQ(readRecords(reader), static_cast<size_t>(RecordCount) * 19);
+    });
+}
+
+} // Anonymous namespace
+
+}} // namespace Ag::IO
+////////////////////////////////////////////////////////////////////////////////
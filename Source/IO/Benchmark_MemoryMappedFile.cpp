@@ -0,0 +1,180 @@
+//! @file IO/Benchmark_MemoryMappedFile.cpp
+//! @brief The definition of benchmarks which compare the throughput of
+//! scanning memory mapped files under different mapping policies.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Header File Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "Ag/Core/Timer.hpp"
+#include "Ag/IO/MemoryMappedFile.hpp"
+
+#include "TestTools.hpp"
+
+namespace Ag {
+namespace IO {
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Data
+////////////////////////////////////////////////////////////////////////////////
+//! @brief The size of the file to scan.
+constexpr size_t FileSize = 128 * 1024 * 1024;
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Data Types
+////////////////////////////////////////////////////////////////////////////////
+//! @brief A named set of options used to map a view.
+struct Policy
+{
+    const char *Name;
+    MappingOptionBits Options;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Functions
+////////////////////////////////////////////////////////////////////////////////
+// Gets the set of mapping policies to compare.
+std::vector<Policy> getPolicies()
+{
+    return {
+        { "default", 0 },
+        { "populate", MappingOption::Populate },
+        { "sequential", MappingOption::Sequential },
+        { "random", MappingOption::Random },
+        { "willneed", MappingOption::WillNeed },
+        { "hugepages", MappingOption::HugePages },
+        { "populate+hugepages", MappingOption::Populate | MappingOption::HugePages },
+    };
+}
+
+// Measures the time taken by a function in seconds.
+double measure(const std::function<void()> &fn)
+{
+    MonotonicTicks start = HighResMonotonicTimer::getTime();
+    fn();
+
+    return HighResMonotonicTimer::getTimeSpan(HighResMonotonicTimer::getDuration(start));
+}
+
+// Sums every 64-bit word of a view in ascending order.
+uint64_t scanSequential(const MemoryMappedView &view)
+{
+    const uint8_t *data = static_cast<const uint8_t *>(view.getPointer());
+    uint64_t sum = 0;
+
+    for (size_t offset = 0; offset + sizeof(uint64_t) <= view.getSize();
+         offset += sizeof(uint64_t))
+    {
+        uint64_t word;
+        std::memcpy(&word, data + offset, sizeof(word));
+        sum += word;
+    }
+
+    return sum;
+}
+
+// Sums a 64-bit word from each page of a view in a shuffled order.
+uint64_t scanRandom(const MemoryMappedView &view, const std::vector<size_t> &pageOrder)
+{
+    const uint8_t *data = static_cast<const uint8_t *>(view.getPointer());
+    size_t pageSize = MemoryMappedFile::getBlockSize();
+    uint64_t sum = 0;
+
+    for (size_t page : pageOrder)
+    {
+        uint64_t word;
+        std::memcpy(&word, data + (page * pageSize), sizeof(word));
+        sum += word;
+    }
+
+    return sum;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Benchmarks
+////////////////////////////////////////////////////////////////////////////////
+GTEST_TEST(MemoryMappedFileBenchmark, ScanPolicies)
+{
+    RandomByteGenerator entropySource(53);
+    FileDeleter deleteOnExit(generateTempFileName());
+
+    createRandomDataFile(entropySource, deleteOnExit.getPath(), FileSize);
+
+    MemoryMappedFile file;
+    file.open(deleteOnExit.getPath(), FileAccess::OpenExisting | FileAccess::Read);
+
+    std::vector<size_t> pageOrder(FileSize / MemoryMappedFile::getBlockSize());
+    std::iota(pageOrder.begin(), pageOrder.end(), 0);
+    std::shuffle(pageOrder.begin(), pageOrder.end(), std::mt19937(59));
+
+    // The file is in the page cache, so the measurements reflect the cost of
+    // page faults and TLB misses rather than of the disk.
+    double megabytes = FileSize / (1024.0 * 1024.0);
+    uint64_t expectedSum = 0;
+    uint64_t expectedRandomSum = 0;
+
+    std::printf("%-20s %10s %16s %10s %16s\n", "Policy", "Map ms",
+                "Sequential MB/s", "Map ms", "Random pages/s");
+
+    for (const Policy &policy : getPolicies())
+    {
+        MemoryMappedView view;
+        uint64_t sum = 0;
+
+        double seqMapSeconds = measure([&]()
+        {
+            view = file.createView(0, FileSize, policy.Options);
+        });
+        double seqScanSeconds = measure([&]() { sum = scanSequential(view); });
+
+        // Drop the pages so that the random scan starts from scratch.
+        view.advise(MappingAdvice::DontNeed);
+        view.release();
+
+        if (expectedSum == 0)
+            expectedSum = sum;
+
+        EXPECT_EQ(sum, expectedSum);
+
+        double randomMapSeconds = measure([&]()
+        {
+            view = file.createView(0, FileSize, policy.Options);
+        });
+        double randomScanSeconds = measure([&]() { sum = scanRandom(view, pageOrder); });
+
+        view.advise(MappingAdvice::DontNeed);
+        view.release();
+
+        if (expectedRandomSum == 0)
+            expectedRandomSum = sum;
+
+        EXPECT_EQ(sum, expectedRandomSum);
+
+        std::printf("%-20s %10.1f %16.1f %10.1f %16.0f\n", policy.Name,
+                    seqMapSeconds * 1000.0,
+                    megabytes / (seqMapSeconds + seqScanSeconds),
+                    randomMapSeconds * 1000.0,
+                    pageOrder.size() / (randomMapSeconds + randomScanSeconds));
+    }
+}
+
+} // Anonymous namespace
+
+}} // namespace Ag::IO
+////////////////////////////////////////////////////////////////////////////////
@@ -11,11 +11,15 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Header File Includes
 ////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstring>
+
 #include <Ag/Core.hpp>
 
 #include "Ag/IO/Exceptions.hpp"
 #include "Ag/IO/ISeekableStream.hpp"
 #include "Ag/IO/BufferedOutputStream.hpp"
+#include "Ag/IO/MemoryStream.hpp"
 
 #include "BinaryHierarchyEncoding.hpp"
 #include "ReadOnlyDataSource.hpp"
@@ -165,6 +169,23 @@ bool BinaryStreamHeader::isValid() const
     return isValid(error);
 }
 
+//! @brief Gets the algorithm used to compress the string table and payload
+//! when either is marked as compressed.
+//! @remarks Streams written before version 4 of the format have no codec
+//! field and are always compressed using bzip2, which has the value 0.
+CompressionCodecID BinaryStreamHeader::getCodecID() const
+{
+    return static_cast<CompressionCodecID>((Flags & CodecMask) >> CodecShift);
+}
+
+//! @brief Sets the algorithm used to compress the string table and payload.
+//! @param[in] codec The identifier of the compression algorithm.
+void BinaryStreamHeader::setCodecID(CompressionCodecID codec)
+{
+    Flags = (Flags & ~CodecMask) |
+            ((static_cast<uint32_t>(codec) << CodecShift) & CodecMask);
+}
+
 //! @brief Determines if the contents of the header are valid.
 //! @param[out] error Receives details of the issue discovered if the header
 //! is invalid.
@@ -194,6 +215,16 @@ bool BinaryStreamHeader::isValid(Ag::String &error) const
     else if (CompressedPayloadSize < 0)
         error = "The compressed payload size cannot be negative.";
 
+    else if ((Flags & 4) && ((Version < 3) || ((Flags & 2) == 0)))
+        error = "The binary stream has an invalid chunked payload.";
+
+    else if (tryGetCompressionCodec(getCodecID()) == nullptr)
+        error = "The binary stream was compressed with an unknown codec.";
+
+    else if ((getCodecID() != CompressionCodecID::Bzip2) &&
+             ((Version < 4) || (((Flags & 2) != 0) && ((Flags & 4) == 0))))
+        error = "The binary stream has an invalid compression codec.";
+
     return error.isEmpty();
 }
 
@@ -337,6 +368,135 @@ bool BinaryStreamHeader::tryWrite(IStream *output)
     return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// PayloadChunkIndex Member Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Constructs an empty chunk index.
+PayloadChunkIndex::PayloadChunkIndex() :
+    ChunkSize(0)
+{
+}
+
+//! @brief Constructs an index describing the chunks a payload will be split
+//! into, with their compressed sizes initially zero.
+//! @param[in] chunkSize The count of uncompressed bytes in each chunk.
+//! @param[in] payloadSize The total count of uncompressed payload bytes.
+PayloadChunkIndex::PayloadChunkIndex(StreamLength chunkSize,
+                                     StreamLength payloadSize) :
+    ChunkSize(chunkSize)
+{
+    if (chunkSize < 1)
+        throw ArgumentException("The payload chunk size must be positive.",
+                                "chunkSize");
+
+    CompressedSizes.resize(static_cast<size_t>((payloadSize + chunkSize - 1) / chunkSize), 0);
+}
+
+//! @brief Gets the count of bytes used to encode the index in a stream.
+StreamLength PayloadChunkIndex::getEncodedSize() const
+{
+    return static_cast<StreamLength>((CompressedSizes.size() + 2) * sizeof(uint64_t));
+}
+
+//! @brief Gets the count of uncompressed bytes in a chunk.
+//! @param[in] index The 0-based index of the chunk.
+//! @param[in] payloadSize The total count of uncompressed payload bytes.
+//! @return The uncompressed size of the chunk.
+StreamLength PayloadChunkIndex::getChunkLength(size_t index,
+                                               StreamLength payloadSize) const
+{
+    StreamLength chunkOffset = static_cast<StreamLength>(index) * ChunkSize;
+
+    return std::min(ChunkSize, payloadSize - chunkOffset);
+}
+
+//! @brief Determines whether the index is consistent with the payload sizes
+//! recorded in the stream header.
+//! @param[in] payloadSize The total count of uncompressed payload bytes.
+//! @param[in] compressedPayloadSize The count of bytes of the index and the
+//! compressed chunks which follow it.
+//! @retval true The index correctly describes the payload.
+//! @retval false The index is inconsistent with the payload sizes.
+bool PayloadChunkIndex::isValid(StreamLength payloadSize,
+                                StreamLength compressedPayloadSize) const
+{
+    if ((ChunkSize < 1) ||
+        (CompressedSizes.size() != static_cast<size_t>((payloadSize + ChunkSize - 1) / ChunkSize)))
+    {
+        return false;
+    }
+
+    StreamLength totalSize = getEncodedSize();
+
+    for (StreamLength compressedSize : CompressedSizes)
+    {
+        if (compressedSize < 1)
+            return false;
+
+        totalSize += compressedSize;
+    }
+
+    return totalSize == compressedPayloadSize;
+}
+
+//! @brief Attempts to read the index from a stream.
+//! @param[in] input The stream positioned at the start of the index.
+//! @retval true The index was read.
+//! @retval false The stream ended before the index was complete or the
+//! index was malformed.
+bool PayloadChunkIndex::tryRead(IStream *input)
+{
+    auto decoder = Bin::ByteOrder::getLittleEndian();
+    uint64_t encodedFields[2];
+
+    CompressedSizes.clear();
+
+    if (input->read(encodedFields, sizeof(encodedFields)) != sizeof(encodedFields))
+        return false;
+
+    ChunkSize = static_cast<StreamLength>(decoder->toHost(encodedFields[0]));
+    uint64_t chunkCount = decoder->toHost(encodedFields[1]);
+
+    // Guard against allocating a huge index from corrupt data.
+    if ((ChunkSize < 1) || (chunkCount > (UINT32_MAX)))
+        return false;
+
+    std::vector<uint64_t> encodedSizes(static_cast<size_t>(chunkCount));
+    size_t byteCount = encodedSizes.size() * sizeof(uint64_t);
+
+    if ((byteCount > 0) &&
+        (input->read(encodedSizes.data(), byteCount) != byteCount))
+        return false;
+
+    CompressedSizes.reserve(encodedSizes.size());
+
+    for (uint64_t encodedSize : encodedSizes)
+        CompressedSizes.push_back(static_cast<StreamLength>(decoder->toHost(encodedSize)));
+
+    return true;
+}
+
+//! @brief Attempts to write the index to a stream.
+//! @param[in] output The stream to write to.
+//! @retval true The index was written.
+//! @retval false The output stream did not write the entire index.
+bool PayloadChunkIndex::tryWrite(IStream *output) const
+{
+    auto encoder = Bin::ByteOrder::getLittleEndian();
+    std::vector<uint64_t> encodedFields;
+
+    encodedFields.reserve(CompressedSizes.size() + 2);
+    encodedFields.push_back(encoder->toTarget(static_cast<uint64_t>(ChunkSize)));
+    encodedFields.push_back(encoder->toTarget(static_cast<uint64_t>(CompressedSizes.size())));
+
+    for (StreamLength compressedSize : CompressedSizes)
+        encodedFields.push_back(encoder->toTarget(static_cast<uint64_t>(compressedSize)));
+
+    size_t byteCount = encodedFields.size() * sizeof(uint64_t);
+
+    return output->write(encodedFields.data(), byteCount) == byteCount;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Global Function Definitions
 ////////////////////////////////////////////////////////////////////////////////
@@ -425,6 +585,96 @@ StreamLength readStreamSize(ReadOnlyDataSource *source,
     }
 }
 
+//! @brief Reads a string table from a stream.
+//! @param[in] stream The stream to read from, positioned at the beginning of
+//! the string table.
+//! @param[in] stringCount The count of strings to read.
+//! @returns A collection of strings in the order in which they were read in.
+StringCollection readStringTable(IStream *stream, size_t stringCount)
+{
+    auto encoding = Bin::ByteOrder::getLittleEndian();
+    StringCollection symbols;
+    std::vector<char> buffer;
+
+    symbols.reserve(stringCount);
+    buffer.reserve(64);
+
+    for (size_t i = 0; i < stringCount; ++i)
+    {
+        size_t utf8ByteCount = readSize(stream, encoding);
+
+        if (utf8ByteCount > 0)
+        {
+            Ag::ensureCapacity(buffer, utf8ByteCount);
+            buffer.resize(utf8ByteCount);
+
+            size_t bytesRead = stream->read(buffer.data(), utf8ByteCount);
+
+            if (bytesRead != utf8ByteCount)
+                throw IOException("Failed to read hierarchy string value.");
+
+            // Create a string from the bounded buffer.
+            symbols.emplace_back(buffer.data(), utf8ByteCount);
+        }
+        else
+        {
+            // The string is empty.
+            symbols.emplace_back();
+        }
+    }
+
+    return symbols;
+}
+
+//! @brief Reads a compressed string table from a stream.
+//! @param[in] stream The stream to read from, positioned at the beginning of
+//! the compressed string table.
+//! @param[in] header The header describing the size and compression of the
+//! string table.
+//! @returns A collection of strings in the order in which they were read in.
+//! @remarks A bzip2 string table is decompressed as it is read, those
+//! compressed with other codecs are stored as a single block.
+StringCollection readCompressedStringTable(IStream *stream,
+                                           const BinaryStreamHeader &header)
+{
+    const ICompressionCodec &codec = getCompressionCodec(header.getCodecID());
+
+    if (codec.getID() == CompressionCodecID::Bzip2)
+    {
+        Bz2DecompressionStream decompressor(stream);
+        decompressor.setReadLimit(header.CompressedSymbolTableSize);
+
+        return readStringTable(&decompressor, header.SymbolCount);
+    }
+
+    size_t tableSize = static_cast<size_t>(header.SymbolTableSize);
+    size_t compressedSize = static_cast<size_t>(header.CompressedSymbolTableSize);
+
+    if (compressedSize > codec.getMaxCompressedSize(tableSize))
+        throw DataFormatException("The compressed string table size is invalid.");
+
+    ByteBlock compressedTable(compressedSize);
+
+    if (stream->read(compressedTable.data(), compressedSize) != compressedSize)
+        throw IOException("Failed to read the compressed string table.");
+
+    ByteBlock table(tableSize);
+
+    try
+    {
+        codec.decompress(compressedTable.data(), compressedSize,
+                         table.data(), tableSize);
+    }
+    catch (const Exception &)
+    {
+        throw DataFormatException("The compressed string table is corrupt.");
+    }
+
+    MemoryStream tableStream(table.data(), table.size(), true);
+
+    return readStringTable(&tableStream, header.SymbolCount);
+}
+
 //! @brief Writes an anonymous size to a stream.
 //! @param[in] stream The stream to write to.
 //! @param[in] length The size value to write.
@@ -544,6 +794,7 @@ StreamLength readFieldHeader(ReadOnlyDataSource *source, const StreamRegion &reg
     case FieldType::Bytes:
     case FieldType::Object:
     case FieldType::Array:
+    case FieldType::PackedArray:
         // The header is immediately followed by the little-endian encoded
         // most-significant bytes of the object size.
         if ((supplemental + 1) <= region.getLength())
@@ -729,6 +980,165 @@ void writeByteFieldHeader(IStream *output, StreamLength size)
     writeOrdinalField(output, FieldType::Bytes, size);
 }
 
+//! @brief Gets the count of bytes used to encode each element of a packed array.
+//! @param[in] elementType The data type of the elements.
+//! @return The size of each element in bytes or 0 if @p elementType is
+//! not recognised.
+size_t getPackedElementSize(PackedElementType elementType)
+{
+    switch (elementType)
+    {
+    case PackedElementType::Int8:
+    case PackedElementType::Uint8:
+        return 1;
+
+    case PackedElementType::Int16:
+    case PackedElementType::Uint16:
+        return 2;
+
+    case PackedElementType::Int32:
+    case PackedElementType::Uint32:
+    case PackedElementType::Float:
+        return 4;
+
+    case PackedElementType::Int64:
+    case PackedElementType::Uint64:
+    case PackedElementType::Double:
+        return 8;
+
+    default:
+        return 0;
+    }
+}
+
+//! @brief Reverses the byte order of each element of a packed array in-place.
+//! @param[in,out] elements The elements to update.
+//! @param[in] elementCount The count of elements in @p elements.
+//! @param[in] elementSize The count of bytes in each element.
+void swapPackedElements(void *elements, size_t elementCount, size_t elementSize)
+{
+    uint8_t *bytes = static_cast<uint8_t *>(elements);
+
+    switch (elementSize)
+    {
+    case 2:
+        for (size_t index = 0; index < elementCount; ++index, bytes += 2)
+        {
+            uint16_t value;
+            std::memcpy(&value, bytes, sizeof(value));
+            value = Bin::byteSwap(value);
+            std::memcpy(bytes, &value, sizeof(value));
+        }
+        break;
+
+    case 4:
+        for (size_t index = 0; index < elementCount; ++index, bytes += 4)
+        {
+            uint32_t value;
+            std::memcpy(&value, bytes, sizeof(value));
+            value = Bin::byteSwap(value);
+            std::memcpy(bytes, &value, sizeof(value));
+        }
+        break;
+
+    case 8:
+        for (size_t index = 0; index < elementCount; ++index, bytes += 8)
+        {
+            uint64_t value;
+            std::memcpy(&value, bytes, sizeof(value));
+            value = Bin::byteSwap(value);
+            std::memcpy(bytes, &value, sizeof(value));
+        }
+        break;
+
+    default:
+        // Single bytes never need swapping.
+        break;
+    }
+}
+
+//! @brief Attempts to interpret the data of a packed array field.
+//! @param[in] source The data source to read from.
+//! @param[in] fieldData The region containing the field data, just after
+//! the field header.
+//! @param[out] elementType Receives the data type of the elements.
+//! @param[out] elementData Receives the region containing the encoded elements.
+//! @retval true The field data was valid.
+//! @retval false The field data could not be read or was invalid.
+bool tryReadPackedArrayInfo(ReadOnlyDataSource *source, const StreamRegion &fieldData,
+                            PackedElementType &elementType, StreamRegion &elementData)
+{
+    uint8_t typeCode;
+
+    if ((fieldData.getLength() < 1) ||
+        (source->tryReadByte(fieldData.getOffset(), typeCode) == false) ||
+        (typeCode >= toScalar(PackedElementType::Max)))
+    {
+        return false;
+    }
+
+    elementType = fromScalar<PackedElementType>(typeCode);
+    elementData = fieldData.slice(1);
+
+    // The data must be a whole number of elements.
+    size_t elementSize = getPackedElementSize(elementType);
+
+    return (elementData.getLength() % static_cast<StreamLength>(elementSize)) == 0;
+}
+
+//! @brief Writes a packed array field in a single block, converting elements
+//! to little-endian byte order if necessary.
+//! @param[in] output The stream to write the field to.
+//! @param[in] elementType The data type of the elements.
+//! @param[in] elements A pointer to the first element in host byte order.
+//! @param[in] elementCount The count of elements to write.
+void writePackedArrayField(IStream *output, PackedElementType elementType,
+                           const void *elements, size_t elementCount)
+{
+    size_t elementSize = getPackedElementSize(elementType);
+
+    if (elementSize == 0)
+        throw ArgumentException("The packed array element type is invalid.",
+                                "elementType");
+
+    size_t byteCount = elementSize * elementCount;
+    uint8_t typeCode = toScalar(elementType);
+
+    writeOrdinalField(output, FieldType::PackedArray,
+                      static_cast<StreamLength>(byteCount + 1));
+
+    if (output->write(&typeCode, 1) != 1)
+        throw IOException("Failed to encode packed array field.");
+
+    if ((elementSize > 1) && Bin::ByteOrder::getLittleEndian()->requiresSwap())
+    {
+        // Convert the elements in batches through a local buffer.
+        uint8_t buffer[4096];
+        const uint8_t *source = static_cast<const uint8_t *>(elements);
+        size_t batchSize = sizeof(buffer) / elementSize;
+
+        while (elementCount > 0)
+        {
+            size_t batchCount = std::min(batchSize, elementCount);
+            size_t batchBytes = batchCount * elementSize;
+
+            std::memcpy(buffer, source, batchBytes);
+            swapPackedElements(buffer, batchCount, elementSize);
+
+            if (output->write(buffer, batchBytes) != batchBytes)
+                throw IOException("Failed to encode packed array field.");
+
+            source += batchBytes;
+            elementCount -= batchCount;
+        }
+    }
+    else if ((byteCount > 0) &&
+             (output->write(elements, byteCount) != byteCount))
+    {
+        throw IOException("Failed to encode packed array field.");
+    }
+}
+
 }} // namespace Ag::IO
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -16,6 +16,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 #include "Ag/IO/Exceptions.hpp"
 #include "Ag/IO/ISeekableStream.hpp"
+#include "HierarchyInterfaces.hpp"
 #include "ReadOnlyDataSource.hpp"
 
 namespace Ag {
@@ -82,6 +83,17 @@ enum class FieldType : uint8_t
     //! The first value in the array is always an anonymously encoded
     //! size value giving the, up to 64-bit, count of elements in the array.
     Array,
+
+    //! @brief Indicates that a packed array of fixed-size primitive values
+    //! follows.
+    //! @remarks The value is combined with a count of bytes which give the
+    //! little-endian-encoded significant bits of the count of bytes in
+    //! the block of array data which follows.
+    //!
+    //! The first byte of the array data is a PackedElementType value, the
+    //! remainder are the elements, each encoded little-endian. The field type
+    //! was introduced in version 2 of the format.
+    PackedArray,
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -93,7 +105,9 @@ struct BinaryStreamHeader
     // Public Fields
     static constexpr uint32_t ExpectedSignature = 0x72694842;
     static constexpr uint32_t MinFormatVersion = 1;
-    static constexpr uint32_t CurrentFormatVersion = 1;
+    static constexpr uint32_t CurrentFormatVersion = 4;
+    static constexpr uint32_t CodecShift = 8;
+    static constexpr uint32_t CodecMask = 0xFF << CodecShift;
 
     uint32_t Signature;
     uint32_t Version;
@@ -108,6 +122,10 @@ struct BinaryStreamHeader
     BinaryStreamHeader();
     ~BinaryStreamHeader() = default;
 
+    // Accessors
+    CompressionCodecID getCodecID() const;
+    void setCodecID(CompressionCodecID codec);
+
     // Operations
     bool isValid() const;
     bool isValid(Ag::String &error) const;
@@ -116,6 +134,32 @@ struct BinaryStreamHeader
     bool tryWrite(IStream *output);
 };
 
+//! @brief The index of the independently compressed chunks of a payload,
+//! which directly precedes the chunks when bit 2 of the header flags is set.
+//! @remarks Each chunk is a separate bzip2 stream which decompresses to
+//! ChunkSize bytes, apart from the last, which holds the remainder of the
+//! payload. Chunked payloads were introduced in version 3 of the format.
+struct PayloadChunkIndex
+{
+    // Public Fields
+    StreamLength ChunkSize;
+    std::vector<StreamLength> CompressedSizes;
+
+    // Construction/Destruction
+    PayloadChunkIndex();
+    PayloadChunkIndex(StreamLength chunkSize, StreamLength payloadSize);
+    ~PayloadChunkIndex() = default;
+
+    // Accessors
+    StreamLength getEncodedSize() const;
+    StreamLength getChunkLength(size_t index, StreamLength payloadSize) const;
+    bool isValid(StreamLength payloadSize, StreamLength compressedPayloadSize) const;
+
+    // Operations
+    bool tryRead(IStream *input);
+    bool tryWrite(IStream *output) const;
+};
+
 class ReadOnlyDataSource;
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -126,6 +170,9 @@ StreamLength readStreamSize(IStream *stream, const Bin::ByteOrder *encoding);
 StreamLength readStreamSize(ReadOnlyDataSource *source, const StreamRegion &region,
                             int &bytesUsed);
 StreamLength writeStreamSize(IStream *stream, StreamLength length);
+StringCollection readStringTable(IStream *stream, size_t stringCount);
+StringCollection readCompressedStringTable(IStream *stream,
+                                           const BinaryStreamHeader &header);
 
 uint8_t makeFieldHeader(FieldType fieldType, uint8_t supplemental);
 StreamLength readFieldHeader(ReadOnlyDataSource *source, const StreamRegion &region,
@@ -144,6 +191,13 @@ void writeObjectHeader(IStream *output, StreamLength dataSize);
 void writeStringField(IStream *output, uint32_t stringID);
 void writeByteFieldHeader(IStream *output, StreamLength size);
 
+size_t getPackedElementSize(PackedElementType elementType);
+void swapPackedElements(void *elements, size_t elementCount, size_t elementSize);
+bool tryReadPackedArrayInfo(ReadOnlyDataSource *source, const StreamRegion &fieldData,
+                            PackedElementType &elementType, StreamRegion &elementData);
+void writePackedArrayField(IStream *output, PackedElementType elementType,
+                           const void *elements, size_t elementCount);
+
 ////////////////////////////////////////////////////////////////////////////////
 // Templates
 ////////////////////////////////////////////////////////////////////////////////
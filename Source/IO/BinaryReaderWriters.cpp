@@ -11,13 +11,27 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Header File Includes
 ////////////////////////////////////////////////////////////////////////////////
+#include <future>
+
+#include "Ag/Core/Instrumentation.hpp"
+#include "Ag/Core/WorkerPool.hpp"
+
 #include "BinaryReaderWriters.hpp"
 #include "Ag/IO/Exceptions.hpp"
+#include "Ag/IO/HierarchySerialization.hpp"
+#include "Ag/IO/MemoryStream.hpp"
 
 namespace Ag {
 namespace IO {
 
 namespace {
+////////////////////////////////////////////////////////////////////////////////
+// Local Data
+////////////////////////////////////////////////////////////////////////////////
+//! @brief The count of compressed payload buffers which can be queued to be
+//! written to an unbuffered output stream in the background.
+constexpr size_t WriteBehindCount = 2;
+
 ////////////////////////////////////////////////////////////////////////////////
 // Local Data Types
 ////////////////////////////////////////////////////////////////////////////////
@@ -77,6 +91,165 @@ public:
     }
 };
 
+//! @brief A stream which compressed payload data is written through.
+//! @details If the output is an unbuffered device, writes to it happen in
+//! the background so that compression isn't held up by them. Otherwise
+//! writes are passed straight through.
+class PayloadOutputStream : public BufferedOutputStream
+{
+public:
+    //! @brief Constructs a stream which writes to the output of a hierarchy.
+    //! @param[in] output The stream to write the payload to.
+    PayloadOutputStream(IStream *output) :
+        BufferedOutputStream(output,
+                             output->isBuffered() ? 0 : BufferedOutputStream::MaxBufferSize,
+                             output->isBuffered() ? 0 : WriteBehindCount)
+    {
+    }
+};
+
+//! @brief An IStream implementation which divides the bytes written to it into
+//! fixed size chunks, compresses each independently on a pool of worker
+//! threads and writes the compressed chunks in order to an output stream.
+class ChunkCompressor : public IStream
+{
+private:
+    WorkerPool _workers;
+    const ICompressionCodec &_codec;
+    std::deque<std::future<ByteBlock>> _pendingChunks;
+    IStream *_output;
+    PayloadChunkIndex &_index;
+    std::vector<uint8_t> _currentChunk;
+    size_t _chunkSize;
+    size_t _maxPendingChunks;
+    size_t _chunksWritten;
+
+    //! @brief Passes the accumulated chunk to a worker thread to compress.
+    void submitCurrentChunk()
+    {
+        if (_currentChunk.empty())
+            return;
+
+        // Limit the memory held by chunks waiting to be written.
+        while (_pendingChunks.size() >= _maxPendingChunks)
+        {
+            writeNextChunk();
+        }
+
+        _pendingChunks.push_back(_workers.submit(
+            [&codec = _codec, chunk = std::move(_currentChunk)]()
+            {
+                ByteBlock compressedData;
+                codec.compress(chunk.data(), chunk.size(), compressedData);
+
+                return compressedData;
+            }));
+
+        _currentChunk = std::vector<uint8_t>();
+        _currentChunk.reserve(_chunkSize);
+    }
+
+    //! @brief Waits for the oldest pending chunk to be compressed and writes
+    //! it to the output stream.
+    void writeNextChunk()
+    {
+        ByteBlock compressedChunk = _pendingChunks.front().get();
+        _pendingChunks.pop_front();
+
+        if (_chunksWritten >= _index.CompressedSizes.size())
+            throw IOException("Too many payload chunks were produced.");
+
+        if (_output->write(compressedChunk.data(),
+                           compressedChunk.size()) != compressedChunk.size())
+        {
+            throw IOException("Failed to write a compressed payload chunk.");
+        }
+
+        _index.CompressedSizes[_chunksWritten++] = compressedChunk.size();
+    }
+public:
+    //! @brief Constructs a stream which compresses data in chunks.
+    //! @param[in] output The stream to write compressed chunks to.
+    //! @param[in] index The index which defines the chunk size and receives
+    //! the compressed size of each chunk.
+    //! @param[in] codec The algorithm used to compress each chunk.
+    //! @param[in] threadCount The count of threads to compress chunks on,
+    //! 0 to use one per hardware thread.
+    ChunkCompressor(IStream *output, PayloadChunkIndex &index,
+                    const ICompressionCodec &codec, size_t threadCount) :
+        _workers(threadCount),
+        _codec(codec),
+        _output(output),
+        _index(index),
+        _chunkSize(static_cast<size_t>(index.ChunkSize)),
+        _maxPendingChunks(_workers.getThreadCount() * 2),
+        _chunksWritten(0)
+    {
+        _currentChunk.reserve(_chunkSize);
+    }
+
+    //! @brief Ensures any outstanding compression tasks complete before the
+    //! worker threads are disposed of.
+    virtual ~ChunkCompressor() override
+    {
+        for (std::future<ByteBlock> &pendingChunk : _pendingChunks)
+        {
+            if (pendingChunk.valid())
+                pendingChunk.wait();
+        }
+    }
+
+    //! @brief Compresses the final partial chunk and writes out all remaining
+    //! chunks in order.
+    void finish()
+    {
+        submitCurrentChunk();
+
+        while (_pendingChunks.empty() == false)
+        {
+            writeNextChunk();
+        }
+
+        if (_chunksWritten != _index.CompressedSizes.size())
+            throw IOException("Too few payload chunks were produced.");
+    }
+
+    // Overrides
+
+    // Inherited from IStream.
+    virtual bool isBuffered() const override { return true; }
+
+    // Inherited from IStream.
+    virtual void flush() override { }
+
+    // Inherited from IStream.
+    virtual size_t read(void */*targetBuffer*/, size_t /*requiredByteCount*/) override
+    {
+        throw NotSupportedException("Reading for a chunk compression stream.");
+    }
+
+    // Inherited from IStream.
+    virtual size_t write(const void *sourceBuffer, size_t sourceByteCount) override
+    {
+        const uint8_t *source = static_cast<const uint8_t *>(sourceBuffer);
+        size_t remaining = sourceByteCount;
+
+        while (remaining > 0)
+        {
+            size_t toCopy = std::min(remaining, _chunkSize - _currentChunk.size());
+
+            _currentChunk.insert(_currentChunk.end(), source, source + toCopy);
+            source += toCopy;
+            remaining -= toCopy;
+
+            if (_currentChunk.size() == _chunkSize)
+                submitCurrentChunk();
+        }
+
+        return sourceByteCount;
+    }
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 // Local Data
 ////////////////////////////////////////////////////////////////////////////////
@@ -94,15 +267,14 @@ constexpr StreamLength MaxBlockSize = 4 * 1024 * 1024;
 //! @param[in] input The input stream positioned just after the header.
 BinaryHierarchyRoot::BinaryHierarchyRoot(const BinaryStreamHeader &header,
                                          IStream *input) :
-    _rootFieldType(FieldType::TinyInt)
+    _rootFieldType(FieldType::TinyInt),
+    _keyScope(PropertyKey::allocateScope())
 {
     if (header.Flags & 1)
     {
         // The string table is compressed, so read it through a stream which
         // will decompress the data.
-        Bz2DecompressionStream decompressor(input);
-
-        _symbols = readStringTable(&decompressor, header.SymbolCount);
+        _symbols = readCompressedStringTable(input, header);
     }
     else
     {
@@ -111,19 +283,21 @@ BinaryHierarchyRoot::BinaryHierarchyRoot(const BinaryStreamHeader &header,
     }
 
     // Index the symbols to allow object properties to be indexed by ID.
-    uint32_t id = 0;
-
-    for (string_cref_t symbol : _symbols)
-        _symbolIDsByText[symbol] = id++;
+    indexSymbols();
 
     // Copy the payload data to a static source (either in memory or to a
     // memory mapped file).
-    ReadOnlyDataSourceUPtr sourceData;
-
-    if (header.Flags & 2)
+    if (header.Flags & 4)
+    {
+        // The payload is compressed in chunks which can be decompressed
+        // independently as they are needed.
+        _source = readChunkedPayload(header, input);
+    }
+    else if (header.Flags & 2)
     {
         // The payload is compressed.
         Bz2DecompressionStream decompressor(input);
+        decompressor.setReadLimit(header.CompressedPayloadSize);
 
         // Decompress the payload into the static source.
         _source = ReadOnlyDataSource::create(&decompressor, header.PayloadSize);
@@ -134,17 +308,107 @@ BinaryHierarchyRoot::BinaryHierarchyRoot(const BinaryStreamHeader &header,
         _source = ReadOnlyDataSource::create(input, header.PayloadSize);
     }
 
-    // Analyse the root element.
-    StreamLength result = readFieldHeader(_source.get(), _source->getRootRegion(),
-                                          _rootFieldType, _rootFieldData);
+    readRootField();
+}
 
-    if (result < 0)
+//! @brief Constructs an object used to read a binary serialized hierarchy
+//! stored in a file.
+//! @param[in] header The header initially read from the file.
+//! @param[in] fileName The path to the file containing the hierarchy.
+//! @param[in] input A stream reading the file, positioned just after the
+//! header.
+//! @remarks Uncompressed sections of the file are mapped into memory rather
+//! than copied, so that the cost of opening a hierarchy with an uncompressed
+//! payload does not depend upon the size of the payload. Compressed sections
+//! are located using the sizes recorded in the header.
+BinaryHierarchyRoot::BinaryHierarchyRoot(const BinaryStreamHeader &header,
+                                         const Fs::Path &fileName,
+                                         ISeekableStream *input) :
+    _rootFieldType(FieldType::TinyInt),
+    _keyScope(PropertyKey::allocateScope())
+{
+    StreamPosition tableOffset = input->getPosition();
+    StreamPosition payloadOffset = tableOffset;
+
+    if (header.Flags & 1)
     {
-        // Dispose of the data before throwing the exception.
-        _source.reset();
+        // The string table is compressed, so must be read into memory.
+        _symbols = readCompressedStringTable(input, header);
+        payloadOffset += header.CompressedSymbolTableSize;
+    }
+    else
+    {
+        // Map the remainder of the file and index the strings in place.
+        StreamRegion remainder(tableOffset, input->getLength() - tableOffset);
 
-        throw DataFormatException("Unable to read root field of serialized hierarchy.");
+        _symbolSource = ReadOnlyDataSource::createMapped(fileName, remainder);
+        payloadOffset += indexStringTable(_symbolSource.get(), header.SymbolCount,
+                                          _symbolViews);
+    }
+
+    indexSymbols();
+
+    if (header.Flags & 4)
+    {
+        // The string table may have been mapped rather than read, so seek
+        // to the start of the chunk index.
+        input->setPosition(StreamRelative::Beginning, payloadOffset);
+
+        _source = readChunkedPayload(header, input);
+    }
+    else if (header.Flags & 2)
+    {
+        // The string table may have been mapped rather than read, so seek
+        // to the start of the compressed payload.
+        input->setPosition(StreamRelative::Beginning, payloadOffset);
+
+        Bz2DecompressionStream decompressor(input);
+        decompressor.setReadLimit(header.CompressedPayloadSize);
+
+        _source = ReadOnlyDataSource::create(&decompressor, header.PayloadSize);
+    }
+    else
+    {
+        _source = ReadOnlyDataSource::createMapped(fileName,
+                                                   StreamRegion(payloadOffset,
+                                                                header.PayloadSize));
+    }
+
+    readRootField();
+}
+
+//! @brief Reads the index and compressed chunks of a chunked payload.
+//! @param[in] header The header of the hierarchy stream.
+//! @param[in] input The stream positioned at the start of the chunk index.
+//! @return A data source which decompresses the chunks on demand.
+//! @throws DataFormatException Thrown if the chunk index is invalid.
+//! @throws IOException Thrown if the stream ends prematurely.
+ReadOnlyDataSourceUPtr BinaryHierarchyRoot::readChunkedPayload(const BinaryStreamHeader &header,
+                                                               IStream *input)
+{
+    PayloadChunkIndex index;
+
+    if (index.tryRead(input) == false)
+        throw IOException("Failed to read the payload chunk index.");
+
+    if (index.isValid(header.PayloadSize, header.CompressedPayloadSize) == false)
+        throw DataFormatException("The payload chunk index is invalid.");
+
+    // Only the compressed data is held in memory until each chunk is needed.
+    std::vector<ByteBlock> compressedChunks;
+    compressedChunks.reserve(index.CompressedSizes.size());
+
+    for (StreamLength compressedSize : index.CompressedSizes)
+    {
+        ByteBlock &chunk = compressedChunks.emplace_back(static_cast<size_t>(compressedSize));
+
+        if (input->read(chunk.data(), chunk.size()) != chunk.size())
+            throw IOException("Failed to read a compressed payload chunk.");
     }
+
+    return ReadOnlyDataSource::createChunked(header.PayloadSize, index.ChunkSize,
+                                             getCompressionCodec(header.getCodecID()),
+                                             std::move(compressedChunks));
 }
 
 //! @brief Gets the object containing the raw serialized hierarchy data.
@@ -166,11 +430,37 @@ bool BinaryHierarchyRoot::tryGetString(uint32_t id, Ag::String &text) const
 
         return true;
     }
+    else if (id < _symbolViews.size())
+    {
+        // The string table was mapped rather than materialised.
+        text = String(_symbolViews[id]);
+
+        return true;
+    }
 
     text = String::Empty;
     return false;
 }
 
+//! @brief Attempts to look up a string from an ID without copying it.
+//! @param[in] id The ID of the string referenced in the hierarchy.
+//! @param[out] text Receives a view of the UTF-8 bytes of the string
+//! associated with the ID, valid for the lifetime of the object, on success.
+//! @retval true The string exists and was returned.
+//! @retval false @p id did not represent a string store in the hierarchy.
+bool BinaryHierarchyRoot::tryGetStringView(uint32_t id, std::string_view &text) const
+{
+    if (id < _symbolViews.size())
+    {
+        text = _symbolViews[id];
+
+        return true;
+    }
+
+    text = std::string_view();
+    return false;
+}
+
 //! @brief Attempts to lookup the numeric identifier of a string.
 //! @param[in] text The test to look up.
 //! @param[out] id Receives the identifier if the text was used in the hierarchy.
@@ -179,7 +469,29 @@ bool BinaryHierarchyRoot::tryGetString(uint32_t id, Ag::String &text) const
 //! @retval false @p text was not used in the hierarchy.
 bool BinaryHierarchyRoot::tryGetStringID(const Ag::String &text, uint32_t &id) const
 {
-    return tryFindMappedValue(_symbolIDsByText, text, id);
+    return tryFindMappedValue(_symbolIDsByText, text.toUtf8View(), id);
+}
+
+//! @brief Attempts to lookup the numeric identifier of a property tag, only
+//! looking up the tag text the first time the key is used with the hierarchy.
+//! @param[in] key The key identifying the tag to look up.
+//! @param[out] id Receives the identifier if the tag was used in the hierarchy.
+//! @retval true The tag was used in the hierarchy and its numeric identifier
+//! was returned in @p id.
+//! @retval false The tag was not used in the hierarchy.
+bool BinaryHierarchyRoot::tryGetStringID(const PropertyKey &key, uint32_t &id) const
+{
+    if (key.tryGetBinding(_keyScope, id) == false)
+    {
+        if (tryGetStringID(key.getTag(), id) == false)
+        {
+            id = PropertyKey::NotFoundID;
+        }
+
+        key.bind(_keyScope, id);
+    }
+
+    return (id != PropertyKey::NotFoundID);
 }
 
 //! @brief Attempts to interpret a field as a boolean value.
@@ -294,6 +606,7 @@ bool BinaryHierarchyRoot::tryReadCharValue(FieldType fieldType,
     case FieldType::Bytes:
     case FieldType::Object:
     case FieldType::Array:
+    case FieldType::PackedArray:
     default:
         hasValue = false;
         break;
@@ -340,45 +653,95 @@ IArrayReader *BinaryHierarchyRoot::getRootArray()
     throw OperationException("The root of the serialized hierarchy was not an array.");
 }
 
-//! @brief Reads a string table from a stream.
-//! @param[in] stream The stream to read from, positioned at the beginning of
-//! the string table.
-//! @param[in] stringCount The count of strings to read.
-//! @returns A collection of strings in the order in which they were read in.
-StringCollection BinaryHierarchyRoot::readStringTable(IStream *stream, size_t stringCount)
+//! @brief Indexes a string table held in a data source without copying the
+//! strings it contains.
+//! @param[in] source The data source, beginning with the string table, which
+//! must allow its data to be accessed in place.
+//! @param[in] stringCount The count of strings to index.
+//! @param[out] symbols Receives views of the strings in the order in which
+//! they were encoded.
+//! @return The count of bytes used to encode the string table.
+//! @throws DataFormatException Thrown if the string table is truncated.
+StreamLength BinaryHierarchyRoot::indexStringTable(ReadOnlyDataSource *source,
+                                                   size_t stringCount,
+                                                   SymbolViewCollection &symbols)
 {
-    auto encoding = Bin::ByteOrder::getLittleEndian();
-    StringCollection symbols;
-    std::vector<char> buffer;
+    StreamRegion remaining = source->getRootRegion();
 
+    symbols.clear();
     symbols.reserve(stringCount);
-    buffer.reserve(64);
 
     for (size_t i = 0; i < stringCount; ++i)
     {
-        size_t utf8ByteCount = readSize(stream, encoding);
+        int bytesUsed = 0;
+        StreamLength utf8ByteCount = readStreamSize(source, remaining, bytesUsed);
 
-        if (utf8ByteCount > 0)
+        if ((utf8ByteCount < 0) ||
+            (utf8ByteCount > (remaining.getLength() - bytesUsed)))
         {
-            Ag::ensureCapacity(buffer, utf8ByteCount);
-            buffer.resize(utf8ByteCount);
-
-            size_t bytesRead = stream->read(buffer.data(), utf8ByteCount);
+            throw DataFormatException("Hierarchy string value extends beyond the end of the data.");
+        }
 
-            if (bytesRead != utf8ByteCount)
-                throw IOException("Failed to read hierarchy string value.");
+        StreamRegion utf8Data = remaining.slice(bytesUsed, utf8ByteCount);
+        const uint8_t *utf8Bytes = nullptr;
 
-            // Create a string from the bounded buffer.
-            symbols.emplace_back(buffer.data(), utf8ByteCount);
+        if (utf8ByteCount == 0)
+        {
+            symbols.emplace_back();
+        }
+        else if (source->tryGetView(utf8Data, utf8Bytes))
+        {
+            symbols.emplace_back(reinterpret_cast<const char *>(utf8Bytes),
+                                 static_cast<size_t>(utf8ByteCount));
         }
         else
         {
-            // The string is empty.
-            symbols.emplace_back();
+            throw OperationException("The hierarchy string table cannot be accessed in place.");
         }
+
+        remaining = remaining.slice(bytesUsed + utf8ByteCount);
+    }
+
+    return remaining.getOffset() - source->getRootRegion().getOffset();
+}
+
+//! @brief Creates an index of symbol text to symbol ID, first creating views
+//! of any materialised symbols.
+void BinaryHierarchyRoot::indexSymbols()
+{
+    if (_symbols.empty() == false)
+    {
+        // String objects are immutable, so their UTF-8 bytes can be viewed
+        // for the lifetime of the collection.
+        _symbolViews.clear();
+        _symbolViews.reserve(_symbols.size());
+
+        for (string_cref_t symbol : _symbols)
+            _symbolViews.push_back(symbol.toUtf8View());
     }
 
-    return symbols;
+    _symbolIDsByText.reserve(_symbolViews.size());
+    uint32_t id = 0;
+
+    for (const std::string_view &symbol : _symbolViews)
+        _symbolIDsByText[symbol] = id++;
+}
+
+//! @brief Analyses the root field of the payload.
+//! @throws DataFormatException Thrown if the root field cannot be decoded.
+void BinaryHierarchyRoot::readRootField()
+{
+    StreamLength result = readFieldHeader(_source.get(), _source->getRootRegion(),
+                                          _rootFieldType, _rootFieldData);
+
+    if (result < 0)
+    {
+        // Dispose of the data before throwing the exception.
+        _source.reset();
+        _symbolSource.reset();
+
+        throw DataFormatException("Unable to read root field of serialized hierarchy.");
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -424,6 +787,30 @@ bool BinaryArrayReader::tryGetNextElementSize(StreamLength &elementSize) const
     return false;
 }
 
+// Inherited from IArrayReader.
+bool BinaryArrayReader::tryGetNextPackedArrayInfo(PackedElementType &elementType,
+                                                  size_t &elementCount) const
+{
+    StreamRegion fieldData;
+    StreamRegion elementData;
+    FieldType fieldType;
+
+    if (tryGetNextField(fieldType, fieldData) &&
+        (fieldType == FieldType::PackedArray) &&
+        tryReadPackedArrayInfo(_root->getDataSource(), fieldData,
+                               elementType, elementData))
+    {
+        elementCount = static_cast<size_t>(elementData.getLength()) /
+                       getPackedElementSize(elementType);
+
+        return true;
+    }
+
+    elementType = PackedElementType::Max;
+    elementCount = 0;
+    return false;
+}
+
 // Inherited from IArrayReader.
 StreamLength BinaryArrayReader::getElementCount() const
 {
@@ -739,6 +1126,27 @@ bool BinaryArrayReader::tryReadNext(String &value)
     return false;
 }
 
+// Inherited from IArrayReader.
+bool BinaryArrayReader::tryReadNext(std::string_view &value)
+{
+    StreamRegion fieldData;
+    uint32_t stringID;
+    FieldType fieldType;
+
+    if (tryGetNextField(fieldType, fieldData) &&
+        (fieldType == FieldType::StringID) &&
+        tryReadEncodedStringID(_root->getDataSource(), fieldData, stringID) &&
+        _root->tryGetStringView(stringID, value))
+    {
+        commitField(fieldData);
+
+        return true;
+    }
+
+    value = std::string_view();
+    return false;
+}
+
 // Inherited from IArrayReader.
 bool BinaryArrayReader::tryReadNext(ByteBlock &value)
 {
@@ -769,6 +1177,29 @@ bool BinaryArrayReader::tryReadNext(ByteBlock &value)
     return false;
 }
 
+// Inherited from IArrayReader.
+bool BinaryArrayReader::tryReadNext(ByteSpan &value)
+{
+    StreamRegion fieldData;
+    FieldType fieldType;
+    const uint8_t *data = nullptr;
+
+    if (tryGetNextField(fieldType, fieldData) &&
+        (fieldType == FieldType::Bytes) &&
+        _root->getDataSource()->tryGetView(fieldData, data))
+    {
+        value = ByteSpan(data, static_cast<size_t>(fieldData.getLength()));
+
+        // Move past the field once successfully accessed.
+        commitField(fieldData);
+
+        return true;
+    }
+
+    value = ByteSpan();
+    return false;
+}
+
 // Inherited from IArrayReader.
 bool BinaryArrayReader::tryReadNext(ISeekableStreamUPtr &value)
 {
@@ -832,6 +1263,37 @@ bool BinaryArrayReader::tryReadNext(IArrayReader *&value)
     return false;
 }
 
+// Inherited from IArrayReader.
+bool BinaryArrayReader::tryReadNextPackedArray(PackedElementType elementType,
+                                               void *elements, size_t elementCount)
+{
+    StreamRegion fieldData;
+    StreamRegion elementData;
+    FieldType fieldType;
+    PackedElementType encodedType;
+    auto dataSource = _root->getDataSource();
+
+    if (tryGetNextField(fieldType, fieldData) &&
+        (fieldType == FieldType::PackedArray) &&
+        tryReadPackedArrayInfo(dataSource, fieldData, encodedType, elementData) &&
+        (encodedType == elementType))
+    {
+        size_t elementSize = getPackedElementSize(elementType);
+
+        if ((static_cast<size_t>(elementData.getLength()) == elementCount * elementSize) &&
+            ((elementCount == 0) || dataSource->tryRead(elementData, elements)))
+        {
+            if (Bin::ByteOrder::getLittleEndian()->requiresSwap())
+                swapPackedElements(elements, elementCount, elementSize);
+
+            commitField(fieldData);
+            return true;
+        }
+    }
+
+    return false;
+}
+
 //! @brief Attempts to get the field type and data location of the next
 //! element of the array to be read.
 //! @param[out] fieldType Receives the data type of the next field.
@@ -916,7 +1378,7 @@ BinaryObjectReader::BinaryObjectReader(const BinaryHierarchyRootSPtr &root,
 }
 
 // Inherited from IObjectReader.
-bool BinaryObjectReader::hasProperty(string_cref_t tag) const
+bool BinaryObjectReader::hasProperty(const PropertyKey &tag) const
 {
     uint32_t tagID;
     return _root->tryGetStringID(tag, tagID) &&
@@ -924,7 +1386,7 @@ bool BinaryObjectReader::hasProperty(string_cref_t tag) const
 }
 
 // Inherited from IObjectReader.
-bool BinaryObjectReader::tryGetPropertySize(string_cref_t tag,
+bool BinaryObjectReader::tryGetPropertySize(const PropertyKey &tag,
                                             StreamLength &propSize) const
 {
     StreamRegion fieldData;
@@ -942,7 +1404,7 @@ bool BinaryObjectReader::tryGetPropertySize(string_cref_t tag,
 }
 
 // Inherited from IObjectReader.
-bool BinaryObjectReader::tryRead(string_cref_t tag, bool &value) const
+bool BinaryObjectReader::tryRead(const PropertyKey &tag, bool &value) const
 {
     StreamRegion fieldData;
     FieldType fieldType;
@@ -953,7 +1415,7 @@ bool BinaryObjectReader::tryRead(string_cref_t tag, bool &value) const
 }
 
 // Inherited from IObjectReader.
-bool BinaryObjectReader::tryRead(string_cref_t tag, int8_t &value) const
+bool BinaryObjectReader::tryRead(const PropertyKey &tag, int8_t &value) const
 {
     StreamRegion fieldValue;
     FieldType fieldType;
@@ -963,7 +1425,7 @@ bool BinaryObjectReader::tryRead(string_cref_t tag, int8_t &value) const
 }
 
 // Inherited from IObjectReader.
-bool BinaryObjectReader::tryRead(string_cref_t tag, uint8_t &value) const
+bool BinaryObjectReader::tryRead(const PropertyKey &tag, uint8_t &value) const
 {
     StreamRegion fieldValue;
     FieldType fieldType;
@@ -973,7 +1435,7 @@ bool BinaryObjectReader::tryRead(string_cref_t tag, uint8_t &value) const
 }
 
 // Inherited from IObjectReader.
-bool BinaryObjectReader::tryRead(string_cref_t tag, int16_t &value) const
+bool BinaryObjectReader::tryRead(const PropertyKey &tag, int16_t &value) const
 {
     StreamRegion fieldValue;
     FieldType fieldType;
@@ -983,7 +1445,7 @@ bool BinaryObjectReader::tryRead(string_cref_t tag, int16_t &value) const
 }
 
 // Inherited from IObjectReader.
-bool BinaryObjectReader::tryRead(string_cref_t tag, uint16_t &value) const
+bool BinaryObjectReader::tryRead(const PropertyKey &tag, uint16_t &value) const
 {
     StreamRegion fieldValue;
     FieldType fieldType;
@@ -993,7 +1455,7 @@ bool BinaryObjectReader::tryRead(string_cref_t tag, uint16_t &value) const
 }
 
 // Inherited from IObjectReader.
-bool BinaryObjectReader::tryRead(string_cref_t tag, int32_t &value) const
+bool BinaryObjectReader::tryRead(const PropertyKey &tag, int32_t &value) const
 {
     StreamRegion fieldValue;
     FieldType fieldType;
@@ -1003,7 +1465,7 @@ bool BinaryObjectReader::tryRead(string_cref_t tag, int32_t &value) const
 }
 
 // Inherited from IObjectReader.
-bool BinaryObjectReader::tryRead(string_cref_t tag, uint32_t &value) const
+bool BinaryObjectReader::tryRead(const PropertyKey &tag, uint32_t &value) const
 {
     StreamRegion fieldValue;
     FieldType fieldType;
@@ -1013,7 +1475,7 @@ bool BinaryObjectReader::tryRead(string_cref_t tag, uint32_t &value) const
 }
 
 // Inherited from IObjectReader.
-bool BinaryObjectReader::tryRead(string_cref_t tag, int64_t &value) const
+bool BinaryObjectReader::tryRead(const PropertyKey &tag, int64_t &value) const
 {
     StreamRegion fieldValue;
     FieldType fieldType;
@@ -1023,7 +1485,7 @@ bool BinaryObjectReader::tryRead(string_cref_t tag, int64_t &value) const
 }
 
 // Inherited from IObjectReader.
-bool BinaryObjectReader::tryRead(string_cref_t tag, uint64_t &value) const
+bool BinaryObjectReader::tryRead(const PropertyKey &tag, uint64_t &value) const
 {
     StreamRegion fieldValue;
     FieldType fieldType;
@@ -1033,7 +1495,7 @@ bool BinaryObjectReader::tryRead(string_cref_t tag, uint64_t &value) const
 }
 
 // Inherited from IObjectReader.
-bool BinaryObjectReader::tryRead(string_cref_t tag, char32_t &value) const
+bool BinaryObjectReader::tryRead(const PropertyKey &tag, char32_t &value) const
 {
     StreamRegion fieldValue;
     FieldType fieldType;
@@ -1043,7 +1505,7 @@ bool BinaryObjectReader::tryRead(string_cref_t tag, char32_t &value) const
 }
 
 // Inherited from IObjectReader.
-bool BinaryObjectReader::tryRead(string_cref_t tag, float &value) const
+bool BinaryObjectReader::tryRead(const PropertyKey &tag, float &value) const
 {
     StreamRegion fieldValue;
     FieldType fieldType;
@@ -1053,7 +1515,7 @@ bool BinaryObjectReader::tryRead(string_cref_t tag, float &value) const
 }
 
 // Inherited from IObjectReader.
-bool BinaryObjectReader::tryRead(string_cref_t tag, double &value) const
+bool BinaryObjectReader::tryRead(const PropertyKey &tag, double &value) const
 {
     StreamRegion fieldValue;
     FieldType fieldType;
@@ -1063,7 +1525,7 @@ bool BinaryObjectReader::tryRead(string_cref_t tag, double &value) const
 }
 
 // Inherited from IObjectReader.
-bool BinaryObjectReader::tryRead(string_cref_t tag, String &value) const
+bool BinaryObjectReader::tryRead(const PropertyKey &tag, String &value) const
 {
     StreamRegion fieldValue;
     uint32_t id;
@@ -1080,7 +1542,26 @@ bool BinaryObjectReader::tryRead(string_cref_t tag, String &value) const
 }
 
 // Inherited from IObjectReader.
-bool BinaryObjectReader::tryRead(string_cref_t tag, ByteBlock &value) const
+bool BinaryObjectReader::tryRead(const PropertyKey &tag, std::string_view &value) const
+{
+    StreamRegion fieldValue;
+    uint32_t id;
+    FieldType fieldType;
+
+    if (tryGetFieldValue(tag, fieldType, fieldValue) &&
+        (fieldType == FieldType::StringID) &&
+        tryReadEncodedStringID(_root->getDataSource(), fieldValue, id) &&
+        _root->tryGetStringView(id, value))
+    {
+        return true;
+    }
+
+    value = std::string_view();
+    return false;
+}
+
+// Inherited from IObjectReader.
+bool BinaryObjectReader::tryRead(const PropertyKey &tag, ByteBlock &value) const
 {
     StreamRegion fieldValue;
     FieldType fieldType;
@@ -1102,7 +1583,27 @@ bool BinaryObjectReader::tryRead(string_cref_t tag, ByteBlock &value) const
 }
 
 // Inherited from IObjectReader.
-bool BinaryObjectReader::tryRead(string_cref_t tag, ISeekableStreamUPtr &value) const
+bool BinaryObjectReader::tryRead(const PropertyKey &tag, ByteSpan &value) const
+{
+    StreamRegion fieldValue;
+    FieldType fieldType;
+    const uint8_t *data = nullptr;
+
+    if (tryGetFieldValue(tag, fieldType, fieldValue) &&
+        (fieldType == FieldType::Bytes) &&
+        _root->getDataSource()->tryGetView(fieldValue, data))
+    {
+        value = ByteSpan(data, static_cast<size_t>(fieldValue.getLength()));
+
+        return true;
+    }
+
+    value = ByteSpan();
+    return false;
+}
+
+// Inherited from IObjectReader.
+bool BinaryObjectReader::tryRead(const PropertyKey &tag, ISeekableStreamUPtr &value) const
 {
     StreamRegion fieldValue;
     FieldType fieldType;
@@ -1120,7 +1621,7 @@ bool BinaryObjectReader::tryRead(string_cref_t tag, ISeekableStreamUPtr &value)
 }
 
 // Inherited from IObjectReader.
-bool BinaryObjectReader::tryRead(string_cref_t tag, IObjectReader *&value) const
+bool BinaryObjectReader::tryRead(const PropertyKey &tag, IObjectReader *&value) const
 {
     StreamRegion fieldValue;
     FieldType fieldType;
@@ -1138,7 +1639,7 @@ bool BinaryObjectReader::tryRead(string_cref_t tag, IObjectReader *&value) const
 }
 
 // Inherited from IObjectReader.
-bool BinaryObjectReader::tryRead(string_cref_t tag, IArrayReader *&value) const
+bool BinaryObjectReader::tryRead(const PropertyKey &tag, IArrayReader *&value) const
 {
     StreamRegion fieldValue;
     FieldType fieldType;
@@ -1162,7 +1663,7 @@ bool BinaryObjectReader::tryRead(string_cref_t tag, IArrayReader *&value) const
 //! @retval true A field with the specified tag was found, and the position of
 //! its data was found.
 //! @retval false The object did not contain a matching field.
-bool BinaryObjectReader::tryFindField(string_cref_t tag, StreamRegion &fieldData) const
+bool BinaryObjectReader::tryFindField(const PropertyKey &tag, StreamRegion &fieldData) const
 {
     uint32_t tagID;
 
@@ -1176,7 +1677,7 @@ bool BinaryObjectReader::tryFindField(string_cref_t tag, StreamRegion &fieldData
 //! @param[out] fieldValue Receives the region containing the field data.
 //! @retval true The field was defined and the header/value returned.
 //! @retval false The field was not defined or the header could not be interpreted.
-bool BinaryObjectReader::tryGetFieldValue(string_cref_t tag, FieldType &fieldType,
+bool BinaryObjectReader::tryGetFieldValue(const PropertyKey &tag, FieldType &fieldType,
                                           StreamRegion &fieldValue) const
 {
     StreamRegion fieldData;
@@ -1196,11 +1697,16 @@ bool BinaryObjectReader::tryGetFieldValue(string_cref_t tag, FieldType &fieldTyp
 //! @param[in] output The stream the hierarchy will eventually be written to.
 //! @param[in] rootWriter A pointer to the root BinaryArrayWriter or
 //! BinaryObjectWriter.
+//! @param[in] options Options controlling how the hierarchy is encoded.
 BinaryWriterRoot::BinaryWriterRoot(ISeekableStream *output, const void *rootWriter,
-                                   bool compress) :
+                                   const SerializationOptions &options) :
     _output(output),
     _rootWriter(reinterpret_cast<uintptr_t>(rootWriter)),
-    _compress(compress)
+    _codec(&getCompressionCodec(options.Codec)),
+    _chunkSize(options.ChunkSize),
+    _threadCount(options.ThreadCount),
+    _keyScope(PropertyKey::allocateScope()),
+    _compress(options.Compress)
 {
     // Stoke the string table with the empty string.
     _symbols.emplace_back();
@@ -1248,10 +1754,31 @@ uint32_t BinaryWriterRoot::getStringID(string_cref_t symbol)
     }
 }
 
+//! @brief Gets the unique identifier associated with a property tag, only
+//! looking up the tag text the first time the key is used with the hierarchy.
+//! @param[in] key The key identifying the tag to look up.
+//! @return The unique identifier associated with the tag which can be used
+//! to represent it in payload data.
+uint32_t BinaryWriterRoot::getStringID(const PropertyKey &key)
+{
+    uint32_t id;
+
+    if (key.tryGetBinding(_keyScope, id) == false)
+    {
+        id = getStringID(key.getTag());
+        key.bind(_keyScope, id);
+    }
+
+    return id;
+}
+
 //! @brief Writes a header, the string table and payload data to the stream
 //! passed to the constructor.
 void BinaryWriterRoot::write()
 {
+    AG_INSTRUMENT_ZONE("BinaryWriterRoot::write");
+    AG_INSTRUMENT_SAMPLE("BinaryWriterRoot::write symbols", static_cast<int64_t>(_symbols.size()));
+
     BinaryStreamHeader header;
     StreamPosition headerOffset = _output->getPosition();
 
@@ -1265,12 +1792,38 @@ void BinaryWriterRoot::write()
     header.SymbolCount = static_cast<uint32_t>(_symbols.size());
 
     if (_compress)
+        header.setCodecID(_codec->getID());
+
+    if (_compress && (_codec->getID() != CompressionCodecID::Bzip2))
+    {
+        // Block codecs compress the entire string table at once.
+        MemoryStream stringTable;
+
+        header.SymbolTableSize = writeStringTable(&stringTable);
+
+        ByteBlock tableData = stringTable.toArray();
+        ByteBlock compressedTable;
+        _codec->compress(tableData.data(), tableData.size(), compressedTable);
+
+        if (_output->write(compressedTable.data(),
+                           compressedTable.size()) != compressedTable.size())
+        {
+            throw IOException("Failed to write the compressed string table.");
+        }
+
+        header.CompressedSymbolTableSize = static_cast<StreamLength>(compressedTable.size());
+        header.Flags |= 1;
+    }
+    else if (_compress)
     {
         // Compress the string table data and write after the header.
         StreamPosition stringTableOffset = _output->getPosition();
         Bz2CompressionStream stringCompressor(_output);
 
         header.SymbolTableSize = writeStringTable(&stringCompressor);
+
+        // Ensure the compressed stream is complete before measuring it.
+        stringCompressor.close();
         header.CompressedSymbolTableSize = _output->getPosition() - stringTableOffset;
 
         header.Flags |= 1;
@@ -1292,13 +1845,25 @@ void BinaryWriterRoot::write()
     }
 
     // Allow the string table and payload to be compressed separately.
-    if (_compress)
+    if (_compress && ((_chunkSize > 0) ||
+                      (_codec->getID() != CompressionCodecID::Bzip2)))
+    {
+        // Compress the payload in independent chunks, which block codecs
+        // always require.
+        writeChunkedPayload(header);
+    }
+    else if (_compress)
     {
         // Compress the payload to be written after the string table.
         StreamPosition payloadOffset = _output->getPosition();
-        Bz2CompressionStream payloadCompressor(_output);
+
+        PayloadOutputStream payloadOutput(_output);
+        Bz2CompressionStream payloadCompressor(&payloadOutput);
 
         header.PayloadSize = _payloadStream.orderedWrite(&payloadCompressor);
+
+        payloadCompressor.close();
+        payloadOutput.flush();
         header.CompressedPayloadSize = _output->getPosition() - payloadOffset;
 
         header.Flags |= 2;
@@ -1327,6 +1892,43 @@ void BinaryWriterRoot::write()
         throw IOException("Failed to write out hierarchy header.");
 }
 
+//! @brief Writes the payload as an index followed by a set of independently
+//! compressed chunks which are compressed in parallel.
+//! @param[in,out] header The header to update with the payload sizes and flags.
+void BinaryWriterRoot::writeChunkedPayload(BinaryStreamHeader &header)
+{
+    StreamPosition payloadOffset = _output->getPosition();
+    size_t chunkSize = (_chunkSize > 0) ? _chunkSize :
+                                          SerializationOptions::DefaultChunkSize;
+    PayloadChunkIndex index(chunkSize, _payloadStream.getLength());
+
+    // Reserve space for the index, which can only be completed once the
+    // size of each compressed chunk is known.
+    if (index.tryWrite(_output) == false)
+        throw IOException("Failed to write initial payload chunk index.");
+
+    {
+        PayloadOutputStream payloadOutput(_output);
+        ChunkCompressor chunkCompressor(&payloadOutput, index, *_codec, _threadCount);
+
+        header.PayloadSize = _payloadStream.orderedWrite(&chunkCompressor);
+        chunkCompressor.finish();
+        payloadOutput.flush();
+    }
+
+    StreamPosition payloadEnd = _output->getPosition();
+    header.CompressedPayloadSize = payloadEnd - payloadOffset;
+    header.Flags |= 2 | 4;
+
+    // Go back and write the completed index.
+    _output->setPosition(StreamRelative::Beginning, payloadOffset);
+
+    if (index.tryWrite(_output) == false)
+        throw IOException("Failed to write payload chunk index.");
+
+    _output->setPosition(StreamRelative::Beginning, payloadEnd);
+}
+
 //! @brief Writes the current string table to an output stream as a set of
 //! headerless size values followed by the UTF-8 encoding of each string.
 //! @param[in] output The stream to write the string table to.
@@ -1347,7 +1949,7 @@ StreamLength BinaryWriterRoot::writeStringTable(IStream *output) const
             if (valueBytesWritten != valueByteCount)
                 throw IOException("Failed to write UTF-8 string value.");
 
-            bytesWritten += static_cast<StreamLength>(bytesWritten);
+            bytesWritten += static_cast<StreamLength>(valueBytesWritten);
         }
     }
 
@@ -1361,10 +1963,10 @@ StreamLength BinaryWriterRoot::writeStringTable(IStream *output) const
 //! hierarchy of data.
 //! @param[in] output The stream the hierarchy should be written to when
 //! the current object is destroyed.
-//! @param[in] compress True to compress the resultant stream, false to store
-//! it in its uncompressed from.
-BinaryArrayWriter::BinaryArrayWriter(ISeekableStream *output, bool compress) :
-    _root(std::make_shared<BinaryWriterRoot>(output, this, compress)),
+//! @param[in] options Options controlling how the resultant stream is
+//! encoded.
+BinaryArrayWriter::BinaryArrayWriter(ISeekableStream *output, const SerializationOptions &options) :
+    _root(std::make_shared<BinaryWriterRoot>(output, this, options)),
     _blockWriter(nullptr),
     _elementCount(0)
 {
@@ -1551,6 +2153,15 @@ IArrayWriter *BinaryArrayWriter::beginWriteArray()
     return new BinaryArrayWriter(_root);
 }
 
+// Inherited from IArrayWriter.
+void BinaryArrayWriter::writePackedArray(PackedElementType elementType,
+                                         const void *elements, size_t elementCount)
+{
+    writePackedArrayField(_blockWriter, elementType, elements, elementCount);
+
+    ++_elementCount;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // BinaryObjectWriter Member Definitions
 ////////////////////////////////////////////////////////////////////////////////
@@ -1558,10 +2169,10 @@ IArrayWriter *BinaryArrayWriter::beginWriteArray()
 //! hierarchy of data.
 //! @param[in] output The stream the hierarchy should be written to when
 //! the current object is destroyed.
-//! @param[in] compress True to compress the resultant stream, false to store
-//! it in its uncompressed from.
-BinaryObjectWriter::BinaryObjectWriter(ISeekableStream *output, bool compress) :
-    _root(std::make_shared<BinaryWriterRoot>(output, this, compress))
+//! @param[in] options Options controlling how the resultant stream is
+//! encoded.
+BinaryObjectWriter::BinaryObjectWriter(ISeekableStream *output, const SerializationOptions &options) :
+    _root(std::make_shared<BinaryWriterRoot>(output, this, options))
 {
     _blockWriter = _root->getOutput().beginWritingBlock(_payloadBlock);
 }
@@ -1598,7 +2209,7 @@ BinaryObjectWriter::~BinaryObjectWriter()
 }
 
 // Inherited from IObjectWriter.
-void BinaryObjectWriter::write(string_cref_t tag, bool value)
+void BinaryObjectWriter::write(const PropertyKey &tag, bool value)
 {
     IStream *output = writeTag(tag);
 
@@ -1606,7 +2217,7 @@ void BinaryObjectWriter::write(string_cref_t tag, bool value)
 }
 
 // Inherited from IObjectWriter.
-void BinaryObjectWriter::write(string_cref_t tag, int8_t value)
+void BinaryObjectWriter::write(const PropertyKey &tag, int8_t value)
 {
     IStream *output = writeTag(tag);
 
@@ -1614,7 +2225,7 @@ void BinaryObjectWriter::write(string_cref_t tag, int8_t value)
 }
 
 // Inherited from IObjectWriter.
-void BinaryObjectWriter::write(string_cref_t tag, uint8_t value)
+void BinaryObjectWriter::write(const PropertyKey &tag, uint8_t value)
 {
     IStream *output = writeTag(tag);
 
@@ -1622,7 +2233,7 @@ void BinaryObjectWriter::write(string_cref_t tag, uint8_t value)
 }
 
 // Inherited from IObjectWriter.
-void BinaryObjectWriter::write(string_cref_t tag, int16_t value)
+void BinaryObjectWriter::write(const PropertyKey &tag, int16_t value)
 {
     IStream *output = writeTag(tag);
 
@@ -1630,7 +2241,7 @@ void BinaryObjectWriter::write(string_cref_t tag, int16_t value)
 }
 
 // Inherited from IObjectWriter.
-void BinaryObjectWriter::write(string_cref_t tag, uint16_t value)
+void BinaryObjectWriter::write(const PropertyKey &tag, uint16_t value)
 {
     IStream *output = writeTag(tag);
 
@@ -1638,7 +2249,7 @@ void BinaryObjectWriter::write(string_cref_t tag, uint16_t value)
 }
 
 // Inherited from IObjectWriter.
-void BinaryObjectWriter::write(string_cref_t tag, int32_t value)
+void BinaryObjectWriter::write(const PropertyKey &tag, int32_t value)
 {
     IStream *output = writeTag(tag);
 
@@ -1646,7 +2257,7 @@ void BinaryObjectWriter::write(string_cref_t tag, int32_t value)
 }
 
 // Inherited from IObjectWriter.
-void BinaryObjectWriter::write(string_cref_t tag, uint32_t value)
+void BinaryObjectWriter::write(const PropertyKey &tag, uint32_t value)
 {
     IStream *output = writeTag(tag);
 
@@ -1654,7 +2265,7 @@ void BinaryObjectWriter::write(string_cref_t tag, uint32_t value)
 }
 
 // Inherited from IObjectWriter.
-void BinaryObjectWriter::write(string_cref_t tag, int64_t value)
+void BinaryObjectWriter::write(const PropertyKey &tag, int64_t value)
 {
     IStream *output = writeTag(tag);
 
@@ -1662,7 +2273,7 @@ void BinaryObjectWriter::write(string_cref_t tag, int64_t value)
 }
 
 // Inherited from IObjectWriter.
-void BinaryObjectWriter::write(string_cref_t tag, uint64_t value)
+void BinaryObjectWriter::write(const PropertyKey &tag, uint64_t value)
 {
     IStream *output = writeTag(tag);
 
@@ -1670,7 +2281,7 @@ void BinaryObjectWriter::write(string_cref_t tag, uint64_t value)
 }
 
 // Inherited from IObjectWriter.
-void BinaryObjectWriter::write(string_cref_t tag, char32_t value)
+void BinaryObjectWriter::write(const PropertyKey &tag, char32_t value)
 {
     IStream *output = writeTag(tag);
 
@@ -1678,7 +2289,7 @@ void BinaryObjectWriter::write(string_cref_t tag, char32_t value)
 }
 
 // Inherited from IObjectWriter.
-void BinaryObjectWriter::write(string_cref_t tag, float value)
+void BinaryObjectWriter::write(const PropertyKey &tag, float value)
 {
     IStream *output = writeTag(tag);
 
@@ -1686,7 +2297,7 @@ void BinaryObjectWriter::write(string_cref_t tag, float value)
 }
 
 // Inherited from IObjectWriter.
-void BinaryObjectWriter::write(string_cref_t tag, double value)
+void BinaryObjectWriter::write(const PropertyKey &tag, double value)
 {
     IStream *output = writeTag(tag);
 
@@ -1694,7 +2305,7 @@ void BinaryObjectWriter::write(string_cref_t tag, double value)
 }
 
 // Inherited from IObjectWriter.
-void BinaryObjectWriter::write(string_cref_t tag, string_cref_t value)
+void BinaryObjectWriter::write(const PropertyKey &tag, string_cref_t value)
 {
     IStream *output = writeTag(tag);
 
@@ -1703,7 +2314,7 @@ void BinaryObjectWriter::write(string_cref_t tag, string_cref_t value)
 }
 
 // Inherited from IObjectWriter.
-void BinaryObjectWriter::write(string_cref_t tag, const void *value, size_t byteCount)
+void BinaryObjectWriter::write(const PropertyKey &tag, const void *value, size_t byteCount)
 {
     IStream *output = writeTag(tag);
 
@@ -1716,7 +2327,7 @@ void BinaryObjectWriter::write(string_cref_t tag, const void *value, size_t byte
 }
 
 // Inherited from IObjectWriter.
-IStreamUPtr BinaryObjectWriter::beginWriteBytes(string_cref_t tag)
+IStreamUPtr BinaryObjectWriter::beginWriteBytes(const PropertyKey &tag)
 {
     // Write the tag to appear before the object data.
     writeTag(tag);
@@ -1725,7 +2336,7 @@ IStreamUPtr BinaryObjectWriter::beginWriteBytes(string_cref_t tag)
 }
 
 // Inherited from IObjectWriter.
-IObjectWriter *BinaryObjectWriter::beginWriteObject(string_cref_t tag)
+IObjectWriter *BinaryObjectWriter::beginWriteObject(const PropertyKey &tag)
 {
     // Write the tag to appear before the object data.
     writeTag(tag);
@@ -1734,7 +2345,7 @@ IObjectWriter *BinaryObjectWriter::beginWriteObject(string_cref_t tag)
 }
 
 // Inherited from IObjectWriter.
-IArrayWriter *BinaryObjectWriter::beginWriteArray(string_cref_t tag)
+IArrayWriter *BinaryObjectWriter::beginWriteArray(const PropertyKey &tag)
 {
     // Write the tag to appear before the array data.
     writeTag(tag);
@@ -1747,21 +2358,20 @@ IArrayWriter *BinaryObjectWriter::beginWriteArray(string_cref_t tag)
 //! @return The stream to write the property value to.
 //! @throws ArgumentException Thrown if a property identified by @p tag has
 //! already been written.
-IStream *BinaryObjectWriter::writeTag(string_cref_t tag)
+IStream *BinaryObjectWriter::writeTag(const PropertyKey &tag)
 {
-    auto result = _usedTags.insert(tag);
+    uint32_t tagID = _root->getStringID(tag);
+    auto result = _usedTagIDs.insert(tagID);
 
     if (result.second == false)
     {
         std::string message("A value has already been assigned to the '");
-        appendAgString(message, tag);
+        appendAgString(message, tag.getTag());
         message.append("' property.");
 
         throw ArgumentException(message.c_str(), "tag");
     }
 
-    uint32_t tagID = _root->getStringID(tag);
-
     writeStringField(_blockWriter, tagID);
 
     return _blockWriter;
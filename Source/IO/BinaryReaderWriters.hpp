@@ -15,8 +15,12 @@
 // Dependent Header Files
 ////////////////////////////////////////////////////////////////////////////////
 #include <deque>
+#include <string_view>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
+#include "Ag/IO/HierarchySerialization.hpp"
 #include "HierarchyInterfaces.hpp"
 #include "BinaryHierarchyEncoding.hpp"
 #include "OutOfOrderStream.hpp"
@@ -34,11 +38,15 @@ class BinaryHierarchyRoot : public HierarchyRootPrivate
 public:
     // Construction/Destruction
     BinaryHierarchyRoot(const BinaryStreamHeader &header, IStream *input);
+    BinaryHierarchyRoot(const BinaryStreamHeader &header, const Fs::Path &fileName,
+                        ISeekableStream *input);
 
     // Accessors
     ReadOnlyDataSource *getDataSource() const;
     bool tryGetString(uint32_t id, Ag::String &text) const;
+    bool tryGetStringView(uint32_t id, std::string_view &text) const;
     bool tryGetStringID(const Ag::String &text, uint32_t &id) const;
+    bool tryGetStringID(const PropertyKey &key, uint32_t &id) const;
 
     bool tryReadBoolValue(FieldType fieldType,
                           const StreamRegion &fieldData,
@@ -55,17 +63,26 @@ public:
     virtual IArrayReader *getRootArray() override;
 private:
     // Internal Types
-    using SymbolIDMap = std::unordered_map<Ag::String, uint32_t>;
+    using SymbolIDMap = std::unordered_map<std::string_view, uint32_t>;
+    using SymbolViewCollection = std::vector<std::string_view>;
 
     // Internal Functions
-    static StringCollection readStringTable(IStream *stream, size_t stringCount);
+    static ReadOnlyDataSourceUPtr readChunkedPayload(const BinaryStreamHeader &header,
+                                                     IStream *input);
+    static StreamLength indexStringTable(ReadOnlyDataSource *source, size_t stringCount,
+                                         SymbolViewCollection &symbols);
+    void indexSymbols();
+    void readRootField();
 
     // Internal Fields
     ReadOnlyDataSourceUPtr _source;
+    ReadOnlyDataSourceUPtr _symbolSource;
     StringCollection _symbols;
+    SymbolViewCollection _symbolViews;
     SymbolIDMap _symbolIDsByText;
     StreamRegion _rootFieldData;
     FieldType _rootFieldType;
+    uint32_t _keyScope;
 public:
     // Templates
 
@@ -106,6 +123,7 @@ public:
         case FieldType::Bytes:
         case FieldType::Object:
         case FieldType::Array:
+        case FieldType::PackedArray:
         default:
             hasValue = false;
             break;
@@ -160,6 +178,7 @@ public:
         case FieldType::Bytes:
         case FieldType::Object:
         case FieldType::Array:
+        case FieldType::PackedArray:
         default:
             hasValue = false;
             break;
@@ -183,6 +202,8 @@ public:
     // Overrides
     virtual bool hasMore() const override;
     virtual bool tryGetNextElementSize(StreamLength &elementSize) const override;
+    virtual bool tryGetNextPackedArrayInfo(PackedElementType &elementType,
+                                           size_t &elementCount) const override;
     virtual StreamLength getElementCount() const override;
     virtual StreamPosition getCurrentElementIndex() const override;
     virtual void reset() override;
@@ -201,10 +222,14 @@ public:
     virtual bool tryReadNext(float &value) override;
     virtual bool tryReadNext(double &value) override;
     virtual bool tryReadNext(String &value) override;
+    virtual bool tryReadNext(std::string_view &value) override;
     virtual bool tryReadNext(ByteBlock &value) override;
+    virtual bool tryReadNext(ByteSpan &value) override;
     virtual bool tryReadNext(ISeekableStreamUPtr &value) override;
     virtual bool tryReadNext(IObjectReader *&value) override;
     virtual bool tryReadNext(IArrayReader *&value) override;
+    virtual bool tryReadNextPackedArray(PackedElementType elementType,
+                                        void *elements, size_t elementCount) override;
 private:
     // Internal Functions
     bool tryGetNextField(FieldType &fieldType, StreamRegion &fieldData) const;
@@ -231,34 +256,36 @@ public:
     // Operations
 
     // Overrides
-    virtual bool hasProperty(string_cref_t tag) const override;
-    virtual bool tryGetPropertySize(string_cref_t tag,
+    virtual bool hasProperty(const PropertyKey &tag) const override;
+    virtual bool tryGetPropertySize(const PropertyKey &tag,
                                     StreamLength &propSize) const override;
 
-    virtual bool tryRead(string_cref_t tag, bool &value) const override;
-    virtual bool tryRead(string_cref_t tag, int8_t &value) const override;
-    virtual bool tryRead(string_cref_t tag, uint8_t &value) const override;
-    virtual bool tryRead(string_cref_t tag, int16_t &value) const override;
-    virtual bool tryRead(string_cref_t tag, uint16_t &value) const override;
-    virtual bool tryRead(string_cref_t tag, int32_t &value) const override;
-    virtual bool tryRead(string_cref_t tag, uint32_t &value) const override;
-    virtual bool tryRead(string_cref_t tag, int64_t &value) const override;
-    virtual bool tryRead(string_cref_t tag, uint64_t &value) const override;
-    virtual bool tryRead(string_cref_t tag, char32_t &value) const override;
-    virtual bool tryRead(string_cref_t tag, float &value) const override;
-    virtual bool tryRead(string_cref_t tag, double &value) const override;
-    virtual bool tryRead(string_cref_t tag, String &value) const override;
-    virtual bool tryRead(string_cref_t tag, ByteBlock &value) const override;
-    virtual bool tryRead(string_cref_t tag, ISeekableStreamUPtr &value) const override;
-    virtual bool tryRead(string_cref_t tag, IObjectReader *&value) const override;
-    virtual bool tryRead(string_cref_t tag, IArrayReader *&value) const override;
+    virtual bool tryRead(const PropertyKey &tag, bool &value) const override;
+    virtual bool tryRead(const PropertyKey &tag, int8_t &value) const override;
+    virtual bool tryRead(const PropertyKey &tag, uint8_t &value) const override;
+    virtual bool tryRead(const PropertyKey &tag, int16_t &value) const override;
+    virtual bool tryRead(const PropertyKey &tag, uint16_t &value) const override;
+    virtual bool tryRead(const PropertyKey &tag, int32_t &value) const override;
+    virtual bool tryRead(const PropertyKey &tag, uint32_t &value) const override;
+    virtual bool tryRead(const PropertyKey &tag, int64_t &value) const override;
+    virtual bool tryRead(const PropertyKey &tag, uint64_t &value) const override;
+    virtual bool tryRead(const PropertyKey &tag, char32_t &value) const override;
+    virtual bool tryRead(const PropertyKey &tag, float &value) const override;
+    virtual bool tryRead(const PropertyKey &tag, double &value) const override;
+    virtual bool tryRead(const PropertyKey &tag, String &value) const override;
+    virtual bool tryRead(const PropertyKey &tag, std::string_view &value) const override;
+    virtual bool tryRead(const PropertyKey &tag, ByteBlock &value) const override;
+    virtual bool tryRead(const PropertyKey &tag, ByteSpan &value) const override;
+    virtual bool tryRead(const PropertyKey &tag, ISeekableStreamUPtr &value) const override;
+    virtual bool tryRead(const PropertyKey &tag, IObjectReader *&value) const override;
+    virtual bool tryRead(const PropertyKey &tag, IArrayReader *&value) const override;
 private:
     // Internal Types
     using FieldDataTagIDMap = Ag::LinearSortedMap<uint32_t, StreamRegion>;
 
     // Internal Functions
-    bool tryFindField(string_cref_t tag, StreamRegion &fieldData) const;
-    bool tryGetFieldValue(string_cref_t tag, FieldType &feldType,
+    bool tryFindField(const PropertyKey &tag, StreamRegion &fieldData) const;
+    bool tryGetFieldValue(const PropertyKey &tag, FieldType &feldType,
                           StreamRegion &fieldValue) const;
 
     // Internal Fields
@@ -272,7 +299,8 @@ class BinaryWriterRoot : public std::enable_shared_from_this<BinaryWriterRoot>
 {
 public:
     // Construction/Destruction
-    BinaryWriterRoot(ISeekableStream *output, const void *rootWriter, bool compress);
+    BinaryWriterRoot(ISeekableStream *output, const void *rootWriter,
+                     const SerializationOptions &options);
     ~BinaryWriterRoot() = default;
 
     // Accessors
@@ -281,6 +309,7 @@ public:
 
     // Operations
     uint32_t getStringID(string_cref_t symbol);
+    uint32_t getStringID(const PropertyKey &key);
     void write();
 private:
     // Internal Types
@@ -289,6 +318,7 @@ private:
 
     // Internal Functions
     StreamLength writeStringTable(IStream *output) const;
+    void writeChunkedPayload(BinaryStreamHeader &header);
 
     // Internal Fields
     OutOfOrderStream _payloadStream;
@@ -296,6 +326,10 @@ private:
     StringBag _symbols;
     ISeekableStream *_output;
     uintptr_t _rootWriter;
+    const ICompressionCodec *_codec;
+    size_t _chunkSize;
+    size_t _threadCount;
+    uint32_t _keyScope;
     bool _compress;
 };
 
@@ -309,7 +343,7 @@ class BinaryArrayWriter : public IArrayWriter
 public:
     // Construction/Destruction
     BinaryArrayWriter() = delete;
-    BinaryArrayWriter(ISeekableStream *output, bool compress);
+    BinaryArrayWriter(ISeekableStream *output, const SerializationOptions &options);
     BinaryArrayWriter(const BinaryWriterRootSPtr &root);
     virtual ~BinaryArrayWriter() override;
 
@@ -331,6 +365,8 @@ public:
     virtual IStreamUPtr beginWriteBytes() override;
     virtual IObjectWriter *beginWriteObject() override;
     virtual IArrayWriter *beginWriteArray() override;
+    virtual void writePackedArray(PackedElementType elementType,
+                                  const void *elements, size_t elementCount) override;
 
 private:
     // Internal Fields
@@ -347,38 +383,38 @@ class BinaryObjectWriter : public IObjectWriter
 public:
     // Construction/Destruction
     BinaryObjectWriter() = delete;
-    BinaryObjectWriter(ISeekableStream *output, bool compress);
+    BinaryObjectWriter(ISeekableStream *output, const SerializationOptions &options);
     BinaryObjectWriter(const BinaryWriterRootSPtr &root);
     virtual ~BinaryObjectWriter() override;
 
     // Overrides
-    virtual void write(string_cref_t tag, bool value) override;
-    virtual void write(string_cref_t tag, int8_t value) override;
-    virtual void write(string_cref_t tag, uint8_t value) override;
-    virtual void write(string_cref_t tag, int16_t value) override;
-    virtual void write(string_cref_t tag, uint16_t value) override;
-    virtual void write(string_cref_t tag, int32_t value) override;
-    virtual void write(string_cref_t tag, uint32_t value) override;
-    virtual void write(string_cref_t tag, int64_t value) override;
-    virtual void write(string_cref_t tag, uint64_t value) override;
-    virtual void write(string_cref_t tag, char32_t value) override;
-    virtual void write(string_cref_t tag, float value) override;
-    virtual void write(string_cref_t tag, double value) override;
-    virtual void write(string_cref_t tag, string_cref_t value) override;
-    virtual void write(string_cref_t tag, const void *value, size_t byteCount) override;
-    virtual IStreamUPtr beginWriteBytes(string_cref_t tag) override;
-    virtual IObjectWriter *beginWriteObject(string_cref_t tag) override;
-    virtual IArrayWriter *beginWriteArray(string_cref_t tag) override;
+    virtual void write(const PropertyKey &tag, bool value) override;
+    virtual void write(const PropertyKey &tag, int8_t value) override;
+    virtual void write(const PropertyKey &tag, uint8_t value) override;
+    virtual void write(const PropertyKey &tag, int16_t value) override;
+    virtual void write(const PropertyKey &tag, uint16_t value) override;
+    virtual void write(const PropertyKey &tag, int32_t value) override;
+    virtual void write(const PropertyKey &tag, uint32_t value) override;
+    virtual void write(const PropertyKey &tag, int64_t value) override;
+    virtual void write(const PropertyKey &tag, uint64_t value) override;
+    virtual void write(const PropertyKey &tag, char32_t value) override;
+    virtual void write(const PropertyKey &tag, float value) override;
+    virtual void write(const PropertyKey &tag, double value) override;
+    virtual void write(const PropertyKey &tag, string_cref_t value) override;
+    virtual void write(const PropertyKey &tag, const void *value, size_t byteCount) override;
+    virtual IStreamUPtr beginWriteBytes(const PropertyKey &tag) override;
+    virtual IObjectWriter *beginWriteObject(const PropertyKey &tag) override;
+    virtual IArrayWriter *beginWriteArray(const PropertyKey &tag) override;
 
 private:
     // Internal Functions
-    IStream *writeTag(string_cref_t tag);
+    IStream *writeTag(const PropertyKey &tag);
 
     // Internal Fields
     BinaryWriterRootSPtr _root;
     OutOfOrderStream::Stream *_blockWriter;
     OutOfOrderStream::BlockRef _payloadBlock;
-    StringSet _usedTags;
+    std::unordered_set<uint32_t> _usedTagIDs;
 };
 
 }} // namespace Ag::IO
@@ -11,20 +11,37 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Header File Includes
 ////////////////////////////////////////////////////////////////////////////////
+#include "Ag/Core/Timer.hpp"
+#include "Ag/Core/WorkerPool.hpp"
 #include "Ag/IO/BufferedInputStream.hpp"
 
 namespace Ag {
 namespace IO {
 
+////////////////////////////////////////////////////////////////////////////////
+// BufferedInputStream::Statistics Member Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Gets the average rate at which the underlying stream delivered
+//! data, in bytes per second, or 0 if nothing has been read yet.
+double BufferedInputStream::Statistics::getFetchThroughput() const
+{
+    return (FetchSeconds > 0.0) ? static_cast<double>(BytesFetched) / FetchSeconds : 0.0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // BufferedInputStream Member Definitions
 ////////////////////////////////////////////////////////////////////////////////
 //! @brief Constructs a stream to batch reads to an underlying stream.
 //! @param[in] input The underlying stream to read form.
 //! @param[in] bufferSize A hint at the size of the buffer to use, in bytes.
+//! @param[in] prefetchCount The count of buffers to fill on a background
+//! thread ahead of the one being read, 1 for double buffering, 2 for triple
+//! buffering, or 0 to fill the buffer synchronously when it is drained.
 //! @remarks The buffer size will be clamped to a value between MinBufferSize,
-//! and MaxBufferSize.
-BufferedInputStream::BufferedInputStream(IStream *input, size_t bufferSize /*= 0*/) :
+//! and MaxBufferSize and the prefetch count to no more than MaxPrefetchCount.
+//! Prefetching begins immediately.
+BufferedInputStream::BufferedInputStream(IStream *input, size_t bufferSize /*= 0*/,
+                                         size_t prefetchCount /*= 0*/) :
     _innerStream(input),
     _bytesRead(0)
 {
@@ -32,6 +49,28 @@ BufferedInputStream::BufferedInputStream(IStream *input, size_t bufferSize /*= 0
 
     // Ensure the buffer is allocated once only.
     _buffer.reserve(safeBufferSize);
+
+    if (prefetchCount > 0)
+    {
+        // A single thread ensures the underlying stream is read in order.
+        _prefetcher = std::make_unique<WorkerPool>(1);
+
+        for (size_t index = 0, count = std::min(prefetchCount, MaxPrefetchCount);
+             index < count; ++index)
+        {
+            ByteBlock buffer;
+            buffer.reserve(safeBufferSize);
+
+            beginPrefetch(std::move(buffer));
+        }
+    }
+}
+
+//! @brief Waits for any background reads to complete.
+BufferedInputStream::~BufferedInputStream()
+{
+    _prefetcher.reset();
+    _pendingBuffers.clear();
 }
 
 //! @brief Gets the total size of the buffer, in bytes.
@@ -64,6 +103,21 @@ void BufferedInputStream::ungetBytes(size_t count)
     _bytesRead -= count;
 }
 
+//! @brief Gets the count of buffers filled ahead of the one being read, or
+//! 0 if the buffer is filled synchronously.
+size_t BufferedInputStream::getPrefetchCount() const
+{
+    return _prefetcher ? _pendingBuffers.size() : 0;
+}
+
+//! @brief Gets measurements of the reads made to the underlying stream.
+//! @note In prefetch mode, reads are only accounted for once the buffer
+//! they filled has been taken by the consumer.
+const BufferedInputStream::Statistics &BufferedInputStream::getStatistics() const
+{
+    return _stats;
+}
+
 //! @brief Gets a read-only reference to the underlying stream.
 const IStream *BufferedInputStream::getInnerStream() const
 {
@@ -79,8 +133,10 @@ bool BufferedInputStream::isBuffered() const
 // Inherited from IStream.
 void BufferedInputStream::flush()
 {
-    // Nothing to flush for a reader. Simply pass down to the inner stream.
-    _innerStream->flush();
+    // Nothing to flush for a reader. Simply pass down to the inner stream,
+    // unless it is in use by the background thread.
+    if (!_prefetcher)
+        _innerStream->flush();
 }
 
 // Inherited from IStream.
@@ -90,6 +146,42 @@ size_t BufferedInputStream::read(void *targetBuffer, size_t requiredByteCount)
     uint8_ptr_t target = reinterpret_cast<uint8_ptr_t>(targetBuffer);
     size_t bytesRead = 0;
 
+    if (_prefetcher)
+    {
+        // Only satisfy reads from the buffers so that data stays in order.
+        while (bytesRead < requiredByteCount)
+        {
+            if (bufferedBytesLeft == 0)
+            {
+                if (tryTakePrefetchedBuffer() == false)
+                {
+                    if (_prefetchError && (bytesRead == 0))
+                    {
+                        // Report the error once the data before it is consumed.
+                        std::exception_ptr error = _prefetchError;
+                        _prefetchError = nullptr;
+
+                        std::rethrow_exception(error);
+                    }
+
+                    break;
+                }
+
+                bufferedBytesLeft = _buffer.size();
+            }
+
+            size_t bytesToCopy = std::min(bufferedBytesLeft, requiredByteCount - bytesRead);
+
+            memcpy(target + bytesRead, _buffer.data() + _bytesRead, bytesToCopy);
+
+            bytesRead += bytesToCopy;
+            _bytesRead += bytesToCopy;
+            bufferedBytesLeft -= bytesToCopy;
+        }
+
+        return bytesRead;
+    }
+
     if (bufferedBytesLeft > 0)
     {
         // Satisfy the first bytes from the buffer.
@@ -114,7 +206,7 @@ size_t BufferedInputStream::read(void *targetBuffer, size_t requiredByteCount)
         if (bytesRequired >= _buffer.capacity())
         {
             // Read the rest bypassing the cache.
-            size_t read = _innerStream->read(target + bytesRead, bytesRequired);
+            size_t read = fetch(target + bytesRead, bytesRequired);
 
             // That should be as much as we can read.
             bytesRead += read;
@@ -123,7 +215,7 @@ size_t BufferedInputStream::read(void *targetBuffer, size_t requiredByteCount)
         {
             // Re-fill the buffer.
             _buffer.resize(_buffer.capacity());
-            size_t read = _innerStream->read(_buffer.data(), _buffer.size());
+            size_t read = fetch(_buffer.data(), _buffer.size());
 
             // Truncate the buffer.
             _buffer.resize(read);
@@ -149,6 +241,109 @@ size_t BufferedInputStream::write(const void */*sourceBuffer*/,
     throw NotSupportedException("Writing to a buffered read stream is not supported.");
 }
 
+//! @brief Reads from the underlying stream while the caller waits.
+//! @param[in] target The buffer to receive the bytes read.
+//! @param[in] byteCount The maximum count of bytes to read.
+//! @return The count of bytes actually read.
+size_t BufferedInputStream::fetch(uint8_ptr_t target, size_t byteCount)
+{
+    MonotonicTicks start = HighResMonotonicTimer::getTime();
+    size_t bytesRead = _innerStream->read(target, byteCount);
+    double seconds = HighResMonotonicTimer::getTimeSpan(HighResMonotonicTimer::getDuration(start));
+
+    // The consumer always waits for a synchronous read.
+    _stats.BytesFetched += bytesRead;
+    ++_stats.FetchCount;
+    _stats.FetchSeconds += seconds;
+    ++_stats.StallCount;
+    _stats.StallSeconds += seconds;
+
+    return bytesRead;
+}
+
+//! @brief Replaces the drained buffer with the next one filled on the
+//! background thread, waiting for it if necessary, and starts re-filling
+//! the drained buffer.
+//! @retval true The buffer was replaced with at least one byte of data.
+//! @retval false The end of the underlying stream was reached, or reading
+//! it failed, in which case the error is stored to be reported by read().
+bool BufferedInputStream::tryTakePrefetchedBuffer()
+{
+    if (_pendingBuffers.empty())
+        return false;
+
+    std::future<FetchedBuffer> next = std::move(_pendingBuffers.front());
+    _pendingBuffers.pop_front();
+
+    if (next.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+    {
+        MonotonicTicks start = HighResMonotonicTimer::getTime();
+        next.wait();
+
+        ++_stats.StallCount;
+        _stats.StallSeconds += HighResMonotonicTimer::getTimeSpan(
+            HighResMonotonicTimer::getDuration(start));
+    }
+
+    FetchedBuffer fetched;
+
+    try
+    {
+        fetched = next.get();
+    }
+    catch (...)
+    {
+        // Data read after the failure cannot be delivered in order.
+        _pendingBuffers.clear();
+        _prefetchError = std::current_exception();
+
+        return false;
+    }
+
+    _stats.BytesFetched += fetched.Data.size();
+    ++_stats.FetchCount;
+    _stats.FetchSeconds += fetched.Seconds;
+
+    if (fetched.Data.empty())
+    {
+        // There is nothing more to prefetch.
+        _pendingBuffers.clear();
+
+        return false;
+    }
+
+    std::swap(_buffer, fetched.Data);
+    _bytesRead = 0;
+
+    // Re-fill the buffer just drained.
+    beginPrefetch(std::move(fetched.Data));
+
+    return true;
+}
+
+//! @brief Schedules a buffer to be filled from the underlying stream on the
+//! background thread.
+//! @param[in] buffer The buffer to fill, its capacity defines the count of
+//! bytes to read.
+void BufferedInputStream::beginPrefetch(ByteBlock &&buffer)
+{
+    IStream *input = _innerStream;
+
+    _pendingBuffers.push_back(_prefetcher->submit(
+        [input, buffer = std::move(buffer)]() mutable
+    {
+        MonotonicTicks start = HighResMonotonicTimer::getTime();
+
+        buffer.resize(buffer.capacity());
+        buffer.resize(input->read(buffer.data(), buffer.size()));
+
+        double seconds = HighResMonotonicTimer::getTimeSpan(
+            HighResMonotonicTimer::getDuration(start));
+
+        return FetchedBuffer { std::move(buffer), seconds };
+    }));
+}
+
 }} // namespace Ag::IO
 ////////////////////////////////////////////////////////////////////////////////
 
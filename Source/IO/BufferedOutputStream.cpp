@@ -12,6 +12,7 @@
 // Header File Includes
 ////////////////////////////////////////////////////////////////////////////////
 #include "Ag/Core/Exception.hpp"
+#include "Ag/Core/WorkerPool.hpp"
 
 #include "Ag/IO/BufferedOutputStream.hpp"
 
@@ -24,11 +25,17 @@ namespace IO {
 //! @brief Constructs a wrapper for a stream which batches write operations.
 //! @param[in] innerStream The stream to wrap.
 //! @param[in] bufferSize The suggested size of the buffer used to batch writes.
+//! @param[in] writeBehindCount The maximum count of full buffers to queue to
+//! be written on a background thread, or 0 to write them synchronously.
 //! @remarks The buffer size will be clamped to a value between MinBufferSize,
-//! and MaxBufferSize.
+//! and MaxBufferSize and the write-behind count to no more than
+//! MaxWriteBehindCount.
 BufferedOutputStream::BufferedOutputStream(IStream *innerStream,
-                                           size_t bufferSize /*= 0*/) :
-    _innerStream(innerStream)
+                                           size_t bufferSize /*= 0*/,
+                                           size_t writeBehindCount /*= 0*/) :
+    _innerStream(innerStream),
+    _writeBehindCount(std::min(writeBehindCount, MaxWriteBehindCount)),
+    _hasWriteFailed(false)
 {
     if (_innerStream == nullptr)
         throw ArgumentNullException("innerStream");
@@ -36,12 +43,39 @@ BufferedOutputStream::BufferedOutputStream(IStream *innerStream,
     size_t bufferSizeHint = std::clamp(bufferSize, MinBufferSize, MaxBufferSize);
 
     _buffer.reserve(bufferSizeHint);
+
+    if (_writeBehindCount > 0)
+    {
+        // A single thread ensures buffers are written in order.
+        _writer = std::make_unique<WorkerPool>(1);
+    }
 }
 
 //! @brief Ensures any buffered data is flushed before destruction.
 BufferedOutputStream::~BufferedOutputStream()
 {
-    flush();
+    if (_innerStream == nullptr)
+    {
+        // The state was moved to another object.
+    }
+    else if (_writer)
+    {
+        // Errors writing in the background cannot be reported from here,
+        // flush() should be called first if they matter.
+        try
+        {
+            flush();
+        }
+        catch (...)
+        {
+        }
+
+        _writer.reset();
+    }
+    else
+    {
+        flush();
+    }
 
     _innerStream = nullptr;
 }
@@ -58,12 +92,47 @@ size_t BufferedOutputStream::getBufferUsed() const
     return _buffer.size();
 }
 
+//! @brief Gets the maximum count of full buffers queued to be written on a
+//! background thread, or 0 if buffers are written synchronously.
+size_t BufferedOutputStream::getWriteBehindCount() const
+{
+    return _writeBehindCount;
+}
+
 //! @brief Gets a read-only pointer to the underlying stream.
 const IStream *BufferedOutputStream::getInnerStream() const
 {
     return _innerStream;
 }
 
+//! @brief Flushes the stream, then takes over the state of another, which
+//! is flushed and left closed.
+//! @param[in] rhs The stream to take the state of.
+//! @return A reference to this object.
+BufferedOutputStream &BufferedOutputStream::operator=(BufferedOutputStream &&rhs)
+{
+    if (this != &rhs)
+    {
+        if (_innerStream != nullptr)
+            flush();
+
+        // Background writes refer to the object which queued them, so ensure
+        // they are complete.
+        if (rhs._innerStream != nullptr)
+            rhs.flush();
+
+        _buffer = std::move(rhs._buffer);
+        _innerStream = rhs._innerStream;
+        _writer = std::move(rhs._writer);
+        _writeBehindCount = rhs._writeBehindCount;
+        _hasWriteFailed.store(rhs._hasWriteFailed.load());
+
+        rhs._innerStream = nullptr;
+    }
+
+    return *this;
+}
+
 // Inherited from IStream.
 bool BufferedOutputStream::isBuffered() const
 {
@@ -76,7 +145,18 @@ void BufferedOutputStream::flush()
     if (_innerStream == nullptr)
         throw OperationException("Cannot flush to a closed stream.");
 
-    if (_buffer.empty() == false)
+    if (_writer)
+    {
+        checkForWriteBehindFailure();
+
+        if (_buffer.empty() == false)
+            beginWriteBehind();
+
+        // Wait for all queued buffers to be written.
+        while (_pendingWrites.empty() == false)
+            completeWriteBehind();
+    }
+    else if (_buffer.empty() == false)
     {
         size_t bytesToWrite = _buffer.size();
         size_t written = _innerStream->write(_buffer.data(), bytesToWrite);
@@ -104,6 +184,28 @@ size_t BufferedOutputStream::write(const void *sourceBuffer, size_t sourceByteCo
 
     uint8_cptr_t source = reinterpret_cast<uint8_cptr_t>(sourceBuffer);
     size_t bytesWritten = 0;
+
+    if (_writer)
+    {
+        checkForWriteBehindFailure();
+
+        // Fill buffers, queuing each one to be written once full.
+        while (bytesWritten < sourceByteCount)
+        {
+            size_t bytesToCopy = std::min(_buffer.capacity() - _buffer.size(),
+                                          sourceByteCount - bytesWritten);
+
+            _buffer.insert(_buffer.end(), source + bytesWritten,
+                           source + bytesWritten + bytesToCopy);
+            bytesWritten += bytesToCopy;
+
+            if (_buffer.size() == _buffer.capacity())
+                beginWriteBehind();
+        }
+
+        return bytesWritten;
+    }
+
     size_t bytesToWrite = 0;
     size_t bufferFree = _buffer.capacity() - _buffer.size();
 
@@ -116,6 +218,26 @@ size_t BufferedOutputStream::write(const void *sourceBuffer, size_t sourceByteCo
             // We have nothing to flush.
             bytesWritten = _innerStream->write(source, sourceByteCount);
         }
+        else if ((sourceByteCount - bufferFree) >= _buffer.capacity())
+        {
+            // Topping up the buffer would still leave too much to buffer, so
+            // write the buffered bytes and the source bytes in one operation.
+            const ByteSpan spans[] = {
+                ByteSpan(_buffer.data(), _buffer.size()),
+                ByteSpan(source, sourceByteCount)
+            };
+
+            bytesToWrite = _buffer.size() + sourceByteCount;
+            size_t innerBytesWritten = _innerStream->writeGathered(spans, std::size(spans));
+
+            // Clear the buffer before any error handling.
+            _buffer.clear();
+
+            if (innerBytesWritten != bytesToWrite)
+                throw OperationException("Failed to write all buffered bytes to the inner stream.");
+
+            bytesWritten = sourceByteCount;
+        }
         else
         {
             // There will need to be at least one write from the
@@ -173,6 +295,141 @@ size_t BufferedOutputStream::write(const void *sourceBuffer, size_t sourceByteCo
     return bytesWritten;
 }
 
+// Inherited from IStream.
+size_t BufferedOutputStream::writeGathered(const ByteSpan *sourceBuffers,
+                                           size_t bufferCount)
+{
+    if (_innerStream == nullptr)
+        throw OperationException("Cannot flush to a closed stream.");
+
+    if (_writer)
+    {
+        // Copy each buffer in turn so that the output stays in order.
+        return IStream::writeGathered(sourceBuffers, bufferCount);
+    }
+
+    size_t sourceByteCount = 0;
+
+    for (size_t index = 0; index < bufferCount; ++index)
+        sourceByteCount += sourceBuffers[index].Length;
+
+    if (sourceByteCount < (_buffer.capacity() - _buffer.size()))
+    {
+        // Everything fits in the buffer.
+        for (size_t index = 0; index < bufferCount; ++index)
+        {
+            const ByteSpan &source = sourceBuffers[index];
+
+            _buffer.insert(_buffer.end(), source.begin(), source.end());
+        }
+    }
+    else
+    {
+        // Write the buffered bytes followed by the source bytes in one operation.
+        std::vector<ByteSpan> spans;
+        spans.reserve(bufferCount + 1);
+
+        if (_buffer.empty() == false)
+            spans.emplace_back(_buffer.data(), _buffer.size());
+
+        spans.insert(spans.end(), sourceBuffers, sourceBuffers + bufferCount);
+
+        size_t bytesToWrite = _buffer.size() + sourceByteCount;
+        size_t innerBytesWritten = _innerStream->writeGathered(spans.data(), spans.size());
+
+        // Clear the buffer before any error handling.
+        _buffer.clear();
+
+        if (innerBytesWritten != bytesToWrite)
+            throw OperationException("Failed to write all buffered bytes to the inner stream.");
+    }
+
+    return sourceByteCount;
+}
+
+//! @brief Queues the current buffer to be written on the background thread
+//! and replaces it with an empty one.
+//! @remarks If the queue is full, waits for the oldest buffer to be written
+//! and re-uses it.
+//! @throws Ag::Exception Any error writing the oldest buffer.
+void BufferedOutputStream::beginWriteBehind()
+{
+    size_t capacity = _buffer.capacity();
+    IStream *output = _innerStream;
+    std::atomic<bool> *hasFailed = &_hasWriteFailed;
+
+    _pendingWrites.push_back(_writer->submit(
+        [output, hasFailed, buffer = std::move(_buffer)]() mutable
+    {
+        // Don't write data after a gap left by an earlier failure.
+        if (hasFailed->load())
+            throw OperationException("A buffer was discarded after an earlier write failed.");
+
+        try
+        {
+            if (output->write(buffer.data(), buffer.size()) != buffer.size())
+                throw OperationException("Failed to write all buffered bytes to the inner stream.");
+        }
+        catch (...)
+        {
+            hasFailed->store(true);
+            throw;
+        }
+
+        buffer.clear();
+
+        return std::move(buffer);
+    }));
+
+    _buffer = ByteBlock();
+
+    if ((_pendingWrites.size() > _writeBehindCount) ||
+        (_pendingWrites.front().wait_for(std::chrono::seconds(0)) == std::future_status::ready))
+    {
+        // Apply back-pressure, or re-use a buffer which has been written.
+        try
+        {
+            _buffer = completeWriteBehind();
+        }
+        catch (...)
+        {
+            _buffer.reserve(capacity);
+            throw;
+        }
+    }
+    else
+    {
+        _buffer.reserve(capacity);
+    }
+}
+
+//! @brief Waits for the oldest queued buffer to be written.
+//! @return The empty buffer, ready to be re-used.
+//! @throws Ag::Exception Any error which occurred writing the buffer.
+ByteBlock BufferedOutputStream::completeWriteBehind()
+{
+    std::future<ByteBlock> oldest = std::move(_pendingWrites.front());
+    _pendingWrites.pop_front();
+
+    return oldest.get();
+}
+
+//! @brief Reports an error which occurred writing a buffer in the background.
+//! @throws Ag::Exception The error which occurred, or OperationException if
+//! it has already been reported.
+void BufferedOutputStream::checkForWriteBehindFailure()
+{
+    if (_hasWriteFailed.load())
+    {
+        // Buffers written before the failure complete normally, the one
+        // which failed reports the original error.
+        while (_pendingWrites.empty() == false)
+            completeWriteBehind();
+
+        throw OperationException("The stream cannot be written after an earlier write failed.");
+    }
+}
+
 }} // namespace Ag::IO
 ////////////////////////////////////////////////////////////////////////////////
 
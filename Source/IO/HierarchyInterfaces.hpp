@@ -18,6 +18,10 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Dependent Header Files
 ////////////////////////////////////////////////////////////////////////////////
+#include <string_view>
+#include <type_traits>
+
+#include "Ag/Core/Binary.hpp"
 #include "Ag/Core/Memory.hpp"
 
 #include "Ag/IO/ISeekableStream.hpp"
@@ -28,12 +32,30 @@ namespace IO {
 ////////////////////////////////////////////////////////////////////////////////
 // Data Type Declarations
 ////////////////////////////////////////////////////////////////////////////////
+//! @brief Identifies the data type of the elements of a packed array, an
+//! array of fixed-size primitive values serialized as a single block.
+enum class PackedElementType : uint8_t
+{
+    Int8,
+    Uint8,
+    Int16,
+    Uint16,
+    Int32,
+    Uint32,
+    Int64,
+    Uint64,
+    Float,
+    Double,
+
+    Max,
+};
 
 ////////////////////////////////////////////////////////////////////////////////
 // Class Declarations
 ////////////////////////////////////////////////////////////////////////////////
 class IArrayReader;
 class IArrayWriter;
+class PropertyKey;
 
 //! @brief An interface to an object which can access the properties of a
 //! serialised object.
@@ -52,7 +74,7 @@ public:
     //! @retval true The object contains a serialized value for the property
     //! identified by @p tag.
     //! @retval false The object contains no properties matching @p tag.
-    virtual bool hasProperty(string_cref_t tag) const = 0;
+    virtual bool hasProperty(const PropertyKey &tag) const = 0;
 
     //! @brief Attempts to read the storage size of a named property.
     //! @param[in] tag The property identifier.
@@ -61,7 +83,7 @@ public:
     //! @retval true The property existed and @p propSize was updated with
     //! its size.
     //! @retval false The property could not be found.
-    virtual bool tryGetPropertySize(string_cref_t tag,
+    virtual bool tryGetPropertySize(const PropertyKey &tag,
                                     StreamLength &propSize) const = 0;
 
     // Operations
@@ -73,7 +95,7 @@ public:
     //! @retval true The property existed and could be interpreted as a bool.
     //! @retval false The property either didn't exist, or the value could not
     //! be interpreted as a bool.
-    virtual bool tryRead(string_cref_t tag, bool &value) const = 0;
+    virtual bool tryRead(const PropertyKey &tag, bool &value) const = 0;
 
     //! @brief Attempts to read the value of a property as a signed 8-bit integer.
     //! @param[in] tag The identifier of the property to read.
@@ -83,7 +105,7 @@ public:
     //! the appropriate type.
     //! @retval false The property either didn't exist, or the value could not
     //! be interpreted as an integer of appropriate size.
-    virtual bool tryRead(string_cref_t tag, int8_t &value) const = 0;
+    virtual bool tryRead(const PropertyKey &tag, int8_t &value) const = 0;
 
     //! @brief Attempts to read the value of a property as
     //! an unsigned 8-bit integer.
@@ -94,7 +116,7 @@ public:
     //! the appropriate type.
     //! @retval false The property either didn't exist, or the value could not
     //! be interpreted as an integer of appropriate size.
-    virtual bool tryRead(string_cref_t tag, uint8_t &value) const = 0;
+    virtual bool tryRead(const PropertyKey &tag, uint8_t &value) const = 0;
 
     //! @brief Attempts to read the value of a property as a signed 16-bit integer.
     //! @param[in] tag The identifier of the property to read.
@@ -104,7 +126,7 @@ public:
     //! the appropriate type.
     //! @retval false The property either didn't exist, or the value could not
     //! be interpreted as an integer of appropriate size.
-    virtual bool tryRead(string_cref_t tag, int16_t &value) const = 0;
+    virtual bool tryRead(const PropertyKey &tag, int16_t &value) const = 0;
 
     //! @brief Attempts to read the value of a property as
     //! an unsigned 16-bit integer.
@@ -115,7 +137,7 @@ public:
     //! the appropriate type.
     //! @retval false The property either didn't exist, or the value could not
     //! be interpreted as an integer of appropriate size.
-    virtual bool tryRead(string_cref_t tag, uint16_t &value) const = 0;
+    virtual bool tryRead(const PropertyKey &tag, uint16_t &value) const = 0;
 
     //! @brief Attempts to read the value of a property as a signed 32-bit integer.
     //! @param[in] tag The identifier of the property to read.
@@ -125,7 +147,7 @@ public:
     //! the appropriate type.
     //! @retval false The property either didn't exist, or the value could not
     //! be interpreted as an integer of appropriate size.
-    virtual bool tryRead(string_cref_t tag, int32_t &value) const = 0;
+    virtual bool tryRead(const PropertyKey &tag, int32_t &value) const = 0;
 
     //! @brief Attempts to read the value of a property as
     //! an unsigned 32-bit integer.
@@ -136,7 +158,7 @@ public:
     //! the appropriate type.
     //! @retval false The property either didn't exist, or the value could not
     //! be interpreted as an integer of appropriate size.
-    virtual bool tryRead(string_cref_t tag, uint32_t &value) const = 0;
+    virtual bool tryRead(const PropertyKey &tag, uint32_t &value) const = 0;
 
     //! @brief Attempts to read the value of a property as a signed 64-bit integer.
     //! @param[in] tag The identifier of the property to read.
@@ -146,7 +168,7 @@ public:
     //! the appropriate type.
     //! @retval false The property either didn't exist, or the value could not
     //! be interpreted as an integer of appropriate size.
-    virtual bool tryRead(string_cref_t tag, int64_t &value) const = 0;
+    virtual bool tryRead(const PropertyKey &tag, int64_t &value) const = 0;
 
     //! @brief Attempts to read the value of a property as
     //! an unsigned 64-bit integer.
@@ -157,7 +179,7 @@ public:
     //! the appropriate type.
     //! @retval false The property either didn't exist, or the value could not
     //! be interpreted as an integer of appropriate size.
-    virtual bool tryRead(string_cref_t tag, uint64_t &value) const = 0;
+    virtual bool tryRead(const PropertyKey &tag, uint64_t &value) const = 0;
 
     //! @brief Attempts to read the value of a property as
     //! a Unicode character.
@@ -168,7 +190,7 @@ public:
     //! the appropriate type.
     //! @retval false The property either didn't exist, or the value could not
     //! be interpreted as a character.
-    virtual bool tryRead(string_cref_t tag, char32_t &value) const = 0;
+    virtual bool tryRead(const PropertyKey &tag, char32_t &value) const = 0;
 
     //! @brief Attempts to read the value of a property as
     //! a 32-bit floating point value.
@@ -179,7 +201,7 @@ public:
     //! the appropriate type.
     //! @retval false The property either didn't exist, or the value could not
     //! be interpreted as a scalar of appropriate size.
-    virtual bool tryRead(string_cref_t tag, float &value) const = 0;
+    virtual bool tryRead(const PropertyKey &tag, float &value) const = 0;
 
     //! @brief Attempts to read the value of a property as
     //! a 64-bit floating point value.
@@ -190,7 +212,7 @@ public:
     //! the appropriate type.
     //! @retval false The property either didn't exist, or the value could not
     //! be interpreted as a scalar of appropriate size.
-    virtual bool tryRead(string_cref_t tag, double &value) const = 0;
+    virtual bool tryRead(const PropertyKey &tag, double &value) const = 0;
 
     //! @brief Attempts to read the string value of a property.
     //! @param[in] tag The identifier of the property to read.
@@ -199,7 +221,18 @@ public:
     //! @retval true The property existed and could be interpreted as a string.
     //! @retval false The property either didn't exist, or the value could not
     //! be interpreted as a string.
-    virtual bool tryRead(string_cref_t tag, String &value) const =0;
+    virtual bool tryRead(const PropertyKey &tag, String &value) const =0;
+
+    //! @brief Attempts to read the string value of a property without
+    //! copying it.
+    //! @param[in] tag The identifier of the property to read.
+    //! @param[out] value Receives a view of the UTF-8 encoded value, valid for
+    //! the lifetime of the hierarchy root, if the property existed and could
+    //! be interpreted as a string.
+    //! @retval true The property existed and could be interpreted as a string.
+    //! @retval false The property either didn't exist, or the value could not
+    //! be interpreted as a string.
+    virtual bool tryRead(const PropertyKey &tag, std::string_view &value) const = 0;
 
     //! @brief Attempts to read a property value which is a block of bytes.
     //! @param[in] tag The identifier of the property to read.
@@ -209,7 +242,19 @@ public:
     //! of bytes.
     //! @retval false The property either didn't exist, or the value could not
     //! be interpreted as a block of bytes.
-    virtual bool tryRead(string_cref_t tag, ByteBlock &value) const =0;
+    virtual bool tryRead(const PropertyKey &tag, ByteBlock &value) const =0;
+
+    //! @brief Attempts to access a property value which is a block of bytes
+    //! without copying it.
+    //! @param[in] tag The identifier of the property to read.
+    //! @param[out] value Receives a view of the bytes, valid for the lifetime
+    //! of the hierarchy root, on success.
+    //! @retval true The property existed, could be interpreted as a block
+    //! of bytes and was resident in memory.
+    //! @retval false The property either didn't exist, the value could not
+    //! be interpreted as a block of bytes, or the underlying data cannot be
+    //! accessed in place.
+    virtual bool tryRead(const PropertyKey &tag, ByteSpan &value) const = 0;
 
     //! @brief Attempts to read a property value which is a block of bytes.
     //! @param[in] tag The identifier of the property to read.
@@ -219,7 +264,7 @@ public:
     //! of bytes.
     //! @retval false The property either didn't exist, or the value could not
     //! be interpreted as a block of bytes.
-    virtual bool tryRead(string_cref_t tag, ISeekableStreamUPtr &value) const =0;
+    virtual bool tryRead(const PropertyKey &tag, ISeekableStreamUPtr &value) const =0;
 
     //! @brief Attempts to read a property as a nested object.
     //! @param[in] tag The identifier of the property to read.
@@ -230,7 +275,7 @@ public:
     //! a pointer to which was written to @p value.
     //! @retval false Either there were no more values in the array to read,
     //! or the next value could not be interpreted as an object.
-    virtual bool tryRead(string_cref_t tag, IObjectReader *&value) const = 0;
+    virtual bool tryRead(const PropertyKey &tag, IObjectReader *&value) const = 0;
 
     //! @brief Attempts to read a property as a nested array.
     //! @param[in] tag The identifier of the property to read.
@@ -241,7 +286,7 @@ public:
     //! a pointer to which was written to @p value.
     //! @retval false Either there were no more values in the array to read,
     //! or the next value could not be interpreted as an array.
-    virtual bool tryRead(string_cref_t tag, IArrayReader *&value) const = 0;
+    virtual bool tryRead(const PropertyKey &tag, IArrayReader *&value) const = 0;
 };
 
 //! @brief An interface to an object which can be used to serialize the
@@ -261,73 +306,73 @@ public:
     //! @brief Writes a boolean value as a named property.
     //! @param[in] tag The identifier of the property to write.
     //! @param[in] value The value of the bool to write.
-    virtual void write(string_cref_t tag, bool value) = 0;
+    virtual void write(const PropertyKey &tag, bool value) = 0;
 
     //! @brief Writes a signed 8-bit integer value as a named property.
     //! @param[in] tag The identifier of the property to write.
     //! @param[in] value The value to write.
-    virtual void write(string_cref_t tag, int8_t value) = 0;
+    virtual void write(const PropertyKey &tag, int8_t value) = 0;
 
     //! @brief Writes an unsigned 8-bit integer value as a named property.
     //! @param[in] tag The identifier of the property to write.
     //! @param[in] value The value to write.
-    virtual void write(string_cref_t tag, uint8_t value) = 0;
+    virtual void write(const PropertyKey &tag, uint8_t value) = 0;
 
     //! @brief Writes a signed 16-bit integer value as a named property.
     //! @param[in] tag The identifier of the property to write.
     //! @param[in] value The value to write.
-    virtual void write(string_cref_t tag, int16_t value) = 0;
+    virtual void write(const PropertyKey &tag, int16_t value) = 0;
 
     //! @brief Writes an unsigned 16-bit integer value as a named property.
     //! @param[in] tag The identifier of the property to write.
     //! @param[in] value The value to write.
-    virtual void write(string_cref_t tag, uint16_t value) = 0;
+    virtual void write(const PropertyKey &tag, uint16_t value) = 0;
 
     //! @brief Writes a signed 32-bit integer value as a named property.
     //! @param[in] tag The identifier of the property to write.
     //! @param[in] value The value to write.
-    virtual void write(string_cref_t tag, int32_t value) = 0;
+    virtual void write(const PropertyKey &tag, int32_t value) = 0;
 
     //! @brief Writes an unsigned 32-bit integer value as a named property.
     //! @param[in] tag The identifier of the property to write.
     //! @param[in] value The value to write.
-    virtual void write(string_cref_t tag, uint32_t value) = 0;
+    virtual void write(const PropertyKey &tag, uint32_t value) = 0;
 
     //! @brief Writes a signed 64-bit integer value as a named property.
     //! @param[in] tag The identifier of the property to write.
     //! @param[in] value The value to write.
-    virtual void write(string_cref_t tag, int64_t value) = 0;
+    virtual void write(const PropertyKey &tag, int64_t value) = 0;
 
     //! @brief Writes an unsigned 64-bit integer value as a named property.
     //! @param[in] tag The identifier of the property to write.
     //! @param[in] value The value to write.
-    virtual void write(string_cref_t tag, uint64_t value) = 0;
+    virtual void write(const PropertyKey &tag, uint64_t value) = 0;
 
     //! @brief Writes a Unicode character value as a named property.
     //! @param[in] tag The identifier of the property to write.
     //! @param[in] value The value to write.
-    virtual void write(string_cref_t tag, char32_t value) = 0;
+    virtual void write(const PropertyKey &tag, char32_t value) = 0;
 
     //! @brief Writes a 32-bit floating point value as a named property.
     //! @param[in] tag The identifier of the property to write.
     //! @param[in] value The value to write.
-    virtual void write(string_cref_t tag, float value) = 0;
+    virtual void write(const PropertyKey &tag, float value) = 0;
 
     //! @brief Writes a 64-bit floating point value as a named property.
     //! @param[in] tag The identifier of the property to write.
     //! @param[in] value The value to write.
-    virtual void write(string_cref_t tag, double value) = 0;
+    virtual void write(const PropertyKey &tag, double value) = 0;
 
     //! @brief Writes a string value as a named property.
     //! @param[in] tag The identifier of the property to write.
     //! @param[in] value The value of the string to write.
-    virtual void write(string_cref_t tag, string_cref_t value) = 0;
+    virtual void write(const PropertyKey &tag, string_cref_t value) = 0;
 
     //! @brief Writes a block of bytes as a named property.
     //! @param[in] tag The identifier of the property to write.
     //! @param[in] value A pointer to the first byte to write.
     //! @param[in] byteCount The count of bytes pointed to by @p value.
-    virtual void write(string_cref_t tag, const void *value, size_t byteCount) =0;
+    virtual void write(const PropertyKey &tag, const void *value, size_t byteCount) =0;
 
     //! @brief Begins writing a block of bytes as a named property.
     //! @param[in] tag The identifier used to retrieve the block during
@@ -335,7 +380,7 @@ public:
     //! @return A pointer to an IStream implementation used to write the bytes
     //! which the caller is responsible for disposing of, and must be disposed
     //! of before any more properties are written to the current object.
-    virtual IStreamUPtr beginWriteBytes(string_cref_t tag) =0;
+    virtual IStreamUPtr beginWriteBytes(const PropertyKey &tag) =0;
 
     //! @brief Begins writing a nested object as a named property.
     //! @param[in] tag The identifier used to retrieve the object during
@@ -343,7 +388,7 @@ public:
     //! @return A pointer to an object used to write the nested object which
     //! the caller is responsible for disposing of, and must be disposed of
     //! before any more properties are written to the current object.
-    virtual IObjectWriter *beginWriteObject(string_cref_t tag) = 0;
+    virtual IObjectWriter *beginWriteObject(const PropertyKey &tag) = 0;
 
     //! @brief Begins writing a nested array as a named property.
     //! @param[in] tag The identifier used to retrieve the array during
@@ -351,7 +396,7 @@ public:
     //! @return A pointer to an object used to write the nested array which
     //! the caller is responsible for disposing of, and must be disposed of
     //! before any more properties are written to the current object.
-    virtual IArrayWriter *beginWriteArray(string_cref_t tag) = 0;
+    virtual IArrayWriter *beginWriteArray(const PropertyKey &tag) = 0;
 };
 
 //! @brief An interface to an object which can access the elements of a
@@ -379,6 +424,16 @@ public:
     //! @retval false There were no more collection elements.
     virtual bool tryGetNextElementSize(StreamLength &elementSize) const = 0;
 
+    //! @brief Attempts to obtain the element type and length of the next
+    //! element to be read if it is a packed array.
+    //! @param[out] elementType Receives the data type of the packed elements.
+    //! @param[out] elementCount Receives the count of packed elements.
+    //! @retval true The next collection element is a packed array.
+    //! @retval false There were no more collection elements or the next
+    //! element was not a packed array.
+    virtual bool tryGetNextPackedArrayInfo(PackedElementType &elementType,
+                                           size_t &elementCount) const = 0;
+
     //! @brief Gets the count of elements in the collection.
     virtual StreamLength getElementCount() const = 0;
 
@@ -529,6 +584,16 @@ public:
     //! or the next value could not be interpreted as a string.
     virtual bool tryReadNext(String &value) =0;
 
+    //! @brief Attempts to read the next element of the array as a string
+    //! without copying it.
+    //! @param[out] value Receives a view of the UTF-8 encoded element, valid
+    //! for the lifetime of the hierarchy root, on success.
+    //! @retval true There was an element left to read and it could be
+    //! interpreted as a string. The view was written to @p value.
+    //! @retval false Either there were no more values in the array to read,
+    //! or the next value could not be interpreted as a string.
+    virtual bool tryReadNext(std::string_view &value) = 0;
+
     //! @brief Attempts to read the next element of the array as a
     //! block of bytes.
     //! @param[out] value Receives the value of the element on success.
@@ -538,6 +603,17 @@ public:
     //! or the next value could not be interpreted as a block of bytes.
     virtual bool tryReadNext(ByteBlock &value) =0;
 
+    //! @brief Attempts to access the next element of the array as a
+    //! block of bytes without copying it.
+    //! @param[out] value Receives a view of the bytes, valid for the lifetime
+    //! of the hierarchy root, on success.
+    //! @retval true There was an element left to read, it could be
+    //! interpreted as a block of bytes and was resident in memory.
+    //! @retval false Either there were no more values in the array to read,
+    //! the next value could not be interpreted as a block of bytes, or the
+    //! underlying data cannot be accessed in place.
+    virtual bool tryReadNext(ByteSpan &value) = 0;
+
     //! @brief Attempts to read the next element of the array as a
     //! block of bytes accessed via an IStream implementation.
     //! @param[out] value Receives the value of the element on success, which
@@ -567,6 +643,18 @@ public:
     //! @retval false Either there were no more values in the array to read,
     //! or the next value could not be interpreted as an array.
     virtual bool tryReadNext(IArrayReader *&value) = 0;
+
+    //! @brief Attempts to read the next value as a packed array.
+    //! @param[in] elementType The data type of the elements to read.
+    //! @param[out] elements A buffer to receive the elements in host byte order.
+    //! @param[in] elementCount The count of elements @p elements can hold,
+    //! which must match the length of the packed array exactly.
+    //! @retval true The next value was a packed array of @p elementCount
+    //! elements of @p elementType which were copied to @p elements.
+    //! @retval false Either there were no more values in the array to read,
+    //! or the next value was not a packed array of the expected type and length.
+    virtual bool tryReadNextPackedArray(PackedElementType elementType,
+                                        void *elements, size_t elementCount) = 0;
 };
 
 //! @brief An interface to an object which can be used to serialize the
@@ -658,6 +746,14 @@ public:
     //! the caller is responsible for disposing of, and must be disposed of
     //! before any more elements are written to the current array.
     virtual IArrayWriter *beginWriteArray() = 0;
+
+    //! @brief Writes an array of primitive values to the collection as a
+    //! single packed array element.
+    //! @param[in] elementType The data type of the elements.
+    //! @param[in] elements A pointer to the first element, in host byte order.
+    //! @param[in] elementCount The count of elements pointed to by @p elements.
+    virtual void writePackedArray(PackedElementType elementType,
+                                  const void *elements, size_t elementCount) = 0;
 };
 
 //! @brief An interface to an object which provides the root of a
@@ -686,6 +782,36 @@ using HierarchyRootPrivateSPtr = std::shared_ptr<HierarchyRootPrivate>;
 ////////////////////////////////////////////////////////////////////////////////
 // Templates
 ////////////////////////////////////////////////////////////////////////////////
+//! @brief Gets the packed array element type corresponding to a C++ type.
+//! @tparam T The data type of the array elements.
+//! @return The corresponding element type or PackedElementType::Max if
+//! @p T cannot be stored in a packed array.
+template<typename T>
+constexpr PackedElementType getPackedElementType()
+{
+    if constexpr (std::is_same_v<T, int8_t>)
+        return PackedElementType::Int8;
+    else if constexpr (std::is_same_v<T, uint8_t>)
+        return PackedElementType::Uint8;
+    else if constexpr (std::is_same_v<T, int16_t>)
+        return PackedElementType::Int16;
+    else if constexpr (std::is_same_v<T, uint16_t>)
+        return PackedElementType::Uint16;
+    else if constexpr (std::is_same_v<T, int32_t>)
+        return PackedElementType::Int32;
+    else if constexpr (std::is_same_v<T, uint32_t>)
+        return PackedElementType::Uint32;
+    else if constexpr (std::is_same_v<T, int64_t>)
+        return PackedElementType::Int64;
+    else if constexpr (std::is_same_v<T, uint64_t>)
+        return PackedElementType::Uint64;
+    else if constexpr (std::is_same_v<T, float>)
+        return PackedElementType::Float;
+    else if constexpr (std::is_same_v<T, double>)
+        return PackedElementType::Double;
+    else
+        return PackedElementType::Max;
+}
 
 }} // namespace Ag::IO
 
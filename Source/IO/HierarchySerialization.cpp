@@ -15,11 +15,172 @@
 #include "Ag/IO/BufferedInputStream.hpp"
 #include "Ag/IO/Exceptions.hpp"
 #include "Ag/IO/HierarchySerialization.hpp"
+#include "Ag/IO/SeekableFileStream.hpp"
 #include "BinaryReaderWriters.hpp"
 
 namespace Ag {
 namespace IO {
 
+namespace {
+////////////////////////////////////////////////////////////////////////////////
+// Local Data
+////////////////////////////////////////////////////////////////////////////////
+//! @brief The source of identifiers for hierarchies which resolve property keys.
+std::atomic<uint32_t> nextKeyScope(1);
+
+//! @brief Packs a hierarchy scope and a tag identifier into a key binding.
+constexpr uint64_t makeBinding(uint32_t scope, uint32_t id)
+{
+    return (static_cast<uint64_t>(scope) << 32) | id;
+}
+
+} // Anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+// PropertyKey Member Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Creates a key for a property tag.
+//! @param[in] tag The null-terminated UTF-8 text of the tag.
+PropertyKey::PropertyKey(utf8_cptr_t tag) :
+    _tag(tag),
+    _binding(0)
+{
+}
+
+//! @brief Creates a key for a property tag.
+//! @param[in] tag The UTF-8 text of the tag.
+PropertyKey::PropertyKey(const std::string &tag) :
+    _tag(tag),
+    _binding(0)
+{
+}
+
+//! @brief Creates a key for a property tag.
+//! @param[in] tag The text of the tag.
+PropertyKey::PropertyKey(string_cref_t tag) :
+    _tag(tag),
+    _binding(0)
+{
+}
+
+//! @brief Creates a copy of a key, including any resolved identifier.
+//! @param[in] rhs The key to copy.
+PropertyKey::PropertyKey(const PropertyKey &rhs) :
+    _tag(rhs._tag),
+    _binding(rhs._binding.load(std::memory_order_relaxed))
+{
+}
+
+//! @brief Gets the text of the tag the key identifies.
+string_cref_t PropertyKey::getTag() const
+{
+    return _tag;
+}
+
+//! @brief Attempts to get the identifier the tag was resolved to within a
+//! specific hierarchy.
+//! @param[in] scope The identifier of the hierarchy, as returned by
+//! allocateScope().
+//! @param[out] id Receives the identifier of the tag in the hierarchy, or
+//! NotFoundID if the tag was found not to be present.
+//! @retval true The key has been resolved against @p scope.
+//! @retval false The key has not been resolved against @p scope.
+bool PropertyKey::tryGetBinding(uint32_t scope, uint32_t &id) const
+{
+    uint64_t binding = _binding.load(std::memory_order_relaxed);
+
+    if (static_cast<uint32_t>(binding >> 32) != scope)
+        return false;
+
+    id = static_cast<uint32_t>(binding);
+    return true;
+}
+
+//! @brief Copies a key, including any resolved identifier.
+//! @param[in] rhs The key to copy.
+//! @return A reference to the updated key.
+PropertyKey &PropertyKey::operator=(const PropertyKey &rhs)
+{
+    if (this != &rhs)
+    {
+        _tag = rhs._tag;
+        _binding.store(rhs._binding.load(std::memory_order_relaxed),
+                       std::memory_order_relaxed);
+    }
+
+    return *this;
+}
+
+//! @brief Records the identifier the tag resolved to within a hierarchy.
+//! @param[in] scope The identifier of the hierarchy, as returned by
+//! allocateScope().
+//! @param[in] id The identifier of the tag within the hierarchy, or
+//! NotFoundID if it is not present.
+void PropertyKey::bind(uint32_t scope, uint32_t id) const
+{
+    _binding.store(makeBinding(scope, id), std::memory_order_relaxed);
+}
+
+//! @brief Allocates a unique identifier for a hierarchy which resolves
+//! property keys.
+//! @return A non-zero value which will not be returned again.
+uint32_t PropertyKey::allocateScope()
+{
+    uint32_t scope = nextKeyScope.fetch_add(1, std::memory_order_relaxed);
+
+    if (scope == 0)
+    {
+        // Skip the value which marks an unbound key after wrapping around.
+        scope = nextKeyScope.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return scope;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// SerializationOptions Member Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Constructs options which write an uncompressed hierarchy.
+SerializationOptions::SerializationOptions() :
+    ChunkSize(0),
+    ThreadCount(0),
+    Codec(CompressionCodecID::Bzip2),
+    Compress(false)
+{
+}
+
+//! @brief Constructs a set of serialization options.
+//! @param[in] compress True to compress the serialized data.
+//! @param[in] chunkSize The count of uncompressed payload bytes in each
+//! independently compressed chunk, or 0 to compress the payload as a single
+//! stream. The value is ignored if @p compress is false.
+//! @param[in] threadCount The count of threads used to compress chunks, 0 to
+//! use one per hardware thread.
+SerializationOptions::SerializationOptions(bool compress, size_t chunkSize /*= 0*/,
+                                           size_t threadCount /*= 0*/) :
+    ChunkSize(chunkSize),
+    ThreadCount(threadCount),
+    Codec(CompressionCodecID::Bzip2),
+    Compress(compress)
+{
+}
+
+//! @brief Constructs a set of options which compress the serialized data.
+//! @param[in] codec The algorithm used to compress the data.
+//! @param[in] chunkSize The count of uncompressed payload bytes in each
+//! independently compressed chunk, or 0 for the default behaviour of the codec.
+//! @param[in] threadCount The count of threads used to compress chunks, 0 to
+//! use one per hardware thread.
+SerializationOptions::SerializationOptions(CompressionCodecID codec,
+                                           size_t chunkSize /*= 0*/,
+                                           size_t threadCount /*= 0*/) :
+    ChunkSize(chunkSize),
+    ThreadCount(threadCount),
+    Codec(codec),
+    Compress(true)
+{
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // ObjectReader Member Definitions
 ////////////////////////////////////////////////////////////////////////////////
@@ -62,7 +223,7 @@ bool ObjectReader::isBound() const
 //! @retval true The object contains a serialized value for the property
 //! identified by @p tag.
 //! @retval false The object contains no properties matching @p tag.
-bool ObjectReader::hasProperty(string_cref_t tag) const
+bool ObjectReader::hasProperty(const PropertyKey &tag) const
 {
     return (_reader != nullptr) && _reader->hasProperty(tag);
 }
@@ -73,14 +234,14 @@ bool ObjectReader::hasProperty(string_cref_t tag) const
 //! @throws ObjectNotBoundException If the object is in an unbound state.
 //! @throws PropertyNotFoundException Thrown if the @p tag doesn't match
 //! any property in the object.
-StreamLength ObjectReader::getPropertySize(string_cref_t tag) const
+StreamLength ObjectReader::getPropertySize(const PropertyKey &tag) const
 {
     StreamLength propSize;
 
     if (verifyAccess("get property size")->tryGetPropertySize(tag, propSize))
         return propSize;
 
-    throw PropertyNotFoundException(tag);
+    throw PropertyNotFoundException(tag.getTag());
 }
 
 //! @brief Attempts to get the storage size of a named property.
@@ -90,7 +251,7 @@ StreamLength ObjectReader::getPropertySize(string_cref_t tag) const
 //! @retval true The property existed and @p propSize was updated with
 //! its size.
 //! @retval false The property could not be found.
-bool ObjectReader::tryGetPropertySize(string_cref_t tag,
+bool ObjectReader::tryGetPropertySize(const PropertyKey &tag,
                                        StreamLength &propSize) const
 {
     propSize = -1;
@@ -126,7 +287,7 @@ ObjectReader &ObjectReader::operator=(ObjectReader &&rhs) noexcept
 //! @retval true The property was found and could be interpreted as a bool.
 //! @retval false No property matching @p tag could be found, or it could, but
 //! it could not be interpreted as a bool.
-bool ObjectReader::tryRead(string_cref_t tag, bool &value) const
+bool ObjectReader::tryRead(const PropertyKey &tag, bool &value) const
 {
     value = false;
 
@@ -141,7 +302,7 @@ bool ObjectReader::tryRead(string_cref_t tag, bool &value) const
 //! @retval true The property was found and could be interpreted as a bool.
 //! @retval false No property matching @p tag could be found, or it could, but
 //! it could not be interpreted as an integer of appropriate size.
-bool ObjectReader::tryRead(string_cref_t tag, int8_t &value) const
+bool ObjectReader::tryRead(const PropertyKey &tag, int8_t &value) const
 {
     value = false;
 
@@ -156,7 +317,7 @@ bool ObjectReader::tryRead(string_cref_t tag, int8_t &value) const
 //! @retval true The property was found and could be interpreted as a bool.
 //! @retval false No property matching @p tag could be found, or it could, but
 //! it could not be interpreted as an integer of appropriate size.
-bool ObjectReader::tryRead(string_cref_t tag, uint8_t &value) const
+bool ObjectReader::tryRead(const PropertyKey &tag, uint8_t &value) const
 {
     value = false;
 
@@ -171,7 +332,7 @@ bool ObjectReader::tryRead(string_cref_t tag, uint8_t &value) const
 //! @retval true The property was found and could be interpreted as a bool.
 //! @retval false No property matching @p tag could be found, or it could, but
 //! it could not be interpreted as an integer of appropriate size.
-bool ObjectReader::tryRead(string_cref_t tag, int16_t &value) const
+bool ObjectReader::tryRead(const PropertyKey &tag, int16_t &value) const
 {
     value = false;
 
@@ -186,7 +347,7 @@ bool ObjectReader::tryRead(string_cref_t tag, int16_t &value) const
 //! @retval true The property was found and could be interpreted as a bool.
 //! @retval false No property matching @p tag could be found, or it could, but
 //! it could not be interpreted as an integer of appropriate size.
-bool ObjectReader::tryRead(string_cref_t tag, uint16_t &value) const
+bool ObjectReader::tryRead(const PropertyKey &tag, uint16_t &value) const
 {
     value = false;
 
@@ -201,7 +362,7 @@ bool ObjectReader::tryRead(string_cref_t tag, uint16_t &value) const
 //! @retval true The property was found and could be interpreted as a bool.
 //! @retval false No property matching @p tag could be found, or it could, but
 //! it could not be interpreted as an integer of appropriate size.
-bool ObjectReader::tryRead(string_cref_t tag, int32_t &value) const
+bool ObjectReader::tryRead(const PropertyKey &tag, int32_t &value) const
 {
     value = false;
 
@@ -216,7 +377,7 @@ bool ObjectReader::tryRead(string_cref_t tag, int32_t &value) const
 //! @retval true The property was found and could be interpreted as a bool.
 //! @retval false No property matching @p tag could be found, or it could, but
 //! it could not be interpreted as an integer of appropriate size.
-bool ObjectReader::tryRead(string_cref_t tag, uint32_t &value) const
+bool ObjectReader::tryRead(const PropertyKey &tag, uint32_t &value) const
 {
     value = false;
 
@@ -231,7 +392,7 @@ bool ObjectReader::tryRead(string_cref_t tag, uint32_t &value) const
 //! @retval true The property was found and could be interpreted as a bool.
 //! @retval false No property matching @p tag could be found, or it could, but
 //! it could not be interpreted as an integer of appropriate size.
-bool ObjectReader::tryRead(string_cref_t tag, int64_t &value) const
+bool ObjectReader::tryRead(const PropertyKey &tag, int64_t &value) const
 {
     value = false;
 
@@ -246,7 +407,7 @@ bool ObjectReader::tryRead(string_cref_t tag, int64_t &value) const
 //! @retval true The property was found and could be interpreted as a bool.
 //! @retval false No property matching @p tag could be found, or it could, but
 //! it could not be interpreted as an integer of appropriate size.
-bool ObjectReader::tryRead(string_cref_t tag, uint64_t &value) const
+bool ObjectReader::tryRead(const PropertyKey &tag, uint64_t &value) const
 {
     value = false;
 
@@ -261,7 +422,7 @@ bool ObjectReader::tryRead(string_cref_t tag, uint64_t &value) const
 //! @retval true The property was found and could be interpreted as a bool.
 //! @retval false No property matching @p tag could be found, or it could, but
 //! it could not be interpreted as a character.
-bool ObjectReader::tryRead(string_cref_t tag, char32_t &value) const
+bool ObjectReader::tryRead(const PropertyKey &tag, char32_t &value) const
 {
     value = false;
 
@@ -276,7 +437,7 @@ bool ObjectReader::tryRead(string_cref_t tag, char32_t &value) const
 //! @retval true The property was found and could be interpreted as a bool.
 //! @retval false No property matching @p tag could be found, or it could, but
 //! it could not be interpreted as a real scalar of appropriate size.
-bool ObjectReader::tryRead(string_cref_t tag, float &value) const
+bool ObjectReader::tryRead(const PropertyKey &tag, float &value) const
 {
     value = false;
 
@@ -291,7 +452,7 @@ bool ObjectReader::tryRead(string_cref_t tag, float &value) const
 //! @retval true The property was found and could be interpreted as a bool.
 //! @retval false No property matching @p tag could be found, or it could, but
 //! it could not be interpreted as a real scalar of appropriate size.
-bool ObjectReader::tryRead(string_cref_t tag, double &value) const
+bool ObjectReader::tryRead(const PropertyKey &tag, double &value) const
 {
     value = false;
 
@@ -305,7 +466,7 @@ bool ObjectReader::tryRead(string_cref_t tag, double &value) const
 //! @retval true The property was found and could be interpreted as a string.
 //! @retval false No property matching @p tag could be found, or it could, but
 //! it could not be interpreted as a string.
-bool ObjectReader::tryRead(string_cref_t tag, Ag::String &value) const
+bool ObjectReader::tryRead(const PropertyKey &tag, Ag::String &value) const
 {
     value = String::Empty;
 
@@ -313,6 +474,22 @@ bool ObjectReader::tryRead(string_cref_t tag, Ag::String &value) const
            _reader->tryRead(tag, value);
 }
 
+//! @brief Attempts to read a serialized string property from the object
+//! without copying it.
+//! @param[in] tag The identifier of the property to read.
+//! @param[out] value Receives a view of the UTF-8 encoded value on success,
+//! which remains valid for the lifetime of the HierarchyRoot.
+//! @retval true The property was found and could be interpreted as a string.
+//! @retval false No property matching @p tag could be found, or it could, but
+//! it could not be interpreted as a string.
+bool ObjectReader::tryRead(const PropertyKey &tag, std::string_view &value) const
+{
+    value = std::string_view();
+
+    return (_reader != nullptr) &&
+           _reader->tryRead(tag, value);
+}
+
 //! @brief Attempts to read a byte block property from the object.
 //! @param[in] tag The identifier of the property to read.
 //! @param[out] value Receives the block of bytes the property contains
@@ -321,12 +498,30 @@ bool ObjectReader::tryRead(string_cref_t tag, Ag::String &value) const
 //! of bytes.
 //! @retval false No property matching @p tag could be found, or it could, but
 //! it could not be interpreted as a block of bytes.
-bool ObjectReader::tryRead(string_cref_t tag, ByteBlock &value) const
+bool ObjectReader::tryRead(const PropertyKey &tag, ByteBlock &value) const
 {
     return (_reader != nullptr) &&
            _reader->tryRead(tag, value);
 }
 
+//! @brief Attempts to access a byte block property from the object without
+//! copying it.
+//! @param[in] tag The identifier of the property to read.
+//! @param[out] value Receives a view of the bytes on success, which remains
+//! valid for the lifetime of the HierarchyRoot.
+//! @retval true The property was found, could be interpreted as a block
+//! of bytes and could be accessed in place.
+//! @retval false No property matching @p tag could be found, it could not be
+//! interpreted as a block of bytes, or the hierarchy data was not resident in
+//! memory, in which case the ByteBlock overload should be used.
+bool ObjectReader::tryRead(const PropertyKey &tag, ByteSpan &value) const
+{
+    value = ByteSpan();
+
+    return (_reader != nullptr) &&
+           _reader->tryRead(tag, value);
+}
+
 //! @brief Attempts to read a stream block property from the object.
 //! @param[in] tag The identifier of the property to read.
 //! @param[out] value Receives a stream to access the field bytes on success.
@@ -334,7 +529,7 @@ bool ObjectReader::tryRead(string_cref_t tag, ByteBlock &value) const
 //! of bytes.
 //! @retval false No property matching @p tag could be found, or it could, but
 //! it could not be interpreted as a block of bytes.
-bool ObjectReader::tryRead(string_cref_t tag, ISeekableStreamUPtr &value) const
+bool ObjectReader::tryRead(const PropertyKey &tag, ISeekableStreamUPtr &value) const
 {
     value.reset();
 
@@ -348,7 +543,7 @@ bool ObjectReader::tryRead(string_cref_t tag, ISeekableStreamUPtr &value) const
 //! @retval true The property was found and could be interpreted as an object.
 //! @retval false No property matching @p tag could be found, or it could, but
 //! it could not be interpreted as an object.
-bool ObjectReader::tryRead(string_cref_t tag, ObjectReader &value) const
+bool ObjectReader::tryRead(const PropertyKey &tag, ObjectReader &value) const
 {
     IObjectReader *reader = nullptr;
 
@@ -370,7 +565,7 @@ bool ObjectReader::tryRead(string_cref_t tag, ObjectReader &value) const
 //! @retval true The property was found and could be interpreted as an array.
 //! @retval false No property matching @p tag could be found, or it could, but
 //! it could not be interpreted as an array.
-bool ObjectReader::tryRead(string_cref_t tag, ArrayReader &value) const
+bool ObjectReader::tryRead(const PropertyKey &tag, ArrayReader &value) const
 {
     IArrayReader *reader = nullptr;
 
@@ -393,7 +588,7 @@ bool ObjectReader::tryRead(string_cref_t tag, ArrayReader &value) const
 //! @throws PropertyNotFoundException If the property does not exist.
 //! @throws PropertyTypeException If the property cannot be interpreted as
 //! a bool.
-bool ObjectReader::readBool(string_cref_t tag) const
+bool ObjectReader::readBool(const PropertyKey &tag) const
 {
     return read<bool>(tag, "boolean");
 }
@@ -405,7 +600,7 @@ bool ObjectReader::readBool(string_cref_t tag) const
 //! @throws PropertyNotFoundException If the property does not exist.
 //! @throws PropertyTypeException If the property cannot be interpreted as
 //! an integer of appropriate size.
-int8_t ObjectReader::readInt8(string_cref_t tag) const
+int8_t ObjectReader::readInt8(const PropertyKey &tag) const
 {
     return read<int8_t>(tag, "signed 8-bit integer");
 }
@@ -417,7 +612,7 @@ int8_t ObjectReader::readInt8(string_cref_t tag) const
 //! @throws PropertyNotFoundException If the property does not exist.
 //! @throws PropertyTypeException If the property cannot be interpreted as
 //! an integer of appropriate size.
-uint8_t ObjectReader::readUint8(string_cref_t tag) const
+uint8_t ObjectReader::readUint8(const PropertyKey &tag) const
 {
     return read<uint8_t>(tag, "unsigned 8-bit integer");
 }
@@ -429,7 +624,7 @@ uint8_t ObjectReader::readUint8(string_cref_t tag) const
 //! @throws PropertyNotFoundException If the property does not exist.
 //! @throws PropertyTypeException If the property cannot be interpreted as
 //! an integer of appropriate size.
-int16_t ObjectReader::readInt16(string_cref_t tag) const
+int16_t ObjectReader::readInt16(const PropertyKey &tag) const
 {
     return read<int16_t>(tag, "signed 16-bit integer");
 }
@@ -441,7 +636,7 @@ int16_t ObjectReader::readInt16(string_cref_t tag) const
 //! @throws PropertyNotFoundException If the property does not exist.
 //! @throws PropertyTypeException If the property cannot be interpreted as
 //! an integer of appropriate size.
-uint16_t ObjectReader::readUint16(string_cref_t tag) const
+uint16_t ObjectReader::readUint16(const PropertyKey &tag) const
 {
     return read<uint16_t>(tag, "unsigned 16-bit integer");
 }
@@ -453,7 +648,7 @@ uint16_t ObjectReader::readUint16(string_cref_t tag) const
 //! @throws PropertyNotFoundException If the property does not exist.
 //! @throws PropertyTypeException If the property cannot be interpreted as
 //! an integer of appropriate size.
-int32_t ObjectReader::readInt32(string_cref_t tag) const
+int32_t ObjectReader::readInt32(const PropertyKey &tag) const
 {
     return read<int32_t>(tag, "signed 32-bit integer");
 }
@@ -465,7 +660,7 @@ int32_t ObjectReader::readInt32(string_cref_t tag) const
 //! @throws PropertyNotFoundException If the property does not exist.
 //! @throws PropertyTypeException If the property cannot be interpreted as
 //! an integer of appropriate size.
-uint32_t ObjectReader::readUint32(string_cref_t tag) const
+uint32_t ObjectReader::readUint32(const PropertyKey &tag) const
 {
     return read<uint32_t>(tag, "unsigned 32-bit integer");
 }
@@ -477,7 +672,7 @@ uint32_t ObjectReader::readUint32(string_cref_t tag) const
 //! @throws PropertyNotFoundException If the property does not exist.
 //! @throws PropertyTypeException If the property cannot be interpreted as
 //! an integer of appropriate size.
-int64_t ObjectReader::readInt64(string_cref_t tag) const
+int64_t ObjectReader::readInt64(const PropertyKey &tag) const
 {
     return read<int64_t>(tag, "signed 64-bit integer");
 }
@@ -489,7 +684,7 @@ int64_t ObjectReader::readInt64(string_cref_t tag) const
 //! @throws PropertyNotFoundException If the property does not exist.
 //! @throws PropertyTypeException If the property cannot be interpreted as
 //! an integer of appropriate size.
-uint64_t ObjectReader::readUint64(string_cref_t tag) const
+uint64_t ObjectReader::readUint64(const PropertyKey &tag) const
 {
     return read<uint64_t>(tag, "unsigned 64-bit integer");
 }
@@ -501,7 +696,7 @@ uint64_t ObjectReader::readUint64(string_cref_t tag) const
 //! @throws PropertyNotFoundException If the property does not exist.
 //! @throws PropertyTypeException If the property cannot be interpreted as
 //! character.
-char32_t ObjectReader::readChar(string_cref_t tag) const
+char32_t ObjectReader::readChar(const PropertyKey &tag) const
 {
     return read<char32_t>(tag, "character");
 }
@@ -514,7 +709,7 @@ char32_t ObjectReader::readChar(string_cref_t tag) const
 //! @throws PropertyNotFoundException If the property does not exist.
 //! @throws PropertyTypeException If the property cannot be interpreted as
 //! a scalar.
-float ObjectReader::readFloat(string_cref_t tag) const
+float ObjectReader::readFloat(const PropertyKey &tag) const
 {
     return read<float>(tag, "float");
 }
@@ -527,7 +722,7 @@ float ObjectReader::readFloat(string_cref_t tag) const
 //! @throws PropertyNotFoundException If the property does not exist.
 //! @throws PropertyTypeException If the property cannot be interpreted as
 //! a scalar.
-double ObjectReader::readDouble(string_cref_t tag) const
+double ObjectReader::readDouble(const PropertyKey &tag) const
 {
     return read<double>(tag, "double");
 }
@@ -539,29 +734,56 @@ double ObjectReader::readDouble(string_cref_t tag) const
 //! @throws PropertyNotFoundException If the property does not exist.
 //! @throws PropertyTypeException If the property cannot be interpreted as
 //! a string.
-String ObjectReader::readString(string_cref_t tag) const
+String ObjectReader::readString(const PropertyKey &tag) const
 {
     return read<String>(tag, "string");
 }
 
+//! @brief Reads a serialized string property from the object without
+//! copying it.
+//! @param[in] tag The identifier of the property to read.
+//! @return A view of the UTF-8 encoded property value which remains valid
+//! for the lifetime of the HierarchyRoot.
+//! @throws ObjectNotBoundException If the object is in an unbound state.
+//! @throws PropertyNotFoundException If the property does not exist.
+//! @throws PropertyTypeException If the property cannot be interpreted as
+//! a string.
+std::string_view ObjectReader::readStringView(const PropertyKey &tag) const
+{
+    return read<std::string_view>(tag, "string");
+}
+
 //! @brief Reads a property encoded with a block of bytes.
 //! @return The property value.
 //! @throws ObjectNotBoundException If the object is in an unbound state.
 //! @throws PropertyNotFoundException If the property does not exist.
 //! @throws PropertyTypeException If the property cannot be interpreted as
 //! a block of bytes.
-ByteBlock ObjectReader::readBytes(string_cref_t tag) const
+ByteBlock ObjectReader::readBytes(const PropertyKey &tag) const
 {
     return read<ByteBlock>(tag, "bytes");
 }
 
+//! @brief Accesses a property encoded with a block of bytes without
+//! copying it.
+//! @return A view of the property value which remains valid for the lifetime
+//! of the HierarchyRoot.
+//! @throws ObjectNotBoundException If the object is in an unbound state.
+//! @throws PropertyNotFoundException If the property does not exist.
+//! @throws PropertyTypeException If the property cannot be interpreted as
+//! a block of bytes, or cannot be accessed in place.
+ByteSpan ObjectReader::readBytesView(const PropertyKey &tag) const
+{
+    return read<ByteSpan>(tag, "bytes view");
+}
+
 //! @brief Reads a property encoded with a stream of bytes.
 //! @return A stream used to access the bytes of the field.
 //! @throws ObjectNotBoundException If the object is in an unbound state.
 //! @throws PropertyNotFoundException If the property does not exist.
 //! @throws PropertyTypeException If the property cannot be interpreted as
 //! a block of bytes.
-ISeekableStreamUPtr ObjectReader::readBytesStream(string_cref_t tag) const
+ISeekableStreamUPtr ObjectReader::readBytesStream(const PropertyKey &tag) const
 {
     return read<ISeekableStreamUPtr>(tag, "bytes");
 }
@@ -575,7 +797,7 @@ ISeekableStreamUPtr ObjectReader::readBytesStream(string_cref_t tag) const
 //! a pointer to which was written to @p value.
 //! @retval false Either there were no more values in the array to read,
 //! or the next value could not be interpreted as an object.
-ObjectReader ObjectReader::readObject(string_cref_t tag) const
+ObjectReader ObjectReader::readObject(const PropertyKey &tag) const
 {
     IObjectReader *nestedReader = read<IObjectReader *>(tag, "nested object");
 
@@ -591,7 +813,7 @@ ObjectReader ObjectReader::readObject(string_cref_t tag) const
 //! a pointer to which was written to @p value.
 //! @retval false Either there were no more values in the array to read,
 //! or the next value could not be interpreted as an array.
-ArrayReader ObjectReader::readArray(string_cref_t tag) const
+ArrayReader ObjectReader::readArray(const PropertyKey &tag) const
 {
     IArrayReader *nestedReader = read<IArrayReader *>(tag, "nested object");
 
@@ -676,7 +898,7 @@ ObjectWriter &ObjectWriter::operator=(ObjectWriter &&rhs) noexcept
 //! @brief Writes a boolean property to the serialized object.
 //! @param[in] tag The tag identifying the property being written.
 //! @param[in] value The value of the property to write.
-void ObjectWriter::write(string_cref_t tag, bool value)
+void ObjectWriter::write(const PropertyKey &tag, bool value)
 {
     verifyAccess("write bool")->write(tag, value);
 }
@@ -684,7 +906,7 @@ void ObjectWriter::write(string_cref_t tag, bool value)
 //! @brief Writes a signed 8-bit integer property to the serialized object.
 //! @param[in] tag The tag identifying the property being written.
 //! @param[in] value The value of the property to write.
-void ObjectWriter::write(string_cref_t tag, int8_t value)
+void ObjectWriter::write(const PropertyKey &tag, int8_t value)
 {
     verifyAccess("write signed 8-bit integer")->write(tag, value);
 }
@@ -692,7 +914,7 @@ void ObjectWriter::write(string_cref_t tag, int8_t value)
 //! @brief Writes an unsigned 8-bit integer property to the serialized object.
 //! @param[in] tag The tag identifying the property being written.
 //! @param[in] value The value of the property to write.
-void ObjectWriter::write(string_cref_t tag, uint8_t value)
+void ObjectWriter::write(const PropertyKey &tag, uint8_t value)
 {
     verifyAccess("write unsigned 8-bit integer")->write(tag, value);
 }
@@ -700,7 +922,7 @@ void ObjectWriter::write(string_cref_t tag, uint8_t value)
 //! @brief Writes a signed 16-bit integer property to the serialized object.
 //! @param[in] tag The tag identifying the property being written.
 //! @param[in] value The value of the property to write.
-void ObjectWriter::write(string_cref_t tag, int16_t value)
+void ObjectWriter::write(const PropertyKey &tag, int16_t value)
 {
     verifyAccess("write signed 16-bit integer")->write(tag, value);
 }
@@ -708,7 +930,7 @@ void ObjectWriter::write(string_cref_t tag, int16_t value)
 //! @brief Writes an unsigned 16-bit integer property to the serialized object.
 //! @param[in] tag The tag identifying the property being written.
 //! @param[in] value The value of the property to write.
-void ObjectWriter::write(string_cref_t tag, uint16_t value)
+void ObjectWriter::write(const PropertyKey &tag, uint16_t value)
 {
     verifyAccess("write unsigned 16-bit integer")->write(tag, value);
 }
@@ -716,7 +938,7 @@ void ObjectWriter::write(string_cref_t tag, uint16_t value)
 //! @brief Writes a signed 32-bit integer property to the serialized object.
 //! @param[in] tag The tag identifying the property being written.
 //! @param[in] value The value of the property to write.
-void ObjectWriter::write(string_cref_t tag, int32_t value)
+void ObjectWriter::write(const PropertyKey &tag, int32_t value)
 {
     verifyAccess("write signed 32-bit integer")->write(tag, value);
 }
@@ -724,7 +946,7 @@ void ObjectWriter::write(string_cref_t tag, int32_t value)
 //! @brief Writes an unsigned 32-bit integer property to the serialized object.
 //! @param[in] tag The tag identifying the property being written.
 //! @param[in] value The value of the property to write.
-void ObjectWriter::write(string_cref_t tag, uint32_t value)
+void ObjectWriter::write(const PropertyKey &tag, uint32_t value)
 {
     verifyAccess("write unsigned 32-bit integer")->write(tag, value);
 }
@@ -732,7 +954,7 @@ void ObjectWriter::write(string_cref_t tag, uint32_t value)
 //! @brief Writes a signed 64-bit integer property to the serialized object.
 //! @param[in] tag The tag identifying the property being written.
 //! @param[in] value The value of the property to write.
-void ObjectWriter::write(string_cref_t tag, int64_t value)
+void ObjectWriter::write(const PropertyKey &tag, int64_t value)
 {
     verifyAccess("write signed 64-bit integer")->write(tag, value);
 }
@@ -740,7 +962,7 @@ void ObjectWriter::write(string_cref_t tag, int64_t value)
 //! @brief Writes an unsigned 64-bit integer property to the serialized object.
 //! @param[in] tag The tag identifying the property being written.
 //! @param[in] value The value of the property to write.
-void ObjectWriter::write(string_cref_t tag, uint64_t value)
+void ObjectWriter::write(const PropertyKey &tag, uint64_t value)
 {
     verifyAccess("write unsigned 64-bit integer")->write(tag, value);
 }
@@ -748,7 +970,7 @@ void ObjectWriter::write(string_cref_t tag, uint64_t value)
 //! @brief Writes a Unicode character property to the serialized object.
 //! @param[in] tag The tag identifying the property being written.
 //! @param[in] value The value of the property to write.
-void ObjectWriter::write(string_cref_t tag, char32_t value)
+void ObjectWriter::write(const PropertyKey &tag, char32_t value)
 {
     verifyAccess("write character")->write(tag, value);
 }
@@ -756,7 +978,7 @@ void ObjectWriter::write(string_cref_t tag, char32_t value)
 //! @brief Writes a 32-bit floating point property to the serialized object.
 //! @param[in] tag The tag identifying the property being written.
 //! @param[in] value The value of the property to write.
-void ObjectWriter::write(string_cref_t tag, float value)
+void ObjectWriter::write(const PropertyKey &tag, float value)
 {
     verifyAccess("write float")->write(tag, value);
 }
@@ -764,7 +986,7 @@ void ObjectWriter::write(string_cref_t tag, float value)
 //! @brief Writes a 64-bit floating point property to the serialized object.
 //! @param[in] tag The tag identifying the property being written.
 //! @param[in] value The value of the property to write.
-void ObjectWriter::write(string_cref_t tag, double value)
+void ObjectWriter::write(const PropertyKey &tag, double value)
 {
     verifyAccess("write double")->write(tag, value);
 }
@@ -772,7 +994,7 @@ void ObjectWriter::write(string_cref_t tag, double value)
 //! @brief Writes a string property to the serialized object.
 //! @param[in] tag The tag identifying the property being written.
 //! @param[in] value The value of the property to write.
-void ObjectWriter::write(string_cref_t tag, string_cref_t value)
+void ObjectWriter::write(const PropertyKey &tag, string_cref_t value)
 {
     verifyAccess("write string")->write(tag, value);
 }
@@ -781,7 +1003,7 @@ void ObjectWriter::write(string_cref_t tag, string_cref_t value)
 //! @param[in] tag The tag identifying the property being written.
 //! @param[in] value A pointer to the first byte to be written.
 //! @param[in] byteCount The count of bytes pointed to by @p value.
-void ObjectWriter::write(string_cref_t tag, const void *value, size_t byteCount)
+void ObjectWriter::write(const PropertyKey &tag, const void *value, size_t byteCount)
 {
     verifyAccess("write bytes")->write(tag, value, byteCount);
 }
@@ -792,7 +1014,7 @@ void ObjectWriter::write(string_cref_t tag, const void *value, size_t byteCount)
 //! @return An stream used to write bytes to which the caller is responsible
 //! for disposing of, and must be disposed of before any more properties are
 //! written to the current object.
-IStreamUPtr ObjectWriter::beginWriteBytes(string_cref_t tag)
+IStreamUPtr ObjectWriter::beginWriteBytes(const PropertyKey &tag)
 {
     return verifyAccess("write byte stream")->beginWriteBytes(tag);
 }
@@ -803,7 +1025,7 @@ IStreamUPtr ObjectWriter::beginWriteBytes(string_cref_t tag)
 //! @return An object used to write the nested object which
 //! the caller is responsible for disposing of, and must be disposed of
 //! before any more properties are written to the current object.
-ObjectWriter ObjectWriter::beginWriteObject(string_cref_t tag)
+ObjectWriter ObjectWriter::beginWriteObject(const PropertyKey &tag)
 {
     return { verifyAccess("write nested object")->beginWriteObject(tag) };
 }
@@ -814,7 +1036,7 @@ ObjectWriter ObjectWriter::beginWriteObject(string_cref_t tag)
 //! @return A pointer to an object used to write the nested array which
 //! the caller is responsible for disposing of, and must be disposed of
 //! before any more properties are written to the current object.
-ArrayWriter ObjectWriter::beginWriteArray(string_cref_t tag)
+ArrayWriter ObjectWriter::beginWriteArray(const PropertyKey &tag)
 {
     return { verifyAccess("write nested array")->beginWriteArray(tag) };
 }
@@ -1115,6 +1337,19 @@ bool ArrayReader::tryReadNext(String &value)
     return (_reader != nullptr) && _reader->tryReadNext(value);
 }
 
+//! @brief Attempts to read the next element of the array as a string without
+//! copying it.
+//! @param[out] value Receives a view of the UTF-8 encoded element on success,
+//! which remains valid for the lifetime of the HierarchyRoot.
+//! @retval true There was an element left to read and it could be
+//! interpreted as a string. The view was written to @p value.
+//! @retval false Either there were no move values in the array to read,
+//! or the next value could not be interpreted as a string.
+bool ArrayReader::tryReadNext(std::string_view &value)
+{
+    return (_reader != nullptr) && _reader->tryReadNext(value);
+}
+
 //! @brief Attempts to read the next element of the array as a block of bytes.
 //! @param[out] value The value of the element on success.
 //! @retval true There was an element left to read and it could be
@@ -1126,6 +1361,20 @@ bool ArrayReader::tryReadNext(ByteBlock &value)
     return (_reader != nullptr) && _reader->tryReadNext(value);
 }
 
+//! @brief Attempts to access the next element of the array as a block of
+//! bytes without copying it.
+//! @param[out] value Receives a view of the element on success, which remains
+//! valid for the lifetime of the HierarchyRoot.
+//! @retval true There was an element left to read, it could be interpreted
+//! as a block of bytes and could be accessed in place.
+//! @retval false Either there were no move values in the array to read,
+//! the next value could not be interpreted as a block of bytes, or the
+//! hierarchy data was not resident in memory.
+bool ArrayReader::tryReadNext(ByteSpan &value)
+{
+    return (_reader != nullptr) && _reader->tryReadNext(value);
+}
+
 //! @brief Attempts to read the next element as a stream of bytes.
 //! @param[out] value Receives a new stream on success.
 //! @retval true There was an element left to read and it could be
@@ -1300,6 +1549,16 @@ String ArrayReader::readNextString()
     return readNext<String>("string");
 }
 
+//! @brief Reads the next element of the array as a string without copying it.
+//! @return A view of the UTF-8 encoded element which remains valid for the
+//! lifetime of the HierarchyRoot.
+//! @throws DataFormatException If there are no more elements available or
+//! the next element cannot be interpreted as a string.
+std::string_view ArrayReader::readNextStringView()
+{
+    return readNext<std::string_view>("string");
+}
+
 //! @brief Reads the next element of the array as a block of bytes.
 //! @return The next element as a block of bytes.
 //! @throws DataFormatException If there are no more elements available or
@@ -1309,6 +1568,18 @@ ByteBlock ArrayReader::readNextBytes()
     return readNext<ByteBlock>("bytes");
 }
 
+//! @brief Accesses the next element of the array as a block of bytes without
+//! copying it.
+//! @return A view of the element which remains valid for the lifetime of the
+//! HierarchyRoot.
+//! @throws DataFormatException If there are no more elements available or
+//! the next element cannot be interpreted as a block of bytes, or cannot be
+//! accessed in place.
+ByteSpan ArrayReader::readNextBytesView()
+{
+    return readNext<ByteSpan>("bytes view");
+}
+
 //! @brief Reads the next element as a stream of bytes.
 //! @return A stream used to read the bytes of the element.
 ISeekableStreamUPtr ArrayReader::readNextByteStream()
@@ -1591,6 +1862,28 @@ HierarchyRoot::HierarchyRoot(IStream *input)
     _root = binaryRoot;
 }
 
+//! @brief Reads an object hierarchy stored in a file.
+//! @param[in] fileName The path to the file containing the serialized data.
+//! @remarks If the payload of the hierarchy is uncompressed, it is mapped
+//! into memory rather than read, so that opening even a very large file is
+//! quick and string and byte values can be accessed without copying them.
+//! Compressed sections are decompressed as they would be from a stream.
+HierarchyRoot::HierarchyRoot(const Fs::Path &fileName)
+{
+    ISeekableStreamUPtr file = SeekableFileStream::open(fileName,
+                                                        FileAccess::Read |
+                                                        FileAccess::OpenExisting);
+
+    BinaryStreamHeader header;
+
+    if (header.tryRead(file.get()) == false)
+        throw IOException("Failed to read binary hierarchy stream header.");
+
+    header.validate();
+
+    _root = std::make_shared<BinaryHierarchyRoot>(header, fileName, file.get());
+}
+
 //! @brief Ensures all resident deserialized data is disposed of.
 HierarchyRoot::~HierarchyRoot()
 {
@@ -1661,7 +1954,18 @@ ArrayReader HierarchyRoot::getRootArray()
 //! which will be written to @p output when the object is destroyed.
 ArrayWriter beginSerializeArray(ISeekableStream *output, bool compress)
 {
-    return ArrayWriter(new BinaryArrayWriter(output, compress));
+    return ArrayWriter(new BinaryArrayWriter(output, SerializationOptions(compress)));
+}
+
+//! @brief Constructs an object to write an array of elements to an output stream.
+//! @param[in] output The output stream to write the elements to.
+//! @param[in] options Options controlling how the data is encoded.
+//! @return An object used to write the array elements, the binary encoding of
+//! which will be written to @p output when the object is destroyed.
+ArrayWriter beginSerializeArray(ISeekableStream *output,
+                                const SerializationOptions &options)
+{
+    return ArrayWriter(new BinaryArrayWriter(output, options));
 }
 
 //! @brief Constructs an object to write an set of named properties output stream.
@@ -1672,7 +1976,18 @@ ArrayWriter beginSerializeArray(ISeekableStream *output, bool compress)
 //! which will be written to @p output when the object is destroyed.
 ObjectWriter beginSerializeObject(ISeekableStream *output, bool compress)
 {
-    return ObjectWriter(new BinaryObjectWriter(output, compress));
+    return ObjectWriter(new BinaryObjectWriter(output, SerializationOptions(compress)));
+}
+
+//! @brief Constructs an object to write an set of named properties output stream.
+//! @param[in] output The output stream to write the elements to.
+//! @param[in] options Options controlling how the data is encoded.
+//! @return An object used to write the property set, the binary encoding of
+//! which will be written to @p output when the object is destroyed.
+ObjectWriter beginSerializeObject(ISeekableStream *output,
+                                  const SerializationOptions &options)
+{
+    return ObjectWriter(new BinaryObjectWriter(output, options));
 }
 
 }} // namespace Ag::IO
@@ -0,0 +1,743 @@
+//! @file IO/HierarchyVisitor.cpp
+//! @brief The definition of an object which receives the contents of a
+//! serialized hierarchy as a forward-only sequence of events.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Header File Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "Ag/IO/BufferedInputStream.hpp"
+#include "Ag/IO/Exceptions.hpp"
+#include "Ag/IO/HierarchyVisitor.hpp"
+#include "BinaryHierarchyEncoding.hpp"
+
+namespace Ag {
+namespace IO {
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Data
+////////////////////////////////////////////////////////////////////////////////
+//! @brief The count of bytes read from the payload stream at a time.
+constexpr size_t InputBufferSize = 64 * 1024;
+
+//! @brief The size of each buffer read ahead from an unbuffered input stream.
+constexpr size_t PrefetchBufferSize = 256 * 1024;
+
+//! @brief The count of buffers read ahead from an unbuffered input stream.
+constexpr size_t PrefetchCount = 2;
+
+//! @brief The count of bytes of byte block or packed array data passed to
+//! the visitor at a time.
+constexpr size_t ChunkSize = 64 * 1024;
+
+//! @brief The value beyond which an anonymous size is not encoded in a
+//! single byte, as defined by the binary encoding.
+constexpr uint8_t SizeEncodingThreshold = 248;
+
+////////////////////////////////////////////////////////////////////////////////
+// Local Data Types
+////////////////////////////////////////////////////////////////////////////////
+//! @brief An object which decodes a binary hierarchy payload from a stream in
+//! a single forward pass, reporting its contents to a visitor.
+//! @remarks Containers are tracked with an explicit stack rather than by
+//! recursion so that the depth of nesting is not limited by the call stack.
+class StreamingParser
+{
+public:
+    // Construction/Destruction
+    //! @brief Constructs a parser to decode a payload.
+    //! @param[in] input The stream positioned at the start of the payload.
+    //! @param[in] symbols The strings defined in the hierarchy string table.
+    //! @param[in] visitor The object to report the contents of the payload to.
+    StreamingParser(IStream *input, const StringCollection &symbols,
+                    HierarchyVisitor &visitor) :
+        _input(input),
+        _symbols(symbols),
+        _visitor(visitor),
+        _inputBuffer(InputBufferSize),
+        _chunk(ChunkSize / sizeof(uint64_t)),
+        _bufferOffset(0),
+        _bufferLength(0),
+        _position(0)
+    {
+    }
+
+    // Operations
+    //! @brief Decodes the root field and everything it contains.
+    //! @throws DataFormatException Thrown if the payload is invalid.
+    //! @throws IOException Thrown if the payload ends prematurely.
+    void parse()
+    {
+        parseField();
+
+        while (_frames.empty() == false)
+        {
+            Frame &top = _frames.back();
+
+            if (top.IsObject)
+            {
+                if (_position >= top.EndPosition)
+                {
+                    verifyEnd(top);
+                    _frames.pop_back();
+                    _visitor.onEndObject();
+                }
+                else
+                {
+                    // Object properties are encoded as tag/value pairs.
+                    uint8_t header = readByte();
+
+                    if (fromScalar<FieldType>(header >> 4) != FieldType::StringID)
+                        throw DataFormatException("An object property was not "
+                                                  "identified by a string tag.");
+
+                    _visitor.onProperty(getSymbol(readUnsigned(header & 0x0F)));
+                    parseField();
+                }
+            }
+            else if (top.RemainingElements > 0)
+            {
+                // Account for the element before the stack can change.
+                --top.RemainingElements;
+                parseField();
+            }
+            else
+            {
+                verifyEnd(top);
+                _frames.pop_back();
+                _visitor.onEndArray();
+            }
+        }
+    }
+private:
+    // Internal Types
+    //! @brief Describes a container which is being decoded.
+    struct Frame
+    {
+        StreamPosition EndPosition;
+        StreamLength RemainingElements;
+        bool IsObject;
+    };
+
+    // Internal Functions
+    //! @brief Ensures a container ended exactly where its header indicated.
+    //! @param[in] frame The container which has been decoded.
+    void verifyEnd(const Frame &frame) const
+    {
+        if (_position != frame.EndPosition)
+            throw DataFormatException("The contents of a serialized container "
+                                      "did not match its encoded size.");
+    }
+
+    //! @brief Decodes a single field, reporting scalar values and beginning
+    //! containers.
+    void parseField()
+    {
+        uint8_t header = readByte();
+        FieldType fieldType = fromScalar<FieldType>(header >> 4);
+        uint8_t supplemental = header & 0x0F;
+
+        switch (fieldType)
+        {
+        case FieldType::TinyInt:
+            _visitor.onInteger(supplemental);
+            break;
+
+        case FieldType::PositiveInteger: {
+            uint64_t value = readUnsigned(supplemental);
+
+            if (value > static_cast<uint64_t>(INT64_MAX))
+                _visitor.onUnsignedInteger(value);
+            else
+                _visitor.onInteger(static_cast<int64_t>(value));
+        } break;
+
+        case FieldType::NegativeInteger:
+            _visitor.onInteger(static_cast<int64_t>(~readUnsigned(supplemental)));
+            break;
+
+        case FieldType::Real:
+            parseReal(supplemental);
+            break;
+
+        case FieldType::StringID:
+            _visitor.onString(getSymbol(readUnsigned(supplemental)));
+            break;
+
+        case FieldType::Bytes:
+            parseBytes(readLength(supplemental));
+            break;
+
+        case FieldType::Object: {
+            StreamLength length = readLength(supplemental);
+
+            _frames.push_back({ _position + length, 0, true });
+            _visitor.onBeginObject();
+        } break;
+
+        case FieldType::Array: {
+            StreamLength length = readLength(supplemental);
+            StreamPosition endPosition = _position + length;
+            StreamLength elementCount = readAnonymousSize();
+
+            _frames.push_back({ endPosition, elementCount, false });
+            _visitor.onBeginArray(elementCount);
+        } break;
+
+        case FieldType::PackedArray:
+            parsePackedArray(readLength(supplemental));
+            break;
+
+        default:
+            throw DataFormatException("Unknown binary hierarchy field type.");
+        }
+    }
+
+    //! @brief Decodes a floating point field.
+    //! @param[in] supplemental The value encoded with the field type.
+    void parseReal(uint8_t supplemental)
+    {
+        auto decoder = Bin::ByteOrder::getLittleEndian();
+
+        if (supplemental == 1)
+        {
+            uint32_t bits;
+            readBytes(&bits, sizeof(bits));
+            bits = decoder->toHost(bits);
+
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            _visitor.onReal(value);
+        }
+        else if (supplemental == 2)
+        {
+            uint64_t bits;
+            readBytes(&bits, sizeof(bits));
+            bits = decoder->toHost(bits);
+
+            double value;
+            std::memcpy(&value, &bits, sizeof(value));
+            _visitor.onReal(value);
+        }
+        else
+        {
+            throw DataFormatException("The floating point encoding is not supported.");
+        }
+    }
+
+    //! @brief Passes the contents of a byte block field to the visitor in chunks.
+    //! @param[in] length The count of bytes in the block.
+    void parseBytes(StreamLength length)
+    {
+        uint8_t *chunk = reinterpret_cast<uint8_t *>(_chunk.data());
+
+        _visitor.onBeginBytes(length);
+
+        while (length > 0)
+        {
+            size_t chunkLength = static_cast<size_t>(std::min(length,
+                                                              static_cast<StreamLength>(ChunkSize)));
+            readBytes(chunk, chunkLength);
+            _visitor.onBytes(chunk, chunkLength);
+            length -= chunkLength;
+        }
+
+        _visitor.onEndBytes();
+    }
+
+    //! @brief Passes the elements of a packed array field to the visitor in
+    //! chunks, converted to host byte order.
+    //! @param[in] length The count of bytes of field data.
+    void parsePackedArray(StreamLength length)
+    {
+        if (length < 1)
+            throw DataFormatException("A packed array field was truncated.");
+
+        uint8_t typeCode = readByte();
+
+        if (typeCode >= toScalar(PackedElementType::Max))
+            throw DataFormatException("Unknown packed array element type.");
+
+        PackedElementType elementType = fromScalar<PackedElementType>(typeCode);
+        StreamLength elementSize = static_cast<StreamLength>(getPackedElementSize(elementType));
+        StreamLength dataLength = length - 1;
+
+        if ((dataLength % elementSize) != 0)
+            throw DataFormatException("A packed array did not contain a whole "
+                                      "number of elements.");
+
+        StreamLength remaining = dataLength / elementSize;
+        StreamLength chunkCapacity = static_cast<StreamLength>(ChunkSize) / elementSize;
+        bool requiresSwap = Bin::ByteOrder::getLittleEndian()->requiresSwap();
+
+        _visitor.onBeginPackedArray(elementType, remaining);
+
+        while (remaining > 0)
+        {
+            size_t chunkCount = static_cast<size_t>(std::min(remaining, chunkCapacity));
+
+            // The chunk is 8-byte aligned, so elements can be accessed in-place.
+            readBytes(_chunk.data(), chunkCount * static_cast<size_t>(elementSize));
+
+            if (requiresSwap)
+                swapPackedElements(_chunk.data(), chunkCount,
+                                   static_cast<size_t>(elementSize));
+
+            _visitor.onPackedElements(_chunk.data(), chunkCount);
+            remaining -= chunkCount;
+        }
+
+        _visitor.onEndPackedArray();
+    }
+
+    //! @brief Looks up a string in the hierarchy string table.
+    //! @param[in] id The identifier of the string.
+    //! @return The string text.
+    string_cref_t getSymbol(uint64_t id) const
+    {
+        if (id >= _symbols.size())
+            throw DataFormatException("A string identifier was out of range.");
+
+        return _symbols[static_cast<size_t>(id)];
+    }
+
+    //! @brief Reads the little-endian encoded significant bytes of a value.
+    //! @param[in] byteCount The count of bytes to read.
+    //! @return The decoded value.
+    uint64_t readUnsigned(uint8_t byteCount)
+    {
+        if (byteCount > sizeof(uint64_t))
+            throw DataFormatException("An encoded integer was too large.");
+
+        uint8_t buffer[sizeof(uint64_t)];
+        uint64_t value = 0;
+
+        readBytes(buffer, byteCount);
+
+        for (uint8_t index = 0; index < byteCount; ++index)
+            value |= static_cast<uint64_t>(buffer[index]) << (index * 8);
+
+        return value;
+    }
+
+    //! @brief Reads the size of a field which contains a block of data.
+    //! @param[in] byteCount The count of bytes used to encode the size.
+    //! @return The count of bytes of field data which follow.
+    StreamLength readLength(uint8_t byteCount)
+    {
+        uint64_t length = readUnsigned(byteCount);
+
+        if (length > static_cast<uint64_t>(INT64_MAX - _position))
+            throw DataFormatException("A field size was out of range.");
+
+        if ((_frames.empty() == false) &&
+            ((_position + static_cast<StreamLength>(length)) > _frames.back().EndPosition))
+        {
+            throw DataFormatException("A field extended beyond the end of its container.");
+        }
+
+        return static_cast<StreamLength>(length);
+    }
+
+    //! @brief Reads an anonymous size value.
+    //! @return The decoded size.
+    StreamLength readAnonymousSize()
+    {
+        uint8_t header = readByte();
+
+        if (header < SizeEncodingThreshold)
+            return header;
+
+        uint64_t size = readUnsigned(static_cast<uint8_t>(header - SizeEncodingThreshold + 1));
+
+        if (size > static_cast<uint64_t>(INT64_MAX))
+            throw DataFormatException("An encoded size was out of range.");
+
+        return static_cast<StreamLength>(size);
+    }
+
+    //! @brief Reads a single byte from the payload.
+    //! @return The byte read.
+    uint8_t readByte()
+    {
+        if ((_bufferOffset == _bufferLength) && (fillBuffer() == false))
+            throw IOException("The serialized hierarchy ended prematurely.");
+
+        ++_position;
+        return _inputBuffer[_bufferOffset++];
+    }
+
+    //! @brief Reads an exact count of bytes from the payload.
+    //! @param[out] target The buffer to receive the bytes.
+    //! @param[in] byteCount The count of bytes to read.
+    void readBytes(void *target, size_t byteCount)
+    {
+        uint8_t *output = static_cast<uint8_t *>(target);
+
+        // Use any buffered data first.
+        size_t buffered = std::min(byteCount, _bufferLength - _bufferOffset);
+
+        if (buffered > 0)
+        {
+            std::memcpy(output, _inputBuffer.data() + _bufferOffset, buffered);
+            _bufferOffset += buffered;
+            output += buffered;
+            byteCount -= buffered;
+            _position += buffered;
+        }
+
+        if (byteCount >= _inputBuffer.size())
+        {
+            // Read large blocks directly rather than through the buffer.
+            while (byteCount > 0)
+            {
+                size_t bytesRead = _input->read(output, byteCount);
+
+                if (bytesRead == 0)
+                    throw IOException("The serialized hierarchy ended prematurely.");
+
+                output += bytesRead;
+                byteCount -= bytesRead;
+                _position += bytesRead;
+            }
+        }
+        else if (byteCount > 0)
+        {
+            while (_bufferLength - _bufferOffset < byteCount)
+            {
+                if (fillBuffer() == false)
+                    throw IOException("The serialized hierarchy ended prematurely.");
+            }
+
+            std::memcpy(output, _inputBuffer.data() + _bufferOffset, byteCount);
+            _bufferOffset += byteCount;
+            _position += byteCount;
+        }
+    }
+
+    //! @brief Reads more of the payload into the input buffer, retaining
+    //! any bytes not yet consumed.
+    //! @retval true More bytes were read.
+    //! @retval false The end of the input stream was reached.
+    bool fillBuffer()
+    {
+        if (_bufferOffset > 0)
+        {
+            std::memmove(_inputBuffer.data(), _inputBuffer.data() + _bufferOffset,
+                         _bufferLength - _bufferOffset);
+            _bufferLength -= _bufferOffset;
+            _bufferOffset = 0;
+        }
+
+        size_t bytesRead = _input->read(_inputBuffer.data() + _bufferLength,
+                                        _inputBuffer.size() - _bufferLength);
+
+        _bufferLength += bytesRead;
+
+        return (bytesRead > 0);
+    }
+
+    // Internal Fields
+    IStream *_input;
+    const StringCollection &_symbols;
+    HierarchyVisitor &_visitor;
+    std::vector<Frame> _frames;
+    std::vector<uint8_t> _inputBuffer;
+    std::vector<uint64_t> _chunk;
+    size_t _bufferOffset;
+    size_t _bufferLength;
+    StreamPosition _position;
+};
+
+//! @brief An IStream implementation which decompresses each chunk of a
+//! chunked payload in turn, presenting them as a single contiguous stream.
+class ChunkedPayloadStream : public IStream
+{
+public:
+    //! @brief Constructs a stream which reads a chunked payload.
+    //! @param[in] input The stream positioned at the first compressed chunk.
+    //! @param[in] index The index describing the chunks which follow.
+    //! @param[in] codec The algorithm used to compress each chunk.
+    //! @param[in] payloadSize The total uncompressed size of the payload.
+    ChunkedPayloadStream(IStream *input, const PayloadChunkIndex &index,
+                         const ICompressionCodec &codec, StreamLength payloadSize) :
+        _input(input),
+        _index(index),
+        _codec(codec),
+        _payloadSize(payloadSize),
+        _nextChunk(0),
+        _chunkOffset(0)
+    {
+    }
+
+    virtual ~ChunkedPayloadStream() = default;
+
+    // Overrides
+
+    // Inherited from IStream.
+    virtual bool isBuffered() const override { return true; }
+
+    // Inherited from IStream.
+    virtual void flush() override { }
+
+    // Inherited from IStream.
+    virtual size_t read(void *targetBuffer, size_t requiredByteCount) override
+    {
+        uint8_t *target = static_cast<uint8_t *>(targetBuffer);
+        size_t bytesRead = 0;
+
+        while (bytesRead < requiredByteCount)
+        {
+            if ((_chunkOffset == _chunk.size()) && (tryReadNextChunk() == false))
+                break;
+
+            size_t toCopy = std::min(requiredByteCount - bytesRead,
+                                     _chunk.size() - _chunkOffset);
+
+            std::memcpy(target + bytesRead, _chunk.data() + _chunkOffset, toCopy);
+            bytesRead += toCopy;
+            _chunkOffset += toCopy;
+        }
+
+        return bytesRead;
+    }
+
+    // Inherited from IStream.
+    virtual size_t write(const void */*sourceBuffer*/, size_t /*sourceByteCount*/) override
+    {
+        throw NotSupportedException("Writing to a decompression stream.");
+    }
+private:
+    //! @brief Reads and decompresses the next chunk of the payload.
+    //! @retval true A new chunk of data is ready to read.
+    //! @retval false There are no more chunks in the payload.
+    bool tryReadNextChunk()
+    {
+        if (_nextChunk >= _index.CompressedSizes.size())
+            return false;
+
+        size_t compressedSize = static_cast<size_t>(_index.CompressedSizes[_nextChunk]);
+        size_t chunkSize = static_cast<size_t>(_index.getChunkLength(_nextChunk,
+                                                                     _payloadSize));
+        ++_nextChunk;
+
+        _compressedChunk.resize(compressedSize);
+
+        if (_input->read(_compressedChunk.data(), compressedSize) != compressedSize)
+            throw IOException("Failed to read a compressed payload chunk.");
+
+        _chunk.resize(chunkSize);
+        _chunkOffset = 0;
+
+        try
+        {
+            _codec.decompress(_compressedChunk.data(), compressedSize,
+                              _chunk.data(), chunkSize);
+        }
+        catch (const Exception &)
+        {
+            throw DataFormatException("A compressed payload chunk was corrupt.");
+        }
+
+        return chunkSize > 0;
+    }
+
+    // Internal Fields
+    IStream *_input;
+    const PayloadChunkIndex &_index;
+    const ICompressionCodec &_codec;
+    std::vector<uint8_t> _compressedChunk;
+    std::vector<uint8_t> _chunk;
+    StreamLength _payloadSize;
+    size_t _nextChunk;
+    size_t _chunkOffset;
+};
+
+} // Anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+// HierarchyVisitor Member Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Receives notification that an object is beginning.
+void HierarchyVisitor::onBeginObject()
+{
+}
+
+//! @brief Receives the tag of an object property, the value of which is
+//! reported by the events which follow.
+//! @param[in] tag The property tag.
+void HierarchyVisitor::onProperty(string_cref_t /*tag*/)
+{
+}
+
+//! @brief Receives notification that the last property of the innermost
+//! object has been reported.
+void HierarchyVisitor::onEndObject()
+{
+}
+
+//! @brief Receives notification that an array is beginning.
+//! @param[in] elementCount The count of elements which will be reported
+//! before onEndArray() is called.
+void HierarchyVisitor::onBeginArray(StreamLength /*elementCount*/)
+{
+}
+
+//! @brief Receives notification that the last element of the innermost array
+//! has been reported.
+void HierarchyVisitor::onEndArray()
+{
+}
+
+//! @brief Receives an integer value.
+//! @param[in] value The value as it was encoded, regardless of the type it was
+//! written with.
+void HierarchyVisitor::onInteger(int64_t /*value*/)
+{
+}
+
+//! @brief Receives an integer value which is too large to be reported by
+//! onInteger().
+//! @param[in] value The value as it was encoded.
+void HierarchyVisitor::onUnsignedInteger(uint64_t /*value*/)
+{
+}
+
+//! @brief Receives a floating point value.
+//! @param[in] value The value, converted to double precision if necessary.
+void HierarchyVisitor::onReal(double /*value*/)
+{
+}
+
+//! @brief Receives a string value.
+//! @param[in] value The text of the string.
+void HierarchyVisitor::onString(string_cref_t /*value*/)
+{
+}
+
+//! @brief Receives notification that a block of bytes is beginning.
+//! @param[in] byteCount The total count of bytes which will be reported
+//! by onBytes() before onEndBytes() is called.
+void HierarchyVisitor::onBeginBytes(StreamLength /*byteCount*/)
+{
+}
+
+//! @brief Receives the next portion of a block of bytes.
+//! @param[in] data The bytes, which are only valid for the duration of the call.
+//! @param[in] byteCount The count of bytes in @p data.
+void HierarchyVisitor::onBytes(const uint8_t * /*data*/, size_t /*byteCount*/)
+{
+}
+
+//! @brief Receives notification that a block of bytes has been reported.
+void HierarchyVisitor::onEndBytes()
+{
+}
+
+//! @brief Receives notification that a packed array is beginning.
+//! @param[in] elementType The data type of the elements.
+//! @param[in] elementCount The total count of elements which will be reported
+//! by onPackedElements() before onEndPackedArray() is called.
+void HierarchyVisitor::onBeginPackedArray(PackedElementType /*elementType*/,
+                                          StreamLength /*elementCount*/)
+{
+}
+
+//! @brief Receives the next portion of the elements of a packed array.
+//! @param[in] elements The suitably aligned elements in host byte order, which
+//! are only valid for the duration of the call.
+//! @param[in] elementCount The count of elements in @p elements.
+void HierarchyVisitor::onPackedElements(const void * /*elements*/,
+                                        size_t /*elementCount*/)
+{
+}
+
+//! @brief Receives notification that the elements of a packed array have
+//! been reported.
+void HierarchyVisitor::onEndPackedArray()
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Global Function Definitions
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Reads a serialized hierarchy in a single forward pass, reporting its
+//! contents to a visitor as they are decoded.
+//! @param[in] input The stream to read the serialized hierarchy from.
+//! @param[in] visitor The object to report the contents of the hierarchy to.
+//! @remarks Unlike HierarchyRoot, the payload is never held in memory, even
+//! when it is compressed, only the string table and a fixed-size buffer are.
+//! This allows hierarchies far larger than available memory to be processed.
+//! @throws IOException Thrown if the stream header cannot be read or the
+//! stream ends prematurely.
+//! @throws DataFormatException Thrown if the serialized data is invalid.
+void visitHierarchy(IStream *input, HierarchyVisitor &visitor)
+{
+    // Read ahead from devices, such as files, so that reading overlaps
+    // decompression and parsing.
+    BufferedInputStream reader(input, PrefetchBufferSize,
+                               input->isBuffered() ? 0 : PrefetchCount);
+    BinaryStreamHeader header;
+
+    if (header.tryRead(&reader) == false)
+        throw IOException("Failed to read binary hierarchy stream header.");
+
+    header.validate();
+
+    StringCollection symbols;
+
+    if (header.Flags & 1)
+    {
+        symbols = readCompressedStringTable(&reader, header);
+    }
+    else
+    {
+        symbols = readStringTable(&reader, header.SymbolCount);
+    }
+
+    if (header.Flags & 4)
+    {
+        // Decompress each independently compressed chunk in turn.
+        PayloadChunkIndex index;
+
+        if ((index.tryRead(&reader) == false) ||
+            (index.isValid(header.PayloadSize, header.CompressedPayloadSize) == false))
+        {
+            throw IOException("Failed to read a valid payload chunk index.");
+        }
+
+        ChunkedPayloadStream payload(&reader, index,
+                                     getCompressionCodec(header.getCodecID()),
+                                     header.PayloadSize);
+        StreamingParser parser(&payload, symbols, visitor);
+        parser.parse();
+    }
+    else if (header.Flags & 2)
+    {
+        // Decompress the payload as it is parsed.
+        Bz2DecompressionStream decompressor(&reader, InputBufferSize);
+        decompressor.setReadLimit(header.CompressedPayloadSize);
+
+        StreamingParser parser(&decompressor, symbols, visitor);
+        parser.parse();
+    }
+    else
+    {
+        StreamingParser parser(&reader, symbols, visitor);
+        parser.parse();
+    }
+}
+
+}} // namespace Ag::IO
+////////////////////////////////////////////////////////////////////////////////
@@ -10,6 +10,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Header File Includes
 ////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
 #include <utility>
 
 #ifndef _WIN32
@@ -247,9 +248,14 @@ void MappingHandle::open(const Fs::Path &filePath, FileAccessBits access,
 //! @param[in] blockIndex The start of the region of the file to map, expressed
 //! as an index of blocks based on the value returned by getBlockSize().
 //! @param[in] length The length of the region to map, in bytes.
+//! @param[in] options A combination of MappingOption bits which define how
+//! the view will be used.
 //! @return The pointer to the first byte of the file mapped into memory.
+//! @remarks Only the Populate and WillNeed options have an effect on Windows,
+//! both of which start reading the view into memory.
 void *MappingHandle::createView(StreamPosition blockIndex,
-                                StreamLength length)
+                                StreamLength length,
+                                MappingOptionBits options /*= 0*/)
 {
     if (_file == INVALID_HANDLE_VALUE)
         throw OperationException("Cannot map a view of a closed file.");
@@ -273,6 +279,9 @@ void *MappingHandle::createView(StreamPosition blockIndex,
     if (ptr == nullptr)
         throw Win32Exception("MapViewOfFile()", ::GetLastError());
 
+    if (options & (MappingOption::Populate | MappingOption::WillNeed))
+        adviseView(ptr, static_cast<size_t>(length), MappingAdvice::WillNeed);
+
     return ptr;
 }
 
@@ -297,6 +306,51 @@ bool MappingHandle::destroyView(void *viewPtr, StreamLength /*length*/,
     return true;
 }
 
+//! @brief Informs the operating system how a range of mapped memory will be used.
+//! @param[in] viewPtr The block-aligned start of the range.
+//! @param[in] length The length of the range, in bytes.
+//! @param[in] advice The expected usage of the range.
+//! @retval true The advice was applied.
+//! @retval false The advice is not supported.
+//! @remarks Only WillNeed and DontNeed have an equivalent on Windows.
+bool MappingHandle::adviseView(void *viewPtr, size_t length, MappingAdvice advice)
+{
+    switch (advice)
+    {
+    case MappingAdvice::Normal:
+        return true;
+
+    case MappingAdvice::WillNeed: {
+        WIN32_MEMORY_RANGE_ENTRY range;
+        range.VirtualAddress = viewPtr;
+        range.NumberOfBytes = length;
+
+        return ::PrefetchVirtualMemory(::GetCurrentProcess(), 1, &range, 0) != FALSE;
+    }
+
+    case MappingAdvice::DontNeed:
+        // Unlocking pages which aren't locked removes them from the working
+        // set, although the function reports ERROR_NOT_LOCKED.
+        ::VirtualUnlock(viewPtr, length);
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+//! @brief Writes modified pages in a range of mapped memory back to the file.
+//! @param[in] viewPtr The block-aligned start of the range.
+//! @param[in] length The length of the range, in bytes.
+//! @param[in] waitForCompletion Ignored, the write is always initiated
+//! without waiting for the data to reach the disk.
+//! @throws Win32Exception If the write could not be initiated.
+void MappingHandle::flushView(void *viewPtr, size_t length, bool /*waitForCompletion*/)
+{
+    if (::FlushViewOfFile(viewPtr, length) == FALSE)
+        throw Win32Exception("FlushViewOfFile()", ::GetLastError());
+}
+
 //! @brief Ensures that if the file is open, it will be closed.
 //! @throws Win32Exception If there were failures closing the file.
 void MappingHandle::close()
@@ -507,9 +561,14 @@ void MappingHandle::open(const Fs::Path &filePath, FileAccessBits access,
 //! @param[in] blockIndex The start of the region of the file to map, expressed
 //! as an index of blocks based on the value returned by getBlockSize().
 //! @param[in] length The length of the region to map, in bytes.
+//! @param[in] options A combination of MappingOption bits which define how
+//! the view will be used.
 //! @return The pointer to the first byte of the file mapped into memory.
+//! @remarks Options other than Populate are hints which are silently
+//! ignored if the platform does not support them.
 void *MappingHandle::createView(StreamPosition blockIndex,
-                                StreamLength length)
+                                StreamLength length,
+                                MappingOptionBits options /*= 0*/)
 {
     if (_mappingFd < 0)
         throw OperationException("Cannot map a view of a closed file.");
@@ -530,12 +589,34 @@ void *MappingHandle::createView(StreamPosition blockIndex,
         protect |= PROT_WRITE;
     }
 
-    void *ptr = mmap64(nullptr, streamToMemorySize(length), protect, flags, _mappingFd,
+#ifdef MAP_POPULATE
+    if (options & MappingOption::Populate)
+        flags |= MAP_POPULATE;
+#else
+    // Fall back to reading ahead asynchronously.
+    if (options & MappingOption::Populate)
+        options |= MappingOption::WillNeed;
+#endif
+
+    size_t viewSize = streamToMemorySize(length);
+    void *ptr = mmap64(nullptr, viewSize, protect, flags, _mappingFd,
                        static_cast<off64_t>(blockIndex) * getBlockSize());
 
     if (ptr == MAP_FAILED)
         throw RuntimeLibraryException("mmap64()", errno);
 
+    // Apply any hints, huge pages first so that read-ahead uses them.
+    if (options & MappingOption::HugePages)
+        adviseView(ptr, viewSize, MappingAdvice::HugePages);
+
+    if (options & MappingOption::Sequential)
+        adviseView(ptr, viewSize, MappingAdvice::Sequential);
+    else if (options & MappingOption::Random)
+        adviseView(ptr, viewSize, MappingAdvice::Random);
+
+    if (options & MappingOption::WillNeed)
+        adviseView(ptr, viewSize, MappingAdvice::WillNeed);
+
     return ptr;
 }
 
@@ -559,6 +640,52 @@ bool MappingHandle::destroyView(void *viewPtr, StreamLength length, bool throwEx
     return true;
 }
 
+//! @brief Informs the operating system how a range of mapped memory will be used.
+//! @param[in] viewPtr The block-aligned start of the range.
+//! @param[in] length The length of the range, in bytes.
+//! @param[in] advice The expected usage of the range.
+//! @retval true The advice was applied.
+//! @retval false The advice is not supported by the platform or the file
+//! system, for example huge pages for a file which cannot use them.
+bool MappingHandle::adviseView(void *viewPtr, size_t length, MappingAdvice advice)
+{
+    int rawAdvice = MADV_NORMAL;
+
+    switch (advice)
+    {
+    case MappingAdvice::Normal: rawAdvice = MADV_NORMAL; break;
+    case MappingAdvice::Sequential: rawAdvice = MADV_SEQUENTIAL; break;
+    case MappingAdvice::Random: rawAdvice = MADV_RANDOM; break;
+    case MappingAdvice::WillNeed: rawAdvice = MADV_WILLNEED; break;
+    case MappingAdvice::DontNeed: rawAdvice = MADV_DONTNEED; break;
+
+    case MappingAdvice::HugePages:
+#ifdef MADV_HUGEPAGE
+        rawAdvice = MADV_HUGEPAGE;
+        break;
+#else
+        return false;
+#endif
+
+    default:
+        return false;
+    }
+
+    return madvise(viewPtr, length, rawAdvice) == 0;
+}
+
+//! @brief Writes modified pages in a range of mapped memory back to the file.
+//! @param[in] viewPtr The block-aligned start of the range.
+//! @param[in] length The length of the range, in bytes.
+//! @param[in] waitForCompletion True to wait for the data to be written,
+//! false to schedule the write and return immediately.
+//! @throws RuntimeLibraryException If the operation failed.
+void MappingHandle::flushView(void *viewPtr, size_t length, bool waitForCompletion)
+{
+    if (msync(viewPtr, length, waitForCompletion ? MS_SYNC : MS_ASYNC) < 0)
+        throw RuntimeLibraryException("msync()", errno);
+}
+
 //! @brief Ensures that if the file is open, it will be closed.
 //! @throws RuntimeLibraryException If there were failures closing the file.
 void MappingHandle::close()
@@ -665,6 +792,67 @@ MemoryMappedView &MemoryMappedView::operator=(MemoryMappedView &&rhs) noexcept
     return *this;
 }
 
+//! @brief Informs the operating system how the entire view will be used.
+//! @param[in] advice The expected usage of the view.
+//! @retval true The advice was applied.
+//! @retval false The advice is not supported on the current platform.
+bool MemoryMappedView::advise(MappingAdvice advice)
+{
+    return advise(advice, 0, getSize());
+}
+
+//! @brief Informs the operating system how a range of the view will be used.
+//! @param[in] advice The expected usage of the range.
+//! @param[in] offset The offset of the start of the range within the view.
+//! @param[in] length The length of the range, which is truncated at the end
+//! of the view.
+//! @retval true The advice was applied.
+//! @retval false The advice is not supported on the current platform.
+//! @throws OperationException If the view is not active.
+//! @throws ArgumentException If @p offset is beyond the end of the view.
+bool MemoryMappedView::advise(MappingAdvice advice, size_t offset, size_t length)
+{
+    uint8_t *start = getAlignedRange(offset, length);
+
+    return (length == 0) || MappingHandle::adviseView(start, length, advice);
+}
+
+//! @brief Starts reading a range of the view into memory in the background
+//! so that it can be accessed later without waiting for the disk.
+//! @param[in] offset The offset of the start of the range within the view.
+//! @param[in] length The length of the range, which is truncated at the end
+//! of the view.
+//! @retval true The read-ahead was started.
+//! @retval false Read-ahead is not supported on the current platform.
+bool MemoryMappedView::prefetch(size_t offset, size_t length)
+{
+    return advise(MappingAdvice::WillNeed, offset, length);
+}
+
+//! @brief Writes modified pages of the entire view back to the file.
+//! @param[in] waitForCompletion True to wait for the data to be written,
+//! false to schedule the write and return immediately.
+void MemoryMappedView::flush(bool waitForCompletion /*= true*/)
+{
+    flush(0, getSize(), waitForCompletion);
+}
+
+//! @brief Writes modified pages in a range of the view back to the file.
+//! @param[in] offset The offset of the start of the range within the view.
+//! @param[in] length The length of the range, which is truncated at the end
+//! of the view.
+//! @param[in] waitForCompletion True to wait for the data to be written,
+//! false to schedule the write and return immediately.
+//! @remarks On Windows, the write is always scheduled without waiting.
+void MemoryMappedView::flush(size_t offset, size_t length,
+                             bool waitForCompletion /*= true*/)
+{
+    uint8_t *start = getAlignedRange(offset, length);
+
+    if (length > 0)
+        MappingHandle::flushView(start, length, waitForCompletion);
+}
+
 //! @brief Release the file mapping, if it wasn't released already, throwing
 //! an exception if the operation fails.
 void MemoryMappedView::release()
@@ -695,6 +883,33 @@ void MemoryMappedView::releaseNoThrow() noexcept
     }
 }
 
+//! @brief Validates a range of the view and expands it to start on a block
+//! boundary, as required by the operating system.
+//! @param[in] offset The offset of the start of the range within the view.
+//! @param[in,out] length The length of the range, updated to be truncated
+//! at the end of the view and to include the bytes before @p offset
+//! back to the preceding block boundary.
+//! @return A pointer to the block-aligned start of the range.
+uint8_t *MemoryMappedView::getAlignedRange(size_t offset, size_t &length) const
+{
+    if (_baseAddr == nullptr)
+        throw OperationException("Cannot operate on an inactive memory mapped view.");
+
+    size_t viewSize = getSize();
+
+    if (offset > viewSize)
+        throw ArgumentException("The offset is beyond the end of the view.", "offset");
+
+    length = std::min(length, viewSize - offset);
+
+    size_t alignedOffset = offset - (offset % MappingHandle::getBlockSize());
+
+    if (length > 0)
+        length += offset - alignedOffset;
+
+    return static_cast<uint8_t *>(_baseAddr) + alignedOffset;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // MemoryMappedFile Member Definitions
 ////////////////////////////////////////////////////////////////////////////////
@@ -730,13 +945,17 @@ StreamLength MemoryMappedFile::getMappingSize() const
 //! @brief Maps a view of part of the file.
 //! @param[in] firstBlock The index of the first block of the file to map.
 //! @param[in] length The length of the view.
+//! @param[in] options A combination of MappingOption bits which define how
+//! the view will be used, unsupported options are ignored.
 //! @return An object representing the contents of the file mapped into memory.
 //! @remarks
 //! The @p firstBlock parameter can be calculated using the getBlockSize()
 //! static member function. View must be mapped on block boundaries.
-MemoryMappedView MemoryMappedFile::createView(uint64_t firstBlock, size_t length)
+MemoryMappedView MemoryMappedFile::createView(uint64_t firstBlock, size_t length,
+                                              MappingOptionBits options /*= 0*/)
 {
-    void *ptr = _handle.createView(static_cast<StreamPosition>(firstBlock), length);
+    void *ptr = _handle.createView(static_cast<StreamPosition>(firstBlock), length,
+                                   options);
 
     StreamPosition offset = firstBlock * MappingHandle::getBlockSize();
 
@@ -251,6 +251,50 @@ StreamLength MemoryStream::getSize() const
     return _totalSize;
 }
 
+//! @brief Gets views of the internal storage which holds a region of the
+//! stream, allowing it to be written elsewhere without an intermediate copy.
+//! @param[in] offset The offset of the first byte of the region.
+//! @param[in] length The count of bytes in the region.
+//! @param[out] spans The collection to append views of the region to, in order.
+//! A view which ends where the region begins is extended rather than a new
+//! one being appended.
+//! @note The views are invalidated by any subsequent write to the stream.
+//! @throws ArgumentException If the region extends beyond the end of the stream.
+void MemoryStream::getRegionSpans(StreamPosition offset, StreamLength length,
+                                  std::vector<ByteSpan> &spans) const
+{
+    if ((offset < 0) || (length < 0) ||
+        (static_cast<size_t>(offset + length) > _totalSize))
+    {
+        throw ArgumentException("The region is not within the stream.", "length");
+    }
+
+    const size_t blockSize = _allocator->getBlockSize();
+    size_t position = static_cast<size_t>(offset);
+    size_t endPosition = position + static_cast<size_t>(length);
+
+    while (position < endPosition)
+    {
+        size_t blockIndex = position / blockSize;
+        size_t blockOffset = position - (blockIndex * blockSize);
+        size_t byteCount = std::min(blockSize - blockOffset, endPosition - position);
+
+        const uint8_t *data = _blocks[blockIndex] + blockOffset;
+
+        if ((spans.empty() == false) && (spans.back().end() == data))
+        {
+            // Extend a view of directly preceding bytes.
+            spans.back().Length += byteCount;
+        }
+        else
+        {
+            spans.emplace_back(data, byteCount);
+        }
+
+        position += byteCount;
+    }
+}
+
 // Inherited from IStream.
 bool MemoryStream::isBuffered() const
 {
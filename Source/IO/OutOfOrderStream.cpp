@@ -30,6 +30,10 @@ namespace {
 //! than an in-memory buffer.
 constexpr StreamLength MaxMemoryStreamSize = 4 * 1024 * 1024;
 
+//! @brief The maximum count of in-memory views of ordered data to pass to
+//! a single gathered write.
+constexpr size_t MaxGatheredSpanCount = 64;
+
 } // Anonymous namespace
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -109,6 +113,14 @@ size_t OutOfOrderStream::BlockWriterStream::write(const void *sourceBuffer,
     return bytesWritten;
 }
 
+// Inherited from IStream.
+size_t OutOfOrderStream::BlockWriterStream::writeGathered(const ByteSpan *sourceBuffers,
+                                                          size_t bufferCount)
+{
+    // Write each buffer in turn so that the bytes are accounted for.
+    return IStream::writeGathered(sourceBuffers, bufferCount);
+}
+
 //! @brief Constructs an object to accumulate data out of order before writing
 //! it to another stream in the correct order.
 OutOfOrderStream::OutOfOrderStream() :
@@ -253,7 +265,12 @@ StreamLength OutOfOrderStream::orderedWrite(IStream *output, BlockRef startBlock
     if (largestBlock <= 0)
         return 0;
 
-    if (output->isBuffered())
+    if (auto memoryStream = dynamic_cast<const MemoryStream *>(_baseStream.get()))
+    {
+        // The data is already in memory, so write it from where it lies.
+        return gatheredOrderedWrite(output, *memoryStream, startBlock, endBlock);
+    }
+    else if (output->isBuffered())
     {
         return innerOrderedWrite(output, startBlock, endBlock, largestBlock);
     }
@@ -333,6 +350,57 @@ StreamLength OutOfOrderStream::innerOrderedWrite(IStream *output, BlockRef start
     return totalBytesWritten;
 }
 
+//! @brief Writes blocks held in memory to an output stream in the correct
+//! order without copying them, gathering many blocks into each write.
+//! @param[in] output The stream to write to.
+//! @param[in] source The in-memory stream holding the out-of-order blocks.
+//! @param[in] startBlock The reference to the first block in the run to write.
+//! @param[in] endBlock The reference to the block after the last one to write.
+//! @returns The count of bytes written to @p output.
+StreamLength OutOfOrderStream::gatheredOrderedWrite(IStream *output,
+                                                    const MemoryStream &source,
+                                                    BlockRef startBlock,
+                                                    BlockRef endBlock)
+{
+    std::vector<ByteSpan> spans;
+    StreamLength totalBytesWritten = 0;
+    size_t batchByteCount = 0;
+
+    spans.reserve(MaxGatheredSpanCount + 8);
+
+    auto writeBatch = [&]()
+    {
+        if (spans.empty())
+            return;
+
+        size_t written = output->writeGathered(spans.data(), spans.size());
+
+        if (written != batchByteCount)
+            throw OperationException("Failed to write ordered data to the output stream.");
+
+        totalBytesWritten += static_cast<StreamLength>(written);
+        batchByteCount = 0;
+        spans.clear();
+    };
+
+    for (auto blockPos = startBlock; blockPos != endBlock; ++blockPos)
+    {
+        // Skip empty blocks.
+        if (blockPos->getLength() <= 0)
+            continue;
+
+        source.getRegionSpans(blockPos->getOffset(), blockPos->getLength(), spans);
+        batchByteCount += static_cast<size_t>(blockPos->getLength());
+
+        if (spans.size() >= MaxGatheredSpanCount)
+            writeBatch();
+    }
+
+    writeBatch();
+
+    return totalBytesWritten;
+}
+
 //! @brief Updates statistics based on bytes being written to he underlying stream.
 //! @param[in] block The reference to the block to possibly update.
 //! @param[in] bytesWritten The count of bytes to be added to the relevant block.
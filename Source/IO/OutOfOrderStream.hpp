@@ -24,6 +24,8 @@ namespace IO {
 ////////////////////////////////////////////////////////////////////////////////
 // Class Declarations
 ////////////////////////////////////////////////////////////////////////////////
+class MemoryStream;
+
 //! @brief An object which allows data to be temporarily written out of order
 //! and then transferred to another stream in the correct order.
 class OutOfOrderStream
@@ -56,6 +58,7 @@ public:
         virtual void flush() override;
         virtual size_t read(void *targetBuffer, size_t requiredByteCount) override;
         virtual size_t write(const void *sourceBuffer, size_t sourceByteCount) override;
+        virtual size_t writeGathered(const ByteSpan *sourceBuffers, size_t bufferCount) override;
 
         // Ensure the parent can manipulate the child in ways the caller can't.
         friend class OutOfOrderStream;
@@ -83,6 +86,8 @@ private:
     // Internal Functions
     StreamLength innerOrderedWrite(IStream *output, BlockRef startBlock,
                                    BlockRef endBlock, StreamLength maxBlockSize);
+    StreamLength gatheredOrderedWrite(IStream *output, const MemoryStream &source,
+                                      BlockRef startBlock, BlockRef endBlock);
 
     BlockRef accountForWrite(BlockRef block, size_t bytesWritten);
     StreamLength calculateSizeToEnd(BlockRef startBlock) const;
@@ -10,8 +10,13 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Header File Includes
 ////////////////////////////////////////////////////////////////////////////////
+#include <atomic>
+#include <mutex>
+
+#include "Ag/Core/WorkerPool.hpp"
 #include "Ag/IO/Exceptions.hpp"
 #include "Ag/IO/MemoryMappedFile.hpp"
+#include "Ag/IO/MemoryStream.hpp"
 #include "Ag/IO/SeekableFileStream.hpp"
 #include "Ag/IO/StreamTools.hpp"
 
@@ -189,6 +194,143 @@ public:
         return ISeekableStreamUPtr(new BlockViewStream(_source.data() + region.getOffset(),
                                                        static_cast<size_t>(region.getLength())));
     }
+
+    // Inherited from ReadOnlyDataSource.
+    virtual bool tryGetView(const StreamRegion &region, const uint8_t *&data) override
+    {
+        if (isRegionValid(region))
+        {
+            data = _source.data() + region.getOffset();
+            return true;
+        }
+
+        data = nullptr;
+        return false;
+    }
+};
+
+//! @brief An implementation of ReadOnlyDataSource which maps a region of an
+//! existing file into the address space in its entirety so that the data can
+//! be accessed in place.
+class MappedFileDataSource : public ReadOnlyDataSource
+{
+private:
+    // Internal Fields
+    MemoryMappedFile _mappedFile;
+    MemoryMappedView _view;
+    uint8_cptr_t _data;
+public:
+    // Construction/Destruction
+
+    //! @brief Constructs a data source which maps part of a file into memory.
+    //! @param[in] fileName The path to the existing file to map.
+    //! @param[in] fileRegion The region of the file to provide access to.
+    //! @throws ArgumentException Thrown if @p fileRegion extends beyond the
+    //! end of the file.
+    MappedFileDataSource(const Fs::Path &fileName, const StreamRegion &fileRegion) :
+        ReadOnlyDataSource(fileRegion.getLength()),
+        _data(nullptr)
+    {
+        _mappedFile.open(fileName, FileAccess::Read | FileAccess::OpenExisting);
+
+        if ((fileRegion.getOffset() < 0) ||
+            (fileRegion.getEnd() > _mappedFile.getMappingSize()))
+        {
+            throw ArgumentException("The region to map extends beyond the end of the file.",
+                                    "fileRegion");
+        }
+
+        if (fileRegion.getLength() > 0)
+        {
+            // Views must begin on a mapping block boundary, so map from the
+            // start of the block containing the region.
+            const StreamLength blockSize = static_cast<StreamLength>(MemoryMappedFile::getBlockSize());
+            StreamPosition firstBlock = fileRegion.getOffset() / blockSize;
+            StreamPosition viewOffset = firstBlock * blockSize;
+            StreamLength viewLength = fileRegion.getEnd() - viewOffset;
+
+            if constexpr (sizeof(size_t) < sizeof(StreamLength))
+            {
+                if (viewLength > static_cast<StreamLength>(SIZE_MAX))
+                    throw OperationException("The region of the file is too large "
+                                             "to map into the address space.");
+            }
+
+            _view = _mappedFile.createView(static_cast<uint64_t>(firstBlock),
+                                           static_cast<size_t>(viewLength));
+
+            _data = reinterpret_cast<uint8_cptr_t>(_view.getPointer()) +
+                    (fileRegion.getOffset() - viewOffset);
+        }
+    }
+
+    //! @brief Ensures the view is unmapped before the file is closed.
+    virtual ~MappedFileDataSource() override
+    {
+        _view.release();
+        _mappedFile.close();
+    }
+
+    // Overrides
+
+    // Inherited from ReadOnlyDataSource.
+    virtual bool tryReadByte(StreamPosition at, uint8_t &value) override
+    {
+        if (isRegionValid(StreamRegion(at, 1)))
+        {
+            value = _data[at];
+            return true;
+        }
+
+        value = 0;
+        return false;
+    }
+
+    // Inherited from ReadOnlyDataSource.
+    virtual bool tryRead(const StreamRegion &region, void *buffer) override
+    {
+        if (isRegionValid(region))
+        {
+            memcpy(buffer, _data + region.getOffset(),
+                   static_cast<size_t>(region.getLength()));
+
+            return true;
+        }
+
+        return false;
+    }
+
+    // Inherited from ReadOnlyDataSource.
+    virtual void readExactly(const StreamRegion &region, void *buffer) override
+    {
+        verifyRegion(region);
+
+        memcpy(buffer, _data + region.getOffset(),
+               static_cast<size_t>(region.getLength()));
+    }
+
+    // Inherited from ReadOnlyDataSource.
+    virtual ISeekableStreamUPtr readStream(const StreamRegion &region) override
+    {
+        verifyRegion(region);
+
+        // Read directly from the mapping rather than opening the file again.
+        return ISeekableStreamUPtr(new BlockViewStream(_data + region.getOffset(),
+                                                       static_cast<size_t>(region.getLength())));
+    }
+
+    // Inherited from ReadOnlyDataSource.
+    virtual bool tryGetView(const StreamRegion &region, const uint8_t *&data) override
+    {
+        if (isRegionValid(region))
+        {
+            data = _data + region.getOffset();
+            return true;
+        }
+
+        data = nullptr;
+        return false;
+    }
 };
 
 //! @brief A wrapper for a MemoryMappedView object which adds a
@@ -584,6 +726,435 @@ public:
     }
 };
 
+//! @brief An implementation of ISeekableStream which reads a region of a file
+//! using positional reads, so that it doesn't disturb other readers.
+class PositionalFileStream : public ISeekableStream
+{
+private:
+    // Internal Fields
+    const SeekableFileStream *_file;
+    StreamRegion _subRegion;
+    StreamPosition _readPosition;
+
+public:
+    // Construction/Destruction
+
+    //! @brief Constructs a stream to read part of a file shared with others.
+    //! @param[in] file The file to read, which must outlive the stream.
+    //! @param[in] region The region of the file to provide access to.
+    PositionalFileStream(const SeekableFileStream *file, const StreamRegion &region) :
+        _file(file),
+        _subRegion(region),
+        _readPosition(0)
+    {
+    }
+
+    // Overrides
+
+    // Inherited from IStream.
+    virtual void flush() override
+    {
+        // Do nothing.
+    }
+
+    // Inherited from IStream.
+    virtual size_t read(void *targetBuffer, size_t requiredByteCount) override
+    {
+        StreamLength maxStreamRead = _subRegion.getLength() - _readPosition;
+        StreamLength safeRead = std::min(maxStreamRead, static_cast<StreamLength>(requiredByteCount));
+
+        if (safeRead <= 0)
+            return 0;
+
+        size_t bytesRead = _file->readAt(_subRegion.getOffset() + _readPosition,
+                                         targetBuffer, static_cast<size_t>(safeRead));
+
+        _readPosition += static_cast<StreamPosition>(bytesRead);
+
+        return bytesRead;
+    }
+
+    // Inherited from IStream.
+    virtual size_t write(const void */*sourceBuffer*/, size_t /*sourceByteCount*/) override
+    {
+        throw NotSupportedException("Data cannot be written to a static data source.");
+    }
+
+    // Inherited from ISeekableStream.
+    virtual StreamPosition getLength() const override
+    {
+        return _subRegion.getLength();
+    }
+
+    // Inherited from ISeekableStream.
+    virtual StreamPosition getPosition() const override
+    {
+        return _readPosition;
+    }
+
+    // Inherited from ISeekableStream.
+    virtual StreamPosition setPosition(StreamRelative relativeTo,
+                                       StreamPosition offset) override
+    {
+        StreamPosition absPos = offset;
+
+        switch (relativeTo)
+        {
+        case Ag::IO::StreamRelative::Beginning:
+        default:
+            absPos = offset;
+            break;
+
+        case Ag::IO::StreamRelative::Current:
+            absPos = _readPosition + offset;
+            break;
+
+        case Ag::IO::StreamRelative::End:
+            absPos = _subRegion.getLength() + offset;
+            break;
+        }
+
+        if ((absPos < 0) || (absPos > _subRegion.getLength()))
+            throw ArgumentException("Stream offset out of range.", "offset");
+
+        _readPosition = absPos;
+
+        return _readPosition;
+    }
+};
+
+//! @brief An implementation of ReadOnlyDataSource which reads a region of an
+//! existing file on demand using positional reads.
+//! @details The object holds no state which changes as it is read, so any
+//! number of threads can read from it at once without locking.
+class PositionalFileDataSource : public ReadOnlyDataSource
+{
+private:
+    // Internal Fields
+    ISeekableStreamUPtr _fileStream;
+    const SeekableFileStream *_file;
+    StreamPosition _fileOffset;
+
+public:
+    // Construction/Destruction
+
+    //! @brief Constructs a data source which reads part of a file.
+    //! @param[in] fileName The path to the existing file to read.
+    //! @param[in] fileRegion The region of the file to provide access to.
+    //! @throws ArgumentException Thrown if @p fileRegion extends beyond the
+    //! end of the file.
+    PositionalFileDataSource(const Fs::Path &fileName, const StreamRegion &fileRegion) :
+        ReadOnlyDataSource(fileRegion.getLength()),
+        _fileStream(SeekableFileStream::open(fileName, FileAccess::Read |
+                                                       FileAccess::OpenExisting)),
+        _file(static_cast<const SeekableFileStream *>(_fileStream.get())),
+        _fileOffset(fileRegion.getOffset())
+    {
+        if ((fileRegion.getOffset() < 0) ||
+            (fileRegion.getEnd() > _fileStream->getLength()))
+        {
+            throw ArgumentException("The region to read extends beyond the end of the file.",
+                                    "fileRegion");
+        }
+    }
+
+    // Overrides
+
+    // Inherited from ReadOnlyDataSource.
+    virtual bool tryReadByte(StreamPosition at, uint8_t &value) override
+    {
+        value = 0;
+
+        return isRegionValid(StreamRegion(at, 1)) &&
+               (_file->readAt(_fileOffset + at, &value, 1) == 1);
+    }
+
+    // Inherited from ReadOnlyDataSource.
+    virtual bool tryRead(const StreamRegion &region, void *buffer) override
+    {
+        if (isRegionValid(region) == false)
+            return false;
+
+        size_t byteCount = static_cast<size_t>(region.getLength());
+
+        return _file->readAt(_fileOffset + region.getOffset(), buffer, byteCount) == byteCount;
+    }
+
+    // Inherited from ReadOnlyDataSource.
+    virtual void readExactly(const StreamRegion &region, void *buffer) override
+    {
+        verifyRegion(region);
+
+        if (tryRead(region, buffer) == false)
+            throw IOException("Failed to read the number of bytes requested.");
+    }
+
+    // Inherited from ReadOnlyDataSource.
+    virtual ISeekableStreamUPtr readStream(const StreamRegion &region) override
+    {
+        verifyRegion(region);
+
+        StreamRegion fileRegion(_fileOffset + region.getOffset(), region.getLength());
+
+        return ISeekableStreamUPtr(new PositionalFileStream(_file, fileRegion));
+    }
+};
+
+//! @brief An implementation of ReadOnlyDataSource backed by a set of
+//! independently compressed chunks which are decompressed on demand.
+//! @remarks Chunks are retained once decompressed, so that views and streams
+//! of data within a single chunk remain valid for the lifetime of the object.
+//! Accesses spanning several chunks which have not yet been decompressed
+//! decompress them in parallel.
+class ChunkedDataSource : public ReadOnlyDataSource
+{
+private:
+    // Internal Types
+    //! @brief The state of a single chunk of the data.
+    struct Chunk
+    {
+        ByteBlock CompressedData;
+        ByteBlock Data;
+        std::once_flag LoadOnce;
+        std::atomic<bool> IsLoaded { false };
+    };
+
+    // Internal Fields
+    const ICompressionCodec &_codec;
+    std::unique_ptr<Chunk[]> _chunks;
+    std::unique_ptr<WorkerPool> _pool;
+    std::mutex _poolLock;
+    size_t _chunkCount;
+    StreamLength _chunkSize;
+public:
+    // Construction/Destruction
+
+    //! @brief Constructs a data source from compressed chunks.
+    //! @param[in] rootExtent The total count of bytes of decompressed data.
+    //! @param[in] chunkSize The count of decompressed bytes in each chunk
+    //! apart from the last.
+    //! @param[in] codec The algorithm used to compress each chunk.
+    //! @param[in] compressedChunks The compressed chunk data.
+    ChunkedDataSource(StreamLength rootExtent, StreamLength chunkSize,
+                      const ICompressionCodec &codec,
+                      std::vector<ByteBlock> &&compressedChunks) :
+        ReadOnlyDataSource(rootExtent),
+        _codec(codec),
+        _chunks(new Chunk[compressedChunks.size()]),
+        _chunkCount(compressedChunks.size()),
+        _chunkSize(chunkSize)
+    {
+        for (size_t index = 0; index < _chunkCount; ++index)
+            _chunks[index].CompressedData = std::move(compressedChunks[index]);
+    }
+
+    // Overrides
+
+    // Inherited from ReadOnlyDataSource.
+    virtual bool tryReadByte(StreamPosition at, uint8_t &value) override
+    {
+        if (isRegionValid(StreamRegion(at, 1)))
+        {
+            size_t index = static_cast<size_t>(at / _chunkSize);
+            const ByteBlock &data = getChunk(index);
+
+            value = data[static_cast<size_t>(at - (index * _chunkSize))];
+            return true;
+        }
+
+        value = 0;
+        return false;
+    }
+
+    // Inherited from ReadOnlyDataSource.
+    virtual bool tryRead(const StreamRegion &region, void *buffer) override
+    {
+        if (isRegionValid(region) == false)
+            return false;
+
+        if (region.getLength() > 0)
+            copyRegion(region, static_cast<uint8_t *>(buffer));
+
+        return true;
+    }
+
+    // Inherited from ReadOnlyDataSource.
+    virtual void readExactly(const StreamRegion &region, void *buffer) override
+    {
+        verifyRegion(region);
+
+        if (region.getLength() > 0)
+            copyRegion(region, static_cast<uint8_t *>(buffer));
+    }
+
+    // Inherited from ReadOnlyDataSource.
+    virtual ISeekableStreamUPtr readStream(const StreamRegion &region) override
+    {
+        verifyRegion(region);
+
+        const uint8_t *data = nullptr;
+
+        if (tryGetView(region, data))
+        {
+            return ISeekableStreamUPtr(new BlockViewStream(data,
+                                                           static_cast<size_t>(region.getLength())));
+        }
+
+        // The region spans chunks, so a copy of it is required.
+        ByteBlock buffer(static_cast<size_t>(region.getLength()));
+        copyRegion(region, buffer.data());
+
+        return ISeekableStreamUPtr(new MemoryStream(buffer.data(), buffer.size(), true));
+    }
+
+    // Inherited from ReadOnlyDataSource.
+    virtual bool tryGetView(const StreamRegion &region, const uint8_t *&data) override
+    {
+        data = nullptr;
+
+        if ((isRegionValid(region) == false) || (region.getLength() < 1))
+            return false;
+
+        size_t first = static_cast<size_t>(region.getOffset() / _chunkSize);
+        size_t last = static_cast<size_t>((region.getEnd() - 1) / _chunkSize);
+
+        if (first != last)
+            return false;
+
+        data = getChunk(first).data() + (region.getOffset() - (first * _chunkSize));
+        return true;
+    }
+
+private:
+    // Internal Functions
+    //! @brief Gets the decompressed data of a chunk, decompressing it if
+    //! it has not been accessed before.
+    //! @param[in] index The 0-based index of the chunk.
+    //! @return The decompressed chunk data.
+    const ByteBlock &getChunk(size_t index)
+    {
+        Chunk &chunk = _chunks[index];
+
+        if (chunk.IsLoaded.load(std::memory_order_acquire) == false)
+        {
+            std::call_once(chunk.LoadOnce, [this, &chunk, index]() {
+                StreamLength chunkOffset = static_cast<StreamLength>(index) * _chunkSize;
+                size_t length = static_cast<size_t>(std::min(_chunkSize,
+                                                             getRootRegion().getEnd() - chunkOffset));
+
+                ByteBlock data(length);
+
+                try
+                {
+                    _codec.decompress(chunk.CompressedData.data(),
+                                      chunk.CompressedData.size(),
+                                      data.data(), length);
+                }
+                catch (const Exception &)
+                {
+                    throw DataFormatException("A compressed payload chunk was corrupt.");
+                }
+
+                chunk.Data = std::move(data);
+                chunk.CompressedData = ByteBlock();
+                chunk.IsLoaded.store(true, std::memory_order_release);
+            });
+        }
+
+        return chunk.Data;
+    }
+
+    //! @brief Copies a region which may span several chunks to a buffer,
+    //! decompressing any chunks not yet accessed in parallel.
+    //! @param[in] region The valid, non-empty region to copy.
+    //! @param[out] buffer The buffer to receive the data.
+    void copyRegion(const StreamRegion &region, uint8_t *buffer)
+    {
+        size_t first = static_cast<size_t>(region.getOffset() / _chunkSize);
+        size_t last = static_cast<size_t>((region.getEnd() - 1) / _chunkSize);
+
+        if (first != last)
+            loadChunks(first, last);
+
+        StreamPosition position = region.getOffset();
+        StreamLength remaining = region.getLength();
+
+        for (size_t index = first; index <= last; ++index)
+        {
+            const ByteBlock &data = getChunk(index);
+            size_t offset = static_cast<size_t>(position - (index * _chunkSize));
+            size_t length = static_cast<size_t>(std::min(remaining,
+                                                         static_cast<StreamLength>(data.size() - offset)));
+
+            std::memcpy(buffer, data.data() + offset, length);
+            buffer += length;
+            position += length;
+            remaining -= length;
+        }
+    }
+
+    //! @brief Ensures a range of chunks are decompressed, decompressing those
+    //! which have not been on worker threads.
+    //! @param[in] first The index of the first chunk to load.
+    //! @param[in] last The index of the last chunk to load.
+    void loadChunks(size_t first, size_t last)
+    {
+        std::vector<size_t> pending;
+
+        for (size_t index = first; index <= last; ++index)
+        {
+            if (_chunks[index].IsLoaded.load(std::memory_order_acquire) == false)
+                pending.push_back(index);
+        }
+
+        if (pending.size() < 2)
+            return;
+
+        WorkerPool *pool;
+
+        {
+            std::lock_guard<std::mutex> guard(_poolLock);
+
+            if (!_pool)
+                _pool = std::make_unique<WorkerPool>();
+
+            pool = _pool.get();
+        }
+
+        std::vector<std::future<void>> results;
+        results.reserve(pending.size());
+
+        for (size_t index : pending)
+            results.push_back(pool->submit([this, index]() { getChunk(index); }));
+
+        // Wait for all chunks, propagating any failure.
+        for (auto &result : results)
+            result.get();
+    }
+
+    //! @brief Reads from a stream until a buffer is full or the stream ends.
+    //! @param[in] input The stream to read from.
+    //! @param[out] buffer The buffer to fill.
+    //! @param[in] byteCount The count of bytes to read.
+    //! @return The count of bytes read.
+    static size_t readAll(IStream *input, uint8_t *buffer, size_t byteCount)
+    {
+        size_t totalRead = 0;
+
+        while (totalRead < byteCount)
+        {
+            size_t bytesRead = input->read(buffer + totalRead, byteCount - totalRead);
+
+            if (bytesRead == 0)
+                break;
+
+            totalRead += bytesRead;
+        }
+
+        return totalRead;
+    }
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 // Local Data
 ////////////////////////////////////////////////////////////////////////////////
@@ -646,6 +1217,64 @@ ReadOnlyDataSource::UPtr ReadOnlyDataSource::create(IStream *inputData,
     }
 }
 
+//! @brief Creates an object which allows random read-only access to a region
+//! of an existing file by mapping it into memory without copying it.
+//! @param[in] fileName The path to the file to map.
+//! @param[in] fileRegion The region of the file to access. Offset 0 of the
+//! resultant data source will correspond to the start of the region.
+//! @return An object which provides access to the data during its lifetime.
+//! @remarks The entire region is mapped at once so that views obtained from
+//! tryGetView() remain valid for the lifetime of the data source.
+ReadOnlyDataSource::UPtr ReadOnlyDataSource::createMapped(const Fs::Path &fileName,
+                                                          const StreamRegion &fileRegion)
+{
+    if (fileRegion.getLength() < 0)
+        throw ArgumentException("The size of the data source must be non-negative.",
+                                "fileRegion");
+
+    return UPtr(new MappedFileDataSource(fileName, fileRegion));
+}
+
+//! @brief Creates an object which allows random read-only access to a region
+//! of an existing file by reading it on demand.
+//! @param[in] fileName The path to the file to read.
+//! @param[in] fileRegion The region of the file to access. Offset 0 of the
+//! resultant data source will correspond to the start of the region.
+//! @return An object which provides access to the data during its lifetime.
+//! @remarks Unlike createMapped(), no address space is consumed, and any
+//! number of threads can read the data source, or streams obtained from it,
+//! at once. Streams obtained from readStream() must not outlive the source.
+ReadOnlyDataSource::UPtr ReadOnlyDataSource::createPositional(const Fs::Path &fileName,
+                                                              const StreamRegion &fileRegion)
+{
+    if (fileRegion.getLength() < 0)
+        throw ArgumentException("The size of the data source must be non-negative.",
+                                "fileRegion");
+
+    return UPtr(new PositionalFileDataSource(fileName, fileRegion));
+}
+
+//! @brief Creates an object which allows random read-only access to a
+//! payload stored as independently compressed chunks.
+//! @param[in] byteCount The total count of decompressed bytes.
+//! @param[in] chunkSize The count of decompressed bytes in each chunk apart
+//! from the last.
+//! @param[in] codec The algorithm used to compress each chunk.
+//! @param[in] compressedChunks The compressed data of each chunk.
+//! @return An object which decompresses chunks as they are first accessed.
+ReadOnlyDataSource::UPtr ReadOnlyDataSource::createChunked(StreamLength byteCount,
+                                                           StreamLength chunkSize,
+                                                           const ICompressionCodec &codec,
+                                                           std::vector<ByteBlock> &&compressedChunks)
+{
+    if ((byteCount < 0) || (chunkSize < 1))
+        throw ArgumentException("The size of the data source must be non-negative.",
+                                "byteCount");
+
+    return UPtr(new ChunkedDataSource(byteCount, chunkSize, codec,
+                                       std::move(compressedChunks)));
+}
+
 //! @brief Gets the region of the underlying data source the object accesses.
 const StreamRegion &ReadOnlyDataSource::getRootRegion() const
 {
@@ -675,6 +1304,19 @@ void ReadOnlyDataSource::verifyRegion(const StreamRegion &region) const
     }
 }
 
+//! @brief Attempts to obtain a pointer to data resident in memory without
+//! copying it.
+//! @param[in] region The region of the data source to access.
+//! @param[out] data Receives a pointer to the first byte of @p region, valid
+//! for the lifetime of the data source, on success.
+//! @retval true The data was resident in memory and @p data was updated.
+//! @retval false The region was invalid, or the data source cannot provide
+//! persistent access to it, in which case tryRead() should be used instead.
+bool ReadOnlyDataSource::tryGetView(const StreamRegion &/*region*/, const uint8_t *&data)
+{
+    data = nullptr;
+    return false;
+}
+
 }} // namespace Ag::IO
 ////////////////////////////////////////////////////////////////////////////////
-
@@ -13,6 +13,11 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Dependent Header Files
 ////////////////////////////////////////////////////////////////////////////////
+#include <vector>
+
+#include "Ag/Core/Binary.hpp"
+#include "Ag/Core/CompressionCodec.hpp"
+#include "Ag/Core/FsPath.hpp"
 #include "Ag/IO/ISeekableStream.hpp"
 
 namespace Ag {
@@ -35,6 +40,11 @@ protected:
 public:
     virtual ~ReadOnlyDataSource() = default;
     static UPtr create(IStream *inputData, StreamLength byteCount);
+    static UPtr createMapped(const Fs::Path &fileName, const StreamRegion &fileRegion);
+    static UPtr createPositional(const Fs::Path &fileName, const StreamRegion &fileRegion);
+    static UPtr createChunked(StreamLength byteCount, StreamLength chunkSize,
+                              const ICompressionCodec &codec,
+                              std::vector<ByteBlock> &&compressedChunks);
 
     // Accessors
     const StreamRegion &getRootRegion() const;
@@ -45,6 +55,7 @@ public:
     virtual bool tryRead(const StreamRegion &region, void *buffer) = 0;
     virtual void readExactly(const StreamRegion &region, void *buffer) = 0;
     virtual ISeekableStreamUPtr readStream(const StreamRegion &region) = 0;
+    virtual bool tryGetView(const StreamRegion &region, const uint8_t *&data);
 
 protected:
     // Internal Functions
@@ -15,10 +15,13 @@
 #ifndef _WIN32
 // POSIX Headers required.
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <fcntl.h>
 #include <unistd.h>
 #endif
 
+#include <mutex>
+
 #include <Ag/Core.hpp>
 
 #include "Ag/IO/SeekableFileStream.hpp"
@@ -39,6 +42,10 @@ struct FileTraits
     using ErrorCode = DWORD;
     static constexpr FileDescriptor BadFile = INVALID_HANDLE_VALUE;
 
+    //! @brief Serialises use of the file pointer, which positional operations
+    //! save and restore.
+    using PositionGuard = std::lock_guard<std::mutex>;
+
     static Exception createError(const std::string_view &fnName,
                                  ErrorCode errorCode)
     {
@@ -121,6 +128,184 @@ struct FileTraits
         return bytesWritten;
     }
 
+    static size_t readScattered(FileDescriptor fd, const MutableByteSpan *buffers,
+                                size_t bufferCount, ErrorCode &errorCode)
+    {
+        // ReadFileScatter() only supports unbuffered page-aligned transfers,
+        // so fill each buffer in turn.
+        size_t bytesRead = 0;
+        errorCode = ERROR_SUCCESS;
+
+        for (size_t index = 0; index < bufferCount; ++index)
+        {
+            const MutableByteSpan &buffer = buffers[index];
+            size_t actuallyRead = read(fd, buffer.Data, buffer.Length, errorCode);
+            bytesRead += actuallyRead;
+
+            if ((errorCode != ERROR_SUCCESS) || (actuallyRead < buffer.Length))
+                break;
+        }
+
+        return bytesRead;
+    }
+
+    static size_t writeGathered(FileDescriptor fd, const ByteSpan *buffers,
+                                size_t bufferCount, ErrorCode &errorCode)
+    {
+        // WriteFileGather() only supports unbuffered page-aligned transfers,
+        // so write each buffer in turn.
+        size_t bytesWritten = 0;
+        errorCode = ERROR_SUCCESS;
+
+        for (size_t index = 0; index < bufferCount; ++index)
+        {
+            const ByteSpan &buffer = buffers[index];
+            size_t actuallyWritten = write(fd, buffer.Data, buffer.Length, errorCode);
+            bytesWritten += actuallyWritten;
+
+            if ((errorCode != ERROR_SUCCESS) || (actuallyWritten < buffer.Length))
+                break;
+        }
+
+        return bytesWritten;
+    }
+
+    static size_t readAt(FileDescriptor fd, StreamPosition offset, void *buffer,
+                         size_t byteCount, ErrorCode &errorCode)
+    {
+        uint8_t *target = reinterpret_cast<uint8_t *>(buffer);
+        size_t bytesRead = 0;
+        errorCode = ERROR_SUCCESS;
+
+        // ReadFile() moves the file pointer of a handle which wasn't opened
+        // for overlapped I/O, even when given an offset, so restore it.
+        LARGE_INTEGER savedPosition;
+        LARGE_INTEGER noOffset;
+        noOffset.QuadPart = 0;
+
+        if (::SetFilePointerEx(fd, noOffset, &savedPosition, FILE_CURRENT) == FALSE)
+        {
+            errorCode = ::GetLastError();
+            return 0;
+        }
+
+        while (bytesRead < byteCount)
+        {
+            DWORD bytesToRead = static_cast<DWORD>(std::min<size_t>(UINT32_MAX,
+                                                                    byteCount - bytesRead));
+            DWORD actuallyRead = 0;
+            OVERLAPPED position = { 0 };
+            ULARGE_INTEGER at;
+            at.QuadPart = static_cast<ULONGLONG>(offset) + bytesRead;
+            position.Offset = at.LowPart;
+            position.OffsetHigh = at.HighPart;
+
+            if (::ReadFile(fd, target + bytesRead, bytesToRead, &actuallyRead, &position))
+            {
+                bytesRead += actuallyRead;
+
+                if (actuallyRead < bytesToRead)
+                {
+                    // We got as much as we could.
+                    break;
+                }
+            }
+            else
+            {
+                errorCode = ::GetLastError();
+
+                if (errorCode == ERROR_HANDLE_EOF)
+                    errorCode = ERROR_SUCCESS;
+
+                break;
+            }
+        }
+
+        if ((::SetFilePointerEx(fd, savedPosition, nullptr, FILE_BEGIN) == FALSE) &&
+            (errorCode == ERROR_SUCCESS))
+        {
+            errorCode = ::GetLastError();
+        }
+
+        return bytesRead;
+    }
+
+    static size_t writeAt(FileDescriptor fd, StreamPosition offset, const void *buffer,
+                          size_t byteCount, ErrorCode &errorCode)
+    {
+        const uint8_t *source = reinterpret_cast<const uint8_t *>(buffer);
+        size_t bytesWritten = 0;
+        errorCode = ERROR_SUCCESS;
+
+        // WriteFile() also moves the file pointer, so restore it.
+        LARGE_INTEGER savedPosition;
+        LARGE_INTEGER noOffset;
+        noOffset.QuadPart = 0;
+
+        if (::SetFilePointerEx(fd, noOffset, &savedPosition, FILE_CURRENT) == FALSE)
+        {
+            errorCode = ::GetLastError();
+            return 0;
+        }
+
+        while (bytesWritten < byteCount)
+        {
+            DWORD bytesToWrite = static_cast<DWORD>(std::min<size_t>(UINT32_MAX,
+                                                                     byteCount - bytesWritten));
+            DWORD actuallyWritten = 0;
+            OVERLAPPED position = { 0 };
+            ULARGE_INTEGER at;
+            at.QuadPart = static_cast<ULONGLONG>(offset) + bytesWritten;
+            position.Offset = at.LowPart;
+            position.OffsetHigh = at.HighPart;
+
+            if (::WriteFile(fd, source + bytesWritten, bytesToWrite, &actuallyWritten, &position))
+            {
+                bytesWritten += actuallyWritten;
+
+                if (actuallyWritten < bytesToWrite)
+                {
+                    // We didn't manage to write it all, so stop trying.
+                    break;
+                }
+            }
+            else
+            {
+                errorCode = ::GetLastError();
+                break;
+            }
+        }
+
+        if ((::SetFilePointerEx(fd, savedPosition, nullptr, FILE_BEGIN) == FALSE) &&
+            (errorCode == ERROR_SUCCESS))
+        {
+            errorCode = ::GetLastError();
+        }
+
+        return bytesWritten;
+    }
+
+    static size_t readScatteredAt(FileDescriptor fd, StreamPosition offset,
+                                  const MutableByteSpan *buffers, size_t bufferCount,
+                                  ErrorCode &errorCode)
+    {
+        size_t bytesRead = 0;
+        errorCode = ERROR_SUCCESS;
+
+        for (size_t index = 0; index < bufferCount; ++index)
+        {
+            const MutableByteSpan &buffer = buffers[index];
+            size_t actuallyRead = readAt(fd, offset + bytesRead, buffer.Data,
+                                         buffer.Length, errorCode);
+            bytesRead += actuallyRead;
+
+            if ((errorCode != ERROR_SUCCESS) || (actuallyRead < buffer.Length))
+                break;
+        }
+
+        return bytesRead;
+    }
+
     static StreamPosition getSize(FileDescriptor fd, ErrorCode &errorCode)
     {
         LARGE_INTEGER win32FileSize;
@@ -266,6 +451,17 @@ struct FileTraits
     using ErrorCode = int;
     static constexpr FileDescriptor BadFile = -1;
 
+    //! @brief Positional operations never use the file pointer, so no
+    //! serialisation is required.
+    struct PositionGuard
+    {
+        PositionGuard(std::mutex &) {}
+    };
+
+    //! @brief The maximum count of buffers passed to a single vectored
+    //! operation, well within IOV_MAX.
+    static constexpr int MaxVectorCount = 64;
+
     static Exception createError(const std::string_view &fnName,
                                  ErrorCode errorCode)
     {
@@ -316,6 +512,220 @@ struct FileTraits
         }
     }
 
+    static size_t readScattered(FileDescriptor fd, const MutableByteSpan *buffers,
+                                size_t bufferCount, ErrorCode &errorCode)
+    {
+        iovec vectors[MaxVectorCount];
+        size_t bytesRead = 0;
+        size_t index = 0;
+        errorCode = 0;
+
+        while (index < bufferCount)
+        {
+            int vectorCount = 0;
+            size_t batchSize = 0;
+
+            for (; (index < bufferCount) && (vectorCount < MaxVectorCount); ++index)
+            {
+                if (buffers[index].Length > 0)
+                {
+                    vectors[vectorCount].iov_base = buffers[index].Data;
+                    vectors[vectorCount].iov_len = buffers[index].Length;
+                    batchSize += buffers[index].Length;
+                    ++vectorCount;
+                }
+            }
+
+            if (vectorCount == 0)
+                break;
+
+            auto actuallyRead = ::readv(fd, vectors, vectorCount);
+
+            if (actuallyRead < 0)
+            {
+                errorCode = errno;
+                break;
+            }
+
+            bytesRead += static_cast<size_t>(actuallyRead);
+
+            if (static_cast<size_t>(actuallyRead) < batchSize)
+            {
+                // We got as much as we could.
+                break;
+            }
+        }
+
+        return bytesRead;
+    }
+
+    static size_t writeGathered(FileDescriptor fd, const ByteSpan *buffers,
+                                size_t bufferCount, ErrorCode &errorCode)
+    {
+        iovec vectors[MaxVectorCount];
+        size_t bytesWritten = 0;
+        size_t index = 0;
+        errorCode = 0;
+
+        while (index < bufferCount)
+        {
+            int vectorCount = 0;
+
+            for (; (index < bufferCount) && (vectorCount < MaxVectorCount); ++index)
+            {
+                if (buffers[index].Length > 0)
+                {
+                    vectors[vectorCount].iov_base = const_cast<uint8_t *>(buffers[index].Data);
+                    vectors[vectorCount].iov_len = buffers[index].Length;
+                    ++vectorCount;
+                }
+            }
+
+            iovec *pending = vectors;
+
+            while (vectorCount > 0)
+            {
+                auto actuallyWritten = ::writev(fd, pending, vectorCount);
+
+                if (actuallyWritten <= 0)
+                {
+                    // Stop on an error or if the device will take no more.
+                    errorCode = (actuallyWritten < 0) ? errno : 0;
+                    return bytesWritten;
+                }
+
+                bytesWritten += static_cast<size_t>(actuallyWritten);
+
+                // Skip the vectors which were fully written and trim the
+                // first which was partially written, if any.
+                size_t remaining = static_cast<size_t>(actuallyWritten);
+
+                while ((vectorCount > 0) && (remaining >= pending->iov_len))
+                {
+                    remaining -= pending->iov_len;
+                    ++pending;
+                    --vectorCount;
+                }
+
+                if (vectorCount > 0)
+                {
+                    pending->iov_base = static_cast<uint8_t *>(pending->iov_base) + remaining;
+                    pending->iov_len -= remaining;
+                }
+            }
+        }
+
+        return bytesWritten;
+    }
+
+    static size_t readAt(FileDescriptor fd, StreamPosition offset, void *buffer,
+                         size_t byteCount, ErrorCode &errorCode)
+    {
+        uint8_t *target = reinterpret_cast<uint8_t *>(buffer);
+        size_t bytesRead = 0;
+        errorCode = 0;
+
+        while (bytesRead < byteCount)
+        {
+            auto actuallyRead = ::pread64(fd, target + bytesRead, byteCount - bytesRead,
+                                          static_cast<off64_t>(offset + bytesRead));
+
+            if (actuallyRead < 0)
+            {
+                errorCode = errno;
+                break;
+            }
+            else if (actuallyRead == 0)
+            {
+                // The end of the file has been reached.
+                break;
+            }
+
+            bytesRead += static_cast<size_t>(actuallyRead);
+        }
+
+        return bytesRead;
+    }
+
+    static size_t writeAt(FileDescriptor fd, StreamPosition offset, const void *buffer,
+                          size_t byteCount, ErrorCode &errorCode)
+    {
+        const uint8_t *source = reinterpret_cast<const uint8_t *>(buffer);
+        size_t bytesWritten = 0;
+        errorCode = 0;
+
+        while (bytesWritten < byteCount)
+        {
+            auto actuallyWritten = ::pwrite64(fd, source + bytesWritten,
+                                              byteCount - bytesWritten,
+                                              static_cast<off64_t>(offset + bytesWritten));
+
+            if (actuallyWritten < 0)
+            {
+                errorCode = errno;
+                break;
+            }
+            else if (actuallyWritten == 0)
+            {
+                // The device will take no more.
+                break;
+            }
+
+            bytesWritten += static_cast<size_t>(actuallyWritten);
+        }
+
+        return bytesWritten;
+    }
+
+    static size_t readScatteredAt(FileDescriptor fd, StreamPosition offset,
+                                  const MutableByteSpan *buffers, size_t bufferCount,
+                                  ErrorCode &errorCode)
+    {
+        iovec vectors[MaxVectorCount];
+        size_t bytesRead = 0;
+        size_t index = 0;
+        errorCode = 0;
+
+        while (index < bufferCount)
+        {
+            int vectorCount = 0;
+            size_t batchSize = 0;
+
+            for (; (index < bufferCount) && (vectorCount < MaxVectorCount); ++index)
+            {
+                if (buffers[index].Length > 0)
+                {
+                    vectors[vectorCount].iov_base = buffers[index].Data;
+                    vectors[vectorCount].iov_len = buffers[index].Length;
+                    batchSize += buffers[index].Length;
+                    ++vectorCount;
+                }
+            }
+
+            if (vectorCount == 0)
+                break;
+
+            auto actuallyRead = ::preadv64(fd, vectors, vectorCount,
+                                           static_cast<off64_t>(offset + bytesRead));
+
+            if (actuallyRead < 0)
+            {
+                errorCode = errno;
+                break;
+            }
+
+            bytesRead += static_cast<size_t>(actuallyRead);
+
+            if (static_cast<size_t>(actuallyRead) < batchSize)
+            {
+                // We got as much as we could.
+                break;
+            }
+        }
+
+        return bytesRead;
+    }
+
     static StreamPosition getSize(FileDescriptor fd, ErrorCode &errorCode)
     {
         struct stat64 fileInfo;
@@ -602,6 +1012,8 @@ size_t SeekableFileStream::read(void *targetBuffer, size_t requiredByteCount)
     if (_fd == FileTraits::BadFile)
         throw OperationException("Reading from a file which isn't open.");
 
+    FileTraits::PositionGuard guard(_positionLock);
+
     FileTraits::ErrorCode errorCode;
     size_t bytesRead = FileTraits::read(_fd, targetBuffer,
                                         requiredByteCount,
@@ -628,6 +1040,8 @@ size_t SeekableFileStream::write(const void *sourceBuffer, size_t sourceByteCoun
     if (_fd == FileTraits::BadFile)
         throw OperationException("Writing to a file which isn't open.");
 
+    FileTraits::PositionGuard guard(_positionLock);
+
     FileTraits::ErrorCode errorCode;
     size_t bytesWritten = FileTraits::write(_fd, sourceBuffer,
                                             sourceByteCount,
@@ -648,6 +1062,168 @@ size_t SeekableFileStream::write(const void *sourceBuffer, size_t sourceByteCoun
     return bytesWritten;
 }
 
+// Inherited from IStream.
+size_t SeekableFileStream::readScattered(const MutableByteSpan *targetBuffers,
+                                         size_t bufferCount)
+{
+    if (_fd == FileTraits::BadFile)
+        throw OperationException("Reading from a file which isn't open.");
+
+    FileTraits::PositionGuard guard(_positionLock);
+
+    FileTraits::ErrorCode errorCode;
+    size_t bytesRead = FileTraits::readScattered(_fd, targetBuffers,
+                                                 bufferCount, errorCode);
+
+    if (errorCode != 0)
+    {
+        std::string fnName;
+        fnName.assign("file.readScattered('");
+        appendAgString(fnName, _location.toString(Fs::PathUsage::Kernel));
+        fnName.append("')");
+
+        throw FileTraits::createError(fnName, errorCode);
+    }
+
+    return bytesRead;
+}
+
+// Inherited from IStream.
+size_t SeekableFileStream::writeGathered(const ByteSpan *sourceBuffers,
+                                         size_t bufferCount)
+{
+    if (_fd == FileTraits::BadFile)
+        throw OperationException("Writing to a file which isn't open.");
+
+    FileTraits::PositionGuard guard(_positionLock);
+
+    FileTraits::ErrorCode errorCode;
+    size_t bytesWritten = FileTraits::writeGathered(_fd, sourceBuffers,
+                                                    bufferCount, errorCode);
+
+    if (errorCode != 0)
+    {
+        std::string fnName;
+        fnName.assign("file.writeGathered('");
+        appendAgString(fnName, _location.toString(Fs::PathUsage::Kernel));
+        fnName.append("')");
+
+        throw FileTraits::createError(fnName, errorCode);
+    }
+
+    return bytesWritten;
+}
+
+//! @brief Reads bytes from a specific offset in the file without using or
+//! affecting the position shared with read() and write().
+//! @param[in] offset The offset of the first byte to read.
+//! @param[out] targetBuffer The buffer to receive the bytes read.
+//! @param[in] byteCount The count of bytes to read.
+//! @return The count of bytes actually read, which is only less than
+//! @p byteCount if the end of the file was reached.
+//! @remarks Multiple threads can read from the same stream at once.
+//! @throws OperationException If the file is not open.
+//! @throws Ag::Exception If an error occurs during the read.
+size_t SeekableFileStream::readAt(StreamPosition offset, void *targetBuffer,
+                                  size_t byteCount) const
+{
+    if (_fd == FileTraits::BadFile)
+        throw OperationException("Reading from a file which isn't open.");
+
+    FileTraits::PositionGuard guard(_positionLock);
+
+    FileTraits::ErrorCode errorCode;
+    size_t bytesRead = FileTraits::readAt(_fd, offset, targetBuffer,
+                                          byteCount, errorCode);
+
+    if (errorCode != 0)
+    {
+        std::string fnName;
+        fnName.assign("file.readAt('");
+        appendAgString(fnName, _location.toString(Fs::PathUsage::Kernel));
+        fnName.append("', ");
+        appendFileSize(FormatInfo::getDisplay(), fnName, byteCount);
+        fnName.push_back(')');
+
+        throw FileTraits::createError(fnName, errorCode);
+    }
+
+    return bytesRead;
+}
+
+//! @brief Reads bytes from a specific offset in the file into a sequence of
+//! buffers without using or affecting the shared position.
+//! @param[in] offset The offset of the first byte to read.
+//! @param[in] targetBuffers An array of buffers to fill in order.
+//! @param[in] bufferCount The count of elements in @p targetBuffers.
+//! @return The total count of bytes read, which is only less than the
+//! combined size of the buffers if the end of the file was reached.
+//! @remarks Multiple threads can read from the same stream at once.
+//! @throws OperationException If the file is not open.
+//! @throws Ag::Exception If an error occurs during the read.
+size_t SeekableFileStream::readScatteredAt(StreamPosition offset,
+                                           const MutableByteSpan *targetBuffers,
+                                           size_t bufferCount) const
+{
+    if (_fd == FileTraits::BadFile)
+        throw OperationException("Reading from a file which isn't open.");
+
+    FileTraits::PositionGuard guard(_positionLock);
+
+    FileTraits::ErrorCode errorCode;
+    size_t bytesRead = FileTraits::readScatteredAt(_fd, offset, targetBuffers,
+                                                   bufferCount, errorCode);
+
+    if (errorCode != 0)
+    {
+        std::string fnName;
+        fnName.assign("file.readScatteredAt('");
+        appendAgString(fnName, _location.toString(Fs::PathUsage::Kernel));
+        fnName.append("')");
+
+        throw FileTraits::createError(fnName, errorCode);
+    }
+
+    return bytesRead;
+}
+
+//! @brief Writes bytes to a specific offset in the file without using or
+//! affecting the position shared with read() and write().
+//! @param[in] offset The offset in the file to write the first byte to.
+//! @param[in] sourceBuffer The bytes to write.
+//! @param[in] byteCount The count of bytes to write.
+//! @return The count of bytes actually written.
+//! @remarks Multiple threads can write to disjoint regions of the same stream
+//! at once.
+//! @throws OperationException If the file is not open.
+//! @throws Ag::Exception If an error occurs during the write.
+size_t SeekableFileStream::writeAt(StreamPosition offset, const void *sourceBuffer,
+                                   size_t byteCount)
+{
+    if (_fd == FileTraits::BadFile)
+        throw OperationException("Writing to a file which isn't open.");
+
+    FileTraits::PositionGuard guard(_positionLock);
+
+    FileTraits::ErrorCode errorCode;
+    size_t bytesWritten = FileTraits::writeAt(_fd, offset, sourceBuffer,
+                                              byteCount, errorCode);
+
+    if (errorCode != 0)
+    {
+        std::string fnName;
+        fnName.assign("file.writeAt('");
+        appendAgString(fnName, _location.toString(Fs::PathUsage::Kernel));
+        fnName.append("', ");
+        appendFileSize(FormatInfo::getDisplay(), fnName, byteCount);
+        fnName.push_back(')');
+
+        throw FileTraits::createError(fnName, errorCode);
+    }
+
+    return bytesWritten;
+}
+
 // Inherited from ISeekableStream.
 StreamPosition SeekableFileStream::getLength() const
 {
@@ -677,6 +1253,8 @@ StreamPosition SeekableFileStream::getPosition() const
     if (_fd == FileTraits::BadFile)
         throw OperationException("Cannot query position of a closed file.");
 
+    FileTraits::PositionGuard guard(_positionLock);
+
     FileTraits::ErrorCode errorCode = 0;
     StreamPosition absPos = FileTraits::tell(_fd, errorCode);
 
@@ -699,6 +1277,8 @@ StreamPosition SeekableFileStream::setPosition(StreamRelative relativeTo, Stream
     if (_fd == FileTraits::BadFile)
         throw OperationException("Cannot query position of a closed file.");
 
+    FileTraits::PositionGuard guard(_positionLock);
+
     FileTraits::ErrorCode errorCode = 0;
     StreamPosition absPos = FileTraits::seek(_fd, relativeTo, offset, errorCode);
 
@@ -22,6 +22,40 @@ namespace IO {
 
 namespace {
 
+////////////////////////////////////////////////////////////////////////////////
+// Local Data Types
+////////////////////////////////////////////////////////////////////////////////
+//! @brief A stream which fails after delivering a set count of bytes.
+class FailingStream : public IStream
+{
+public:
+    size_t BytesLeft;
+
+    FailingStream(size_t bytesBeforeFailure) :
+        BytesLeft(bytesBeforeFailure)
+    {
+    }
+
+    virtual void flush() override { }
+
+    virtual size_t read(void *targetBuffer, size_t requiredByteCount) override
+    {
+        if (BytesLeft == 0)
+            throw OperationException("The device failed.");
+
+        size_t count = std::min(BytesLeft, requiredByteCount);
+        std::fill_n(static_cast<uint8_t *>(targetBuffer), count, 0xA5);
+        BytesLeft -= count;
+
+        return count;
+    }
+
+    virtual size_t write(const void */*sourceBuffer*/, size_t /*sourceByteCount*/) override
+    {
+        throw NotSupportedException("The stream does not support writing.");
+    }
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 // Unit Tests
 ////////////////////////////////////////////////////////////////////////////////
@@ -141,6 +175,60 @@ GTEST_TEST(BufferedInputStream, ReadThroughBuffer)
     EXPECT_EQ(memcmp(readBytes.data(), originalBytes.data(), originalBytes.size()), 0);
 }
 
+GTEST_TEST(BufferedInputStream, PrefetchReadsInOrder)
+{
+    RandomByteGenerator entropySource(108);
+    MemoryStream innerStream;
+
+    ByteBlock originalBytes = fillRandomData(entropySource, 100000);
+    innerStream.write(originalBytes.data(), originalBytes.size());
+    innerStream.setPosition(StreamRelative::Beginning, 0);
+
+    BufferedInputStream specimen(&innerStream, 4096, 2);
+
+    EXPECT_EQ(specimen.getBufferSize(), 4096u);
+    EXPECT_EQ(specimen.getPrefetchCount(), 2u);
+
+    // Read in uneven pieces, some larger than a buffer.
+    ByteBlock readBytes(originalBytes.size() + 64);
+    size_t offset = 0;
+    size_t pieceSize = 1;
+
+    while (offset < originalBytes.size())
+    {
+        size_t bytesRead = specimen.read(readBytes.data() + offset, pieceSize);
+
+        ASSERT_GT(bytesRead, 0u);
+        offset += bytesRead;
+        pieceSize = (pieceSize * 7 + 13) % 9000;
+    }
+
+    EXPECT_EQ(offset, originalBytes.size());
+    EXPECT_EQ(specimen.read(readBytes.data(), readBytes.size()), 0u);
+
+    readBytes.resize(originalBytes.size());
+    EXPECT_EQ(readBytes, originalBytes);
+
+    const BufferedInputStream::Statistics &stats = specimen.getStatistics();
+    EXPECT_EQ(stats.BytesFetched, originalBytes.size());
+    EXPECT_GE(stats.FetchCount, originalBytes.size() / 4096);
+}
+
+GTEST_TEST(BufferedInputStream, PrefetchReportsErrors)
+{
+    FailingStream innerStream(10000);
+    BufferedInputStream specimen(&innerStream, 4096, 1);
+    ByteBlock readBytes(20000);
+
+    // The bytes delivered before the failure are available, then the
+    // failure is reported.
+    EXPECT_EQ(specimen.read(readBytes.data(), readBytes.size()), 10000u);
+    EXPECT_THROW(specimen.read(readBytes.data(), 1), OperationException);
+
+    // After an error, the stream appears to have ended.
+    EXPECT_EQ(specimen.read(readBytes.data(), 1), 0u);
+}
+
 } // Anonymous namespace
 
 }} // namespace Ag::IO
@@ -10,7 +10,9 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Header File Includes
 ////////////////////////////////////////////////////////////////////////////////
+#include <chrono>
 #include <random>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -24,6 +26,44 @@ namespace IO {
 
 namespace {
 
+////////////////////////////////////////////////////////////////////////////////
+// Local Data Types
+////////////////////////////////////////////////////////////////////////////////
+//! @brief A stream which slowly accepts a set count of writes, then fails.
+class FailingStream : public IStream
+{
+public:
+    ByteBlock Data;
+    size_t WritesLeft;
+
+    FailingStream(size_t writesBeforeFailure) :
+        WritesLeft(writesBeforeFailure)
+    {
+    }
+
+    virtual void flush() override { }
+
+    virtual size_t read(void */*targetBuffer*/, size_t /*requiredByteCount*/) override
+    {
+        throw NotSupportedException("The stream does not support reading.");
+    }
+
+    virtual size_t write(const void *sourceBuffer, size_t sourceByteCount) override
+    {
+        if (WritesLeft == 0)
+            throw OperationException("The device failed.");
+
+        // Simulate device latency.
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+        const uint8_t *source = static_cast<const uint8_t *>(sourceBuffer);
+        Data.insert(Data.end(), source, source + sourceByteCount);
+        --WritesLeft;
+
+        return sourceByteCount;
+    }
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 // Unit Tests
 ////////////////////////////////////////////////////////////////////////////////
@@ -134,6 +174,103 @@ GTEST_TEST(BufferedOutputStream, PartialWriteThroughEmptyBuffer)
     EXPECT_EQ(innerStream.getPosition(), static_cast<StreamPosition>(totalData));
 }
 
+GTEST_TEST(BufferedOutputStream, GatheredWrite)
+{
+    RandomByteGenerator entropySource(13);
+    MemoryStream innerStream;
+    BufferedOutputStream specimen(&innerStream);
+
+    ByteBlock small = fillRandomData(entropySource, 16);
+    ByteBlock large = fillRandomData(entropySource, specimen.getBufferSize() * 2);
+    const ByteSpan smallSpans[] = {
+        ByteSpan(small.data(), 8),
+        ByteSpan(small.data() + 8, 8),
+    };
+
+    // Verify that a small gathered write is buffered.
+    EXPECT_EQ(specimen.writeGathered(smallSpans, std::size(smallSpans)), small.size());
+    EXPECT_EQ(specimen.getBufferUsed(), small.size());
+    EXPECT_EQ(innerStream.getPosition(), 0);
+
+    // Verify that a large gathered write is written through along with
+    // the data already buffered.
+    const ByteSpan largeSpans[] = {
+        ByteSpan(small.data(), small.size()),
+        ByteSpan(large.data(), large.size()),
+    };
+    size_t largeSize = small.size() + large.size();
+
+    EXPECT_EQ(specimen.writeGathered(largeSpans, std::size(largeSpans)), largeSize);
+    EXPECT_EQ(specimen.getBufferUsed(), 0u);
+
+    ByteBlock expected;
+    expected.insert(expected.end(), small.begin(), small.end());
+    expected.insert(expected.end(), small.begin(), small.end());
+    expected.insert(expected.end(), large.begin(), large.end());
+
+    EXPECT_EQ(innerStream.toArray(), expected);
+}
+
+GTEST_TEST(BufferedOutputStream, WriteBehindPreservesOrder)
+{
+    RandomByteGenerator entropySource(14);
+    FailingStream innerStream(SIZE_MAX);
+    ByteBlock expected;
+
+    {
+        BufferedOutputStream specimen(&innerStream, 1024, 2);
+
+        EXPECT_EQ(specimen.getWriteBehindCount(), 2u);
+
+        // Write pieces both smaller and larger than the buffer.
+        for (size_t pieceSize = 1; expected.size() < 50000; pieceSize = (pieceSize * 5 + 7) % 3000)
+        {
+            ByteBlock piece = fillRandomData(entropySource, pieceSize);
+
+            ASSERT_EQ(specimen.write(piece.data(), piece.size()), piece.size());
+            expected.insert(expected.end(), piece.begin(), piece.end());
+        }
+
+        specimen.flush();
+        EXPECT_EQ(specimen.getBufferUsed(), 0u);
+
+        // The inner stream is up to date once flushed.
+        EXPECT_EQ(innerStream.Data, expected);
+
+        // Write some more which should be flushed at destruction.
+        ByteBlock piece = fillRandomData(entropySource, 100);
+        specimen.write(piece.data(), piece.size());
+        expected.insert(expected.end(), piece.begin(), piece.end());
+    }
+
+    EXPECT_EQ(innerStream.Data, expected);
+}
+
+GTEST_TEST(BufferedOutputStream, WriteBehindReportsErrors)
+{
+    RandomByteGenerator entropySource(15);
+    FailingStream innerStream(3);
+    BufferedOutputStream specimen(&innerStream, 1024, 2);
+
+    ByteBlock data = fillRandomData(entropySource, specimen.getBufferSize() * 8);
+
+    // The failure is reported by a later write or the flush.
+    EXPECT_THROW({
+        for (size_t offset = 0; offset < data.size(); offset += 100)
+            specimen.write(data.data() + offset, std::min<size_t>(100, data.size() - offset));
+
+        specimen.flush();
+    }, OperationException);
+
+    // Only the buffers before the failure reached the device, in order.
+    ASSERT_EQ(innerStream.Data.size(), specimen.getBufferSize() * 3);
+    EXPECT_TRUE(std::equal(innerStream.Data.begin(), innerStream.Data.end(), data.begin()));
+
+    // The stream can no longer be written.
+    EXPECT_THROW(specimen.write(data.data(), 1), OperationException);
+    EXPECT_THROW(specimen.flush(), OperationException);
+}
+
 } // Anonymous namespace
 
 }} // namespace Ag::IO
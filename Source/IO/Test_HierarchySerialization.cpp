@@ -10,11 +10,18 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Header File Includes
 ////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+
 #include <gtest/gtest.h>
 
+#include "Ag/Core/Instrumentation.hpp"
+#include "Ag/GTest_Core.hpp"
 #include "Ag/IO/HierarchySerialization.hpp"
+#include "Ag/IO/HierarchyVisitor.hpp"
 #include "Ag/IO/MemoryStream.hpp"
+#include "Ag/IO/SeekableFileStream.hpp"
 
+#include "SampleData.hpp"
 #include "TestTools.hpp"
 
 namespace Ag {
@@ -24,502 +31,70 @@ namespace {
 ////////////////////////////////////////////////////////////////////////////////
 // Local Data Types
 ////////////////////////////////////////////////////////////////////////////////
-struct SampleData
+//! @brief A visitor which renders the events it receives as text.
+class LoggingVisitor : public HierarchyVisitor
 {
-    // Public Constants
-    static constexpr size_t BlockSize = 4 * 1024;
-    static constexpr size_t MaxBlockSize = 4 * 1024 * 1024;
-    static constexpr size_t StreamSize = 64 * 1024;
-    static constexpr size_t MaxStreamSize = 16 * 1024 * 1024;
-    static constexpr size_t StreamTransferSize = 4096;
-
-    // Public Types
-    using UPtr = std::unique_ptr<SampleData>;
-    using Collection = std::vector<UPtr>;
-
-    // Public Fields
-    bool BoolValue;
-    int8_t Int8Value;
-    uint8_t Uint8Value;
-    int16_t Int16Value;
-    uint16_t Uint16Value;
-    int32_t Int32Value;
-    uint32_t Uint32Value;
-    int64_t Int64Value;
-    uint64_t Uint64Value;
-    char32_t CharValue;
-    float FloatValue;
-    double DoubleValue;
-    String TextValue;
-    ByteBlock BlockValue;
-    ByteBlock StreamValue;
-
-    UPtr Child;
-    Collection Children;
-
-    // Construction
-    SampleData() :
-        BoolValue(false),
-        Int8Value(0),
-        Uint8Value(0),
-        Int16Value(0),
-        Uint16Value(0),
-        Int32Value(0),
-        Uint32Value(0),
-        Int64Value(0),
-        Uint64Value(0),
-        CharValue(U'\0'),
-        FloatValue(0.0f),
-        DoubleValue(0.0),
-        TextValue(String::Empty)
-    {
-    }
-
-    SampleData(const SampleData &rhs)
-    {
-        clone(rhs);
-    }
-
-    void clone(const SampleData &rhs)
-    {
-        // Reset the state of the object.
-        Child.reset();
-        Children.clear();
-
-        // Copy fields
-        BoolValue = rhs.BoolValue;
-        Int8Value = rhs.Int8Value;
-        Uint8Value = rhs.Uint8Value;
-        Int16Value = rhs.Int16Value;
-        Uint16Value = rhs.Uint16Value;
-        Int32Value = rhs.Int32Value;
-        Uint32Value = rhs.Uint32Value;
-        Int64Value = rhs.Int64Value;
-        Uint64Value = rhs.Uint64Value;
-        CharValue = rhs.CharValue;
-        FloatValue = rhs.FloatValue;
-        DoubleValue = rhs.DoubleValue;
-        TextValue = rhs.TextValue;
-        BlockValue = rhs.BlockValue;
-        StreamValue = rhs.StreamValue;
-
-        // Copy the named child.
-        if (rhs.Child)
-        {
-            Child = std::make_unique<SampleData>(*rhs.Child);
-        }
-
-        // Copy anonymous children.
-        if (rhs.Children.empty() == false)
-        {
-            Children.reserve(rhs.Children.size());
-
-            for (const auto &child : rhs.Children)
-            {
-                Children.push_back(std::make_unique<SampleData>(*child));
-            }
-        }
-    }
-
-    void makeEmpty()
-    {
-        BoolValue = false;
-        Int8Value = 0;
-        Uint8Value = 0;
-        Int16Value = 0;
-        Uint16Value = 0;
-        Int32Value = 0;
-        Uint32Value = 0;
-        Int64Value = 0;
-        Uint64Value = 0;
-        CharValue = U'\0';
-        FloatValue = 0.0f;
-        DoubleValue = 0.0;
-        TextValue = String::Empty;
-        BlockValue.clear();
-        StreamValue.clear();
-
-        Child.reset();
-        Children.clear();
-    }
-
-    void makeMinimum()
-    {
-        BoolValue = false;
-        Int8Value = std::numeric_limits<decltype(Int8Value)>::min();
-        Uint8Value = std::numeric_limits<decltype(Uint8Value)>::min();
-        Int16Value = std::numeric_limits<decltype(Int16Value)>::min();
-        Uint16Value = std::numeric_limits<decltype(Uint16Value)>::min();
-        Int32Value = std::numeric_limits<decltype(Int32Value)>::min();
-        Uint32Value = std::numeric_limits<decltype(Uint32Value)>::min();
-        Int64Value = std::numeric_limits<decltype(Int64Value)>::min();
-        Uint64Value = std::numeric_limits<decltype(Uint64Value)>::min();
-        CharValue = std::numeric_limits<decltype(CharValue)>::min();
-        FloatValue = std::numeric_limits<decltype(FloatValue)>::min();
-        DoubleValue = std::numeric_limits<decltype(DoubleValue)>::min();
-        TextValue = "A";
-        BlockValue.clear();
-        BlockValue.push_back(0xA5);
-        StreamValue.clear();
-        StreamValue.push_back(0x5A);
-    }
-
-    void makeMaximum()
-    {
-        RandomByteGenerator generator(255);
-
-        size_t textLength = generator.nextValue<uint32_t>() % (1024 * 1024);
-
-        BoolValue = true;
-        Int8Value = std::numeric_limits<decltype(Int8Value)>::max();
-        Uint8Value = std::numeric_limits<decltype(Uint8Value)>::max();
-        Int16Value = std::numeric_limits<decltype(Int16Value)>::max();
-        Uint16Value = std::numeric_limits<decltype(Uint16Value)>::max();
-        Int32Value = std::numeric_limits<decltype(Int32Value)>::max();
-        Uint32Value = std::numeric_limits<decltype(Uint32Value)>::max();
-        Int64Value = std::numeric_limits<decltype(Int64Value)>::max();
-        Uint64Value = std::numeric_limits<decltype(Uint64Value)>::max();
-        CharValue = std::numeric_limits<decltype(CharValue)>::max();
-        FloatValue = std::numeric_limits<decltype(FloatValue)>::max();
-        DoubleValue = std::numeric_limits<decltype(DoubleValue)>::max();
-        TextValue = generator.nextString(textLength);
-
-        BlockValue.clear();
-        BlockValue.reserve(BlockSize);
-        std::generate_n(std::back_inserter(BlockValue), MaxBlockSize, generator);
-
-        StreamValue.clear();
-        StreamValue.reserve(StreamSize);
-        std::generate_n(std::back_inserter(StreamValue), MaxStreamSize, generator);
-    }
-
-    void makeRandom(RandomByteGenerator &generator,
-                    bool generateChild = false,
-                    size_t generateChildCount = 0)
-    {
-        // Reset the state of the object.
-        Child.reset();
-        Children.clear();
-
-        // Generate field values.
-        BoolValue = generator() > 128;
-        Int8Value = generator.nextValue<int8_t>();
-        Uint8Value = generator();
-        Int16Value = generator.nextValue<int16_t>();
-        Uint16Value = generator.nextValue<uint16_t>();
-        Int32Value = generator.nextValue<int32_t>();
-        Uint32Value = generator.nextValue<uint32_t>();
-        Int64Value = generator.nextValue<int64_t>();
-        Uint64Value = generator.nextValue<uint64_t>();
-        CharValue = static_cast<char32_t>(generator.nextValue<uint8_t>() + 32);
-        FloatValue = generator.nextValue<float>();
-        DoubleValue = generator.nextValue<double>();
-        TextValue = generator.nextString();
-
-        size_t blockSize = generator.nextValue<size_t>() % BlockSize;
-        BlockValue.clear();
-        BlockValue.reserve(blockSize);
-        std::generate_n(std::back_inserter(BlockValue), blockSize, generator);
-
-        size_t streamSize = generator.nextValue<size_t>() % StreamSize;
-        StreamValue.clear();
-        StreamValue.reserve(blockSize);
-        std::generate_n(std::back_inserter(StreamValue), streamSize, generator);
-
-        if (generateChild)
-        {
-            // Generate a named child.
-            Child = std::make_unique<SampleData>();
-            Child->makeRandom(generator, false, 0);
-        }
-
-        if (generateChildCount > 0)
-        {
-            // Generate anonymous children.
-            Children.reserve(generateChildCount);
-
-            for (size_t i = 0; i < generateChildCount; ++i)
-            {
-                Children.push_back(std::make_unique<SampleData>());
-                Children.back()->makeRandom(generator, false, 0);
-            }
-        }
+public:
+    std::string Log;
+    StreamLength ByteCount = 0;
+    StreamLength ElementCount = 0;
+    int64_t ElementSum = 0;
+
+    virtual void onBeginObject() override { Log.append("{ "); }
+    virtual void onProperty(string_cref_t tag) override
+    {
+        Log.append(tag.getUtf8Bytes());
+        Log.append(": ");
     }
-
-    void write(ObjectWriter &writer) const
-    {
-        // Write fields.
-        writer.write("BoolValue", BoolValue);
-        writer.write("Int8Value", Int8Value);
-        writer.write("Uint8Value", Uint8Value);
-        writer.write("Int16Value", Int16Value);
-        writer.write("Uint16Value", Uint16Value);
-        writer.write("Int32Value", Int32Value);
-        writer.write("Uint32Value", Uint32Value);
-        writer.write("Int64Value", Int64Value);
-        writer.write("Uint64Value", Uint64Value);
-        writer.write("CharValue", CharValue);
-        writer.write("FloatValue", FloatValue);
-        writer.write("DoubleValue", DoubleValue);
-        writer.write("TextValue", TextValue);
-        writer.write("BlockValue", BlockValue.data(), BlockValue.size());
-        writeStreamValue(writer.beginWriteBytes("StreamValue"));
-
-        // Write Child/Children.
-        if (Child)
-        {
-            ObjectWriter childWriter = writer.beginWriteObject("Child");
-
-            Child->write(childWriter);
-        }
-
-        if (Children.empty() == false)
-        {
-            ArrayWriter childrenWriter = writer.beginWriteArray("Children");
-
-            for (const auto &childPtr : Children)
-            {
-                ObjectWriter childWriter = childrenWriter.beginWriteObject();
-
-                childPtr->write(childWriter);
-            }
-        }
+    virtual void onEndObject() override { Log.append("} "); }
+    virtual void onBeginArray(StreamLength elementCount) override
+    {
+        Log.append("[").append(std::to_string(elementCount)).append(" ");
     }
-
-    void write(ArrayWriter &writer) const
-    {
-        // Write fields.
-        writer.write(BoolValue);
-        writer.write(Int8Value);
-        writer.write(Uint8Value);
-        writer.write(Int16Value);
-        writer.write(Uint16Value);
-        writer.write(Int32Value);
-        writer.write(Uint32Value);
-        writer.write(Int64Value);
-        writer.write(Uint64Value);
-        writer.write(CharValue);
-        writer.write(FloatValue);
-        writer.write(DoubleValue);
-        writer.write(TextValue);
-        writer.write(BlockValue.data(), BlockValue.size());
-        writeStreamValue(writer.beginWriteBytes());
-
-        // Write Child/Children.
-
-        // Write bool to indicate if the Child property follows.
-        if (Child)
-        {
-            writer.write(true);
-            ObjectWriter childWriter = writer.beginWriteObject();
-
-            Child->write(childWriter);
-        }
-        else
-        {
-            writer.write(false);
-        }
-
-        if (Children.empty() == false)
-        {
-            for (const auto &childPtr : Children)
-            {
-                ObjectWriter childWriter = writer.beginWriteObject();
-
-                childPtr->write(childWriter);
-            }
-        }
+    virtual void onEndArray() override { Log.append("] "); }
+    virtual void onInteger(int64_t value) override
+    {
+        Log.append(std::to_string(value)).append(" ");
     }
-
-    void read(const ObjectReader &reader)
-    {
-        Child.reset();
-        Children.clear();
-
-        BoolValue = reader.readBool("BoolValue");
-        Int8Value = reader.readInt8("Int8Value");
-        Uint8Value = reader.readUint8("Uint8Value");
-        Int16Value = reader.readInt16("Int16Value");
-        Uint16Value = reader.readUint16("Uint16Value");
-        Int32Value = reader.readInt32("Int32Value");
-        Uint32Value = reader.readUint32("Uint32Value");
-        Int64Value = reader.readInt64("Int64Value");
-        Uint64Value = reader.readUint64("Uint64Value");
-        CharValue = reader.readChar("CharValue");
-        FloatValue = reader.readFloat("FloatValue");
-        DoubleValue = reader.readDouble("DoubleValue");
-        TextValue = reader.readString("TextValue");
-        BlockValue = reader.readBytes("BlockValue");
-        readStreamValue(reader.readBytesStream("StreamValue"));
-
-        // Read Child/Children.
-        ObjectReader childReader;
-        ArrayReader childrenReader;
-
-        if (reader.tryRead("Child", childReader))
-        {
-            Child = std::make_unique<SampleData>();
-            Child->read(childReader);
-        }
-
-        if (reader.tryRead("Children", childrenReader))
-        {
-            Children.reserve(static_cast<size_t>(childrenReader.getElementCount()));
-
-            while (childrenReader.hasMore())
-            {
-                childReader = childrenReader.readNextObject();
-
-                Children.push_back(std::make_unique<SampleData>());
-                Children.back()->read(childReader);
-            }
-        }
+    virtual void onUnsignedInteger(uint64_t value) override
+    {
+        Log.append(std::to_string(value)).append("u ");
     }
-
-    void read(ArrayReader &reader)
-    {
-        Child.reset();
-        Children.clear();
-
-        BoolValue = reader.readNextBool();
-        Int8Value = reader.readNextInt8();
-        Uint8Value = reader.readNextUint8();
-        Int16Value = reader.readNextInt16();
-        Uint16Value = reader.readNextUint16();
-        Int32Value = reader.readNextInt32();
-        Uint32Value = reader.readNextUint32();
-        Int64Value = reader.readNextInt64();
-        Uint64Value = reader.readNextUint64();
-        CharValue = reader.readNextChar();
-        FloatValue = reader.readNextFloat();
-        DoubleValue = reader.readNextDouble();
-        TextValue = reader.readNextString();
-        BlockValue = reader.readNextBytes();
-        readStreamValue(reader.readNextByteStream());
-
-        // Read Child/Children.
-        ObjectReader childReader;
-
-        // Read bool field to determine of the child is written.
-        if (reader.readNextBool())
-        {
-            childReader = reader.readNextObject();
-
-            Child = std::make_unique<SampleData>();
-            Child->read(childReader);
-        }
-
-        Children.reserve(static_cast<size_t>(reader.getElementCount() - reader.getCurrentElementIndex()));
-
-        while (reader.hasMore())
-        {
-            childReader = reader.readNextObject();
-
-            Children.push_back(std::make_unique<SampleData>());
-            Children.back()->read(childReader);
-        }
+    virtual void onReal(double value) override
+    {
+        Log.append(std::to_string(value)).append(" ");
     }
-
-    bool isEqual(const SampleData &rhs) const
-    {
-        if ((BoolValue == rhs.BoolValue) &&
-            (Int8Value == rhs.Int8Value) &&
-            (Uint8Value == rhs.Uint8Value) &&
-            (Int16Value == rhs.Int16Value) &&
-            (Uint16Value == rhs.Uint16Value) &&
-            (Int32Value == rhs.Int32Value) &&
-            (Uint32Value == rhs.Uint32Value) &&
-            (Int64Value == rhs.Int64Value) &&
-            (Uint64Value == rhs.Uint64Value) &&
-            (CharValue == rhs.CharValue) &&
-            (FloatValue == rhs.FloatValue) &&
-            (DoubleValue == rhs.DoubleValue) &&
-            (TextValue == rhs.TextValue) &&
-            isEqual(BlockValue, rhs.BlockValue) &&
-            isEqual(StreamValue, rhs.StreamValue) &&
-            isEqual(Child, rhs.Child) &&
-            (Children.size() == rhs.Children.size()))
-        {
-            for (size_t i = 0; i < Children.size(); ++i)
-            {
-                if (isEqual(Children.at(i), rhs.Children.at(i)) == false)
-                    return false;
-            }
-
-            return true;
-        }
-
-        return false;
+    virtual void onString(string_cref_t value) override
+    {
+        Log.append("'").append(value.getUtf8Bytes()).append("' ");
     }
-
-    void writeStreamValue(IStreamUPtr valueStream) const
+    virtual void onBeginBytes(StreamLength byteCount) override
     {
-        size_t bytesWritten = 0;
-
-        while (bytesWritten < StreamValue.size())
-        {
-            size_t bytesToWrite = std::min(StreamValue.size() - bytesWritten,
-                                           StreamTransferSize);
-
-            size_t written = valueStream->write(StreamValue.data() + bytesWritten,
-                                                bytesToWrite);
-
-            if (written != bytesToWrite)
-                throw IOException("Failed to write stream value.");
-
-            bytesWritten += written;
-        }
+        Log.append("<").append(std::to_string(byteCount));
     }
-
-    void readStreamValue(ISeekableStreamUPtr valueStream)
+    virtual void onBytes(const uint8_t *data, size_t byteCount) override
     {
-        StreamValue.clear();
-        StreamValue.reserve(static_cast<size_t>(valueStream->getLength()));
-
-        size_t bytesRead = 0;
-
-        do
-        {
-            size_t oldSize = StreamValue.size();
-            size_t newSize = oldSize + StreamTransferSize;
-
-            StreamValue.resize(newSize);
+        ByteCount += static_cast<StreamLength>(byteCount);
 
-            bytesRead = valueStream->read(StreamValue.data() + oldSize,
-                                          StreamTransferSize);
-
-            newSize = oldSize + bytesRead;
-
-            if (bytesRead < StreamTransferSize)
-                StreamValue.resize(newSize);
-
-            // Continue until we make a partial transfer.
-        } while (bytesRead == StreamTransferSize);
+        for (size_t index = 0; index < byteCount; ++index)
+            ElementSum += data[index];
     }
-
-    static bool isEqual(const ByteBlock &lhs, const ByteBlock &rhs)
+    virtual void onEndBytes() override { Log.append("> "); }
+    virtual void onBeginPackedArray(PackedElementType elementType,
+                                    StreamLength elementCount) override
     {
-        if (lhs.size() == rhs.size())
-        {
-            return std::memcmp(lhs.data(), rhs.data(), lhs.size()) == 0;
-        }
-
-        return false;
+        Log.append("(").append(std::to_string(toScalar(elementType)));
+        Log.append("x").append(std::to_string(elementCount));
     }
-
-    static bool isEqual(const UPtr &lhs, const UPtr &rhs)
+    virtual void onPackedElements(const void *elements, size_t elementCount) override
     {
-        if (lhs && rhs)
-        {
-            // Check for the same instance.
-            if (lhs.get() == rhs.get())
-                return true;
-
-            return lhs->isEqual(*rhs);
-        }
+        const int32_t *values = static_cast<const int32_t *>(elements);
+        ElementCount += static_cast<StreamLength>(elementCount);
 
-        return !lhs && !rhs;
+        for (size_t index = 0; index < elementCount; ++index)
+            ElementSum += values[index];
     }
+    virtual void onEndPackedArray() override { Log.append(") "); }
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -976,6 +551,582 @@ GTEST_TEST(HierarchySerialization, A05_ReadNestedArray)
     EXPECT_TRUE(readData.isEqual(originalData));
 }
 
+GTEST_TEST(HierarchySerialization, A06_ReadCompressedObject)
+{
+    RandomByteGenerator entropySource(41);
+    MemoryStream dataSource;
+    SampleData original;
+
+    original.makeRandom(entropySource, true);
+
+    ObjectWriter writer = beginSerializeObject(&dataSource, true);
+
+    original.write(writer);
+    writer.close();
+
+    dataSource.setPosition(StreamRelative::Beginning, 0);
+
+    HierarchyRoot root(&dataSource);
+
+    ASSERT_TRUE(root.hasRootObject());
+
+    ObjectReader specimen = root.getRootObject();
+    SampleData readData;
+    readData.read(specimen);
+
+    EXPECT_TRUE(readData.isEqual(original));
+}
+
+GTEST_TEST(HierarchySerialization, B00_ReadMappedObject)
+{
+    RandomByteGenerator entropySource(51);
+    FileDeleter deleteOnExit(generateTempFileName());
+    SampleData original;
+
+    original.makeRandom(entropySource, true);
+
+    {
+        ISeekableStreamUPtr output = SeekableFileStream::open(deleteOnExit.getPath(),
+                                                              FileAccess::ReadWrite |
+                                                              FileAccess::CreateAlways);
+
+        ObjectWriter writer = beginSerializeObject(output.get(), false);
+        original.write(writer);
+        writer.close();
+    }
+
+    HierarchyRoot root(deleteOnExit.getPath());
+
+    ASSERT_TRUE(root.hasRootObject());
+
+    ObjectReader specimen = root.getRootObject();
+    SampleData readData;
+    readData.read(specimen);
+
+    EXPECT_TRUE(readData.isEqual(original));
+
+    // Access values in-place.
+    std::string_view text;
+    ASSERT_TRUE(specimen.tryRead("TextValue", text));
+    EXPECT_EQ(text, original.TextValue.toUtf8View());
+
+    ByteSpan block = specimen.readBytesView("BlockValue");
+    ASSERT_EQ(block.Length, original.BlockValue.size());
+    EXPECT_TRUE(std::equal(block.begin(), block.end(), original.BlockValue.begin()));
+
+    EXPECT_FALSE(specimen.tryRead("Int32Value", text));
+    EXPECT_FALSE(specimen.tryRead("TextValue", block));
+}
+
+GTEST_TEST(HierarchySerialization, B00_ReadMappedCompressedArray)
+{
+    RandomByteGenerator entropySource(52);
+    FileDeleter deleteOnExit(generateTempFileName());
+    SampleData original;
+    constexpr size_t ChildCount = 3;
+
+    original.makeRandom(entropySource, false, ChildCount);
+
+    {
+        ISeekableStreamUPtr output = SeekableFileStream::open(deleteOnExit.getPath(),
+                                                              FileAccess::ReadWrite |
+                                                              FileAccess::CreateAlways);
+
+        ArrayWriter writer = beginSerializeArray(output.get(), true);
+        original.write(writer);
+        writer.close();
+    }
+
+    // The compressed sections are decompressed rather than mapped.
+    HierarchyRoot root(deleteOnExit.getPath());
+
+    ASSERT_TRUE(root.hasRootArray());
+
+    ArrayReader specimen = root.getRootArray();
+    SampleData readData;
+    readData.read(specimen);
+
+    EXPECT_EQ(readData.Children.size(), ChildCount);
+    EXPECT_TRUE(readData.isEqual(original));
+}
+
+GTEST_TEST(HierarchySerialization, B01_ReadArrayViews)
+{
+    MemoryStream dataSource;
+    const uint8_t bytes[] = { 1, 2, 3, 5, 8, 13 };
+
+    {
+        ArrayWriter writer = beginSerializeArray(&dataSource, false);
+
+        writer.write(String("Hello World!"));
+        writer.write(bytes, sizeof(bytes));
+        writer.write(42);
+        writer.write(String::Empty);
+    }
+
+    dataSource.setPosition(StreamRelative::Beginning, 0);
+
+    HierarchyRoot root(&dataSource);
+    ASSERT_TRUE(root.hasRootArray());
+
+    ArrayReader specimen = root.getRootArray();
+
+    EXPECT_EQ(specimen.readNextStringView(), "Hello World!");
+
+    ByteSpan block = specimen.readNextBytesView();
+    ASSERT_EQ(block.Length, sizeof(bytes));
+    EXPECT_TRUE(std::equal(block.begin(), block.end(), bytes));
+
+    std::string_view text;
+    EXPECT_FALSE(specimen.tryReadNext(text));
+    EXPECT_FALSE(specimen.tryReadNext(block));
+    EXPECT_EQ(specimen.readNextInt32(), 42);
+
+    ASSERT_TRUE(specimen.tryReadNext(text));
+    EXPECT_TRUE(text.empty());
+    EXPECT_FALSE(specimen.hasMore());
+}
+
+GTEST_TEST(HierarchySerialization, B02_ReadWritePropertyKeys)
+{
+    const PropertyKey idKey("ID");
+    const PropertyKey nameKey("Name");
+    const PropertyKey missingKey("Missing");
+    constexpr int32_t RecordCount = 16;
+    MemoryStream first;
+    MemoryStream second;
+
+    {
+        ArrayWriter writer = beginSerializeArray(&first, false);
+
+        for (int32_t index = 0; index < RecordCount; ++index)
+        {
+            ObjectWriter record = writer.beginWriteObject();
+            record.write(idKey, index);
+            record.write(nameKey, String::format("Record {0}", { index }));
+
+            EXPECT_THROW({ record.write(idKey, index); }, ArgumentException);
+        }
+    }
+
+    {
+        // Use the same keys with a hierarchy with a different symbol table.
+        ObjectWriter writer = beginSerializeObject(&second, false);
+        writer.write("Padding", true);
+        writer.write(nameKey, String("Second"));
+        writer.write(idKey, 42);
+    }
+
+    first.setPosition(StreamRelative::Beginning, 0);
+    second.setPosition(StreamRelative::Beginning, 0);
+
+    HierarchyRoot firstRoot(&first);
+    HierarchyRoot secondRoot(&second);
+    ArrayReader records = firstRoot.getRootArray();
+    ObjectReader secondObject = secondRoot.getRootObject();
+
+    for (int32_t index = 0; index < RecordCount; ++index)
+    {
+        ObjectReader record = records.readNextObject();
+
+        EXPECT_EQ(record.readInt32(idKey), index);
+        EXPECT_STRINGEQ(record.readString(nameKey),
+                        String::format("Record {0}", { index }));
+        EXPECT_FALSE(record.hasProperty(missingKey));
+
+        // Alternate between hierarchies to force keys to be re-resolved.
+        EXPECT_EQ(secondObject.readInt32(idKey), 42);
+        EXPECT_STRINGEQC(secondObject.readString(nameKey), "Second");
+    }
+
+    EXPECT_FALSE(records.hasMore());
+    EXPECT_THROW({ secondObject.readBool(missingKey); }, PropertyNotFoundException);
+
+    // Copies retain the tag and any resolved identifier.
+    PropertyKey copy(nameKey);
+    EXPECT_STRINGEQC(copy.getTag(), "Name");
+    EXPECT_STRINGEQC(secondObject.readString(copy), "Second");
+}
+
+GTEST_TEST(HierarchySerialization, B03_ReadWritePackedArrays)
+{
+    MemoryStream dataSource;
+    std::vector<int32_t> integers(10000);
+    std::vector<double> reals(257);
+    const uint16_t words[] = { 0x0102, 0xFFFE, 0x8000 };
+
+    for (size_t index = 0; index < integers.size(); ++index)
+        integers[index] = static_cast<int32_t>(index * 2654435761u);
+
+    for (size_t index = 0; index < reals.size(); ++index)
+        reals[index] = static_cast<double>(index) / 7.0;
+
+    {
+        ArrayWriter writer = beginSerializeArray(&dataSource, false);
+
+        writer.writePackedArray(integers);
+        writer.writePackedArray(reals);
+        writer.writePackedArray(words, std::size(words));
+        writer.writePackedArray(std::vector<uint8_t>());
+        writer.write(42);
+    }
+
+    dataSource.setPosition(StreamRelative::Beginning, 0);
+
+    HierarchyRoot root(&dataSource);
+    ASSERT_TRUE(root.hasRootArray());
+
+    ArrayReader specimen = root.getRootArray();
+    EXPECT_EQ(specimen.getElementCount(), 5);
+
+    // The element type must match exactly.
+    size_t count = 0;
+    std::vector<uint32_t> mismatched;
+    EXPECT_FALSE(specimen.tryGetNextPackedArrayLength<uint32_t>(count));
+    EXPECT_FALSE(specimen.tryReadNextPackedArray(mismatched));
+
+    ASSERT_TRUE(specimen.tryGetNextPackedArrayLength<int32_t>(count));
+    EXPECT_EQ(count, integers.size());
+    EXPECT_EQ(specimen.readNextPackedArray<int32_t>(), integers);
+
+    // The length must match exactly when reading into a buffer.
+    std::vector<double> realBuffer(reals.size() - 1);
+    EXPECT_FALSE(specimen.tryReadNextPackedArray(realBuffer.data(), realBuffer.size()));
+    realBuffer.resize(reals.size());
+    ASSERT_TRUE(specimen.tryReadNextPackedArray(realBuffer.data(), realBuffer.size()));
+    EXPECT_EQ(realBuffer, reals);
+
+    uint16_t wordBuffer[std::size(words)] = { 0 };
+    ASSERT_TRUE(specimen.tryReadNextPackedArray(wordBuffer, std::size(wordBuffer)));
+    EXPECT_TRUE(std::equal(std::begin(words), std::end(words), wordBuffer));
+
+    EXPECT_TRUE(specimen.readNextPackedArray<uint8_t>().empty());
+    EXPECT_THROW({ specimen.readNextPackedArray<int32_t>(); }, PropertyTypeException);
+    EXPECT_EQ(specimen.readNextInt32(), 42);
+    EXPECT_THROW({ specimen.readNextPackedArray<int32_t>(); }, DataFormatException);
+}
+
+GTEST_TEST(HierarchySerialization, B03_ReadVersion1Stream)
+{
+    MemoryStream dataSource;
+
+    {
+        ObjectWriter writer = beginSerializeObject(&dataSource, false);
+        writer.write("Value", 42);
+    }
+
+    // Mark the stream as having been written in the original format, which
+    // is identical in the absence of packed arrays.
+    const uint8_t version1[] = { 1, 0, 0, 0 };
+    dataSource.setPosition(StreamRelative::Beginning, 4);
+    ASSERT_EQ(dataSource.write(version1, sizeof(version1)), sizeof(version1));
+    dataSource.setPosition(StreamRelative::Beginning, 0);
+
+    HierarchyRoot root(&dataSource);
+    ASSERT_TRUE(root.hasRootObject());
+    EXPECT_EQ(root.getRootObject().readInt32("Value"), 42);
+}
+
+GTEST_TEST(HierarchySerialization, B04_ReadChunkedCompressedObject)
+{
+    RandomByteGenerator entropySource(61);
+    FileDeleter deleteOnExit(generateTempFileName());
+    SampleData original;
+    std::vector<int32_t> packed(10000);
+
+    original.makeRandom(entropySource, true);
+
+    for (size_t index = 0; index < packed.size(); ++index)
+        packed[index] = static_cast<int32_t>(index * 7);
+
+    // Use a small chunk size so that the payload spans many chunks.
+    const SerializationOptions options(true, 1024, 3);
+
+    {
+        ISeekableStreamUPtr output = SeekableFileStream::open(deleteOnExit.getPath(),
+                                                              FileAccess::ReadWrite |
+                                                              FileAccess::CreateAlways);
+
+        ObjectWriter writer = beginSerializeObject(output.get(), options);
+        original.write(writer);
+        writer.beginWriteArray("Packed").writePackedArray(packed);
+        writer.close();
+    }
+
+    auto verifyRoot = [&](HierarchyRoot &root)
+    {
+        ASSERT_TRUE(root.hasRootObject());
+
+        ObjectReader specimen = root.getRootObject();
+        SampleData readData;
+        readData.read(specimen);
+
+        EXPECT_TRUE(readData.isEqual(original));
+
+        ArrayReader packedReader = specimen.readArray("Packed");
+        EXPECT_EQ(packedReader.readNextPackedArray<int32_t>(), packed);
+    };
+
+    // Read the chunks from a stream.
+    {
+        ISeekableStreamUPtr input = SeekableFileStream::open(deleteOnExit.getPath(),
+                                                             FileAccess::Read |
+                                                             FileAccess::OpenExisting);
+        HierarchyRoot root(input.get());
+        verifyRoot(root);
+    }
+
+    // Read the chunks from a memory-mapped file.
+    HierarchyRoot root(deleteOnExit.getPath());
+    verifyRoot(root);
+}
+
+GTEST_TEST(HierarchySerialization, B05_ReadLzCompressedArray)
+{
+    RandomByteGenerator entropySource(62);
+    FileDeleter deleteOnExit(generateTempFileName());
+    SampleData original;
+    constexpr size_t ChildCount = 3;
+
+    original.makeRandom(entropySource, true, ChildCount);
+
+    {
+        ISeekableStreamUPtr output = SeekableFileStream::open(deleteOnExit.getPath(),
+                                                              FileAccess::ReadWrite |
+                                                              FileAccess::CreateAlways);
+
+        ArrayWriter writer = beginSerializeArray(output.get(),
+                                                 SerializationOptions(CompressionCodecID::Lz));
+        original.write(writer);
+        writer.close();
+    }
+
+    auto verifyRoot = [&](HierarchyRoot &root)
+    {
+        ASSERT_TRUE(root.hasRootArray());
+
+        ArrayReader specimen = root.getRootArray();
+        SampleData readData;
+        readData.read(specimen);
+
+        EXPECT_EQ(readData.Children.size(), ChildCount);
+        EXPECT_TRUE(readData.isEqual(original));
+    };
+
+    // Read from a stream.
+    ISeekableStreamUPtr input = SeekableFileStream::open(deleteOnExit.getPath(),
+                                                         FileAccess::Read |
+                                                         FileAccess::OpenExisting);
+    ByteBlock encoded(static_cast<size_t>(input->getLength()));
+    ASSERT_EQ(input->read(encoded.data(), encoded.size()), encoded.size());
+
+    {
+        MemoryStream dataSource(encoded.data(), encoded.size(), true);
+        HierarchyRoot root(&dataSource);
+        verifyRoot(root);
+    }
+
+    // Read from a memory-mapped file.
+    {
+        HierarchyRoot root(deleteOnExit.getPath());
+        verifyRoot(root);
+    }
+
+    // An unrecognised codec is rejected.
+    encoded[9] = 0x7F;
+    MemoryStream corruptSource(encoded.data(), encoded.size(), true);
+
+    EXPECT_THROW({ HierarchyRoot root(&corruptSource); }, DataFormatException);
+}
+
+GTEST_TEST(HierarchySerialization, C00_VisitHierarchy)
+{
+    const uint8_t bytes[] = { 1, 2, 3 };
+    const int32_t packed[] = { 10, -20, 30 };
+
+    for (bool compress : { false, true })
+    {
+        MemoryStream dataSource;
+
+        {
+            ObjectWriter writer = beginSerializeObject(&dataSource, compress);
+            writer.write("Name", String("Root"));
+            writer.write("Small", static_cast<int8_t>(7));
+            writer.write("Negative", static_cast<int64_t>(-300));
+            writer.write("Huge", UINT64_MAX);
+            writer.write("Real", 0.5);
+            writer.write("Data", bytes, sizeof(bytes));
+
+            ArrayWriter items = writer.beginWriteArray("Items");
+            items.write(1000);
+            items.writePackedArray(packed, std::size(packed));
+
+            ObjectWriter child = items.beginWriteObject();
+            child.write("Flag", true);
+            child.close();
+
+            items.beginWriteArray().close();
+            items.close();
+        }
+
+        dataSource.setPosition(StreamRelative::Beginning, 0);
+
+        LoggingVisitor visitor;
+        visitHierarchy(&dataSource, visitor);
+
+        EXPECT_EQ(visitor.Log, "{ Name: 'Root' Small: 7 Negative: -300 "
+                               "Huge: 18446744073709551615u Real: 0.500000 "
+                               "Data: <3> Items: [4 1000 (4x3) { Flag: 1 } [0 ] ] } ");
+        EXPECT_EQ(visitor.ByteCount, 3);
+        EXPECT_EQ(visitor.ElementCount, 3);
+        EXPECT_EQ(visitor.ElementSum, 6 + 20);
+    }
+}
+
+GTEST_TEST(HierarchySerialization, C01_VisitLargeCompressedArray)
+{
+    MemoryStream dataSource;
+    std::vector<int32_t> packed(100000, 1);
+    std::vector<uint8_t> bytes(200000, 2);
+    constexpr int RecordCount = 1000;
+
+    {
+        ArrayWriter writer = beginSerializeArray(&dataSource, true);
+
+        for (int index = 0; index < RecordCount; ++index)
+        {
+            ObjectWriter record = writer.beginWriteObject();
+            record.write("Index", index);
+        }
+
+        writer.writePackedArray(packed);
+        writer.write(bytes.data(), bytes.size());
+    }
+
+    dataSource.setPosition(StreamRelative::Beginning, 0);
+
+    LoggingVisitor visitor;
+    visitHierarchy(&dataSource, visitor);
+
+    EXPECT_EQ(visitor.ElementCount, static_cast<StreamLength>(packed.size()));
+    EXPECT_EQ(visitor.ByteCount, static_cast<StreamLength>(bytes.size()));
+    EXPECT_EQ(visitor.ElementSum, static_cast<int64_t>(packed.size() + bytes.size() * 2));
+    const std::string expectedEnd = "{ Index: 999 } (4x100000) <200000> ] ";
+    ASSERT_GT(visitor.Log.size(), expectedEnd.size());
+    EXPECT_EQ(visitor.Log.substr(visitor.Log.size() - expectedEnd.size()), expectedEnd);
+}
+
+GTEST_TEST(HierarchySerialization, C01_VisitChunkedArray)
+{
+    MemoryStream dataSource;
+    std::vector<int32_t> packed(50000, 1);
+    constexpr int RecordCount = 1000;
+
+    {
+        ArrayWriter writer = beginSerializeArray(&dataSource,
+                                                 SerializationOptions(true, 4096));
+
+        for (int index = 0; index < RecordCount; ++index)
+        {
+            ObjectWriter record = writer.beginWriteObject();
+            record.write("Index", index);
+        }
+
+        writer.writePackedArray(packed);
+    }
+
+    dataSource.setPosition(StreamRelative::Beginning, 0);
+
+    LoggingVisitor visitor;
+    visitHierarchy(&dataSource, visitor);
+
+    EXPECT_EQ(visitor.ElementCount, static_cast<StreamLength>(packed.size()));
+    EXPECT_EQ(visitor.ElementSum, static_cast<int64_t>(packed.size()));
+    const std::string expectedEnd = "{ Index: 999 } (4x50000) ] ";
+    ASSERT_GT(visitor.Log.size(), expectedEnd.size());
+    EXPECT_EQ(visitor.Log.substr(visitor.Log.size() - expectedEnd.size()), expectedEnd);
+}
+
+GTEST_TEST(HierarchySerialization, C01_VisitLzCompressedArray)
+{
+    MemoryStream dataSource;
+    std::vector<int32_t> packed(50000, 1);
+    constexpr int RecordCount = 1000;
+
+    {
+        ArrayWriter writer = beginSerializeArray(&dataSource,
+                                                 SerializationOptions(CompressionCodecID::Lz,
+                                                                      16 * 1024));
+
+        for (int index = 0; index < RecordCount; ++index)
+        {
+            ObjectWriter record = writer.beginWriteObject();
+            record.write("Index", index);
+        }
+
+        writer.writePackedArray(packed);
+    }
+
+    // The repetitive content should compress well.
+    EXPECT_LT(dataSource.getLength(), static_cast<StreamLength>(packed.size()));
+
+    dataSource.setPosition(StreamRelative::Beginning, 0);
+
+    LoggingVisitor visitor;
+    visitHierarchy(&dataSource, visitor);
+
+    EXPECT_EQ(visitor.ElementCount, static_cast<StreamLength>(packed.size()));
+    EXPECT_EQ(visitor.ElementSum, static_cast<int64_t>(packed.size()));
+    const std::string expectedEnd = "{ Index: 999 } (4x50000) ] ";
+    ASSERT_GT(visitor.Log.size(), expectedEnd.size());
+    EXPECT_EQ(visitor.Log.substr(visitor.Log.size() - expectedEnd.size()), expectedEnd);
+}
+
+GTEST_TEST(HierarchySerialization, C02_VisitTruncatedHierarchy)
+{
+    MemoryStream dataSource;
+
+    {
+        ArrayWriter writer = beginSerializeArray(&dataSource, false);
+
+        for (int index = 0; index < 100; ++index)
+            writer.write(String("Text"));
+    }
+
+    ByteBlock truncated = dataSource.toArray();
+    truncated.resize(truncated.size() - 10);
+    MemoryStream input(truncated.data(), truncated.size(), true);
+
+    LoggingVisitor visitor;
+    EXPECT_THROW({ visitHierarchy(&input, visitor); }, IOException);
+}
+
+GTEST_TEST(HierarchySerialization, D00_InstrumentCompressedWrite)
+{
+    RandomByteGenerator entropySource(43);
+    MemoryStream dataSource;
+    SampleData original;
+
+    original.makeRandom(entropySource, true);
+
+    Instrumentation::clear();
+    Instrumentation::setEnabled(true);
+
+    ObjectWriter writer = beginSerializeObject(&dataSource, true);
+    original.write(writer);
+    writer.close();
+
+    Instrumentation::setEnabled(false);
+
+    std::string trace;
+    Instrumentation::appendChromeTrace(trace);
+    Instrumentation::clear();
+
+    EXPECT_NE(trace.find("\"BinaryWriterRoot::write\""), std::string::npos);
+    EXPECT_NE(trace.find("\"Bz2CompressionStream::close\""), std::string::npos);
+    EXPECT_NE(trace.find("\"Bz2CompressionStream output bytes\""), std::string::npos);
+}
+
 } // Anonymous namespace
 
 }} // namespace Ag::IO
@@ -10,10 +10,13 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Header File Includes
 ////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+
 #include <gtest/gtest.h>
 
 #include "TestTools.hpp"
 #include "Ag/IO/MemoryMappedFile.hpp"
+#include "Ag/IO/SeekableFileStream.hpp"
 
 namespace Ag {
 namespace IO {
@@ -133,6 +136,115 @@ GTEST_TEST(MemoryMappedFile, ReadOffsetView)
     }
 }
 
+GTEST_TEST(MemoryMappedFile, ViewOptions)
+{
+    RandomByteGenerator entropySource(29);
+    FileDeleter deleteOnExit(generateTempFileName());
+    size_t FileSize = MemoryMappedFile::getBlockSize() * 4;
+
+    createRandomDataFile(entropySource, deleteOnExit.getPath(), FileSize);
+
+    MemoryMappedFile specimen;
+    specimen.open(deleteOnExit.getPath(), FileAccess::OpenExisting | FileAccess::Read);
+
+    // Unsupported options should be silently ignored.
+    const MappingOptionBits optionSets[] = {
+        MappingOption::Populate,
+        MappingOption::Sequential | MappingOption::WillNeed,
+        MappingOption::Random,
+        MappingOption::HugePages | MappingOption::Populate,
+    };
+
+    for (MappingOptionBits options : optionSets)
+    {
+        MemoryMappedView view = specimen.createView(0, FileSize, options);
+        ASSERT_TRUE(view.isActive());
+
+        uint8_cptr_t source = reinterpret_cast<uint8_cptr_t>(view.getPointer());
+        entropySource.reset();
+
+        for (size_t i = 0; i < FileSize; ++i)
+        {
+            ASSERT_EQ(entropySource(), source[i]) << "Mis-matching bytes at offset #" << i;
+        }
+    }
+}
+
+GTEST_TEST(MemoryMappedFile, AdviseViewRanges)
+{
+    RandomByteGenerator entropySource(31);
+    FileDeleter deleteOnExit(generateTempFileName());
+    size_t BlockSize = MemoryMappedFile::getBlockSize();
+    size_t FileSize = BlockSize * 4;
+
+    createRandomDataFile(entropySource, deleteOnExit.getPath(), FileSize);
+
+    MemoryMappedFile specimen;
+    specimen.open(deleteOnExit.getPath(), FileAccess::OpenExisting | FileAccess::Read);
+    MemoryMappedView view = specimen.createView(0, FileSize);
+
+    // Unaligned ranges and ranges which extend beyond the view are accepted.
+    EXPECT_TRUE(view.advise(MappingAdvice::Normal, 0, FileSize));
+    EXPECT_NO_THROW(view.prefetch(BlockSize + 13, BlockSize * 8));
+    EXPECT_NO_THROW(view.advise(MappingAdvice::DontNeed, 7, BlockSize));
+    EXPECT_TRUE(view.advise(MappingAdvice::WillNeed, FileSize, 100));
+    EXPECT_THROW(view.advise(MappingAdvice::Normal, FileSize + 1, 1), ArgumentException);
+
+    // Discarded pages should be re-read from the file.
+    uint8_cptr_t source = reinterpret_cast<uint8_cptr_t>(view.getPointer());
+    entropySource.reset();
+
+    for (size_t i = 0; i < FileSize; ++i)
+    {
+        ASSERT_EQ(entropySource(), source[i]) << "Mis-matching bytes at offset #" << i;
+    }
+
+    view.release();
+    EXPECT_THROW(view.prefetch(0, 1), OperationException);
+}
+
+GTEST_TEST(MemoryMappedFile, FlushModifiedView)
+{
+    RandomByteGenerator entropySource(37);
+    FileDeleter deleteOnExit(generateTempFileName());
+    size_t BlockSize = MemoryMappedFile::getBlockSize();
+    size_t FileSize = BlockSize * 2;
+
+    createRandomDataFile(entropySource, deleteOnExit.getPath(), FileSize);
+
+    MemoryMappedFile specimen;
+    specimen.open(deleteOnExit.getPath(), FileAccess::OpenExisting | FileAccess::ReadWrite);
+
+    {
+        MemoryMappedView view = specimen.createView(0, FileSize);
+        uint8_t *target = reinterpret_cast<uint8_t *>(view.getPointer());
+
+        std::fill_n(target + 10, 100, static_cast<uint8_t>(0xA5));
+        EXPECT_NO_THROW(view.flush(10, 100, /* waitForCompletion = */ false));
+
+        std::fill_n(target + BlockSize + 1, 100, static_cast<uint8_t>(0x5A));
+        EXPECT_NO_THROW(view.flush());
+    }
+
+    specimen.close();
+
+    // Verify the changes reached the file.
+    ISeekableStreamUPtr file = SeekableFileStream::open(deleteOnExit.getPath(),
+                                                        FileAccess::OpenExisting |
+                                                        FileAccess::Read);
+    SeekableFileStream *fileStream = dynamic_cast<SeekableFileStream *>(file.get());
+    ASSERT_NE(fileStream, nullptr);
+
+    ByteBlock first(100);
+    ByteBlock second(100);
+    EXPECT_EQ(fileStream->readAt(10, first.data(), first.size()), first.size());
+    EXPECT_EQ(fileStream->readAt(BlockSize + 1, second.data(), second.size()),
+              second.size());
+
+    EXPECT_EQ(first, ByteBlock(100, 0xA5));
+    EXPECT_EQ(second, ByteBlock(100, 0x5A));
+}
+
 } // Anonymous namespace
 
 }} // namespace Ag::IO
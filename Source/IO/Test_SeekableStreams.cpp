@@ -12,6 +12,7 @@
 // Header File Includes
 ////////////////////////////////////////////////////////////////////////////////
 #include <random>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -23,6 +24,7 @@
 #include "Ag/IO/MemoryStream.hpp"
 #include "Ag/IO/SeekableFileStream.hpp"
 
+#include "ReadOnlyDataSource.hpp"
 #include "TestTools.hpp"
 
 namespace Ag {
@@ -210,6 +212,196 @@ TYPED_TEST(SeekableStream, SeekEndRelative)
     EXPECT_TRUE(std::equal(readBytes.begin(), readBytes.end(), reReadBytes.begin()));
 }
 
+TYPED_TEST(SeekableStream, GatherWriteScatterRead)
+{
+    ISeekableStreamUPtr stream = this->_harness.createNew();
+    RandomByteGenerator entropySource(44);
+
+    // Write a set of uneven blocks, including an empty one, in one operation.
+    std::vector<ByteBlock> blocks;
+    std::vector<ByteSpan> sourceSpans;
+    size_t totalSize = 0;
+
+    for (size_t blockSize : { 17, 0, 4096, 1, 300 })
+    {
+        blocks.push_back(fillRandomData(entropySource, blockSize));
+        sourceSpans.emplace_back(blocks.back().data(), blockSize);
+        totalSize += blockSize;
+    }
+
+    EXPECT_EQ(stream->writeGathered(sourceSpans.data(), sourceSpans.size()), totalSize);
+    EXPECT_EQ(stream->getPosition(), static_cast<StreamPosition>(totalSize));
+
+    // Read the data back into differently sized blocks, with a final block
+    // which extends beyond the end of the stream.
+    EXPECT_EQ(stream->setPosition(StreamRelative::Beginning, 0), 0);
+
+    ByteBlock first(1000);
+    ByteBlock second(3000);
+    ByteBlock third(1000);
+    const MutableByteSpan targetSpans[] = {
+        MutableByteSpan(first.data(), first.size()),
+        MutableByteSpan(second.data(), second.size()),
+        MutableByteSpan(third.data(), third.size()),
+    };
+
+    EXPECT_EQ(stream->readScattered(targetSpans, std::size(targetSpans)), totalSize);
+
+    ByteBlock expected;
+    ByteBlock actual;
+
+    for (const ByteBlock &block : blocks)
+        expected.insert(expected.end(), block.begin(), block.end());
+
+    actual.insert(actual.end(), first.begin(), first.end());
+    actual.insert(actual.end(), second.begin(), second.end());
+    actual.insert(actual.end(), third.begin(), third.end());
+    actual.resize(totalSize);
+
+    EXPECT_EQ(actual, expected);
+}
+
+GTEST_TEST(SeekableFileStream, PositionalReadWrite)
+{
+    SeekableFileHarness harness;
+    ISeekableStreamUPtr stream = harness.createExisting(8192, false);
+    SeekableFileStream *file = dynamic_cast<SeekableFileStream *>(stream.get());
+    ASSERT_NE(file, nullptr);
+
+    // Read a block in the middle of the file without moving the position.
+    ByteBlock expected(1000);
+    ByteBlock actual(1000);
+    EXPECT_EQ(stream->setPosition(StreamRelative::Beginning, 4000), 4000);
+    EXPECT_EQ(stream->read(expected.data(), expected.size()), expected.size());
+    EXPECT_EQ(stream->setPosition(StreamRelative::Beginning, 10), 10);
+
+    EXPECT_EQ(file->readAt(4000, actual.data(), actual.size()), actual.size());
+    EXPECT_EQ(actual, expected);
+    EXPECT_EQ(stream->getPosition(), 10);
+
+    // Overwrite part of the file, then read it back across the end.
+    RandomByteGenerator entropySource(45);
+    ByteBlock update = fillRandomData(entropySource, 500);
+
+    EXPECT_EQ(file->writeAt(7900, update.data(), update.size()), update.size());
+    EXPECT_EQ(stream->getPosition(), 10);
+    EXPECT_EQ(stream->getLength(), 8400);
+
+    ByteBlock head(200);
+    ByteBlock tail(1000);
+    const MutableByteSpan targetSpans[] = {
+        MutableByteSpan(head.data(), head.size()),
+        MutableByteSpan(tail.data(), tail.size()),
+    };
+
+    EXPECT_EQ(file->readScatteredAt(7900, targetSpans, std::size(targetSpans)),
+              update.size());
+    EXPECT_TRUE(std::equal(head.begin(), head.end(), update.begin()));
+    EXPECT_TRUE(std::equal(update.begin() + head.size(), update.end(), tail.begin()));
+
+    // Reading beyond the end should succeed with no data.
+    EXPECT_EQ(file->readAt(9000, actual.data(), actual.size()), 0u);
+}
+
+GTEST_TEST(SeekableFileStream, PositionalReadBetweenSequentialReads)
+{
+    SeekableFileHarness harness;
+    ISeekableStreamUPtr stream = harness.createExisting(8192, false);
+    SeekableFileStream *file = dynamic_cast<SeekableFileStream *>(stream.get());
+    ASSERT_NE(file, nullptr);
+
+    ByteBlock expected(2000);
+    ASSERT_EQ(file->readAt(0, expected.data(), expected.size()), expected.size());
+
+    // Sequential reads should continue from where they left off, regardless
+    // of the positional read between them.
+    ByteBlock first(1000);
+    ByteBlock middle(500);
+    ByteBlock second(1000);
+
+    EXPECT_EQ(stream->read(first.data(), first.size()), first.size());
+    EXPECT_EQ(file->readAt(6000, middle.data(), middle.size()), middle.size());
+    EXPECT_EQ(stream->read(second.data(), second.size()), second.size());
+
+    EXPECT_TRUE(std::equal(first.begin(), first.end(), expected.begin()));
+    EXPECT_TRUE(std::equal(second.begin(), second.end(),
+                           expected.begin() + first.size()));
+    EXPECT_EQ(stream->getPosition(), 2000);
+}
+
+GTEST_TEST(SeekableFileStream, PositionalDataSourceConcurrentReads)
+{
+    constexpr size_t ThreadCount = 4;
+    constexpr size_t RegionSize = 16 * 1024;
+    RandomByteGenerator entropySource(46);
+    Fs::Path fileName = generateTempFileName();
+
+    ByteBlock fileData = fillRandomData(entropySource, ThreadCount * RegionSize + 100);
+
+    {
+        ISeekableStreamUPtr file = SeekableFileStream::open(fileName,
+                                                            FileAccess::ReadWrite |
+                                                            FileAccess::CreateAlways);
+        ASSERT_EQ(file->write(fileData.data(), fileData.size()), fileData.size());
+    }
+
+    {
+        StreamRegion fileRegion(100, ThreadCount * RegionSize);
+        ReadOnlyDataSource::UPtr source = ReadOnlyDataSource::createPositional(fileName,
+                                                                               fileRegion);
+        std::vector<ByteBlock> results(ThreadCount);
+        std::vector<std::thread> readers;
+
+        // Read each region in small pieces on a separate thread, alternating
+        // between direct reads and streams.
+        for (size_t index = 0; index < ThreadCount; ++index)
+        {
+            readers.emplace_back([&, index]()
+            {
+                ByteBlock &result = results[index];
+                StreamRegion region(static_cast<StreamPosition>(index * RegionSize),
+                                    RegionSize);
+                result.resize(RegionSize);
+
+                if (index & 1)
+                {
+                    ISeekableStreamUPtr stream = source->readStream(region);
+
+                    for (size_t offset = 0; offset < RegionSize; offset += 1024)
+                        stream->read(result.data() + offset, 1024);
+                }
+                else
+                {
+                    for (size_t offset = 0; offset < RegionSize; offset += 1024)
+                    {
+                        StreamRegion piece(region.getOffset() + offset, 1024);
+                        source->readExactly(piece, result.data() + offset);
+                    }
+                }
+            });
+        }
+
+        for (std::thread &reader : readers)
+            reader.join();
+
+        for (size_t index = 0; index < ThreadCount; ++index)
+        {
+            auto expectedStart = fileData.begin() + 100 + (index * RegionSize);
+
+            EXPECT_TRUE(std::equal(results[index].begin(), results[index].end(),
+                                   expectedStart));
+        }
+
+        uint8_t value;
+        EXPECT_FALSE(source->tryReadByte(ThreadCount * RegionSize, value));
+        EXPECT_THROW(ReadOnlyDataSource::createPositional(fileName,
+                                                          StreamRegion(200, ThreadCount * RegionSize)),
+                     ArgumentException);
+    }
+
+    Fs::Entry(fileName).remove(/* reportError = */ false);
+}
+
 } // Anonymous namespace
 
 }} // namespace Ag::IO
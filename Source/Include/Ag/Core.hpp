@@ -20,6 +20,7 @@
 #include "Core/AlignedTypes.hpp"
 #include "Core/Binary.hpp"
 #include "Core/Timer.hpp"
+#include "Core/Instrumentation.hpp"
 #include "Core/ByteOrder.hpp"
 #include "Core/CodePoint.hpp"
 #include "Core/EnumInfo.hpp"
@@ -41,6 +42,7 @@
 #include "Core/Variant.hpp"
 #include "Core/Trace.hpp"
 #include "Core/String.hpp"
+#include "Core/StringBuilder.hpp"
 #include "Core/Version.hpp"
 #include "Core/AppMetadata.hpp"
 #include "Core/ScalarParser.hpp"
@@ -50,6 +52,9 @@
 #include "Core/FsSearchPathList.hpp"
 #include "Core/FsDirectory.hpp"
 #include "Core/Stream.hpp"
+#include "Core/CompressionCodec.hpp"
+#include "Core/WorkerPool.hpp"
+#include "Core/SamplingProfiler.hpp"
 #include "Core/Uri.hpp"
 #include "Core/App.hpp"
 
@@ -28,6 +28,68 @@ namespace Ag {
 ////////////////////////////////////////////////////////////////////////////////
 using ByteBlock = std::vector<uint8_t>;
 
+//! @brief A read-only view of a contiguous block of bytes owned by
+//! another object.
+struct ByteSpan
+{
+    // Public Fields
+    const uint8_t *Data = nullptr;
+    size_t Length = 0;
+
+    // Construction
+    constexpr ByteSpan() = default;
+
+    //! @brief Constructs a view of a block of bytes.
+    //! @param[in] data A pointer to the first byte.
+    //! @param[in] length The count of bytes pointed to by @p data.
+    constexpr ByteSpan(const uint8_t *data, size_t length) :
+        Data(data),
+        Length(length)
+    {
+    }
+
+    // Accessors
+    //! @brief Determines if the view contains no bytes.
+    constexpr bool isEmpty() const { return Length == 0; }
+
+    //! @brief Gets a pointer to the first byte in the view.
+    constexpr const uint8_t *begin() const { return Data; }
+
+    //! @brief Gets a pointer to the byte after the last in the view.
+    constexpr const uint8_t *end() const { return Data + Length; }
+};
+
+//! @brief A writable view of a contiguous block of bytes owned by
+//! another object.
+struct MutableByteSpan
+{
+    // Public Fields
+    uint8_t *Data = nullptr;
+    size_t Length = 0;
+
+    // Construction
+    constexpr MutableByteSpan() = default;
+
+    //! @brief Constructs a view of a block of bytes.
+    //! @param[in] data A pointer to the first byte.
+    //! @param[in] length The count of bytes pointed to by @p data.
+    constexpr MutableByteSpan(uint8_t *data, size_t length) :
+        Data(data),
+        Length(length)
+    {
+    }
+
+    // Accessors
+    //! @brief Determines if the view contains no bytes.
+    constexpr bool isEmpty() const { return Length == 0; }
+
+    //! @brief Gets a pointer to the first byte in the view.
+    constexpr uint8_t *begin() const { return Data; }
+
+    //! @brief Gets a pointer to the byte after the last in the view.
+    constexpr uint8_t *end() const { return Data + Length; }
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 // Function Declarations
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,171 @@
+//! @file Ag/Core/CompressionCodec.hpp
+//! @brief The declaration of an interface to interchangeable block
+//! compression algorithms and streams which apply them.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __AG_CORE_COMPRESSION_CODEC_HPP__
+#define __AG_CORE_COMPRESSION_CODEC_HPP__
+
+////////////////////////////////////////////////////////////////////////////////
+// Dependent Header Files
+////////////////////////////////////////////////////////////////////////////////
+#include <cstdint>
+
+#include <vector>
+
+#include "Configuration.hpp"
+#include "Stream.hpp"
+
+namespace Ag {
+
+////////////////////////////////////////////////////////////////////////////////
+// Data Type Declarations
+////////////////////////////////////////////////////////////////////////////////
+//! @brief Identifies a compression algorithm.
+//! @note The values are persisted in encoded data and must never change.
+enum class CompressionCodecID : uint8_t
+{
+    //! @brief The bzip2 algorithm, slow but with a high compression ratio.
+    Bzip2 = 0,
+
+    //! @brief A byte-oriented LZ77 algorithm, in the style of LZ4, which
+    //! trades compression ratio for speed.
+    Lz = 1,
+
+    Max,
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Class Declarations
+////////////////////////////////////////////////////////////////////////////////
+//! @brief An interface to an algorithm which compresses independent blocks
+//! of data held in memory.
+//! @details Implementations are stateless, so a single instance can be used
+//! on any number of threads at once.
+class ICompressionCodec
+{
+public:
+    // Construction/Destruction
+    virtual ~ICompressionCodec() = default;
+
+    // Accessors
+
+    //! @brief Gets the value which identifies the algorithm in encoded data.
+    virtual CompressionCodecID getID() const = 0;
+
+    //! @brief Gets the short display name of the algorithm.
+    virtual utf8_cptr_t getName() const = 0;
+
+    //! @brief Gets the largest count of bytes a block can compress to.
+    //! @param[in] sourceByteCount The count of bytes to compress.
+    //! @return The minimum capacity of a buffer passed to compress().
+    virtual size_t getMaxCompressedSize(size_t sourceByteCount) const = 0;
+
+    // Operations
+
+    //! @brief Compresses a block of data.
+    //! @param[in] source The bytes to compress.
+    //! @param[in] sourceByteCount The count of bytes in @p source.
+    //! @param[out] target The buffer to receive the compressed bytes.
+    //! @param[in] targetCapacity The count of bytes available in @p target,
+    //! which should be at least the value returned by getMaxCompressedSize().
+    //! @return The count of compressed bytes written to @p target.
+    //! @throws OperationException If @p target was too small.
+    virtual size_t compress(const void *source, size_t sourceByteCount,
+                            void *target, size_t targetCapacity) const = 0;
+
+    //! @brief Decompresses a block of data produced by compress().
+    //! @param[in] source The compressed bytes.
+    //! @param[in] sourceByteCount The count of bytes in @p source.
+    //! @param[out] target The buffer to receive the decompressed bytes.
+    //! @param[in] targetByteCount The exact count of bytes the block
+    //! decompresses to.
+    //! @throws OperationException If the data was corrupt or did not
+    //! decompress to exactly @p targetByteCount bytes.
+    virtual void decompress(const void *source, size_t sourceByteCount,
+                            void *target, size_t targetByteCount) const = 0;
+
+    // Helpers
+    void compress(const void *source, size_t sourceByteCount,
+                  std::vector<uint8_t> &target) const;
+};
+
+//! @brief A stream which compresses data in blocks using an arbitrary codec
+//! before writing it to a nested stream.
+//! @details Each block is preceded by its uncompressed and compressed sizes
+//! and the stream is terminated by an empty block, so that it can be read by
+//! a CodecDecompressionStream using the same codec.
+class CodecCompressionStream : public IStream
+{
+public:
+    // Public Constants
+    static constexpr size_t DefaultBlockSize = 256 * 1024;
+
+    // Construction/Destruction
+    CodecCompressionStream(IStream *outputStream, const ICompressionCodec &codec,
+                           size_t blockSize = DefaultBlockSize);
+    virtual ~CodecCompressionStream();
+
+    // Operations
+    void close();
+
+    // Overrides
+    virtual bool isBuffered() const override;
+    virtual void flush() override;
+    virtual size_t read(void *targetBuffer, size_t requiredByteCount) override;
+    virtual size_t write(const void *sourceBuffer, size_t sourceByteCount) override;
+private:
+    // Internal Functions
+    void writeBlock();
+
+    // Internal Fields
+    IStream *_output;
+    const ICompressionCodec &_codec;
+    std::vector<uint8_t> _block;
+    std::vector<uint8_t> _compressedBlock;
+    size_t _blockSize;
+    bool _isClosed;
+};
+
+//! @brief A stream which decompresses blocks written by a
+//! CodecCompressionStream from a nested stream.
+class CodecDecompressionStream : public IStream
+{
+public:
+    // Construction/Destruction
+    CodecDecompressionStream(IStream *inputStream, const ICompressionCodec &codec);
+    virtual ~CodecDecompressionStream() = default;
+
+    // Overrides
+    virtual bool isBuffered() const override;
+    virtual void flush() override;
+    virtual size_t read(void *targetBuffer, size_t requiredByteCount) override;
+    virtual size_t write(const void *sourceBuffer, size_t sourceByteCount) override;
+private:
+    // Internal Functions
+    bool tryReadBlock();
+
+    // Internal Fields
+    IStream *_input;
+    const ICompressionCodec &_codec;
+    std::vector<uint8_t> _block;
+    std::vector<uint8_t> _compressedBlock;
+    size_t _blockOffset;
+    bool _isEnd;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Declarations
+////////////////////////////////////////////////////////////////////////////////
+const ICompressionCodec *tryGetCompressionCodec(CompressionCodecID id);
+const ICompressionCodec &getCompressionCodec(CompressionCodecID id);
+
+} // namespace Ag
+
+#endif // Header guard
+////////////////////////////////////////////////////////////////////////////////
@@ -41,6 +41,22 @@ class String;
 //! @addtogroup CoreExceptions
 //! @{
 
+//! @brief Defines how much of the call stack is captured when an exception
+//! is constructed.
+enum class StackCapturePolicy
+{
+    //! @brief No stack trace is captured, exceptions are as cheap as possible.
+    Off,
+
+    //! @brief Raw return addresses are captured into a fixed buffer and are
+    //! only resolved to symbols if the stack trace is requested.
+    Raw,
+
+    //! @brief The stack trace is resolved to symbols when the exception is
+    //! constructed. Traces from the same throw site share one resolved copy.
+    Full,
+};
+
 //! @brief The base class for all exceptions thrown by the Ag libraries.
 class Exception : public std::exception
 {
@@ -58,6 +74,8 @@ public:
     const std::string_view &getDetail() const;
     const StackTrace &getStackTrace() const;
     const Exception &getInnerException() const;
+    static StackCapturePolicy getStackCapturePolicy();
+    static void setStackCapturePolicy(StackCapturePolicy policy);
 
     // Overrides
     virtual const char *what() const noexcept override;
@@ -1,7 +1,7 @@
 //! @file Ag/Core/Format.hpp
 //! @brief The declaration of objects and functions which format values as text.
 //! @author GiantRobotLemur@na-se.co.uk
-//! @date 2021-2023
+//! @date 2021-2026
 //! @copyright This file is part of the Silver (Ag) project which is released
 //! under LGPL 3 license. See LICENSE file at the repository root or go to
 //! https://github.com/GiantRobotLemur/Ag for full license details.
@@ -17,6 +17,8 @@
 #include <initializer_list>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <vector>
 
 #include "String.hpp"
 
@@ -99,6 +101,213 @@ private:
     uint8_t _radix;
 };
 
+//! @brief A lightweight reference to a value to be inserted into formatted
+//! text by a CompiledFormat object, which avoids constructing a Variant.
+//! @note The object refers to text and String values rather than copying
+//! them, so it should not outlive the value it was constructed from.
+class FormatArgument
+{
+public:
+    // Construction/Destruction
+    //! @brief Constructs an argument representing empty text.
+    FormatArgument() :
+        _kind(Kind::Text)
+    {
+        _value.View.Bytes = "";
+        _value.View.Length = 0;
+    }
+
+    //! @brief Constructs an argument referencing a value of a supported type.
+    //! @tparam T The data type of the value, which can be bool, a character,
+    //! integer or floating point type, text convertible to std::string_view,
+    //! a String, a Variant or a pointer.
+    //! @param[in] value The value to reference.
+    template<typename T>
+    FormatArgument(const T &value)
+    {
+        using TValue = std::decay_t<T>;
+
+        if constexpr (std::is_same_v<TValue, bool>)
+        {
+            _kind = Kind::Boolean;
+            _value.Boolean = value;
+        }
+        else if constexpr (std::is_same_v<TValue, char32_t> ||
+                           std::is_same_v<TValue, char>)
+        {
+            _kind = Kind::Character;
+            _value.Character = static_cast<char32_t>(value);
+        }
+        else if constexpr (std::is_integral_v<TValue> && std::is_signed_v<TValue>)
+        {
+            _kind = Kind::Signed;
+            _value.Signed = static_cast<int64_t>(value);
+        }
+        else if constexpr (std::is_integral_v<TValue>)
+        {
+            _kind = Kind::Unsigned;
+            _value.Unsigned = static_cast<uint64_t>(value);
+        }
+        else if constexpr (std::is_floating_point_v<TValue>)
+        {
+            _kind = Kind::Real;
+            _value.Real = static_cast<double>(value);
+        }
+        else if constexpr (std::is_same_v<TValue, String>)
+        {
+            _kind = Kind::String;
+            _value.Text = &value;
+        }
+        else if constexpr (std::is_same_v<TValue, Variant>)
+        {
+            _kind = Kind::Variant;
+            _value.Boxed = &value;
+        }
+        else if constexpr (std::is_convertible_v<const T &, std::string_view>)
+        {
+            _kind = Kind::Text;
+
+            if constexpr (std::is_pointer_v<T>)
+            {
+                if (value == nullptr)
+                {
+                    _value.View.Bytes = "";
+                    _value.View.Length = 0;
+                    return;
+                }
+            }
+
+            std::string_view text(value);
+            _value.View.Bytes = text.data();
+            _value.View.Length = text.length();
+        }
+        else if constexpr (std::is_pointer_v<TValue>)
+        {
+            _kind = Kind::Pointer;
+            _value.Pointer = reinterpret_cast<uintptr_t>(value);
+        }
+        else
+        {
+            static_assert(sizeof(T) == 0, "The type cannot be formatted.");
+        }
+    }
+
+    // Operations
+    void appendToString(const FormatInfo &options, std::string &buffer) const;
+    bool tryAppendFileSize(const FormatInfo &options, std::string &buffer) const;
+private:
+    // Internal Types
+    //! @brief Identifies the type of value referenced.
+    enum class Kind : uint8_t
+    {
+        Boolean,
+        Character,
+        Signed,
+        Unsigned,
+        Real,
+        Pointer,
+        Text,
+        String,
+        Variant,
+    };
+
+    //! @brief The storage for the value or a reference to it.
+    union Value
+    {
+        bool Boolean;
+        char32_t Character;
+        int64_t Signed;
+        uint64_t Unsigned;
+        double Real;
+        uintptr_t Pointer;
+        const String *Text;
+        const Variant *Boxed;
+
+        struct
+        {
+            const char *Bytes;
+            size_t Length;
+        } View;
+    };
+
+    // Internal Fields
+    Value _value;
+    Kind _kind;
+};
+
+//! @brief A format specification which has been parsed once so that it can
+//! be used to format sets of values repeatedly.
+//! @details The specification uses the same syntax as appendFormat(). The
+//! options used to format each insertion token are calculated up-front, and
+//! values can be passed directly to append() or format() without being
+//! converted to Variant objects.
+class CompiledFormat
+{
+public:
+    // Construction/Destruction
+    explicit CompiledFormat(const std::string_view &spec);
+    CompiledFormat(const FormatInfo &options, const std::string_view &spec);
+    ~CompiledFormat() = default;
+
+    // Accessors
+    size_t getParameterCount() const;
+
+    // Operations
+    void appendArguments(std::string &buffer, const FormatArgument *args,
+                         size_t argCount) const;
+    void appendVariants(std::string &buffer,
+                        const std::initializer_list<Variant> &params) const;
+
+    //! @brief Appends text with values inserted to an STL string.
+    //! @tparam TArgs The types of the values, see FormatArgument.
+    //! @param[out] buffer The buffer to append the formatted text to.
+    //! @param[in] args The values to insert.
+    //! @throws FormatException If an insertion token refers to a value
+    //! beyond the end of args.
+    template<typename... TArgs>
+    void append(std::string &buffer, const TArgs &... args) const
+    {
+        const FormatArgument argList[] = { FormatArgument(args)..., FormatArgument() };
+
+        appendArguments(buffer, argList, sizeof...(TArgs));
+    }
+
+    //! @brief Creates a string with values inserted.
+    //! @tparam TArgs The types of the values, see FormatArgument.
+    //! @param[in] args The values to insert.
+    //! @return The formatted text.
+    //! @throws FormatException If an insertion token refers to a value
+    //! beyond the end of args.
+    template<typename... TArgs>
+    String format(const TArgs &... args) const
+    {
+        std::string buffer;
+        append(buffer, args...);
+
+        return String(std::move(buffer));
+    }
+private:
+    // Internal Types
+    //! @brief Describes a value to insert after a run of literal text.
+    struct Insertion
+    {
+        FormatInfo Options;
+        size_t LiteralLength;
+        size_t ValueIndex;
+        char TypeCode;
+    };
+
+    using InsertionCollection = std::vector<Insertion>;
+
+    // Internal Functions
+    void compile(const FormatInfo &options, const std::string_view &spec);
+
+    // Internal Fields
+    std::string _literals;
+    InsertionCollection _insertions;
+    size_t _parameterCount;
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 // Function Declarations
 ////////////////////////////////////////////////////////////////////////////////
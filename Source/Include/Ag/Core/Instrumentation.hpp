@@ -0,0 +1,160 @@
+//! @file Ag/Core/Instrumentation.hpp
+//! @brief The declaration of a light-weight mechanism for recording timed
+//! zones, counters and histogram samples in release builds.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __AG_CORE_INSTRUMENTATION_HPP__
+#define __AG_CORE_INSTRUMENTATION_HPP__
+
+////////////////////////////////////////////////////////////////////////////////
+// Dependent Header Files
+////////////////////////////////////////////////////////////////////////////////
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "Timer.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Macro Definitions
+////////////////////////////////////////////////////////////////////////////////
+#ifdef AG_DISABLE_INSTRUMENTATION
+// The values are referenced, but not evaluated, to avoid unused variable warnings.
+#define AG_INSTRUMENT_ZONE(name)
+#define AG_INSTRUMENT_COUNTER(name, value) do { static_cast<void>(sizeof(value)); } while (false)
+#define AG_INSTRUMENT_SAMPLE(name, value) do { static_cast<void>(sizeof(value)); } while (false)
+#else
+#define AG_INSTRUMENT_CONCAT_(lhs, rhs) lhs ## rhs
+#define AG_INSTRUMENT_CONCAT(lhs, rhs) AG_INSTRUMENT_CONCAT_(lhs, rhs)
+
+//! @brief Records the time taken to execute the rest of the current scope.
+//! @param name A string literal naming the zone.
+#define AG_INSTRUMENT_ZONE(name) \
+    ::Ag::InstrumentationZone AG_INSTRUMENT_CONCAT(agInstrumentZone, __LINE__)(name)
+
+//! @brief Records the current value of a named counter.
+//! @param name A string literal naming the counter.
+//! @param value The integer value of the counter.
+#define AG_INSTRUMENT_COUNTER(name, value) \
+    do { if (::Ag::Instrumentation::isEnabled()) \
+             ::Ag::Instrumentation::recordCounter((name), (value)); } while (false)
+
+//! @brief Adds a value to a named histogram.
+//! @param name A string literal naming the histogram.
+//! @param value The integer value to add.
+#define AG_INSTRUMENT_SAMPLE(name, value) \
+    do { if (::Ag::Instrumentation::isEnabled()) \
+             ::Ag::Instrumentation::recordSample((name), (value)); } while (false)
+#endif
+
+namespace Ag {
+
+////////////////////////////////////////////////////////////////////////////////
+// Data Type Declarations
+////////////////////////////////////////////////////////////////////////////////
+//! @brief A summary of the values added to a named histogram.
+struct InstrumentHistogram
+{
+    //! @brief The count of buckets, one per bit of magnitude plus one for
+    //! values less than 1.
+    static constexpr size_t BucketCount = 64;
+
+    //! @brief The count of values added to the histogram.
+    size_t Count = 0;
+
+    //! @brief The smallest value added.
+    int64_t Min = 0;
+
+    //! @brief The largest value added.
+    int64_t Max = 0;
+
+    //! @brief The sum of all values added.
+    double Sum = 0.0;
+
+    //! @brief The count of values in each power-of-2 range. Bucket 0 holds
+    //! values less than 1, bucket n holds values in the range [2^(n-1), 2^n).
+    std::array<size_t, BucketCount> Buckets{};
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Declarations
+////////////////////////////////////////////////////////////////////////////////
+//! @brief A namespace containing functions which record events into per-thread
+//! buffers and export them for analysis.
+//! @details Event names must be string literals or otherwise outlive all
+//! recorded events, only their addresses are recorded.
+namespace Instrumentation
+{
+//! @brief The default maximum count of zone and counter events retained,
+//! after which further events are dropped.
+constexpr size_t DefaultEventCapacity = 1u << 20;
+
+//! @brief The flag tested by isEnabled(), use setEnabled() to change it.
+extern std::atomic<bool> IsEnabledFlag;
+
+//! @brief Determines whether events are currently being recorded.
+inline bool isEnabled() { return IsEnabledFlag.load(std::memory_order_relaxed); }
+
+void setEnabled(bool isEnabled);
+void recordZone(const char *name, MonotonicTicks start, MonotonicTicks duration);
+void recordCounter(const char *name, int64_t value);
+void recordSample(const char *name, int64_t value);
+void flush();
+void clear();
+void setEventCapacity(size_t capacity);
+size_t getEventCount();
+size_t getDroppedEventCount();
+bool tryGetHistogram(std::string_view name, InstrumentHistogram &histogram);
+void appendChromeTrace(std::string &destination);
+} // namespace Instrumentation
+
+////////////////////////////////////////////////////////////////////////////////
+// Class Declarations
+////////////////////////////////////////////////////////////////////////////////
+//! @brief An object which records the time between its construction and
+//! destruction as a named zone, if instrumentation is enabled.
+class InstrumentationZone
+{
+public:
+    // Construction/Destruction
+    //! @brief Starts timing a zone if instrumentation is enabled.
+    //! @param[in] name A string literal naming the zone.
+    InstrumentationZone(const char *name) :
+        _name(Instrumentation::isEnabled() ? name : nullptr),
+        _start((_name == nullptr) ? 0 : HighResMonotonicTimer::getTime())
+    {
+    }
+
+    InstrumentationZone(const InstrumentationZone &) = delete;
+    InstrumentationZone(InstrumentationZone &&) = delete;
+
+    //! @brief Records the zone if timing was started.
+    ~InstrumentationZone()
+    {
+        if (_name != nullptr)
+        {
+            Instrumentation::recordZone(_name, _start,
+                                        HighResMonotonicTimer::getDuration(_start));
+        }
+    }
+
+    // Operations
+    InstrumentationZone &operator=(const InstrumentationZone &) = delete;
+    InstrumentationZone &operator=(InstrumentationZone &&) = delete;
+private:
+    // Internal Fields
+    const char *_name;
+    MonotonicTicks _start;
+};
+
+} // namespace Ag
+
+#endif // Header guard
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,73 @@
+//! @file Ag/Core/SamplingProfiler.hpp
+//! @brief The declaration of an in-process statistical profiler which samples
+//! the call stacks of running threads.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __AG_CORE_SAMPLING_PROFILER_HPP__
+#define __AG_CORE_SAMPLING_PROFILER_HPP__
+
+////////////////////////////////////////////////////////////////////////////////
+// Dependent Header Files
+////////////////////////////////////////////////////////////////////////////////
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace Ag {
+
+////////////////////////////////////////////////////////////////////////////////
+// Class Declarations
+////////////////////////////////////////////////////////////////////////////////
+class SamplingProfilerPrivate;
+
+//! @brief An object which periodically samples the call stacks of registered
+//! threads while they consume CPU time.
+//! @details Each registered thread is interrupted by a CPU time driven timer
+//! signal which records its raw return addresses into a lock-free ring buffer
+//! owned by the thread. A background thread aggregates the samples away from
+//! the hot path, and the results can be exported as collapsed stacks resolved
+//! using the same symbol information as StackTrace.
+//!
+//! Only one profiler can run at a time. The thread which starts a profiler
+//! is registered automatically, other threads must call
+//! registerCurrentThread() to be sampled and are unregistered when they exit.
+class SamplingProfiler
+{
+public:
+    // Construction/Destruction
+    SamplingProfiler();
+    SamplingProfiler(const SamplingProfiler &) = delete;
+    SamplingProfiler(SamplingProfiler &&) = delete;
+    ~SamplingProfiler();
+
+    // Accessors
+    static bool isSupported();
+    bool isRunning() const;
+    size_t getSampleCount() const;
+    size_t getStackCount() const;
+    static size_t getDroppedSampleCount();
+
+    // Operations
+    SamplingProfiler &operator=(const SamplingProfiler &) = delete;
+    SamplingProfiler &operator=(SamplingProfiler &&) = delete;
+    static void registerCurrentThread();
+    static void unregisterCurrentThread();
+    void start(uint32_t samplesPerSecond = 997);
+    void stop();
+    void collect();
+    void clear();
+    void appendCollapsedStacks(std::string &destination) const;
+private:
+    // Internal Fields
+    std::unique_ptr<SamplingProfilerPrivate> _data;
+};
+
+} // namespace Ag
+
+#endif // Header guard
+////////////////////////////////////////////////////////////////////////////////
@@ -1,7 +1,7 @@
 //! @file Ag/Core/ScalarParser.hpp
 //! @brief The declaration of an object which parses scalar values from text.
 //! @author GiantRobotLemur@na-se.co.uk
-//! @date 2021-2023
+//! @date 2021-2026
 //! @copyright This file is part of the Silver (Ag) project which is released
 //! under LGPL 3 license. See LICENSE file at the repository root or go to
 //! https://github.com/GiantRobotLemur/Ag for full license details.
@@ -15,6 +15,8 @@
 ////////////////////////////////////////////////////////////////////////////////
 #include <cmath>
 #include <limits>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
 #include "Format.hpp"
@@ -253,6 +255,133 @@ private:
     DigitVector _exponentDigits;
 };
 
+////////////////////////////////////////////////////////////////////////////////
+// Function Declarations
+////////////////////////////////////////////////////////////////////////////////
+size_t parseScalarPrefix(std::string_view text, int8_t &value, int radix = 10);
+size_t parseScalarPrefix(std::string_view text, uint8_t &value, int radix = 10);
+size_t parseScalarPrefix(std::string_view text, int16_t &value, int radix = 10);
+size_t parseScalarPrefix(std::string_view text, uint16_t &value, int radix = 10);
+size_t parseScalarPrefix(std::string_view text, int32_t &value, int radix = 10);
+size_t parseScalarPrefix(std::string_view text, uint32_t &value, int radix = 10);
+size_t parseScalarPrefix(std::string_view text, int64_t &value, int radix = 10);
+size_t parseScalarPrefix(std::string_view text, uint64_t &value, int radix = 10);
+size_t parseScalarPrefix(std::string_view text, float &value);
+size_t parseScalarPrefix(std::string_view text, double &value);
+
+//! @brief Parses a buffer of delimited values, such as a column of a table,
+//! into an array.
+//! @tparam T The scalar data type of the values to parse.
+//! @param[in] text The text to parse. Values are separated by the delimiter
+//! or by line breaks and may be surrounded by spaces or tabs.
+//! @param[in] delimiter The character which separates values on a line.
+//! @param[out] values The array to append the parsed values to.
+//! @param[out] errorOffset Optionally receives the offset into text of the
+//! first value which could not be parsed.
+//! @param[in] radix The radix of integer values, between 2 and 36.
+//! @retval true All values were parsed.
+//! @retval false A value was malformed, out of range or missing, values
+//! before it will have been appended to the array.
+//! @note Values must be in the neutral format accepted by parseScalarPrefix(),
+//! use ScalarParser for locale-specific formats or radix prefixes.
+template<typename T>
+bool tryParseScalarArray(std::string_view text, char delimiter,
+                         std::vector<T> &values, size_t *errorOffset = nullptr,
+                         int radix = 10)
+{
+    static_assert(std::is_arithmetic_v<T>, "Only scalar values can be parsed.");
+
+    const bool isDelimiterBlank = (delimiter == ' ') || (delimiter == '\t');
+    size_t offset = 0;
+    bool isOK = true;
+
+    auto isBlank = [](char next) { return (next == ' ') || (next == '\t'); };
+    auto isLineBreak = [](char next) { return (next == '\r') || (next == '\n'); };
+
+    // Skip leading blank lines.
+    while ((offset < text.length()) &&
+           (isBlank(text[offset]) || isLineBreak(text[offset])))
+    {
+        ++offset;
+    }
+
+    while (isOK && (offset < text.length()))
+    {
+        T value;
+        size_t length;
+
+        if constexpr (std::is_integral_v<T>)
+        {
+            length = parseScalarPrefix(text.substr(offset), value, radix);
+        }
+        else
+        {
+            length = parseScalarPrefix(text.substr(offset), value);
+        }
+
+        if (length == 0)
+        {
+            isOK = false;
+            break;
+        }
+
+        values.push_back(value);
+        offset += length;
+
+        // Consume the separator, which can be surrounded by blanks.
+        size_t valueEnd = offset;
+
+        while ((offset < text.length()) && isBlank(text[offset]))
+        {
+            ++offset;
+        }
+
+        if (offset == text.length())
+        {
+            break;
+        }
+
+        if (isLineBreak(text[offset]) || (isDelimiterBlank && (offset > valueEnd)))
+        {
+            // Skip to the next value, ignoring blank lines.
+            while ((offset < text.length()) &&
+                   (isBlank(text[offset]) || isLineBreak(text[offset])))
+            {
+                ++offset;
+            }
+        }
+        else if (text[offset] == delimiter)
+        {
+            ++offset;
+
+            while ((offset < text.length()) && isBlank(text[offset]))
+            {
+                ++offset;
+            }
+
+            if ((offset == text.length()) || isLineBreak(text[offset]) ||
+                (text[offset] == delimiter))
+            {
+                // The field after the delimiter is empty.
+                isOK = false;
+            }
+        }
+        else
+        {
+            // The value was followed by unexpected characters.
+            offset = valueEnd;
+            isOK = false;
+        }
+    }
+
+    if ((isOK == false) && (errorOffset != nullptr))
+    {
+        *errorOffset = offset;
+    }
+
+    return isOK;
+}
+
 } // namespace Ag
 
 #endif // Header guard
@@ -64,6 +64,9 @@ public:
     //! @return The actual number of bytes written.
     //! @throws Ag::Exception If an error occurs during the write.
     virtual size_t write(const void *sourceBuffer, size_t sourceByteCount) = 0;
+
+    virtual size_t readScattered(const MutableByteSpan *targetBuffers, size_t bufferCount);
+    virtual size_t writeGathered(const ByteSpan *sourceBuffers, size_t bufferCount);
 };
 
 DECLARE_UNIQUE_PTR(IStream);
@@ -152,6 +155,11 @@ using IFileStreamUPtr = IFileStream::UPtr;
 // allowing the library to remain private.
 class AgBz2Context;
 
+namespace Bz2 {
+class ParallelCompressor;
+class ParallelDecompressor;
+} // namespace Bz2
+
 //! @brief A stream which compresses data before writing it to a nested stream.
 class Bz2CompressionStream : public IStream
 {
@@ -223,6 +231,54 @@ private:
     uintptr_t _workspace[Bz2CompressionStream::WorkspaceWordCount];
 };
 
+//! @brief A stream which compresses data on a set of worker threads before
+//! writing it to a nested stream.
+//! @details Data is split into chunks which each compress to a single bzip2
+//! block. The blocks are spliced, in order, into a single standard bzip2
+//! stream which can be read by Bz2DecompressionStream.
+class ParallelBz2CompressionStream : public IStream
+{
+public:
+    // Construction/Destruction
+    ParallelBz2CompressionStream(IStream *outputStream,
+                                 size_t threadCount = 0,
+                                 int compressionLevel = 9,
+                                 int workFactor = 30);
+    virtual ~ParallelBz2CompressionStream();
+
+    // Operations
+    void close();
+
+    // Overrides
+    virtual bool isBuffered() const override;
+    virtual void flush() override;
+    virtual size_t read(void *targetBuffer, size_t requiredByteCount) override;
+    virtual size_t write(const void *sourceBuffer, size_t sourceByteCount) override;
+private:
+    // Internal Fields
+    std::unique_ptr<Bz2::ParallelCompressor> _compressor;
+};
+
+//! @brief A stream which decompresses the blocks of bzip2 data read from a
+//! nested stream on a set of worker threads.
+class ParallelBz2DecompressionStream : public IStream
+{
+public:
+    // Construction/Destruction
+    ParallelBz2DecompressionStream(IStream *inputStream,
+                                   size_t threadCount = 0);
+    virtual ~ParallelBz2DecompressionStream();
+
+    // Overrides
+    virtual bool isBuffered() const override;
+    virtual void flush() override;
+    virtual size_t read(void *targetBuffer, size_t requiredByteCount) override;
+    virtual size_t write(const void *sourceBuffer, size_t sourceByteCount) override;
+private:
+    // Internal Fields
+    std::unique_ptr<Bz2::ParallelDecompressor> _decompressor;
+};
+
 } // namespace Ag
 
 #endif // Header guard
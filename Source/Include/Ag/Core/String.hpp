@@ -13,10 +13,12 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Dependent Header Files
 ////////////////////////////////////////////////////////////////////////////////
+#include <deque>
 #include <functional>
 #include <initializer_list>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "Configuration.hpp"
@@ -35,67 +37,7 @@ class String
 {
 public:
     // Public Types
-    //! @brief An iterator data type which allows a caller to iterate through
-    //! the Unicode code points of the string by performing implicit conversion.
-    class iterator
-    {
-        friend class String;
-    public:
-        // Construction
-        iterator(const std::shared_ptr<StringPrivate> &source, size_t offset);
-        iterator(const iterator &rhs);
-        ~iterator() = default;
-
-        // Required Bi-directional Iterator Members
-
-        // Public Types
-        //! @brief The standard iterator typedef for the type of object the
-        //! iterator dereferences into.
-        typedef char32_t value_type;
-
-        //! @brief The standard iterator typedef for the type of reference
-        // which exposes the item the iterator represents.
-        typedef char32_t &reference;
-
-        //! @brief The standard iterator typedef for the type of pointer
-        // which exposes the item the iterator represents.
-        typedef  char32_t *pointer;
-
-        //! @brief The standard iterator typedef for the category the iterator
-        //! belongs to.
-        typedef std::bidirectional_iterator_tag iterator_category;
-
-        //! @brief The standard iterator typedef for the type returned when
-        //! one iterator instance is subtracted from another.
-        typedef std::ptrdiff_t difference_type;
-
-        // Required Member Functions
-        iterator &operator=(const iterator &rhs);
-        const char32_t &operator*() const;
-        const char32_t *operator->() const;
-        iterator &operator++();
-        iterator operator++(int);
-        iterator &operator--();
-        iterator operator--(int);
-        bool operator==(const iterator &rhs) const;
-        bool operator!=(const iterator &rhs) const;
-
-        // Accessors
-        size_t getOffset() const;
-    private:
-        // Internal Functions
-        bool isPastEnd() const;
-        void ensureCacheValid() const;
-        bool tryAdvance(size_t &nextOffset) const;
-        bool tryRetreat(size_t &previousOffset) const;
-
-        // Internal Data
-        std::shared_ptr<StringPrivate> _source;
-        size_t _offset;
-        mutable size_t _cachedEncodedLength;
-        mutable char32_t _cachedValue;
-        mutable bool _hasCachedValue;
-    };
+    class iterator;
 
     // Public Data
     //! @brief An empty string value.
@@ -113,12 +55,16 @@ public:
     String(wchar_cptr_t boundedWide, size_t charCount);
     String(const std::string_view &stlUtf8StringView);
     String(const std::string &stlUtf8String);
+    String(std::string &&stlUtf8String);
     String(const std::u16string_view &stlUtf16View);
     String(const std::u16string &stlUtf16String);
     String(const std::u32string_view &stlUtf32View);
     String(const std::u32string &stlUtf32String);
     String(const std::wstring_view &stlWideView);
     String(const std::wstring &stlWideString);
+    String(const String &rhs);
+    String(String &&rhs) noexcept;
+    ~String();
 
     // Accessors
     bool isEmpty() const;
@@ -157,14 +103,16 @@ public:
     bool operator!=(utf8_cptr_t nullTerminatedUtf8) const;
     bool operator<(const String &rhs) const;
     String operator+(const String &rhs) const;
-    String operator=(utf8_cptr_t nullTerminatedUtf8);
-    String operator=(utf16_cptr_t nullTerminatedUtf16);
-    String operator=(utf32_cptr_t nullTerminatedUtf32);
-    String operator=(wchar_cptr_t nullTerminatedWide);
-    String operator=(const std::string &stlUtf8String);
-    String operator=(const std::u16string &stlUtf16String);
-    String operator=(const std::u32string &stlUtf32String);
-    String operator=(const std::wstring &wideString);
+    String &operator=(const String &rhs);
+    String &operator=(String &&rhs) noexcept;
+    String &operator=(utf8_cptr_t nullTerminatedUtf8);
+    String &operator=(utf16_cptr_t nullTerminatedUtf16);
+    String &operator=(utf32_cptr_t nullTerminatedUtf32);
+    String &operator=(wchar_cptr_t nullTerminatedWide);
+    String &operator=(const std::string &stlUtf8String);
+    String &operator=(const std::u16string &stlUtf16String);
+    String &operator=(const std::u32string &stlUtf32String);
+    String &operator=(const std::wstring &wideString);
 
     String toUpper() const;
     String toLower() const;
@@ -190,8 +138,104 @@ public:
     bool tryParseScalar(float &scalar) const;
     bool tryParseScalar(double &scalar) const;
 private:
+    // Internal Types
+    //! @brief The type of the pointer to a shared string value in the
+    //! global pool.
+    using SharedPtr = std::shared_ptr<StringPrivate>;
+
+    //! @brief The count of bytes of storage in each string object, enough
+    //! for a shared pointer to a pooled value or a short in-line value.
+    static constexpr size_t StorageSize = sizeof(void *) * 3;
+
+    //! @brief The maximum count of UTF-8 bytes which can be stored in-line,
+    //! leaving space for a null terminator and the length byte.
+    static constexpr size_t MaxInlineLength = StorageSize - 2;
+
+    //! @brief The value of the length byte which indicates that the storage
+    //! contains a shared pointer to a pooled value.
+    static constexpr uint8_t SharedTag = 0xFF;
+
+    static_assert(sizeof(SharedPtr) < StorageSize,
+                  "String storage too small for a shared pointer.");
+
+    // Internal Functions
+    bool isInline() const noexcept;
+    const SharedPtr &getShared() const noexcept;
+    SharedPtr &getShared() noexcept;
+    std::string_view getView() const noexcept;
+    void initialise(StringPrivate &&key);
+    void initialiseInline(utf8_cptr_t boundedUtf8, size_t byteCount) noexcept;
+    void initialiseCopy(const String &rhs) noexcept;
+    void initialiseMove(String &&rhs) noexcept;
+    void release() noexcept;
+
     // Internal Fields
-    std::shared_ptr<StringPrivate> _str;
+    //! @brief Either holds a short null-terminated UTF-8 value followed by
+    //! its length in the last byte, or a shared pointer to a pooled value
+    //! followed by SharedTag in the last byte.
+    alignas(SharedPtr) char _storage[StorageSize];
+};
+
+//! @brief An iterator data type which allows a caller to iterate through
+//! the Unicode code points of the string by performing implicit conversion.
+class String::iterator
+{
+    friend class String;
+public:
+    // Construction
+    iterator(const String &source, size_t offset);
+    iterator(const iterator &rhs);
+    ~iterator() = default;
+
+    // Required Bi-directional Iterator Members
+
+    // Public Types
+    //! @brief The standard iterator typedef for the type of object the
+    //! iterator dereferences into.
+    typedef char32_t value_type;
+
+    //! @brief The standard iterator typedef for the type of reference
+    // which exposes the item the iterator represents.
+    typedef char32_t &reference;
+
+    //! @brief The standard iterator typedef for the type of pointer
+    // which exposes the item the iterator represents.
+    typedef  char32_t *pointer;
+
+    //! @brief The standard iterator typedef for the category the iterator
+    //! belongs to.
+    typedef std::bidirectional_iterator_tag iterator_category;
+
+    //! @brief The standard iterator typedef for the type returned when
+    //! one iterator instance is subtracted from another.
+    typedef std::ptrdiff_t difference_type;
+
+    // Required Member Functions
+    iterator &operator=(const iterator &rhs);
+    const char32_t &operator*() const;
+    const char32_t *operator->() const;
+    iterator &operator++();
+    iterator operator++(int);
+    iterator &operator--();
+    iterator operator--(int);
+    bool operator==(const iterator &rhs) const;
+    bool operator!=(const iterator &rhs) const;
+
+    // Accessors
+    size_t getOffset() const;
+private:
+    // Internal Functions
+    bool isPastEnd() const;
+    void ensureCacheValid() const;
+    bool tryAdvance(size_t &nextOffset) const;
+    bool tryRetreat(size_t &previousOffset) const;
+
+    // Internal Data
+    String _source;
+    size_t _offset;
+    mutable size_t _cachedEncodedLength;
+    mutable char32_t _cachedValue;
+    mutable bool _hasCachedValue;
 };
 
 //! @brief An alias type used to receive a string value from a function parameter.
@@ -245,6 +289,35 @@ namespace Ag {
 //! @brief An alias for a hash set of strings.
 using StringSet = std::unordered_set<String>;
 
+//! @brief A cache which maps text onto previously constructed string values
+//! so that identifiers which are repeatedly converted to String values can be
+//! resolved without recourse to the global string pool and its lock.
+//! @note Instances are not thread-safe, use getThreadPool() to obtain an
+//! instance private to the calling thread.
+class StringInternPool
+{
+public:
+    // Construction/Destruction
+    StringInternPool() = default;
+    StringInternPool(const StringInternPool &) = delete;
+    StringInternPool(StringInternPool &&) = default;
+    ~StringInternPool() = default;
+
+    // Accessors
+    size_t getCount() const;
+    static StringInternPool &getThreadPool();
+
+    // Operations
+    StringInternPool &operator=(const StringInternPool &) = delete;
+    StringInternPool &operator=(StringInternPool &&) = default;
+    const String &intern(const std::string_view &utf8);
+    void clear();
+private:
+    // Internal Fields
+    std::deque<String> _values;
+    std::unordered_map<std::string_view, const String *> _valuesByText;
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 // Function Declarations
 ////////////////////////////////////////////////////////////////////////////////
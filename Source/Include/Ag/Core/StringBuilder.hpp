@@ -0,0 +1,134 @@
+//! @file Ag/Core/StringBuilder.hpp
+//! @brief The declaration of an object which accumulates text in order to
+//! create an immutable string value.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __AG_CORE_STRING_BUILDER_HPP__
+#define __AG_CORE_STRING_BUILDER_HPP__
+
+////////////////////////////////////////////////////////////////////////////////
+// Dependent Header Files
+////////////////////////////////////////////////////////////////////////////////
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Configuration.hpp"
+#include "Format.hpp"
+#include "String.hpp"
+
+namespace Ag {
+
+////////////////////////////////////////////////////////////////////////////////
+// Class Declarations
+////////////////////////////////////////////////////////////////////////////////
+class Variant;
+
+//! @brief An object which accumulates UTF-8 encoded fragments of text in
+//! chunks so that a String can be built without repeatedly copying the text
+//! already appended.
+//! @details Text is appended to chunks which are allocated with room to
+//! spare, so appending at most copies the contents of the last chunk, never
+//! the whole value. The text is only validated and hashed once, when it is
+//! converted to a String.
+class StringBuilder
+{
+public:
+    // Construction/Destruction
+    StringBuilder();
+    StringBuilder(size_t initialCapacity);
+    StringBuilder(const StringBuilder &) = delete;
+    StringBuilder(StringBuilder &&) = default;
+    ~StringBuilder() = default;
+
+    // Accessors
+    bool isEmpty() const;
+    size_t getUtf8Length() const;
+    size_t getChunkCount() const;
+
+    // Operations
+    StringBuilder &operator=(const StringBuilder &) = delete;
+    StringBuilder &operator=(StringBuilder &&) = default;
+    StringBuilder &append(const std::string_view &utf8Text);
+    StringBuilder &append(const std::string &utf8Text);
+    StringBuilder &append(utf8_cptr_t nullTerminatedUtf8);
+    StringBuilder &append(const String &text);
+    StringBuilder &append(char32_t codePoint);
+    StringBuilder &appendFormat(const std::string_view &spec,
+                                const std::initializer_list<Variant> &params);
+    StringBuilder &appendFormat(const FormatInfo &options,
+                                const std::string_view &spec,
+                                const std::initializer_list<Variant> &params);
+
+    //! @brief Appends text produced by inserting values into a pre-compiled
+    //! format specification.
+    //! @tparam TArgs The types of the values, see FormatArgument.
+    //! @param[in] format The compiled format specification.
+    //! @param[in] args The values to insert.
+    //! @return A reference to the current object.
+    template<typename... TArgs>
+    StringBuilder &appendFormat(const CompiledFormat &format, const TArgs &... args)
+    {
+        std::string &tail = reserveTail(MinValueSpace * (sizeof...(TArgs) + 1));
+        size_t initialLength = tail.length();
+
+        format.append(tail, args...);
+        _length += tail.length() - initialLength;
+
+        return *this;
+    }
+
+    //! @brief Appends a scalar value formatted as text.
+    //! @tparam T The data type of the value, which must be supported by one
+    //! of the appendValue() functions declared in Format.hpp.
+    //! @param[in] options The options which define how the value is rendered.
+    //! @param[in] value The value to format.
+    //! @return A reference to the current object.
+    template<typename T>
+    StringBuilder &appendValue(const FormatInfo &options, T value)
+    {
+        std::string &tail = reserveTail(MinValueSpace);
+        size_t initialLength = tail.length();
+
+        Ag::appendValue(options, tail, value);
+        _length += tail.length() - initialLength;
+
+        return *this;
+    }
+
+    void clear();
+    String toString() const;
+private:
+    // Internal Types
+    using ChunkCollection = std::vector<std::string>;
+
+    // Internal Constants
+    //! @brief The size of the first chunk if none was specified.
+    static constexpr size_t DefaultChunkSize = 256;
+
+    //! @brief The size beyond which chunks no longer grow.
+    static constexpr size_t MaxChunkSize = 1 << 20;
+
+    //! @brief The space reserved for a single formatted value, which is
+    //! enough for any value without padding.
+    static constexpr size_t MinValueSpace = 32;
+
+    // Internal Functions
+    std::string &reserveTail(size_t byteCount);
+
+    // Internal Fields
+    ChunkCollection _chunks;
+    size_t _length;
+    size_t _nextChunkSize;
+};
+
+} // namespace Ag
+
+#endif // Header guard
+////////////////////////////////////////////////////////////////////////////////
@@ -57,6 +57,34 @@ enum Encoding
     Encoding_Max,
 };
 
+//! @brief Expresses the reason a bulk conversion between encodings stopped.
+enum class TranscodeStatus : uint8_t
+{
+    //! @brief All of the source text was converted.
+    Complete,
+
+    //! @brief The destination had no room for the next converted character.
+    DestinationFull,
+
+    //! @brief An ill-formed sequence was encountered in the source text.
+    InvalidInput,
+};
+
+//! @brief Describes the outcome of a bulk conversion between encodings.
+struct TranscodeResult
+{
+    //! @brief The count of source elements successfully converted. If the
+    //! conversion was incomplete, this is the offset of the first element of
+    //! the character which could not be converted.
+    size_t Consumed;
+
+    //! @brief The count of elements written to the destination.
+    size_t Produced;
+
+    //! @brief The reason the conversion stopped.
+    TranscodeStatus Status;
+};
+
 
 ////////////////////////////////////////////////////////////////////////////////
 // Data Declarations
@@ -221,6 +249,16 @@ void appendNative(std::wstring &destination, const char *nativeBytes,
 void appendWide(std::string &destination, wchar_cptr_t wideChars,
                 size_t charCount);
 bool appendCodePoint(std::string &destination, char32_t codePoint);
+TranscodeResult transcode(const std::string_view &utf8Text,
+                          char16_t *destination, size_t capacity);
+TranscodeResult transcode(const std::string_view &utf8Text,
+                          char32_t *destination, size_t capacity);
+TranscodeResult transcode(const std::string_view &utf8Text,
+                          wchar_t *destination, size_t capacity);
+TranscodeResult transcode(const std::u16string_view &utf16Text,
+                          char32_t *destination, size_t capacity);
+TranscodeResult transcode(const std::u32string_view &utf32Text,
+                          char16_t *destination, size_t capacity);
 bool isValidCodePoint(char32_t codePoint);
 bool isWhiteSpace(char32_t codePoint);
 bool isNullOrEmpty(const utf8_cptr_t utf8Array);
@@ -0,0 +1,97 @@
+//! @file Ag/Core/WorkerPool.hpp
+//! @brief The declaration of an object which executes tasks on a fixed set
+//! of background threads.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __AG_CORE_WORKER_POOL_HPP__
+#define __AG_CORE_WORKER_POOL_HPP__
+
+////////////////////////////////////////////////////////////////////////////////
+// Dependent Header Files
+////////////////////////////////////////////////////////////////////////////////
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Ag {
+
+////////////////////////////////////////////////////////////////////////////////
+// Class Declarations
+////////////////////////////////////////////////////////////////////////////////
+//! @brief An object which executes tasks on a fixed set of background
+//! threads, starting them in the order they were submitted.
+//! @details Tasks which are still queued when the pool is destroyed are
+//! executed before the threads are joined.
+class WorkerPool
+{
+public:
+    // Public Types
+    //! @brief The signature of a task executed by the pool.
+    using Task = std::function<void()>;
+
+    // Construction/Destruction
+    WorkerPool(size_t threadCount = 0);
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool(WorkerPool &&) = delete;
+    ~WorkerPool();
+
+    // Accessors
+    size_t getThreadCount() const;
+    static size_t getDefaultThreadCount();
+
+    // Operations
+    WorkerPool &operator=(const WorkerPool &) = delete;
+    WorkerPool &operator=(WorkerPool &&) = delete;
+    void post(Task &&task);
+
+    //! @brief Schedules a function to be executed on a worker thread.
+    //! @tparam TFn The type of a callable object taking no parameters.
+    //! @param[in] fn The function to execute.
+    //! @return A future which receives the result of the function, or the
+    //! exception it threw.
+    template<typename TFn>
+    std::future<std::invoke_result_t<std::decay_t<TFn>>> submit(TFn &&fn)
+    {
+        using TResult = std::invoke_result_t<std::decay_t<TFn>>;
+        using TPackagedTask = std::packaged_task<TResult()>;
+
+        // std::function requires a copyable object, so the packaged task
+        // must be shared.
+        auto task = std::make_shared<TPackagedTask>(std::forward<TFn>(fn));
+        std::future<TResult> result = task->get_future();
+
+        post([task]() { (*task)(); });
+
+        return result;
+    }
+private:
+    // Internal Types
+    using TaskQueue = std::deque<Task>;
+    using ThreadCollection = std::vector<std::thread>;
+
+    // Internal Functions
+    void runWorker();
+
+    // Internal Fields
+    std::mutex _queueLock;
+    std::condition_variable _taskAvailable;
+    TaskQueue _tasks;
+    ThreadCollection _threads;
+    bool _isStopping;
+};
+
+} // namespace Ag
+
+#endif // Header guard
+////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,7 @@
 #include "IO/StreamTools.hpp"
 
 #include "IO/HierarchySerialization.hpp"
+#include "IO/HierarchyVisitor.hpp"
 
 #endif // Header guard
 ////////////////////////////////////////////////////////////////////////////////
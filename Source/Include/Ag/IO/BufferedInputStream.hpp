@@ -14,9 +14,17 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Dependent Header Files
 ////////////////////////////////////////////////////////////////////////////////
+#include <deque>
+#include <exception>
+#include <future>
+#include <memory>
+
 #include "Ag/Core/Stream.hpp"
 
 namespace Ag {
+
+class WorkerPool;
+
 namespace IO {
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -24,21 +32,56 @@ namespace IO {
 ////////////////////////////////////////////////////////////////////////////////
 //! @brief An implementation of IStream which buffers bytes read from an
 //! underlying stream.
+//! @details By default, the buffer is re-filled synchronously when it has
+//! been drained. If a prefetch count is specified, a background thread fills
+//! further buffers from the underlying stream while the current one is being
+//! read, so that the latency of the device overlaps the work of the consumer.
+//! In that mode, the underlying stream must not be accessed by anything else
+//! while the BufferedInputStream exists and an error reading it is reported
+//! by the first read() after all the data which preceded it was consumed.
 class BufferedInputStream : public IStream
 {
 public:
     // Public Constants
     static constexpr size_t MinBufferSize = 512;
     static constexpr size_t MaxBufferSize = 1024 * 1024;
+    static constexpr size_t MaxPrefetchCount = 4;
+
+    // Public Types
+    //! @brief Measurements of how reads from the underlying stream have
+    //! affected the consumer of a BufferedInputStream.
+    struct Statistics
+    {
+        //! @brief The count of bytes read from the underlying stream.
+        uint64_t BytesFetched = 0;
+
+        //! @brief The count of reads made to the underlying stream.
+        uint64_t FetchCount = 0;
+
+        //! @brief The total time spent reading the underlying stream, in seconds.
+        double FetchSeconds = 0.0;
+
+        //! @brief The count of times the consumer waited for data to be
+        //! read from the underlying stream.
+        uint64_t StallCount = 0;
+
+        //! @brief The total time the consumer spent waiting, in seconds.
+        double StallSeconds = 0.0;
+
+        double getFetchThroughput() const;
+    };
 
     // Construction/Destruction
-    BufferedInputStream(IStream *input, size_t bufferSize = 0);
-    virtual ~BufferedInputStream() override = default;
+    BufferedInputStream(IStream *input, size_t bufferSize = 0,
+                        size_t prefetchCount = 0);
+    virtual ~BufferedInputStream() override;
 
     // Accessors
     size_t getBufferSize() const;
     size_t getBufferUsed() const;
     size_t getBufferedBytesRead() const;
+    size_t getPrefetchCount() const;
+    const Statistics &getStatistics() const;
     const IStream *getInnerStream() const;
 
     // Operations
@@ -50,10 +93,29 @@ public:
     virtual size_t read(void *targetBuffer, size_t requiredByteCount)  override;
     virtual size_t write(const void *sourceBuffer, size_t sourceByteCount)  override;
 private:
+    // Internal Types
+    //! @brief A buffer filled from the underlying stream on a background thread.
+    struct FetchedBuffer
+    {
+        ByteBlock Data;
+        double Seconds = 0.0;
+    };
+
+    using PendingBufferQueue = std::deque<std::future<FetchedBuffer>>;
+
+    // Internal Functions
+    size_t fetch(uint8_ptr_t target, size_t byteCount);
+    bool tryTakePrefetchedBuffer();
+    void beginPrefetch(ByteBlock &&buffer);
+
     // Internal Fields
     ByteBlock _buffer;
     IStream *_innerStream;
     size_t _bytesRead;
+    Statistics _stats;
+    PendingBufferQueue _pendingBuffers;
+    std::exception_ptr _prefetchError;
+    std::unique_ptr<WorkerPool> _prefetcher;
 };
 
 }} // namespace Ag::IO
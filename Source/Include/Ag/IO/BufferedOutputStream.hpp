@@ -14,9 +14,17 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Dependent Header Files
 ////////////////////////////////////////////////////////////////////////////////
+#include <atomic>
+#include <deque>
+#include <future>
+#include <memory>
+
 #include "Ag/Core/Stream.hpp"
 
 namespace Ag {
+
+class WorkerPool;
+
 namespace IO {
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -31,6 +39,14 @@ namespace IO {
 //! with an ISeekableStream, or a readable IStream, the outer stream must be
 //! flushed before the inner stream is re-positioned.
 //! 
+//! If a write-behind count is specified, full buffers are written to the
+//! inner stream in order on a background thread, so that the producer is
+//! not held up by the latency of the device. No more than that count of
+//! buffers are queued, beyond which write() waits for the oldest to be
+//! written. An error writing a buffer is reported by the next call to write()
+//! or flush(), after which the stream cannot be written. The inner stream
+//! must not be accessed until flush() has been called.
+//! 
 //! The BufferedOutputStream will throw NotSupportedException on any call to
 //! read(), whether the underlying stream is capable of reading or not.
 class BufferedOutputStream : public IStream
@@ -39,25 +55,46 @@ public:
     // Public Constants
     static constexpr size_t MinBufferSize = 512;
     static constexpr size_t MaxBufferSize = 1024 * 1024;
+    static constexpr size_t MaxWriteBehindCount = 8;
 
     // Construction/Destruction
-    BufferedOutputStream(IStream *innerStream, size_t bufferSize = 0);
+    BufferedOutputStream(IStream *innerStream, size_t bufferSize = 0,
+                         size_t writeBehindCount = 0);
+    BufferedOutputStream(const BufferedOutputStream &) = delete;
     virtual ~BufferedOutputStream();
 
     // Accessors
     size_t getBufferSize() const;
     size_t getBufferUsed() const;
+    size_t getWriteBehindCount() const;
     const IStream *getInnerStream() const;
 
+    // Operations
+    BufferedOutputStream &operator=(const BufferedOutputStream &) = delete;
+    BufferedOutputStream &operator=(BufferedOutputStream &&rhs);
+
     // Overrides
     virtual bool isBuffered() const override;
     virtual void flush() override;
     virtual size_t read(void *targetBuffer, size_t requiredByteCount) override;
     virtual size_t write(const void *sourceBuffer, size_t sourceByteCount) override;
+    virtual size_t writeGathered(const ByteSpan *sourceBuffers, size_t bufferCount) override;
 private:
+    // Internal Types
+    using PendingWriteQueue = std::deque<std::future<ByteBlock>>;
+
+    // Internal Functions
+    void beginWriteBehind();
+    ByteBlock completeWriteBehind();
+    void checkForWriteBehindFailure();
+
     // Internal Fields
     ByteBlock _buffer;
     IStream *_innerStream;
+    PendingWriteQueue _pendingWrites;
+    std::unique_ptr<WorkerPool> _writer;
+    size_t _writeBehindCount;
+    std::atomic<bool> _hasWriteFailed;
 };
 
 }} // namespace Ag::IO
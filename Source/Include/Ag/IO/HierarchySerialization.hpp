@@ -14,6 +14,8 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Dependent Header Files
 ////////////////////////////////////////////////////////////////////////////////
+#include <atomic>
+
 #include <Ag/Core.hpp>
 
 #include "HierarchyInterfaces.hpp"
@@ -34,6 +36,76 @@ class IArrayWriter;
 class ArrayReader;
 class ArrayWriter;
 
+//! @brief Options which control how a hierarchy is serialized.
+struct SerializationOptions
+{
+    // Public Constants
+    //! @brief A chunk size which balances parallelism against compression ratio.
+    static constexpr size_t DefaultChunkSize = 4 * 1024 * 1024;
+
+    // Public Fields
+    //! @brief The count of uncompressed payload bytes in each independently
+    //! compressed chunk, or 0 to compress the payload as a single stream.
+    size_t ChunkSize;
+
+    //! @brief The count of threads used to compress chunks, 0 to use one
+    //! per hardware thread.
+    size_t ThreadCount;
+
+    //! @brief The algorithm used to compress the data. Codecs other than
+    //! bzip2 always compress the payload in chunks, using DefaultChunkSize
+    //! if ChunkSize is 0.
+    CompressionCodecID Codec;
+
+    //! @brief True to compress the serialized data, false to store it
+    //! uncompressed.
+    bool Compress;
+
+    // Construction/Destruction
+    SerializationOptions();
+    SerializationOptions(bool compress, size_t chunkSize = 0, size_t threadCount = 0);
+    SerializationOptions(CompressionCodecID codec, size_t chunkSize = 0,
+                         size_t threadCount = 0);
+    ~SerializationOptions() = default;
+};
+
+//! @brief A property tag which caches the identifier it resolves to within
+//! a serialized hierarchy so that repeated access to the same property of
+//! many objects does not look the tag up by text each time.
+//! @details A key remembers the identifier of its tag within the last
+//! hierarchy it was resolved against, reader or writer, so keys are best
+//! declared once per schema and re-used for every object. A key can be
+//! shared between threads, although concurrent use against different
+//! hierarchies will cause each to resolve the tag again.
+class PropertyKey
+{
+public:
+    // Public Constants
+    //! @brief The identifier bound to a key whose tag is absent from a
+    //! hierarchy.
+    static constexpr uint32_t NotFoundID = UINT32_MAX;
+
+    // Construction/Destruction
+    PropertyKey(utf8_cptr_t tag);
+    PropertyKey(const std::string &tag);
+    PropertyKey(string_cref_t tag);
+    PropertyKey(const PropertyKey &rhs);
+    ~PropertyKey() = default;
+
+    // Accessors
+    string_cref_t getTag() const;
+    bool tryGetBinding(uint32_t scope, uint32_t &id) const;
+
+    // Operations
+    PropertyKey &operator=(const PropertyKey &rhs);
+    void bind(uint32_t scope, uint32_t id) const;
+    static uint32_t allocateScope();
+private:
+    // Internal Fields
+    String _tag;
+    mutable std::atomic<uint64_t> _binding;
+};
+
 //! @brief An object which reads a serialized object in a serialized hierarchy.
 class ObjectReader
 {
@@ -47,50 +119,54 @@ public:
 
     // Accessors
     bool isBound() const;
-    bool hasProperty(string_cref_t tag) const;
-    StreamLength getPropertySize(string_cref_t tag) const;
-    bool tryGetPropertySize(string_cref_t tag, StreamLength &propSize) const;
+    bool hasProperty(const PropertyKey &tag) const;
+    StreamLength getPropertySize(const PropertyKey &tag) const;
+    bool tryGetPropertySize(const PropertyKey &tag, StreamLength &propSize) const;
 
     // Operations
     void close();
     ObjectReader &operator=(const ObjectReader &) = delete;
     ObjectReader &operator=(ObjectReader &&rhs) noexcept;
 
-    bool tryRead(string_cref_t tag, bool &value) const;
-    bool tryRead(string_cref_t tag, int8_t &value) const;
-    bool tryRead(string_cref_t tag, uint8_t &value) const;
-    bool tryRead(string_cref_t tag, int16_t &value) const;
-    bool tryRead(string_cref_t tag, uint16_t &value) const;
-    bool tryRead(string_cref_t tag, int32_t &value) const;
-    bool tryRead(string_cref_t tag, uint32_t &value) const;
-    bool tryRead(string_cref_t tag, int64_t &value) const;
-    bool tryRead(string_cref_t tag, uint64_t &value) const;
-    bool tryRead(string_cref_t tag, char32_t &value) const;
-    bool tryRead(string_cref_t tag, float &value) const;
-    bool tryRead(string_cref_t tag, double &value) const;
-    bool tryRead(string_cref_t tag, Ag::String &value) const;
-    bool tryRead(string_cref_t tag, ByteBlock &value) const;
-    bool tryRead(string_cref_t tag, ISeekableStreamUPtr &value) const;
-    bool tryRead(string_cref_t tag, ObjectReader &value) const;
-    bool tryRead(string_cref_t tag, ArrayReader &value) const;
-
-    bool readBool(string_cref_t tag) const;
-    int8_t readInt8(string_cref_t tag) const;
-    uint8_t readUint8(string_cref_t tag) const;
-    int16_t readInt16(string_cref_t tag) const;
-    uint16_t readUint16(string_cref_t tag) const;
-    int32_t readInt32(string_cref_t tag) const;
-    uint32_t readUint32(string_cref_t tag) const;
-    int64_t readInt64(string_cref_t tag) const;
-    uint64_t readUint64(string_cref_t tag) const;
-    char32_t readChar(string_cref_t tag) const;
-    float readFloat(string_cref_t tag) const;
-    double readDouble(string_cref_t tag) const;
-    String readString(string_cref_t tag) const;
-    ByteBlock readBytes(string_cref_t tag) const;
-    ISeekableStreamUPtr readBytesStream(string_cref_t tag) const;
-    ObjectReader readObject(string_cref_t tag) const;
-    ArrayReader readArray(string_cref_t tag) const;
+    bool tryRead(const PropertyKey &tag, bool &value) const;
+    bool tryRead(const PropertyKey &tag, int8_t &value) const;
+    bool tryRead(const PropertyKey &tag, uint8_t &value) const;
+    bool tryRead(const PropertyKey &tag, int16_t &value) const;
+    bool tryRead(const PropertyKey &tag, uint16_t &value) const;
+    bool tryRead(const PropertyKey &tag, int32_t &value) const;
+    bool tryRead(const PropertyKey &tag, uint32_t &value) const;
+    bool tryRead(const PropertyKey &tag, int64_t &value) const;
+    bool tryRead(const PropertyKey &tag, uint64_t &value) const;
+    bool tryRead(const PropertyKey &tag, char32_t &value) const;
+    bool tryRead(const PropertyKey &tag, float &value) const;
+    bool tryRead(const PropertyKey &tag, double &value) const;
+    bool tryRead(const PropertyKey &tag, Ag::String &value) const;
+    bool tryRead(const PropertyKey &tag, std::string_view &value) const;
+    bool tryRead(const PropertyKey &tag, ByteBlock &value) const;
+    bool tryRead(const PropertyKey &tag, ByteSpan &value) const;
+    bool tryRead(const PropertyKey &tag, ISeekableStreamUPtr &value) const;
+    bool tryRead(const PropertyKey &tag, ObjectReader &value) const;
+    bool tryRead(const PropertyKey &tag, ArrayReader &value) const;
+
+    bool readBool(const PropertyKey &tag) const;
+    int8_t readInt8(const PropertyKey &tag) const;
+    uint8_t readUint8(const PropertyKey &tag) const;
+    int16_t readInt16(const PropertyKey &tag) const;
+    uint16_t readUint16(const PropertyKey &tag) const;
+    int32_t readInt32(const PropertyKey &tag) const;
+    uint32_t readUint32(const PropertyKey &tag) const;
+    int64_t readInt64(const PropertyKey &tag) const;
+    uint64_t readUint64(const PropertyKey &tag) const;
+    char32_t readChar(const PropertyKey &tag) const;
+    float readFloat(const PropertyKey &tag) const;
+    double readDouble(const PropertyKey &tag) const;
+    String readString(const PropertyKey &tag) const;
+    std::string_view readStringView(const PropertyKey &tag) const;
+    ByteBlock readBytes(const PropertyKey &tag) const;
+    ByteSpan readBytesView(const PropertyKey &tag) const;
+    ISeekableStreamUPtr readBytesStream(const PropertyKey &tag) const;
+    ObjectReader readObject(const PropertyKey &tag) const;
+    ArrayReader readArray(const PropertyKey &tag) const;
 private:
     // Internal Functions
     IObjectReader *verifyAccess(utf8_cptr_t op) const;
@@ -112,7 +188,7 @@ private:
     //! @throws PropertyTypeException If the property exists but the value cannot
     //! be converted to the appropriate type.
     template<typename T>
-    T read(string_cref_t tag, utf8_cptr_t dataType) const
+    T read(const PropertyKey &tag, utf8_cptr_t dataType) const
     {
         IObjectReader *reader = verifyAccess("read property");
 
@@ -122,9 +198,9 @@ private:
             return value;
 
         if (reader->hasProperty(tag) == false)
-            throw PropertyNotFoundException(tag);
+            throw PropertyNotFoundException(tag.getTag());
 
-        throw PropertyTypeException(tag, dataType);
+        throw PropertyTypeException(tag.getTag(), dataType);
     }
 };
 
@@ -147,24 +223,24 @@ public:
     ObjectWriter &operator=(const ObjectWriter &) = delete;
     ObjectWriter &operator=(ObjectWriter &&rhs) noexcept;
 
-    void write(string_cref_t tag, bool value);
-
-    void write(string_cref_t tag, int8_t value);
-    void write(string_cref_t tag, uint8_t value);
-    void write(string_cref_t tag, int16_t value);
-    void write(string_cref_t tag, uint16_t value);
-    void write(string_cref_t tag, int32_t value);
-    void write(string_cref_t tag, uint32_t value);
-    void write(string_cref_t tag, int64_t value);
-    void write(string_cref_t tag, uint64_t value);
-    void write(string_cref_t tag, char32_t value);
-    void write(string_cref_t tag, float value);
-    void write(string_cref_t tag, double value);
-    void write(string_cref_t tag, string_cref_t value);
-    void write(string_cref_t tag, const void *value, size_t byteCount);
-    IStreamUPtr beginWriteBytes(string_cref_t tag);
-    ObjectWriter beginWriteObject(string_cref_t tag);
-    ArrayWriter beginWriteArray(string_cref_t tag);
+    void write(const PropertyKey &tag, bool value);
+
+    void write(const PropertyKey &tag, int8_t value);
+    void write(const PropertyKey &tag, uint8_t value);
+    void write(const PropertyKey &tag, int16_t value);
+    void write(const PropertyKey &tag, uint16_t value);
+    void write(const PropertyKey &tag, int32_t value);
+    void write(const PropertyKey &tag, uint32_t value);
+    void write(const PropertyKey &tag, int64_t value);
+    void write(const PropertyKey &tag, uint64_t value);
+    void write(const PropertyKey &tag, char32_t value);
+    void write(const PropertyKey &tag, float value);
+    void write(const PropertyKey &tag, double value);
+    void write(const PropertyKey &tag, string_cref_t value);
+    void write(const PropertyKey &tag, const void *value, size_t byteCount);
+    IStreamUPtr beginWriteBytes(const PropertyKey &tag);
+    ObjectWriter beginWriteObject(const PropertyKey &tag);
+    ArrayWriter beginWriteArray(const PropertyKey &tag);
 private:
     // Internal Functions
     IObjectWriter *verifyAccess(utf8_cptr_t op);
@@ -213,7 +289,9 @@ public:
     bool tryReadNext(float &value);
     bool tryReadNext(double &value);
     bool tryReadNext(String &value);
+    bool tryReadNext(std::string_view &value);
     bool tryReadNext(ByteBlock &value);
+    bool tryReadNext(ByteSpan &value);
     bool tryReadNext(ISeekableStreamUPtr &value);
     bool tryReadNext(ObjectReader &value);
     bool tryReadNext(ArrayReader &value);
@@ -231,10 +309,102 @@ public:
     float readNextFloat();
     double readNextDouble();
     String readNextString();
+    std::string_view readNextStringView();
     ByteBlock readNextBytes();
+    ByteSpan readNextBytesView();
     ISeekableStreamUPtr readNextByteStream();
     ObjectReader readNextObject();
     ArrayReader readNextArray();
+
+    // Templates
+
+    //! @brief Attempts to get the length of the next element if it is a
+    //! packed array of a specific type.
+    //! @tparam T The data type of the packed array elements.
+    //! @param[out] count Receives the count of elements in the packed array.
+    //! @retval true The next element was a packed array of @p T values.
+    //! @retval false There were no more elements or the next element was not
+    //! a packed array of @p T values.
+    template<typename T>
+    bool tryGetNextPackedArrayLength(size_t &count) const
+    {
+        constexpr PackedElementType RequiredType = getPackedElementType<T>();
+        static_assert(RequiredType != PackedElementType::Max,
+                      "The type cannot be the element of a packed array.");
+
+        PackedElementType elementType = PackedElementType::Max;
+        count = 0;
+
+        return (_reader != nullptr) &&
+               _reader->tryGetNextPackedArrayInfo(elementType, count) &&
+               (elementType == RequiredType);
+    }
+
+    //! @brief Attempts to read the next element as a packed array.
+    //! @tparam T The data type of the packed array elements.
+    //! @param[out] values The buffer to receive the elements.
+    //! @param[in] count The count of elements @p values can hold, which must
+    //! be the length of the packed array.
+    //! @retval true The elements were copied into @p values.
+    //! @retval false There were no more elements or the next element was not
+    //! a packed array of @p count elements of type @p T.
+    template<typename T>
+    bool tryReadNextPackedArray(T *values, size_t count)
+    {
+        constexpr PackedElementType RequiredType = getPackedElementType<T>();
+        static_assert(RequiredType != PackedElementType::Max,
+                      "The type cannot be the element of a packed array.");
+
+        return (_reader != nullptr) &&
+               _reader->tryReadNextPackedArray(RequiredType, values, count);
+    }
+
+    //! @brief Attempts to read the next element as a packed array.
+    //! @tparam T The data type of the packed array elements.
+    //! @param[out] values Receives the elements of the packed array.
+    //! @retval true The elements were copied into @p values.
+    //! @retval false There were no more elements or the next element was not
+    //! a packed array of @p T values.
+    template<typename T>
+    bool tryReadNextPackedArray(std::vector<T> &values)
+    {
+        size_t count;
+
+        if (tryGetNextPackedArrayLength<T>(count))
+        {
+            values.resize(count);
+
+            if (tryReadNextPackedArray(values.data(), count))
+                return true;
+        }
+
+        values.clear();
+        return false;
+    }
+
+    //! @brief Reads the next element as a packed array.
+    //! @tparam T The data type of the packed array elements.
+    //! @return The elements of the packed array.
+    //! @throws ObjectNotBoundException Thrown if the object is not bound to
+    //! an underlying reader.
+    //! @throws DataFormatException Thrown if there are no more elements
+    //! left to read.
+    //! @throws PropertyTypeException Thrown if the next element is not a
+    //! packed array of @p T values.
+    template<typename T>
+    std::vector<T> readNextPackedArray()
+    {
+        IArrayReader *reader = verifyAccess("read next packed array");
+        std::vector<T> values;
+
+        if (tryReadNextPackedArray(values))
+            return values;
+
+        if (reader->hasMore() == false)
+            throw DataFormatException("The end of the array has been reached.");
+
+        throw PropertyTypeException("packed array");
+    }
 private:
     // Internal Functions
     IArrayReader *verifyAccess(utf8_cptr_t op) const;
@@ -308,6 +478,37 @@ public:
     IStreamUPtr beginWriteBytes();
     ObjectWriter beginWriteObject();
     ArrayWriter beginWriteArray();
+
+    // Templates
+
+    //! @brief Writes an array of primitive values as a single packed array
+    //! element which can be read back as a block.
+    //! @tparam T The data type of the elements.
+    //! @param[in] values A pointer to the first element to write.
+    //! @param[in] count The count of elements pointed to by @p values.
+    //! @throws ObjectNotBoundException Thrown if the object is not bound to
+    //! an underlying writer.
+    template<typename T>
+    void writePackedArray(const T *values, size_t count)
+    {
+        constexpr PackedElementType ElementType = getPackedElementType<T>();
+        static_assert(ElementType != PackedElementType::Max,
+                      "The type cannot be the element of a packed array.");
+
+        verifyAccess("write packed array")->writePackedArray(ElementType, values, count);
+    }
+
+    //! @brief Writes an array of primitive values as a single packed array
+    //! element which can be read back as a block.
+    //! @tparam T The data type of the elements.
+    //! @param[in] values The elements to write.
+    //! @throws ObjectNotBoundException Thrown if the object is not bound to
+    //! an underlying writer.
+    template<typename T>
+    void writePackedArray(const std::vector<T> &values)
+    {
+        writePackedArray(values.data(), values.size());
+    }
 private:
     // Internal Functions
     IArrayWriter *verifyAccess(utf8_cptr_t op);
@@ -324,6 +525,7 @@ class HierarchyRoot
 public:
     // Construction/Destruction
     HierarchyRoot(IStream *input);
+    HierarchyRoot(const Fs::Path &fileName);
     ~HierarchyRoot();
 
     // Accessors
@@ -341,7 +543,11 @@ private:
 // Function Declarations
 ////////////////////////////////////////////////////////////////////////////////
 ArrayWriter beginSerializeArray(ISeekableStream *output, bool compress);
+ArrayWriter beginSerializeArray(ISeekableStream *output,
+                                const SerializationOptions &options);
 ObjectWriter beginSerializeObject(ISeekableStream *output, bool compress);
+ObjectWriter beginSerializeObject(ISeekableStream *output,
+                                  const SerializationOptions &options);
 
 }} // namespace Ag::IO
 
@@ -0,0 +1,66 @@
+//! @file Ag/IO/HierarchyVisitor.hpp
+//! @brief The declaration of an object which receives the contents of a
+//! serialized hierarchy as a forward-only sequence of events.
+//! @author GiantRobotLemur@na-se.co.uk
+//! @date 2026
+//! @copyright This file is part of the Silver (Ag) project which is released
+//! under LGPL 3 license. See LICENSE file at the repository root or go to
+//! https://github.com/GiantRobotLemur/Ag for full license details.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef HEADER_IO_HIERARCHY_VISITOR_HPP_
+#define HEADER_IO_HIERARCHY_VISITOR_HPP_
+
+////////////////////////////////////////////////////////////////////////////////
+// Dependent Header Files
+////////////////////////////////////////////////////////////////////////////////
+#include "HierarchySerialization.hpp"
+
+namespace Ag {
+namespace IO {
+
+////////////////////////////////////////////////////////////////////////////////
+// Class Declarations
+////////////////////////////////////////////////////////////////////////////////
+//! @brief A base class for an object which receives the contents of a
+//! serialized hierarchy in the order in which they are encoded.
+//! @details Each value is reported by a single event, or a begin/end pair of
+//! events enclosing the contents of a container. Properties of an object are
+//! reported by onProperty() immediately before the events for their value.
+//! The default implementation of each event does nothing, so derived classes
+//! need only override the events they are interested in.
+class HierarchyVisitor
+{
+public:
+    // Construction/Destruction
+    HierarchyVisitor() = default;
+    virtual ~HierarchyVisitor() = default;
+
+    // Overrides
+    virtual void onBeginObject();
+    virtual void onProperty(string_cref_t tag);
+    virtual void onEndObject();
+    virtual void onBeginArray(StreamLength elementCount);
+    virtual void onEndArray();
+    virtual void onInteger(int64_t value);
+    virtual void onUnsignedInteger(uint64_t value);
+    virtual void onReal(double value);
+    virtual void onString(string_cref_t value);
+    virtual void onBeginBytes(StreamLength byteCount);
+    virtual void onBytes(const uint8_t *data, size_t byteCount);
+    virtual void onEndBytes();
+    virtual void onBeginPackedArray(PackedElementType elementType,
+                                    StreamLength elementCount);
+    virtual void onPackedElements(const void *elements, size_t elementCount);
+    virtual void onEndPackedArray();
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Function Declarations
+////////////////////////////////////////////////////////////////////////////////
+void visitHierarchy(IStream *input, HierarchyVisitor &visitor);
+
+}} // namespace Ag::IO
+
+#endif // Header guard
+////////////////////////////////////////////////////////////////////////////////
@@ -23,6 +23,56 @@ namespace IO {
 ////////////////////////////////////////////////////////////////////////////////
 // Data Type Declarations
 ////////////////////////////////////////////////////////////////////////////////
+//! @brief An alias for a bit field used to define how a view of a memory
+//! mapped file is created.
+using MappingOptionBits = uint8_t;
+
+//! @brief Defines bit patterns used when creating views of memory mapped files.
+struct MappingOption
+{
+    //! @brief Reads the entire view into memory as it is created, so that
+    //! accessing it later does not incur page faults.
+    static constexpr MappingOptionBits Populate = 0x01;
+
+    //! @brief Indicates the view will be accessed in ascending order, so
+    //! pages can be read aggressively ahead and discarded soon after use.
+    static constexpr MappingOptionBits Sequential = 0x02;
+
+    //! @brief Indicates the view will be accessed in no particular order, so
+    //! read-ahead should be minimal.
+    static constexpr MappingOptionBits Random = 0x04;
+
+    //! @brief Starts reading the view into memory in the background.
+    static constexpr MappingOptionBits WillNeed = 0x08;
+
+    //! @brief Requests the view be backed by huge pages, where supported,
+    //! to reduce TLB pressure when scanning large mappings.
+    static constexpr MappingOptionBits HugePages = 0x10;
+};
+
+//! @brief Describes how a range of a memory mapped view is expected to be used.
+enum class MappingAdvice
+{
+    //! @brief The default behaviour, undoing any previous advice.
+    Normal,
+
+    //! @brief The range will be accessed in ascending order.
+    Sequential,
+
+    //! @brief The range will be accessed in no particular order.
+    Random,
+
+    //! @brief The range will be accessed soon and should be read ahead.
+    WillNeed,
+
+    //! @brief The range will not be accessed soon, so the memory backing it
+    //! can be reclaimed. The data will be re-read from the file if accessed.
+    DontNeed,
+
+    //! @brief The range should be backed by huge pages, where supported.
+    HugePages,
+};
+
 //! @brief A platform-specific abstraction of memory-mapped file mechanics.
 class MappingHandle
 {
@@ -45,8 +95,10 @@ public:
     void open(const Fs::Path &filePath, FileAccessBits access,
               StreamLength mappingSize = -1);
     void *createView(StreamPosition blockIndex,
-                     StreamLength length);
+                     StreamLength length, MappingOptionBits options = 0);
     static bool destroyView(void *viewPtr, StreamLength length, bool throwExceptions = false);
+    static bool adviseView(void *viewPtr, size_t length, MappingAdvice advice);
+    static void flushView(void *viewPtr, size_t length, bool waitForCompletion);
     void close();
 private:
     // Internal Functions
@@ -92,10 +144,16 @@ public:
 
     // Moving is allowed.
     MemoryMappedView &operator=(MemoryMappedView &&rhs) noexcept;
+    bool advise(MappingAdvice advice);
+    bool advise(MappingAdvice advice, size_t offset, size_t length);
+    bool prefetch(size_t offset, size_t length);
+    void flush(bool waitForCompletion = true);
+    void flush(size_t offset, size_t length, bool waitForCompletion = true);
     void release();
 private:
     // Internal Functions
     void releaseNoThrow() noexcept;
+    uint8_t *getAlignedRange(size_t offset, size_t &length) const;
 
     // Internal Fields
     StreamRegion _position;
@@ -117,7 +175,8 @@ public:
     StreamLength getMappingSize() const;
 
     // Operations
-    MemoryMappedView createView(uint64_t firstBlock, size_t length);
+    MemoryMappedView createView(uint64_t firstBlock, size_t length,
+                                MappingOptionBits options = 0);
     void open(const Fs::Path &path, FileAccessBits access, StreamLength mappingSize = -1);
     void close();
 private:
@@ -38,6 +38,8 @@ public:
     // Accessors
     ByteBlock toArray() const;
     StreamLength getSize() const;
+    void getRegionSpans(StreamPosition offset, StreamLength length,
+                        std::vector<ByteSpan> &spans) const;
 
     // Overrides
 
@@ -14,6 +14,8 @@
 ////////////////////////////////////////////////////////////////////////////////
 // Dependent Header Files
 ////////////////////////////////////////////////////////////////////////////////
+#include <mutex>
+
 #include "ISeekableStream.hpp"
 
 namespace Ag {
@@ -31,6 +33,12 @@ namespace IO {
 //! reading or writing small amounts of data, it would be wise to wrap the
 //! stream in something like a BufferedOutputStream to batch low-level read or
 //! write operations.
+//! 
+//! The readAt(), readScatteredAt() and writeAt() functions access the file at
+//! explicit offsets without using the position shared by read() and write(),
+//! so that multiple threads can access the same stream at once. On Windows,
+//! where the position is saved and restored around each positional operation,
+//! operations which use the position are serialised by a lock.
 class SeekableFileStream : public ISeekableStream
 {
 public:
@@ -57,10 +65,20 @@ public:
     //! @brief Gets the path defining the file the stream accesses.
     const Fs::Path &getPath() const;
 
+    // Operations
+    size_t readAt(StreamPosition offset, void *targetBuffer, size_t byteCount) const;
+    size_t readScatteredAt(StreamPosition offset, const MutableByteSpan *targetBuffers,
+                           size_t bufferCount) const;
+    size_t writeAt(StreamPosition offset, const void *sourceBuffer, size_t byteCount);
+
     // Inherited from IStream.
     virtual void flush() override;
     virtual size_t read(void *targetBuffer, size_t requiredByteCount) override;
     virtual size_t write(const void *sourceBuffer, size_t sourceByteCount) override;
+    virtual size_t readScattered(const MutableByteSpan *targetBuffers,
+                                 size_t bufferCount) override;
+    virtual size_t writeGathered(const ByteSpan *sourceBuffers,
+                                 size_t bufferCount) override;
 
     // Inherited from ISeekableStream
     virtual StreamPosition getLength() const override;
@@ -71,6 +89,7 @@ private:
     // Internal Fields
     Fs::Path _location;
     FileDescriptor _fd;
+    mutable std::mutex _positionLock;
 };
 
 }} // namespace Ag::IO
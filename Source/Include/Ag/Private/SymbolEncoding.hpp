@@ -81,6 +81,65 @@ struct SymbolHeaderV1
     // } StringTable[SymbolCount];
 };
 
+//! @brief The version 2 structure of a binary symbol file, which is designed
+//! to be memory mapped and searched in place without decoding.
+//! @details All offsets are measured in bytes from the beginning of the file
+//! and all values use the byte order of the platform which wrote the file.
+struct SymbolHeaderV2
+{
+    //! @brief The count of records in the symbol table.
+    uint32_t SymbolCount;
+
+    //! @brief The count of consecutive symbol table records summarised by each
+    //! entry in the sparse index.
+    uint32_t IndexStride;
+
+    //! @brief The count of entries in the sparse index.
+    uint32_t IndexCount;
+
+    //! @brief The alignment of the symbol table within the file, in bytes.
+    uint32_t TableAlignment;
+
+    //! @brief The offset of the sparse index.
+    uint64_t IndexOffset;
+
+    //! @brief The offset of the symbol table, a multiple of TableAlignment.
+    uint64_t SymbolTableOffset;
+
+    //! @brief The offset of the string table.
+    uint64_t StringTableOffset;
+
+    //! @brief The count of bytes in the string table.
+    uint64_t StringTableSize;
+
+    // The header immediately follows the SymbolFileHeader and so might not be
+    // naturally aligned.
+    //
+    // The sparse index is 8-byte aligned and holds the offset of the first
+    // symbol in each run of IndexStride records.
+    // uint64_t SparseIndex[IndexCount];
+    //
+    // The symbol table is ordered by offset.
+    // SymbolRecordV2 SymbolTable[SymbolCount];
+    //
+    // The string table holds the characters of each unique symbol name
+    // without separators.
+    // char StringTable[StringTableSize];
+};
+
+//! @brief A record in the symbol table of a version 2 symbol file.
+struct SymbolRecordV2
+{
+    //! @brief The offset of the symbol within the binary.
+    uint64_t Offset;
+
+    //! @brief The offset of the symbol name from the start of the string table.
+    uint32_t NameOffset;
+
+    //! @brief The count of characters in the symbol name.
+    uint32_t NameLength;
+};
+
 //! @brief An object which packs multiple scalar fields into a run of bytes.
 //! @note This class requires the IStream interface to be defined to be able
 //! to read/write field data. That interface has different definitions and
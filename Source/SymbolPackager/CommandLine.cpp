@@ -212,7 +212,8 @@ bool tryParseFormat(const std::string &value, Format &fmt)
 //! @brief Constructs an object which manages the command line options.
 CommandLine::CommandLine() :
     _command(Command_Max),
-    _compressSymbols(true)
+    _compressSymbols(true),
+    _writeMappableSymbols(true)
 {
     std::vector<char> buffer;
     int bufferSize = 128;
@@ -244,6 +245,13 @@ bool CommandLine::compressSymbols() const
     return _compressSymbols;
 }
 
+//! @brief Gets whether symbols should be written in the memory-mappable
+//! version 2 format rather than the compact, sequential version 1 format.
+bool CommandLine::writeMappableSymbols() const
+{
+    return _writeMappableSymbols;
+}
+
 //! @brief Gets the primary input file specified the last time a command line
 //! was parsed.
 const std::string &CommandLine::getInputFile() const
@@ -279,8 +287,9 @@ void CommandLine::displayHelp()
 "Options:\n"
 "  -?/h              Displays this usage summary.\n"
 "  --help\n"
-"  -c                Writes symbols in a compressed format (the default).\n"
-"  -u                Writes symbols in an uncompressed format.\n"
+"  -m                Writes symbols in a memory-mappable format (the default).\n"
+"  -c                Writes symbols in a compact, compressed format.\n"
+"  -u                Writes symbols in a compact, uncompressed format.\n"
 "  -o <file>         Specifies the name of the symbol file to write.\n"
 "  --output <file>   \n"
 "  -f <format>       Specifies the format of the input file. Valid values are:\n"
@@ -375,14 +384,21 @@ bool CommandLine::tryParse(int argc, const char *argv[], std::string &error)
                     }
                     break;
 
+                case 'M':
+                case 'm':
+                    _writeMappableSymbols = true;
+                    break;
+
                 case 'U':
                 case 'u':
                     _compressSymbols = false;
+                    _writeMappableSymbols = false;
                     break;
 
                 case 'C':
                 case 'c':
                     _compressSymbols = true;
+                    _writeMappableSymbols = false;
                     break;
 
                 case '?':
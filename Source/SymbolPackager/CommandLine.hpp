@@ -46,6 +46,7 @@ public:
     // Accessors
     Command getCommand() const;
     bool compressSymbols() const;
+    bool writeMappableSymbols() const;
     const std::string &getInputFile() const;
     const std::string &getExecutableFile() const;
     const std::string &getOutputFile() const;
@@ -62,6 +63,7 @@ private:
     std::string _workingFolder;
     Command _command;
     bool _compressSymbols;
+    bool _writeMappableSymbols;
 };
 
 #endif // Header guard
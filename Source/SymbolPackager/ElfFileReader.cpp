@@ -135,10 +135,10 @@ std::string fixupSymbol(const std::string_view &symbol)
 {
     std::string fixed;
 
-    // De-mangle the symbol.
-    size_t length = 0;
+    // De-mangle the symbol. Note that the length returned is the size of
+    // the allocated buffer, not of the string.
     int status = 0;
-    char *demangled = abi::__cxa_demangle(symbol.data(), nullptr, &length, &status);
+    char *demangled = abi::__cxa_demangle(symbol.data(), nullptr, nullptr, &status);
 
     if ((demangled == nullptr) || (status != 0))
     {
@@ -154,7 +154,7 @@ std::string fixupSymbol(const std::string_view &symbol)
     }
     else
     {
-        fixed.assign(demangled, length);
+        fixed.assign(demangled);
         free(demangled);
     }
 
@@ -57,7 +57,7 @@ bool readSymbols(const CommandLine &args, SymbolDb &symbols, std::string &error)
     return error.empty();
 }
 
-//! @brief Writes the symbol data as a compressed binary .sym file.
+//! @brief Writes the symbol data as a binary .sym file.
 //! @param[in] args The command line arguments defining the name of the file
 //! to write.
 //! @param[in] symbols The database of symbols to write.
@@ -72,7 +72,14 @@ bool writeSymbols(const CommandLine &args, const SymbolDb &symbols,
 
     if (output.tryOpen(args.getOutputFile().c_str(), "wb"))
     {
-        isOK = symbols.writeSymbolFile(&output, args.compressSymbols());
+        if (args.writeMappableSymbols())
+        {
+            isOK = symbols.writeMappableSymbolFile(&output);
+        }
+        else
+        {
+            isOK = symbols.writeSymbolFile(&output, args.compressSymbols());
+        }
 
         if (isOK == false)
         {
@@ -18,6 +18,16 @@
 #include "Ag/Private/SymbolEncoding.hpp"
 
 namespace {
+////////////////////////////////////////////////////////////////////////////////
+// Local Data
+////////////////////////////////////////////////////////////////////////////////
+//! @brief The count of symbol records summarised by each sparse index entry
+//! in a version 2 file, chosen so that each run fills a single page.
+constexpr uint32_t MappableIndexStride = 256;
+
+//! @brief The alignment of the symbol table in a version 2 file.
+constexpr uint32_t MappableTableAlignment = 4096;
+
 ////////////////////////////////////////////////////////////////////////////////
 // Local Data Types
 ////////////////////////////////////////////////////////////////////////////////
@@ -162,6 +172,36 @@ bool writeStrings(Ag::IStream *output, Ag::PackedFieldHelper &fieldPacker,
     return isOK;
 }
 
+//! @brief Rounds a file offset up to a multiple of an alignment.
+//! @param[in] offset The offset to align.
+//! @param[in] alignment The required alignment, a power of 2.
+uint64_t alignOffset(uint64_t offset, uint64_t alignment)
+{
+    return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+//! @brief Writes zero bytes to pad the output to a required offset.
+//! @param[in] output The output stream to write to.
+//! @param[in] currentOffset The count of bytes already written.
+//! @param[in] requiredOffset The offset the output should be padded to.
+//! @return A boolean value indicating whether the padding was written.
+bool writePadding(Ag::IStream *output, uint64_t currentOffset, uint64_t requiredOffset)
+{
+    static const uint8_t zeros[64] = { 0 };
+    bool isOK = true;
+
+    while (isOK && (currentOffset < requiredOffset))
+    {
+        size_t count = static_cast<size_t>(std::min<uint64_t>(sizeof(zeros),
+                                                              requiredOffset - currentOffset));
+
+        isOK = (output->write(zeros, count) == count);
+        currentOffset += count;
+    }
+
+    return isOK;
+}
+
 bool writeSymbolFileHeader(Ag::IStream *output,
                            uint8_t verMajor, uint8_t verMinor,
                            uint8_t verRevision, uint8_t verPatch)
@@ -379,6 +419,87 @@ bool SymbolDb::writeSymbolFile(Ag::IStream *outputStream, bool compress) const
     return false;
 }
 
+//! @brief Writes the contents of the database to an output stream using the
+//! version 2 format, which can be memory mapped and searched in place.
+//! @param[in] outputStream The binary stream to write the binary symbol data to.
+//! @return A boolean value indicating whether the file was successfully written.
+bool SymbolDb::writeMappableSymbolFile(Ag::IStream *outputStream) const
+{
+    if ((_symbolTable.empty() == false) && _symbolIndex.empty())
+    {
+        // The table has not been compiled since the last symbol was
+        // added to it.
+        return false;
+    }
+
+    // Build the symbol table in offset order and the string table, visiting
+    // names in lexical order so that duplicates are adjacent and can share
+    // characters.
+    std::vector<Ag::SymbolRecordV2> records(_symbolTable.size());
+    std::string strings;
+    const SymbolEntry *prevEntry = nullptr;
+    uint64_t nameOffset = 0;
+
+    for (const SymbolEntry *entry : _symbolIndex)
+    {
+        if ((prevEntry == nullptr) || (prevEntry->Symbol != entry->Symbol))
+        {
+            nameOffset = strings.length();
+            strings.append(entry->Symbol);
+        }
+
+        Ag::SymbolRecordV2 &record = records[entry - _symbolTable.data()];
+        record.Offset = entry->Offset;
+        record.NameOffset = static_cast<uint32_t>(nameOffset);
+        record.NameLength = static_cast<uint32_t>(entry->Symbol.length());
+
+        prevEntry = entry;
+    }
+
+    if (strings.length() > UINT32_MAX)
+        return false;
+
+    // Lay out the file.
+    Ag::SymbolHeaderV2 fileData;
+    zeroFill(fileData);
+
+    uint64_t headerEnd = sizeof(Ag::SymbolFileHeader) + sizeof(fileData);
+
+    fileData.SymbolCount = static_cast<uint32_t>(records.size());
+    fileData.IndexStride = MappableIndexStride;
+    fileData.IndexCount = (fileData.SymbolCount + MappableIndexStride - 1) /
+                          MappableIndexStride;
+    fileData.TableAlignment = MappableTableAlignment;
+    fileData.IndexOffset = alignOffset(headerEnd, sizeof(uint64_t));
+    fileData.SymbolTableOffset = alignOffset(fileData.IndexOffset +
+                                             (fileData.IndexCount * sizeof(uint64_t)),
+                                             MappableTableAlignment);
+    fileData.StringTableOffset = fileData.SymbolTableOffset +
+                                 (records.size() * sizeof(Ag::SymbolRecordV2));
+    fileData.StringTableSize = strings.length();
+
+    std::vector<uint64_t> sparseIndex;
+    sparseIndex.reserve(fileData.IndexCount);
+
+    for (size_t index = 0; index < records.size(); index += MappableIndexStride)
+    {
+        sparseIndex.push_back(records[index].Offset);
+    }
+
+    size_t indexSize = sparseIndex.size() * sizeof(uint64_t);
+    size_t tableSize = records.size() * sizeof(Ag::SymbolRecordV2);
+
+    // Write the file header, the version 2 format is 2.0.0.0.
+    return writeSymbolFileHeader(outputStream, 2, 0, 0, 0) &&
+           (outputStream->write(&fileData, sizeof(fileData)) == sizeof(fileData)) &&
+           writePadding(outputStream, headerEnd, fileData.IndexOffset) &&
+           (outputStream->write(sparseIndex.data(), indexSize) == indexSize) &&
+           writePadding(outputStream, fileData.IndexOffset + indexSize,
+                        fileData.SymbolTableOffset) &&
+           (outputStream->write(records.data(), tableSize) == tableSize) &&
+           (outputStream->write(strings.data(), strings.length()) == strings.length());
+}
+
 //! @brief Writes out the contents of the database as text.
 bool SymbolDb::writeText(FILE *outputStream) const
 {
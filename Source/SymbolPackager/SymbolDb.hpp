@@ -48,6 +48,7 @@ public:
     void addSymbol(uint64_t offset, const std::string &symbol);
     void addSymbol(uint64_t offset, const BoundedString &symbol);
     bool writeSymbolFile(Ag::IStream *outputStream, bool compress) const;
+    bool writeMappableSymbolFile(Ag::IStream *outputStream) const;
     bool writeText(FILE *outputStream) const;
 private:
     // Internal Functions
@@ -111,6 +111,27 @@ bool readStringTable(Ag::IStream *input, size_t stringCount, size_t maxLength,
     return isOK;
 }
 
+//! @brief Reads and discards bytes from a stream.
+//! @param[in] input The input stream to read from.
+//! @param[in] byteCount The count of bytes to skip.
+//! @retval true The bytes were skipped.
+//! @retval false The end of the input stream was unexpectedly encountered.
+bool trySkip(Ag::IStream *input, uint64_t byteCount)
+{
+    uint8_t buffer[256];
+    bool isOK = true;
+
+    while (isOK && (byteCount > 0))
+    {
+        size_t count = static_cast<size_t>(std::min<uint64_t>(sizeof(buffer), byteCount));
+
+        isOK = (input->read(buffer, count) == count);
+        byteCount -= count;
+    }
+
+    return isOK;
+}
+
 bool isMatchingVersion(const Ag::SymbolFileHeader &header,
                        uint8_t major, uint8_t minor,
                        uint8_t revision, uint8_t patch)
@@ -193,6 +214,19 @@ void SymbolFileReader::readSymbols(SymbolDb &symbols, std::string &error)
                 readSymbolData(&input, header, symbols, error);
             }
         }
+        else if (isMatchingVersion(fileHeader, 2, 0, 0, 0))
+        {
+            Ag::SymbolHeaderV2 header;
+
+            if (input.read(&header, sizeof(header)) != sizeof(header))
+            {
+                appendFormat(error, "Failed to read the v2 format header from the "
+                             "file '%s'.", _inputFile.c_str());
+                return;
+            }
+
+            readMappableSymbolData(&input, header, symbols, error);
+        }
         else
         {
             appendFormat(error, "The symbol file '%s' was encoded using "
@@ -244,5 +278,54 @@ void SymbolFileReader::readSymbolData(Ag::IStream *input,
     }
 }
 
+//! @brief Reads the symbols from the remainder of a version 2 symbol file.
+//! @param[in] input The input stream positioned after the version 2 header.
+//! @param[in] header The version 2 header read from the file.
+//! @param[out] symbols An object to receive the symbol data.
+//! @param[out] error Receives an error message if the operation failed.
+void SymbolFileReader::readMappableSymbolData(Ag::IStream *input,
+                                              const Ag::SymbolHeaderV2 &header,
+                                              SymbolDb &symbols, std::string &error)
+{
+    // The sparse index is only needed for searching, so skip everything
+    // before the symbol table.
+    uint64_t position = sizeof(Ag::SymbolFileHeader) + sizeof(header);
+    std::vector<Ag::SymbolRecordV2> records(header.SymbolCount);
+    std::string strings;
+    size_t tableSize = records.size() * sizeof(Ag::SymbolRecordV2);
+
+    if ((header.SymbolTableOffset < position) ||
+        (header.StringTableOffset != header.SymbolTableOffset + tableSize) ||
+        (trySkip(input, header.SymbolTableOffset - position) == false) ||
+        (input->read(records.data(), tableSize) != tableSize))
+    {
+        appendFormat(error, "Failed to read the symbol table from the "
+                     "file '%s'.", _inputFile.c_str());
+        return;
+    }
+
+    strings.resize(static_cast<size_t>(header.StringTableSize));
+
+    if (input->read(strings.data(), strings.size()) != strings.size())
+    {
+        appendFormat(error, "Failed to read the string table from the "
+                     "file '%s'.", _inputFile.c_str());
+        return;
+    }
+
+    for (const Ag::SymbolRecordV2 &record : records)
+    {
+        if ((static_cast<uint64_t>(record.NameOffset) + record.NameLength) > strings.size())
+        {
+            appendFormat(error, "The symbol table in the file '%s' references "
+                         "a name outside of the string table.", _inputFile.c_str());
+            return;
+        }
+
+        symbols.addSymbol(record.Offset, strings.substr(record.NameOffset,
+                                                        record.NameLength));
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -25,6 +25,7 @@ class SymbolDb;
 namespace Ag {
 class IStream;
 struct SymbolHeaderV1;
+struct SymbolHeaderV2;
 } // namespace Ag
 
 //! @brief An object which reads symbols pre-packaged in a file.
@@ -40,6 +41,8 @@ private:
     // Internal Functions
     void readSymbolData(Ag::IStream *input, const Ag::SymbolHeaderV1 &header,
                         SymbolDb &symbols, std::string &error);
+    void readMappableSymbolData(Ag::IStream *input, const Ag::SymbolHeaderV2 &header,
+                                SymbolDb &symbols, std::string &error);
 
     // Internal Fields
     std::string _inputFile;
@@ -39,7 +39,7 @@ function(ag_enable_proxy_stacktrace destTargetName symbolTargetName)
     if (DEFINED WIN32)
         # Use the PDB file to extract function symbols.
         add_custom_command(TARGET ${destTargetName} POST_BUILD
-                           COMMAND "${SymTool}" ARGS "$<TARGET_PDB_FILE:${symbolTargetName}>" -c
+                           COMMAND "${SymTool}" ARGS "$<TARGET_PDB_FILE:${symbolTargetName}>"
                                                   -o "$<TARGET_FILE_DIR:${destTargetName}>/$<TARGET_FILE_BASE_NAME:${symbolTargetName}>.sym"
                                                   --exe "$<TARGET_FILE:${symbolTargetName}>"
                            COMMAND "${SymTool}" ARGS "$<TARGET_FILE_DIR:${destTargetName}>/$<TARGET_FILE_BASE_NAME:${symbolTargetName}>.sym"
@@ -186,6 +186,48 @@ function(ag_add_test_app target)
     ag_enable_stacktrace("${target}")
 endfunction()
 
+# Create a Google Test application which measures the performance of an Ag
+# library. Unlike unit test applications, the benchmarks are not registered
+# with CTest and must be run explicitly.
+# Arguments: target - The mandatory target name
+#            TEST_LIB <libName> - The Ag library to measure.
+#            SOURCES <files>    - The benchmark source code files.
+function(ag_add_benchmark_app target)
+    set(prefix BAPP)
+    set(noValues "")
+    set(singleValues "TEST_LIB")
+    set(multiValues SOURCES)
+
+    cmake_parse_arguments("${prefix}"
+                          "${noValues}"
+                          "${singleValues}"
+                          "${multiValues}"
+                          ${ARGN})
+
+    add_executable("${target}")
+
+    target_link_libraries("${target}" PRIVATE gtest gtest_main)
+
+    if(DEFINED BAPP_TEST_LIB)
+        # Link to the library being measured.
+        target_link_libraries("${target}" PRIVATE "${BAPP_TEST_LIB}")
+
+        # Put the benchmark app in the same folder as the library.
+        get_target_property(folder "${BAPP_TEST_LIB}" FOLDER)
+
+        if (DEFINED folder)
+            set_target_properties("${target}" PROPERTIES FOLDER "${folder}")
+        endif()
+    endif()
+
+    if (DEFINED WIN32)
+        # Define a macro indicating the app uses the wmain() entry point.
+        target_compile_definitions(${target} PRIVATE "_CUI")
+    endif()
+
+    target_sources(${target} PRIVATE ${BAPP_SOURCES})
+endfunction()
+
 macro(ag_configure_version target)
     string(TIMESTAMP CURRENT_YEAR "%Y")
 